@@ -67,6 +67,9 @@ public:
     static api_error trimmed_data_access_exception(std::string msg) {
         return api_error("TrimmedDataAccessException", std::move(msg));
     }
+    static api_error provisioned_throughput_exceeded(std::string msg) {
+        return api_error("ProvisionedThroughputExceededException", std::move(msg));
+    }
     static api_error request_limit_exceeded(std::string msg) {
         return api_error("RequestLimitExceeded", std::move(msg));
     }
@@ -1228,6 +1228,68 @@ void validate_value(const rjson::value& v, const char* caller) {
     }
 }
 
+bool table_throughput_limiter::try_consume(std::unordered_map<table_id, token_bucket>& buckets, const schema_ptr& schema, const char* tag) {
+    const std::map<sstring, sstring>* tags = db::get_tags_of_table(schema);
+    if (!tags) {
+        return true;
+    }
+    auto tag_it = tags->find(tag);
+    if (tag_it == tags->end() || tag_it->second.empty()) {
+        return true;
+    }
+    double limit;
+    try {
+        limit = std::stod(std::string(tag_it->second));
+    } catch (...) {
+        // An unparsable limit tag disables accounting rather than breaking
+        // the table.
+        return true;
+    }
+    if (limit <= 0) {
+        return true;
+    }
+    // Each shard independently enforces its equal share of the table's
+    // limit, avoiding any cross-shard coordination on the hot path.
+    limit /= smp::count;
+    const auto now = lowres_clock::now();
+    auto [it, inserted] = buckets.try_emplace(schema->id(), token_bucket{limit, now});
+    auto& bucket = it->second;
+    if (!inserted) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(now - bucket.last_refill).count();
+        bucket.tokens = std::min(limit, bucket.tokens + elapsed * limit);
+        bucket.last_refill = now;
+    }
+    if (bucket.tokens < 1.0) {
+        return false;
+    }
+    bucket.tokens -= 1.0;
+    return true;
+}
+
+bool table_throughput_limiter::account_read(const schema_ptr& schema) {
+    return try_consume(_read_buckets, schema, READ_CAPACITY_TAG_KEY);
+}
+
+bool table_throughput_limiter::account_write(const schema_ptr& schema) {
+    return try_consume(_write_buckets, schema, WRITE_CAPACITY_TAG_KEY);
+}
+
+void executor::maybe_throttle_read(const schema_ptr& schema) {
+    if (!_throughput_limiter.account_read(schema)) {
+        _stats.requests_throttled_reads++;
+        throw api_error::provisioned_throughput_exceeded(
+                format("Read capacity limit of table {} exceeded", schema->cf_name()));
+    }
+}
+
+void executor::maybe_throttle_write(const schema_ptr& schema) {
+    if (!_throughput_limiter.account_write(schema)) {
+        _stats.requests_throttled_writes++;
+        throw api_error::provisioned_throughput_exceeded(
+                format("Write capacity limit of table {} exceeded", schema->cf_name()));
+    }
+}
+
 // The put_or_delete_item class builds the mutations needed by the PutItem and
 // DeleteItem operations - either as stand-alone commands or part of a list
 // of commands in BatchWriteItems.
@@ -1243,10 +1305,12 @@ class put_or_delete_item {
 private:
     partition_key _pk;
     clustering_key _ck;
+public:
     struct cell {
         bytes column_name;
         bytes value;
     };
+private:
     // PutItem: engaged _cells, write these cells to item (_pk, _ck).
     // DeleteItem: disengaged _cells, delete the entire item (_pk, _ck).
     std::optional<std::vector<cell>> _cells;
@@ -1255,6 +1319,9 @@ public:
     struct put_item {};
     put_or_delete_item(const rjson::value& key, schema_ptr schema, delete_item);
     put_or_delete_item(const rjson::value& item, schema_ptr schema, put_item);
+    // Builds a PutItem write from an already-decoded key and serialized
+    // cells, as produced by the streaming PutItem decoder.
+    put_or_delete_item(partition_key pk, clustering_key ck, std::vector<cell> cells);
     // put_or_delete_item doesn't keep a reference to schema (so it can be
     // moved between shards for LWT) so it needs to be given again to build():
     mutation build(schema_ptr schema, api::timestamp_type ts) const;
@@ -1302,6 +1369,10 @@ put_or_delete_item::put_or_delete_item(const rjson::value& item, schema_ptr sche
     }
 }
 
+put_or_delete_item::put_or_delete_item(partition_key pk, clustering_key ck, std::vector<cell> cells)
+        : _pk(std::move(pk)), _ck(std::move(ck)), _cells(std::move(cells)) {
+}
+
 mutation put_or_delete_item::build(schema_ptr schema, api::timestamp_type ts) const {
     mutation m(schema, _pk);
     // If there's no clustering key, a tombstone should be created directly
@@ -1642,6 +1713,17 @@ public:
             }
         }
     }
+    // Used by the streaming PutItem decoder, which already built the
+    // mutation while parsing the raw request. The request passed here
+    // contains only the TableName - the decoder falls back to the DOM path
+    // (and the constructor above) for requests with any other field, so the
+    // optional-field handling of the constructor above is not needed.
+    put_item_operation(service::storage_proxy& proxy, rjson::value&& request, put_or_delete_item&& mutation_builder)
+        : rmw_operation(proxy, std::move(request))
+        , _mutation_builder(std::move(mutation_builder)) {
+        _pk = _mutation_builder.pk();
+        _ck = _mutation_builder.ck();
+    }
     bool needs_read_before_write() const {
         return _request.HasMember("Expected") ||
                check_needs_read_before_write(_condition_expression) ||
@@ -1689,11 +1771,240 @@ future<executor::request_return_type> executor::put_item(client_state& client_st
             });
         });
     }
+    maybe_throttle_write(op->schema());
     return op->execute(_proxy, client_state, trace_state, std::move(permit), needs_read_before_write, _stats).finally([op, start_time, this] {
         _stats.api_operations.put_item_latency.add(std::chrono::steady_clock::now() - start_time);
     });
 }
 
+// A SAX handler (see rjson::parse_sax()) decoding a simple PutItem request
+// without materializing the request DOM. For small write-mostly workloads,
+// building and destroying the DOM of every request is a significant fraction
+// of the request's CPU cost, while all that PutItem eventually needs from
+// the "Item" is each attribute's name and serialized value.
+// The handler only accepts the common simple shape of a PutItem request:
+// a TableName, and an Item whose attribute values are all scalars (S, N, B
+// or BOOL). Any other top-level field (ConditionExpression, Expected,
+// ReturnValues, etc.) and any nested, set or NULL attribute value makes the
+// handler abort the parse, and the caller falls back to the DOM path.
+class put_item_sax_handler {
+public:
+    struct attribute {
+        std::string name;
+        alternator_type type = alternator_type::NOT_SUPPORTED_YET;
+        std::string value; // content of an S or N value; B still base64-encoded
+        bool bool_value = false;
+    };
+private:
+    enum class state {
+        expect_request,     // expecting the request object to start
+        request,            // inside the request object, expecting a field name
+        expect_table_name,  // seen "TableName", expecting its value
+        expect_item,        // seen "Item", expecting the item object to start
+        item,               // inside the item object, expecting an attribute name
+        expect_value,       // seen an attribute name, expecting its value object
+        value,              // inside an attribute value object, expecting its type
+        expect_scalar,      // seen the value's type, expecting the scalar itself
+        expect_value_end,   // seen the scalar, expecting the value object to end
+        done,
+    };
+    state _state = state::expect_request;
+    std::string _table_name;
+    std::vector<attribute> _attributes;
+    bool _seen_table_name = false;
+    bool _seen_item = false;
+public:
+    bool Null() { return false; }
+    bool Int(int) { return false; }
+    bool Uint(unsigned) { return false; }
+    bool Int64(int64_t) { return false; }
+    bool Uint64(uint64_t) { return false; }
+    bool Double(double) { return false; }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return false; }
+    bool StartArray() { return false; }
+    bool EndArray(rapidjson::SizeType) { return false; }
+    bool Bool(bool b) {
+        if (_state != state::expect_scalar || _attributes.back().type != alternator_type::BOOL) {
+            return false;
+        }
+        _attributes.back().bool_value = b;
+        _state = state::expect_value_end;
+        return true;
+    }
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        switch (_state) {
+        case state::expect_table_name:
+            _table_name.assign(str, length);
+            _state = state::request;
+            return true;
+        case state::expect_scalar: {
+            auto& attr = _attributes.back();
+            if (attr.type == alternator_type::BOOL) {
+                return false;
+            }
+            attr.value.assign(str, length);
+            _state = state::expect_value_end;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+    bool StartObject() {
+        switch (_state) {
+        case state::expect_request:
+            _state = state::request;
+            return true;
+        case state::expect_item:
+            _state = state::item;
+            return true;
+        case state::expect_value:
+            _state = state::value;
+            return true;
+        default:
+            return false;
+        }
+    }
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        std::string_view key(str, length);
+        switch (_state) {
+        case state::request:
+            if (key == "TableName" && !std::exchange(_seen_table_name, true)) {
+                _state = state::expect_table_name;
+                return true;
+            }
+            if (key == "Item" && !std::exchange(_seen_item, true)) {
+                _state = state::expect_item;
+                return true;
+            }
+            return false;
+        case state::item:
+            _attributes.emplace_back();
+            _attributes.back().name.assign(str, length);
+            _state = state::expect_value;
+            return true;
+        case state::value: {
+            auto& attr = _attributes.back();
+            if (key == "S") {
+                attr.type = alternator_type::S;
+            } else if (key == "N") {
+                attr.type = alternator_type::N;
+            } else if (key == "B") {
+                attr.type = alternator_type::B;
+            } else if (key == "BOOL") {
+                attr.type = alternator_type::BOOL;
+            } else {
+                return false;
+            }
+            _state = state::expect_scalar;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+    bool EndObject(rapidjson::SizeType) {
+        switch (_state) {
+        case state::expect_value_end:
+            _state = state::item;
+            return true;
+        case state::item:
+            _state = state::request;
+            return true;
+        case state::request:
+            _state = state::done;
+            return true;
+        default:
+            return false;
+        }
+    }
+    bool done() const {
+        return _state == state::done && _seen_table_name && _seen_item;
+    }
+    std::string_view table_name() const { return _table_name; }
+    std::vector<attribute>&& attributes() && { return std::move(_attributes); }
+};
+
+shared_ptr<rmw_operation> executor::try_parse_put_item_streamed(std::string_view content) {
+    put_item_sax_handler handler;
+    if (!rjson::parse_sax(content, handler) || !handler.done()) {
+        return nullptr;
+    }
+    auto request = rjson::empty_object();
+    rjson::add_with_string_name(request, "TableName", rjson::from_string(handler.table_name()));
+    schema_ptr schema = get_table(_proxy, request);
+    // Key columns - of which there are at most two - are converted to JSON
+    // form and passed through the same pk_from_json()/ck_from_json() and
+    // get_key_from_typed_value() as in the DOM path, to keep the type
+    // checking and error reporting identical. All other attributes are
+    // serialized directly.
+    auto key = rjson::empty_object();
+    std::vector<put_or_delete_item::cell> cells;
+    auto attributes = std::move(handler).attributes();
+    cells.reserve(attributes.size());
+    for (auto& attr : attributes) {
+        bytes column_name = to_bytes(attr.name);
+        const column_definition* cdef = find_attribute(*schema, column_name);
+        if (cdef) {
+            rjson::value scalar = attr.type == alternator_type::BOOL
+                    ? rjson::value(attr.bool_value)
+                    : rjson::from_string(attr.value);
+            auto typed_value = rjson::empty_object();
+            rjson::add_with_string_name(typed_value, represent_type(attr.type).ident, std::move(scalar));
+            if (cdef->is_primary_key()) {
+                rjson::add_with_string_name(key, attr.name, std::move(typed_value));
+            } else {
+                // Fixed-type regular column can be used for GSI key
+                cells.push_back({std::move(column_name), get_key_from_typed_value(typed_value, *cdef)});
+            }
+        } else {
+            bytes value;
+            switch (attr.type) {
+            case alternator_type::S:
+                value = bytes{int8_t(alternator_type::S)} + to_bytes(attr.value);
+                break;
+            case alternator_type::B:
+                value = bytes{int8_t(alternator_type::B)} + base64_decode(attr.value);
+                break;
+            case alternator_type::BOOL:
+                value = bytes{int8_t(alternator_type::BOOL)} + boolean_type->decompose(attr.bool_value);
+                break;
+            case alternator_type::N:
+                try {
+                    value = bytes{int8_t(alternator_type::N)} + decimal_type->from_string(attr.value);
+                } catch (const marshal_exception& e) {
+                    throw api_error::validation(format("The parameter cannot be converted to a numeric value: {}", attr.value));
+                }
+                break;
+            default:
+                return nullptr;
+            }
+            cells.push_back({std::move(column_name), std::move(value)});
+        }
+    }
+    partition_key pk = pk_from_json(key, schema);
+    clustering_key ck = ck_from_json(key, schema);
+    auto op = make_shared<put_item_operation>(_proxy, std::move(request),
+            put_or_delete_item(std::move(pk), std::move(ck), std::move(cells)));
+    if (op->shard_for_execute(false)) {
+        // LWT operations must run on a shard owning the key. Let the DOM
+        // path do the cross-shard bounce, it already knows how.
+        return nullptr;
+    }
+    return op;
+}
+
+future<executor::request_return_type> executor::put_item_streamed(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, shared_ptr<rmw_operation> op) {
+    _stats.api_operations.put_item++;
+    auto start_time = std::chrono::steady_clock::now();
+    elogger.trace("put_item (streamed) {}", op->request());
+    tracing::add_table_name(trace_state, op->schema()->ks_name(), op->schema()->cf_name());
+    maybe_throttle_write(op->schema());
+    return op->execute(_proxy, client_state, trace_state, std::move(permit), false, _stats).finally([op, start_time, this] {
+        _stats.api_operations.put_item_latency.add(std::chrono::steady_clock::now() - start_time);
+    });
+}
+
 class delete_item_operation : public rmw_operation {
 private:
     put_or_delete_item _mutation_builder;
@@ -1774,6 +2085,7 @@ future<executor::request_return_type> executor::delete_item(client_state& client
             });
         });
     }
+    maybe_throttle_write(op->schema());
     return op->execute(_proxy, client_state, trace_state, std::move(permit), needs_read_before_write, _stats).finally([op, start_time, this] {
         _stats.api_operations.delete_item_latency.add(std::chrono::steady_clock::now() - start_time);
     });
@@ -1949,6 +2261,7 @@ future<executor::request_return_type> executor::batch_write_item(client_state& c
         std::unordered_set<primary_key, primary_key_hash, primary_key_equal> used_keys(
                 1, primary_key_hash{schema}, primary_key_equal{schema});
         for (auto& request : it->value.GetArray()) {
+            maybe_throttle_write(schema);
             if (!request.IsObject() || request.MemberCount() != 1) {
                 return make_ready_future<request_return_type>(api_error::validation(format("Invalid BatchWriteItem request: {}", request)));
             }
@@ -3018,6 +3331,7 @@ future<executor::request_return_type> executor::update_item(client_state& client
             });
         });
     }
+    maybe_throttle_write(op->schema());
     return op->execute(_proxy, client_state, trace_state, std::move(permit), needs_read_before_write, _stats).finally([op, start_time, this] {
         _stats.api_operations.update_item_latency.add(std::chrono::steady_clock::now() - start_time);
     });
@@ -3067,6 +3381,7 @@ future<executor::request_return_type> executor::get_item(client_state& client_st
     elogger.trace("Getting item {}", request);
 
     schema_ptr schema = get_table(_proxy, request);
+    maybe_throttle_read(schema);
 
     tracing::add_table_name(trace_state, schema->ks_name(), schema->cf_name());
 
@@ -3221,6 +3536,7 @@ future<executor::request_return_type> executor::batch_get_item(client_state& cli
         verify_all_are_used(request, "ExpressionAttributeNames", used_attribute_names, "GetItem");
         auto& keys = (it->value)["Keys"];
         for (rjson::value& key : keys.GetArray()) {
+            maybe_throttle_read(rs.schema);
             rs.add(key);
             check_key(key, rs.schema);
         }
@@ -3231,6 +3547,41 @@ future<executor::request_return_type> executor::batch_get_item(client_state& cli
     // requests for the different partitions all in parallel.
     std::vector<future<std::vector<rjson::value>>> response_futures;
     for (const auto& rs : requests) {
+        // A table without clustering keys has all its requested partitions
+        // fetched with one multi-partition query instead of one query per
+        // partition. The ranges are sorted in ring order, which lets the
+        // storage proxy serve the whole batch as a single local multi-range
+        // read when this node is a suitable replica for all of them. The
+        // response assembly loop below walks the requests with the same
+        // grouping.
+        if (rs.schema->clustering_key_size() == 0 && rs.requests.size() > 1) {
+            dht::partition_range_vector partition_ranges;
+            partition_ranges.reserve(rs.requests.size());
+            for (const auto& r : rs.requests) {
+                partition_ranges.emplace_back(dht::partition_range(dht::decorate_key(*rs.schema, r.first)));
+            }
+            std::sort(partition_ranges.begin(), partition_ranges.end(),
+                    [less = dht::ring_position_less_comparator(*rs.schema)] (const dht::partition_range& a, const dht::partition_range& b) {
+                return less(a.start()->value(), b.start()->value());
+            });
+            std::vector<query::clustering_range> bounds{query::clustering_range::make_open_ended_both_sides()};
+            auto regular_columns = boost::copy_range<query::column_id_vector>(
+                    rs.schema->regular_columns() | boost::adaptors::transformed([] (const column_definition& cdef) { return cdef.id; }));
+            auto selection = cql3::selection::selection::wildcard(rs.schema);
+            auto partition_slice = query::partition_slice(std::move(bounds), {}, std::move(regular_columns), selection->get_query_options());
+            auto command = ::make_lw_shared<query::read_command>(rs.schema->id(), rs.schema->version(), partition_slice, _proxy.get_max_result_size(partition_slice),
+                    query::tombstone_limit(_proxy.get_tombstone_limit()));
+            command->allow_limit = db::allow_per_partition_rate_limit::yes;
+            future<std::vector<rjson::value>> f = _proxy.query(rs.schema, std::move(command), std::move(partition_ranges), rs.cl,
+                    service::storage_proxy::coordinator_query_options(executor::default_timeout(), permit, client_state, trace_state)).then(
+                    [schema = rs.schema, partition_slice = std::move(partition_slice), selection = std::move(selection), attrs_to_get = rs.attrs_to_get] (service::storage_proxy::coordinator_query_result qr) mutable {
+                utils::get_local_injector().inject("alternator_batch_get_item", [] { throw std::runtime_error("batch_get_item injection"); });
+                std::vector<rjson::value> jsons = describe_multi_item(schema, partition_slice, *selection, *qr.query_result, *attrs_to_get);
+                return make_ready_future<std::vector<rjson::value>>(std::move(jsons));
+            });
+            response_futures.push_back(std::move(f));
+            continue;
+        }
         for (const auto &r : rs.requests) {
             auto& pk = r.first;
             auto& cks = r.second;
@@ -3274,42 +3625,57 @@ future<executor::request_return_type> executor::batch_get_item(client_state& cli
     auto fut_it = response_futures.begin();
     for (const auto& rs : requests) {
         auto table = table_name(*rs.schema);
+        // Must match the grouping done by the dispatch loop above: one
+        // future for the whole table if its partitions were read together,
+        // one future per partition otherwise.
+        const bool combined_read = rs.schema->clustering_key_size() == 0 && rs.requests.size() > 1;
+        bool first = true;
+        bool combined_read_failed = false;
         for (const auto &r : rs.requests) {
-            auto& pk = r.first;
             auto& cks = r.second;
-            auto& fut = *fut_it;
-            ++fut_it;
-            try {
-                std::vector<rjson::value> results = co_await std::move(fut);
-                some_succeeded = true;
-                if (!response["Responses"].HasMember(table)) {
-                    rjson::add_with_string_name(response["Responses"], table, rjson::empty_array());
-                }
-                for (rjson::value& json : results) {
-                    rjson::push_back(response["Responses"][table], std::move(json));
-                }
-            } catch(...) {
-                eptr = std::current_exception();
-                // This read of potentially several rows in one partition,
-                // failed. We need to add the row key(s) to UnprocessedKeys.
-                if (!response["UnprocessedKeys"].HasMember(table)) {
-                    // Add the table's entry in UnprocessedKeys. Need to copy
-                    // all the table's parameters from the request except the
-                    // Keys field, which we start empty and then build below.
-                    rjson::add_with_string_name(response["UnprocessedKeys"], table, rjson::empty_object());
-                    rjson::value& unprocessed_item = response["UnprocessedKeys"][table];
-                    rjson::value& request_item = request_items[table];
-                    for (auto it = request_item.MemberBegin(); it != request_item.MemberEnd(); ++it) {
-                        if (it->name != "Keys") {
-                            rjson::add_with_string_name(unprocessed_item,
-                                rjson::to_string_view(it->name), rjson::copy(it->value));
-                        }
+            if (!combined_read || first) {
+                first = false;
+                auto& fut = *fut_it;
+                ++fut_it;
+                try {
+                    std::vector<rjson::value> results = co_await std::move(fut);
+                    some_succeeded = true;
+                    if (!response["Responses"].HasMember(table)) {
+                        rjson::add_with_string_name(response["Responses"], table, rjson::empty_array());
                     }
-                    rjson::add_with_string_name(unprocessed_item, "Keys", rjson::empty_array());
+                    for (rjson::value& json : results) {
+                        rjson::push_back(response["Responses"][table], std::move(json));
+                    }
+                    continue;
+                } catch(...) {
+                    eptr = std::current_exception();
+                    combined_read_failed = combined_read;
+                    // This read failed. We need to add the row key(s) to
+                    // UnprocessedKeys - all of the table's keys if this was
+                    // a combined read (the remaining iterations take the
+                    // branch below).
                 }
-                for (auto& ck : cks) {
-                    rjson::push_back(response["UnprocessedKeys"][table]["Keys"], std::move(*ck.second));
+            } else if (!combined_read_failed) {
+                // Covered by the successful combined read awaited above.
+                continue;
+            }
+            if (!response["UnprocessedKeys"].HasMember(table)) {
+                // Add the table's entry in UnprocessedKeys. Need to copy
+                // all the table's parameters from the request except the
+                // Keys field, which we start empty and then build below.
+                rjson::add_with_string_name(response["UnprocessedKeys"], table, rjson::empty_object());
+                rjson::value& unprocessed_item = response["UnprocessedKeys"][table];
+                rjson::value& request_item = request_items[table];
+                for (auto it = request_item.MemberBegin(); it != request_item.MemberEnd(); ++it) {
+                    if (it->name != "Keys") {
+                        rjson::add_with_string_name(unprocessed_item,
+                            rjson::to_string_view(it->name), rjson::copy(it->value));
+                    }
                 }
+                rjson::add_with_string_name(unprocessed_item, "Keys", rjson::empty_array());
+            }
+            for (auto& ck : cks) {
+                rjson::push_back(response["UnprocessedKeys"][table]["Keys"], std::move(*ck.second));
             }
         }
     }
@@ -3732,6 +4098,7 @@ future<executor::request_return_type> executor::scan(client_state& client_state,
     elogger.trace("Scanning {}", request);
 
     auto [schema, table_type] = get_table_or_view(_proxy, request);
+    maybe_throttle_read(schema);
 
     auto segment = get_int_attribute(request, "Segment");
     auto total_segments = get_int_attribute(request, "TotalSegments");
@@ -4207,6 +4574,7 @@ future<executor::request_return_type> executor::query(client_state& client_state
     elogger.trace("Querying {}", request);
 
     auto [schema, table_type] = get_table_or_view(_proxy, request);
+    maybe_throttle_read(schema);
 
     tracing::add_table_name(trace_state, schema->ks_name(), schema->cf_name());
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <seastar/core/future.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/http/httpd.hh>
 #include "seastarx.hh"
 #include <seastar/json/json_elements.hh>
@@ -152,6 +153,41 @@ using attrs_to_get_node = attribute_path_map_node<std::monostate>;
 using attrs_to_get = attribute_path_map<std::monostate>;
 
 
+class rmw_operation;
+
+// Per-shard token buckets implementing DynamoDB-style RCU/WCU accounting
+// per table. A table opts into accounting by setting the
+// system:read_capacity_units and/or system:write_capacity_units tags (e.g.,
+// with TagResource) to the allowed number of operations per second; tables
+// without these tags are not accounted at all.
+// Each shard independently enforces its 1/smp::count share of the table's
+// limit, so - like db::rate_limiter's buckets - the state is plain
+// shard-local data and needs no cross-shard coordination. A bucket
+// accumulates up to one second's worth of unused capacity, allowing short
+// bursts.
+// Unlike DynamoDB's capacity units, every operation currently weighs one
+// unit regardless of item size. What this simplification buys us is that an
+// operation's cost is known before executing it, so a throttled tenant's
+// request can be rejected immediately, before any statement work is done.
+class table_throughput_limiter {
+    struct token_bucket {
+        double tokens;
+        lowres_clock::time_point last_refill;
+    };
+    // Keyed by table id. Entries of dropped tables are left behind, but
+    // they are tiny and only ever allocated for explicitly tagged tables.
+    std::unordered_map<table_id, token_bucket> _read_buckets;
+    std::unordered_map<table_id, token_bucket> _write_buckets;
+    bool try_consume(std::unordered_map<table_id, token_bucket>& buckets, const schema_ptr& schema, const char* tag);
+public:
+    static constexpr auto READ_CAPACITY_TAG_KEY = "system:read_capacity_units";
+    static constexpr auto WRITE_CAPACITY_TAG_KEY = "system:write_capacity_units";
+    // Account one read (write) unit against the table's limit. Returns
+    // false when the operation should be throttled.
+    bool account_read(const schema_ptr& schema);
+    bool account_write(const schema_ptr& schema);
+};
+
 class executor : public peering_sharded_service<executor> {
     gms::gossiper& _gossiper;
     service::storage_proxy& _proxy;
@@ -161,6 +197,16 @@ class executor : public peering_sharded_service<executor> {
     // An smp_service_group to be used for limiting the concurrency when
     // forwarding Alternator request between shards - if necessary for LWT.
     smp_service_group _ssg;
+    // RCU/WCU-style per-table throughput accounting. Checked by
+    // maybe_throttle_read()/maybe_throttle_write() at the start of each
+    // data-path operation, before any statement work is done for it.
+    table_throughput_limiter _throughput_limiter;
+
+    // Check an operation against the table's read (write) capacity limit
+    // and throw ProvisionedThroughputExceededException if it must be
+    // throttled. Called on the shard which executes the operation.
+    void maybe_throttle_read(const schema_ptr& schema);
+    void maybe_throttle_write(const schema_ptr& schema);
 
 public:
     using client_state = service::client_state;
@@ -178,6 +224,15 @@ public:
     future<request_return_type> delete_table(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, rjson::value request);
     future<request_return_type> update_table(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, rjson::value request);
     future<request_return_type> put_item(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, rjson::value request);
+    // Attempts to parse a PutItem request directly from its raw JSON with a
+    // streaming (SAX) decoder, serializing the item's attribute values as
+    // they are parsed instead of materializing the request DOM first. On
+    // success returns an opaque parsed operation to be executed with
+    // put_item_streamed(). Returns nullptr when the request doesn't fit the
+    // streaming decoder (see executor.cc for what it covers), in which case
+    // the caller should parse the request and use the regular put_item().
+    shared_ptr<rmw_operation> try_parse_put_item_streamed(std::string_view content);
+    future<request_return_type> put_item_streamed(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, shared_ptr<rmw_operation> op);
     future<request_return_type> get_item(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, rjson::value request);
     future<request_return_type> delete_item(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, rjson::value request);
     future<request_return_type> update_item(client_state& client_state, tracing::trace_state_ptr trace_state, service_permit permit, rjson::value request);
@@ -419,6 +419,26 @@ future<executor::request_return_type> server::handle_api_request(std::unique_ptr
 
     tracing::trace_state_ptr trace_state = maybe_trace_query(client_state, username, op, content);
     tracing::trace(trace_state, op);
+    if (op == "PutItem") {
+        // Try the streaming PutItem decoder first: it executes simple
+        // PutItem requests straight from the raw JSON, without materializing
+        // the request DOM. Requests the decoder doesn't cover fall through
+        // to the regular DOM path below.
+        std::string linearized;
+        std::string_view body;
+        if (content.size() == 1) {
+            body = std::string_view(content.front().get(), content.front().size());
+        } else {
+            for (const auto& chunk : content) {
+                linearized.append(chunk.get(), chunk.size());
+            }
+            body = linearized;
+        }
+        if (auto streamed_op = _executor.try_parse_put_item_streamed(body)) {
+            co_return co_await _executor.put_item_streamed(client_state, std::move(trace_state),
+                    make_service_permit(std::move(units)), std::move(streamed_op));
+        }
+    }
     rjson::value json_request = co_await _json_parser.parse(std::move(content));
     co_return co_await callback_it->second(_executor, client_state, trace_state,
             make_service_permit(std::move(units)), std::move(json_request), std::move(req));
@@ -86,6 +86,10 @@ stats::stats() : api_operations{} {
                     seastar::metrics::description("Counts a number of requests blocked due to memory pressure.")),
             seastar::metrics::make_total_operations("requests_shed", requests_shed,
                     seastar::metrics::description("Counts a number of requests shed due to overload.")),
+            seastar::metrics::make_total_operations("requests_throttled_reads", requests_throttled_reads,
+                    seastar::metrics::description("Counts a number of read requests rejected by per-table read capacity accounting.")),
+            seastar::metrics::make_total_operations("requests_throttled_writes", requests_throttled_writes,
+                    seastar::metrics::description("Counts a number of write requests rejected by per-table write capacity accounting.")),
             seastar::metrics::make_total_operations("filtered_rows_read_total", cql_stats.filtered_rows_read_total,
                     seastar::metrics::description("number of rows read during filtering operations")),
             seastar::metrics::make_total_operations("filtered_rows_matched_total", cql_stats.filtered_rows_matched_total,
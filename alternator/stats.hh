@@ -80,6 +80,10 @@ public:
     uint64_t shard_bounce_for_lwt = 0;
     uint64_t requests_blocked_memory = 0;
     uint64_t requests_shed = 0;
+    // Requests rejected by the per-table RCU/WCU accounting (see
+    // table_throughput_limiter in executor.hh)
+    uint64_t requests_throttled_reads = 0;
+    uint64_t requests_throttled_writes = 0;
     // CQL-derived stats
     cql3::cql_stats cql_stats;
 private:
@@ -24,6 +24,7 @@
 #include "compaction_manager.hh"
 #include "hinted_handoff.hh"
 #include "error_injection.hh"
+#include "table_benchmark.hh"
 #include "authorization_cache.hh"
 #include <seastar/http/exception.hh>
 #include "stream_manager.hh"
@@ -250,6 +251,9 @@ future<> set_server_done(http_context& ctx) {
         rb->register_function(r, "error_injection",
                 "The error injection API");
         set_error_injection(ctx, r);
+        rb->register_function(r, "table_benchmark",
+                "The table benchmark API");
+        set_table_benchmark(ctx, r);
     });
 }
 
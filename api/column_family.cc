@@ -447,11 +447,9 @@ void set_column_family(http_context& ctx, routes& r) {
     // FIXME: this refers to partitions, not rows.
     cf::get_estimated_row_count.set(r, [&ctx] (std::unique_ptr<request> req) {
         return map_reduce_cf(ctx, req->param["name"], int64_t(0), [](replica::column_family& cf) {
-            uint64_t res = 0;
-            for (auto sstables = cf.get_sstables(); auto& i : *sstables) {
-                res += i->get_stats_metadata().estimated_partition_size.count();
-            }
-            return res;
+            // Include the memtable contents so freshly written, not yet
+            // flushed partitions show up in the estimate too.
+            return cf.estimated_partition_count();
         },
         std::plus<uint64_t>());
     });
@@ -10,6 +10,7 @@
 
 #include "compaction_manager.hh"
 #include "compaction/compaction_manager.hh"
+#include "compaction/compaction_strategy.hh"
 #include "api/api-doc/compaction_manager.json.hh"
 #include "db/system_keyspace.hh"
 #include "column_family.hh"
@@ -90,6 +91,54 @@ void set_compaction_manager(http_context& ctx, routes& r) {
         });
     });
 
+    cm::get_strategy_dry_run.set(r, [&ctx] (std::unique_ptr<request> req) {
+        auto ks_name = validate_keyspace(ctx, req->param);
+        auto table_name = req->get_query_param("cf");
+        sstables::compaction_strategy_type strategy_type;
+        std::map<sstring, sstring> options;
+        try {
+            strategy_type = sstables::compaction_strategy::type(req->get_query_param("strategy"));
+            for (auto& opt : split(req->get_query_param("options"), ",")) {
+                auto pos = opt.find('=');
+                if (pos == sstring::npos) {
+                    throw bad_param_exception(format("Invalid strategy option '{}': expected key=value", opt));
+                }
+                options[opt.substr(0, pos)] = opt.substr(pos + 1);
+            }
+            // Validate the strategy options here, so a typo fails the request
+            // instead of every shard.
+            sstables::make_compaction_strategy(strategy_type, options);
+        } catch (const exceptions::configuration_exception& e) {
+            throw bad_param_exception(e.what());
+        }
+        return ctx.db.map_reduce0([ks_name, table_name, strategy_type, options] (replica::database& db) {
+            auto& t = db.find_column_family(ks_name, table_name);
+            auto& cm = db.get_compaction_manager();
+            auto& ts = t.as_table_state();
+            // A throwaway strategy instance: asking it what it would compact
+            // doesn't register anything with the compaction manager, so this
+            // has no effect on the table.
+            auto strategy = sstables::make_compaction_strategy(strategy_type, options);
+            auto desc = strategy.get_sstables_for_compaction(ts, cm.get_strategy_control(), cm.get_candidates(ts));
+            std::vector<cm::dry_run_job> jobs;
+            if (!desc.sstables.empty()) {
+                cm::dry_run_job job;
+                job.shard = this_shard_id();
+                job.sstables = desc.sstables.size();
+                uint64_t size = 0;
+                for (const auto& sst : desc.sstables) {
+                    size += sst->bytes_on_disk();
+                }
+                job.size = size;
+                job.level = desc.level;
+                jobs.push_back(std::move(job));
+            }
+            return jobs;
+        }, std::vector<cm::dry_run_job>(), concat<cm::dry_run_job>).then([] (const std::vector<cm::dry_run_job>& res) {
+            return make_ready_future<json::json_return_type>(res);
+        });
+    });
+
     cm::force_user_defined_compaction.set(r, [] (std::unique_ptr<request> req) {
         //TBD
         // FIXME
@@ -36,6 +36,7 @@
 #include "compaction/compaction_manager.hh"
 #include "sstables/sstables.hh"
 #include "replica/database.hh"
+#include "schema_registry.hh"
 #include "db/extensions.hh"
 #include "db/snapshot-ctl.hh"
 #include "transport/controller.hh"
@@ -429,6 +430,35 @@ void set_sstables_loader(http_context& ctx, routes& r, sharded<sstables_loader>&
             return make_ready_future<json::json_return_type>(json_void());
         });
     });
+
+    ss::upload_sstable_component.set(r, [&ctx, &sst_loader](std::unique_ptr<request> req) -> future<json::json_return_type> {
+        auto ks = validate_keyspace(ctx, req->param);
+        auto cf = req->get_query_param("cf");
+        auto component = req->get_query_param("component");
+        if (cf.empty() || component.empty()) {
+            throw httpd::bad_param_exception("The cf and component query parameters are required");
+        }
+        std::optional<uint32_t> expected_crc32;
+        if (auto crc = req->get_query_param("expected_crc32"); !crc.empty()) {
+            try {
+                expected_crc32 = boost::lexical_cast<uint32_t>(crc);
+            } catch (const boost::bad_lexical_cast&) {
+                throw httpd::bad_param_exception(fmt::format("Invalid expected_crc32 value: {}", crc));
+            }
+        }
+        if (!req->content_stream) {
+            throw httpd::server_error_exception("Request body streaming is not enabled");
+        }
+        try {
+            // The component is written on the shard serving the request; the
+            // load that follows distributes the sstables among shards anyway.
+            co_await sst_loader.local().upload_component(ks, cf, component, *req->content_stream, expected_crc32);
+        } catch (...) {
+            auto msg = fmt::format("Failed to upload sstable component: {}", std::current_exception());
+            throw httpd::server_error_exception(msg);
+        }
+        co_return json_void();
+    });
 }
 
 void unset_sstables_loader(http_context& ctx, routes& r) {
@@ -537,6 +567,68 @@ void set_storage_service(http_context& ctx, routes& r, sharded<service::storage_
         });
     });
 
+    ss::get_hot_partitions.set(r, [&ctx] (std::unique_ptr<request> req) {
+        api::req_param<unsigned> list_size(*req, "list_size", 10);
+        apilog.debug("hot_partitions query: list_size={}", list_size.param);
+        return db::query_hot_partitions(ctx.db).then([list_size = list_size.value] (db::hot_partitions_results res) {
+            namespace cf = httpd::column_family_json;
+            ss::hot_partitions_results results;
+            for (auto& d: res.read.top(list_size)) {
+                cf::toppartitions_record r;
+                r.partition = "(" + d.item.schema->ks_name() + ":" + d.item.schema->cf_name() + ") " + sstring(d.item);
+                r.count = d.count;
+                r.error = d.error;
+                results.read.push(r);
+            }
+            for (auto& d: res.write.top(list_size)) {
+                cf::toppartitions_record r;
+                r.partition = "(" + d.item.schema->ks_name() + ":" + d.item.schema->cf_name() + ") " + sstring(d.item);
+                r.count = d.count;
+                r.error = d.error;
+                results.write.push(r);
+            }
+            std::unordered_map<std::tuple<sstring, sstring>, std::pair<double, double>, utils::tuple_hash> rates;
+            for (auto& [table, rate] : res.read_rates) {
+                rates[table].first = rate;
+            }
+            for (auto& [table, rate] : res.write_rates) {
+                rates[table].second = rate;
+            }
+            for (auto& [table, rw] : rates) {
+                ss::hot_partition_table_rate r;
+                r.ks = std::get<0>(table);
+                r.cf = std::get<1>(table);
+                r.read_rate = rw.first;
+                r.write_rate = rw.second;
+                results.rates.push(r);
+            }
+            return make_ready_future<json::json_return_type>(results);
+        });
+    });
+
+    ss::warm_cache.set(r, [&ctx] (std::unique_ptr<request> req) -> future<json::json_return_type> {
+        auto ks_name = validate_keyspace(ctx, req->param);
+        auto cf_name = req->get_query_param("cf");
+        auto keys = split(req->get_query_param("keys"), ",");
+        api::req_param<uint64_t> max_bytes(*req, "max_bytes", 1 << 20);
+        auto schema = ctx.db.local().find_column_family(ks_name, cf_name).schema();
+        apilog.debug("warm_cache: {}.{}, {} keys", ks_name, cf_name, keys.size());
+        unsigned warmed = 0;
+        for (auto& key : keys) {
+            partition_key pk = partition_key::from_nodetool_style_string(schema, key);
+            auto dk = dht::decorate_key(*schema, std::move(pk));
+            auto shard = dht::shard_of(*schema, dk.token());
+            co_await ctx.db.invoke_on(shard, [gs = global_schema_ptr(schema), key_bytes = to_bytes(dk.key().representation()),
+                    max_bytes = max_bytes.value] (replica::database& db) {
+                schema_ptr s = gs;
+                auto dk = dht::decorate_key(*s, partition_key::from_bytes(managed_bytes(key_bytes)));
+                return db.warm_partition_cache(std::move(s), std::move(dk), max_bytes, db::timeout_clock::now() + std::chrono::minutes(1));
+            });
+            ++warmed;
+        }
+        co_return json::json_return_type(warmed);
+    });
+
     ss::get_leaving_nodes.set(r, [&ctx](const_req req) {
         return container_to_vec(ctx.get_token_metadata().get_leaving_endpoints());
     });
@@ -1398,6 +1490,26 @@ void set_snapshot(http_context& ctx, routes& r, sharded<db::snapshot_ctl>& snap_
         });
     });
 
+    ss::get_snapshot_diff.set(r, [&snap_ctl](std::unique_ptr<request> req) -> future<json::json_return_type> {
+        auto from = req->get_query_param("from");
+        auto to = req->get_query_param("to");
+        if (from.empty() || to.empty()) {
+            throw httpd::bad_param_exception("Both 'from' and 'to' snapshot tags must be specified");
+        }
+        auto diff = co_await snap_ctl.local().get_snapshot_diff(std::move(from), std::move(to));
+        std::vector<ss::snapshot_diff_entry> res;
+        res.reserve(diff.size());
+        for (auto& f : diff) {
+            ss::snapshot_diff_entry e;
+            e.ks = std::move(f.ks);
+            e.cf = std::move(f.cf);
+            e.name = std::move(f.name);
+            e.size = f.size;
+            res.push_back(std::move(e));
+        }
+        co_return json::json_return_type(std::move(res));
+    });
+
     ss::take_snapshot.set(r, [&ctx, &snap_ctl](std::unique_ptr<request> req) -> future<json::json_return_type> {
         apilog.info("take_snapshot: {}", req->query_parameters);
         auto tag = req->get_query_param("tag");
@@ -1549,6 +1661,7 @@ void set_snapshot(http_context& ctx, routes& r, sharded<db::snapshot_ctl>& snap_
 
 void unset_snapshot(http_context& ctx, routes& r) {
     ss::get_snapshot_details.unset(r);
+    ss::get_snapshot_diff.unset(r);
     ss::take_snapshot.unset(r);
     ss::del_snapshot.unset(r);
     ss::true_snapshots_size.unset(r);
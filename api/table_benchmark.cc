@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include <random>
+
+#include <boost/range/irange.hpp>
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+
+#include "api/api-doc/table_benchmark.json.hh"
+#include "api/table_benchmark.hh"
+
+#include "db/timeout_clock.hh"
+#include "mutation.hh"
+#include "query-request.hh"
+#include "replica/database.hh"
+#include "schema.hh"
+#include "service/client_state.hh"
+#include "service/storage_proxy.hh"
+#include "service_permit.hh"
+#include "timestamp.hh"
+#include "types.hh"
+#include "utils/UUID.hh"
+
+namespace api {
+
+namespace tb = httpd::table_benchmark_json;
+using namespace json;
+
+static constexpr auto benchmark_request_timeout = std::chrono::seconds(10);
+
+// Deterministically synthesizes the n-th component value for the common
+// key column types, so the loop can address a bounded key space on any
+// table built from them. Key columns of other types are rejected up
+// front, before any requests are issued.
+static bytes make_key_component(const abstract_type& t, uint64_t n) {
+    switch (t.get_kind()) {
+    case abstract_type::kind::int32:
+        return int32_type->decompose(int32_t(n));
+    case abstract_type::kind::long_kind:
+        return long_type->decompose(int64_t(n));
+    case abstract_type::kind::ascii:
+    case abstract_type::kind::utf8:
+    case abstract_type::kind::bytes:
+        return to_bytes(format("key{:016d}", n));
+    case abstract_type::kind::uuid:
+        return uuid_type->decompose(utils::UUID(0, int64_t(n)));
+    default:
+        throw bad_param_exception(format("Cannot synthesize benchmark keys for column type {}", t.name()));
+    }
+}
+
+static partition_key make_benchmark_pkey(const schema& s, uint64_t n) {
+    std::vector<bytes> components;
+    for (const column_definition& cdef : s.partition_key_columns()) {
+        components.push_back(make_key_component(*cdef.type, n));
+    }
+    return partition_key::from_exploded(s, components);
+}
+
+static clustering_key make_benchmark_ckey(const schema& s, uint64_t n) {
+    std::vector<bytes> components;
+    for (const column_definition& cdef : s.clustering_key_columns()) {
+        components.push_back(make_key_component(*cdef.type, n));
+    }
+    return clustering_key::from_exploded(s, components);
+}
+
+static uint64_t parse_uint_param(const request& req, const sstring& name, uint64_t default_value) {
+    auto v = req.get_query_param(name);
+    if (v.empty()) {
+        return default_value;
+    }
+    try {
+        return boost::lexical_cast<uint64_t>(v);
+    } catch (const boost::bad_lexical_cast&) {
+        throw bad_param_exception(format("Invalid value for parameter {}: {}", name, v));
+    }
+}
+
+namespace {
+
+struct benchmark_run {
+    schema_ptr s;
+    bool read;
+    bool uniform;
+    uint64_t requests;
+    uint64_t partitions;
+
+    // Shared between the fibers of the run. All fibers live on the
+    // handler's shard; the proxy fans the requests out from there like it
+    // does for client requests.
+    uint64_t issued = 0;
+    uint64_t failures = 0;
+    utils::estimated_histogram latencies_us;
+    std::mt19937_64 rnd{std::random_device{}()};
+
+    uint64_t next_key() {
+        auto seq = issued++;
+        if (uniform) {
+            return std::uniform_int_distribution<uint64_t>(0, partitions - 1)(rnd);
+        }
+        return seq % partitions;
+    }
+};
+
+} // anonymous namespace
+
+static future<> benchmark_fiber(http_context& ctx, benchmark_run& run) {
+    const auto& s = *run.s;
+    while (run.issued < run.requests) {
+        auto key = run.next_key();
+        auto op_start = std::chrono::steady_clock::now();
+        try {
+            if (run.read) {
+                dht::partition_range_vector ranges;
+                ranges.emplace_back(dht::partition_range::make_singular(dht::decorate_key(s, make_benchmark_pkey(s, key))));
+                auto cmd = make_lw_shared<query::read_command>(s.id(), s.version(), s.full_slice(), query::max_result_size(1 << 20),
+                        query::tombstone_limit::max, query::row_limit(1024));
+                co_await ctx.sp.local().query(run.s, std::move(cmd), std::move(ranges), db::consistency_level::ONE,
+                        {db::timeout_clock::now() + benchmark_request_timeout, empty_service_permit(), service::client_state::for_internal_calls()});
+            } else {
+                mutation m(run.s, make_benchmark_pkey(s, key));
+                auto ck = s.clustering_key_size() ? make_benchmark_ckey(s, key) : clustering_key::make_empty();
+                m.partition().clustered_row(s, std::move(ck)).apply(row_marker(new_timestamp()));
+                std::vector<mutation> muts;
+                muts.push_back(std::move(m));
+                co_await ctx.sp.local().mutate(std::move(muts), db::consistency_level::ONE,
+                        db::timeout_clock::now() + benchmark_request_timeout, nullptr, empty_service_permit(),
+                        db::allow_per_partition_rate_limit::no);
+            }
+            auto latency = std::chrono::steady_clock::now() - op_start;
+            run.latencies_us.add(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+        } catch (...) {
+            ++run.failures;
+        }
+    }
+}
+
+static future<json::json_return_type> run_benchmark(http_context& ctx, std::unique_ptr<request> req) {
+    benchmark_run run;
+    sstring ks = req->param["keyspace"];
+    sstring cf = req->param["table"];
+    try {
+        run.s = ctx.db.local().find_schema(ks, cf);
+    } catch (const replica::no_such_keyspace&) {
+        throw bad_param_exception(format("Unknown keyspace {}", ks));
+    } catch (const replica::no_such_column_family&) {
+        throw bad_param_exception(format("Unknown table {}.{}", ks, cf));
+    }
+
+    sstring mode = req->get_query_param("mode");
+    if (mode != "read" && mode != "write") {
+        throw bad_param_exception(format("Invalid mode {}: expected read or write", mode));
+    }
+    run.read = mode == "read";
+
+    sstring distribution = req->get_query_param("distribution");
+    if (distribution.empty()) {
+        distribution = "uniform";
+    }
+    if (distribution != "uniform" && distribution != "sequential") {
+        throw bad_param_exception(format("Invalid distribution {}: expected uniform or sequential", distribution));
+    }
+    run.uniform = distribution == "uniform";
+
+    run.requests = std::max(parse_uint_param(*req, "requests", 10000), uint64_t(1));
+    run.partitions = std::max(parse_uint_param(*req, "partitions", 10000), uint64_t(1));
+    auto concurrency = std::clamp(parse_uint_param(*req, "concurrency", 16), uint64_t(1), uint64_t(1024));
+
+    // Fail fast on key types we cannot synthesize rather than half way
+    // through the loop.
+    make_benchmark_pkey(*run.s, 0);
+    if (!run.read && run.s->clustering_key_size()) {
+        make_benchmark_ckey(*run.s, 0);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    co_await coroutine::parallel_for_each(boost::irange<uint64_t>(0, concurrency), [&ctx, &run] (uint64_t) {
+        return benchmark_fiber(ctx, run);
+    });
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    tb::benchmark_result res;
+    res.ops = run.latencies_us.count();
+    res.failures = run.failures;
+    res.duration_in_ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    res.avg_latency_in_us = run.latencies_us.mean();
+    res.median_latency_in_us = run.latencies_us.percentile(0.5);
+    res.latency_95_in_us = run.latencies_us.percentile(0.95);
+    res.latency_99_in_us = run.latencies_us.percentile(0.99);
+    res.max_latency_in_us = run.latencies_us.max();
+    co_return json::json_return_type(res);
+}
+
+void set_table_benchmark(http_context& ctx, routes& r) {
+    tb::run_benchmark.set(r, [&ctx] (std::unique_ptr<request> req) {
+        return run_benchmark(ctx, std::move(req));
+    });
+}
+
+} // namespace api
@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "api.hh"
+
+namespace api {
+
+void set_table_benchmark(http_context& ctx, routes& r);
+
+}
@@ -72,28 +72,32 @@ atomic_cell::atomic_cell(const abstract_type& type, atomic_cell_view other)
 //  - org.apache.cassandra.db.BufferDeletedCell#reconcile()
 std::strong_ordering
 compare_atomic_cell_for_merge(atomic_cell_view left, atomic_cell_view right) {
-    if (left.timestamp() != right.timestamp()) {
-        return left.timestamp() <=> right.timestamp();
+    // Decode each cell's metadata once up front instead of re-walking the
+    // fragmented representation through the accessors at every step below.
+    const auto lh = left.decode_header();
+    const auto rh = right.decode_header();
+    if (lh.timestamp != rh.timestamp) {
+        return lh.timestamp <=> rh.timestamp;
     }
-    if (left.is_live() != right.is_live()) {
-        return left.is_live() ? std::strong_ordering::less : std::strong_ordering::greater;
+    if (lh.is_live() != rh.is_live()) {
+        return lh.is_live() ? std::strong_ordering::less : std::strong_ordering::greater;
     }
-    if (left.is_live()) {
+    if (lh.is_live()) {
         auto c = compare_unsigned(left.value(), right.value()) <=> 0;
         if (c != 0) {
             return c;
         }
-        if (left.is_live_and_has_ttl() != right.is_live_and_has_ttl()) {
+        if (lh.is_live_and_has_ttl() != rh.is_live_and_has_ttl()) {
             // prefer expiring cells.
-            return left.is_live_and_has_ttl() ? std::strong_ordering::greater : std::strong_ordering::less;
+            return lh.is_live_and_has_ttl() ? std::strong_ordering::greater : std::strong_ordering::less;
         }
-        if (left.is_live_and_has_ttl()) {
-            if (left.expiry() != right.expiry()) {
-                return left.expiry() <=> right.expiry();
+        if (lh.is_live_and_has_ttl()) {
+            if (lh.expiry() != rh.expiry()) {
+                return lh.expiry() <=> rh.expiry();
             } else {
                 // prefer the cell that was written later,
                 // so it survives longer after it expires, until purged.
-                return right.ttl() <=> left.ttl();
+                return rh.ttl_duration() <=> lh.ttl_duration();
             }
         }
     } else {
@@ -103,8 +107,8 @@ compare_atomic_cell_for_merge(atomic_cell_view left, atomic_cell_view right) {
         // delegates to AbstractCell.reconcile() which compares values after
         // comparing timestamps, which in case of deleted cells will hold
         // serialized expiry.
-        return (uint64_t) left.deletion_time().time_since_epoch().count()
-                <=> (uint64_t) right.deletion_time().time_since_epoch().count();
+        return (uint64_t) lh.expiry_or_deletion_time
+                <=> (uint64_t) rh.expiry_or_deletion_time;
     }
     return std::strong_ordering::equal;
 }
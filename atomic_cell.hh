@@ -12,6 +12,7 @@
 #include "timestamp.hh"
 #include "tombstone.hh"
 #include "gc_clock.hh"
+#include "utils/bit_cast.hh"
 #include "utils/managed_bytes.hh"
 #include <seastar/net//byteorder.hh>
 #include <seastar/util/bool_class.hh>
@@ -141,6 +142,59 @@ public:
         assert(is_live_and_has_ttl(cell));
         return gc_clock::duration(get_field<int32_t>(cell, ttl_offset));
     }
+    // All the fixed-size metadata of a cell, decoded in one pass.
+    //
+    // The per-field accessors above re-walk the fragmented representation and
+    // re-check fragment bounds on every call, which adds up during
+    // reconciliation, where each compared cell has its flags and timestamp -
+    // and for expiring or dead cells more - inspected several times. A
+    // decoded header is filled with a single bounds check and contiguous
+    // unaligned loads in the common case of the header lying within the
+    // cell's first fragment, and is then read as plain integers.
+    //
+    // Fields whose presence the flags don't indicate are left zeroed and
+    // meaningless.
+    struct decoded_header {
+        int8_t flags = 0;
+        api::timestamp_type timestamp = api::missing_timestamp;
+        int64_t expiry_or_deletion_time = 0; // expiry if live with ttl, deletion time if dead
+        int32_t ttl = 0;
+
+        bool is_live() const { return flags & LIVE_FLAG; }
+        bool is_live_and_has_ttl() const { return flags & EXPIRY_FLAG; }
+        gc_clock::time_point expiry() const { return gc_clock::time_point(gc_clock::duration(expiry_or_deletion_time)); }
+        gc_clock::duration ttl_duration() const { return gc_clock::duration(ttl); }
+        gc_clock::time_point deletion_time() const { return gc_clock::time_point(gc_clock::duration(expiry_or_deletion_time)); }
+    };
+    static decoded_header decode_header(atomic_cell_value_view cell) {
+        decoded_header h;
+        const auto frag = cell.current_fragment();
+        // Every field the flags tell us to read lies within the cell, so if
+        // the first fragment covers the whole cell, or at least the largest
+        // possible header, all reads below stay within the fragment.
+        if (frag.size() >= std::min<size_t>(cell.size_bytes(), ttl_offset + ttl_size)) [[likely]] {
+            const auto* p = frag.data();
+            h.flags = static_cast<int8_t>(*p);
+            h.timestamp = net::ntoh(read_unaligned<api::timestamp_type>(p + timestamp_offset));
+            if (h.flags & EXPIRY_FLAG) {
+                h.expiry_or_deletion_time = net::ntoh(read_unaligned<int64_t>(p + expiry_offset));
+                h.ttl = net::ntoh(read_unaligned<int32_t>(p + ttl_offset));
+            } else if (!(h.flags & LIVE_FLAG)) {
+                h.expiry_or_deletion_time = net::ntoh(read_unaligned<int64_t>(p + deletion_time_offset));
+            }
+        } else {
+            // The header straddles a fragment boundary; decode field by field.
+            h.flags = static_cast<int8_t>(cell.front());
+            h.timestamp = get_field<api::timestamp_type>(cell, timestamp_offset);
+            if (h.flags & EXPIRY_FLAG) {
+                h.expiry_or_deletion_time = get_field<int64_t>(cell, expiry_offset);
+                h.ttl = get_field<int32_t>(cell, ttl_offset);
+            } else if (!(h.flags & LIVE_FLAG)) {
+                h.expiry_or_deletion_time = get_field<int64_t>(cell, deletion_time_offset);
+            }
+        }
+        return h;
+    }
     static managed_bytes make_dead(api::timestamp_type timestamp, gc_clock::time_point deletion_time) {
         managed_bytes b(managed_bytes::initialized_later(), flags_size + timestamp_size + deletion_time_size);
         b[0] = 0;
@@ -231,6 +285,12 @@ public:
     api::timestamp_type timestamp() const {
         return atomic_cell_type::timestamp(_view);
     }
+    // Decodes all the cell's fixed-size metadata in one pass; cheaper than
+    // calling several of the accessors above, see
+    // atomic_cell_type::decoded_header.
+    atomic_cell_type::decoded_header decode_header() const {
+        return atomic_cell_type::decode_header(_view);
+    }
     void set_timestamp(api::timestamp_type ts) {
         atomic_cell_type::set_timestamp(_view, ts);
     }
@@ -24,6 +24,7 @@
 #include "auth/passwords.hh"
 #include "auth/roles-metadata.hh"
 #include "cql3/untyped_result_set.hh"
+#include "db/config.hh"
 #include "log.hh"
 #include "service/migration_manager.hh"
 #include "utils/class_registrator.hh"
@@ -56,7 +57,27 @@ password_authenticator::~password_authenticator() {
 password_authenticator::password_authenticator(cql3::query_processor& qp, ::service::migration_manager& mm)
     : _qp(qp)
     , _migration_manager(mm)
-    , _stopped(make_ready_future<>()) {
+    , _stopped(make_ready_future<>())
+    , _credentials_cache_cfg_cb([this] (uint32_t) { (void) _credentials_cache_config_action.trigger_later(); })
+    , _credentials_cache_config_action([this] { update_cache_config(); return make_ready_future<>(); })
+    , _credentials_cache_max_entries_observer(_qp.db().get_config().credentials_cache_max_entries.observe(_credentials_cache_cfg_cb))
+    , _credentials_update_interval_in_ms_observer(_qp.db().get_config().credentials_update_interval_in_ms.observe(_credentials_cache_cfg_cb))
+    , _credentials_validity_in_ms_observer(_qp.db().get_config().credentials_validity_in_ms.observe(_credentials_cache_cfg_cb)) {
+}
+
+utils::loading_cache_config password_authenticator::credentials_cache_config() const {
+    const auto& cfg = _qp.db().get_config();
+    utils::loading_cache_config c;
+    c.max_size = cfg.credentials_cache_max_entries();
+    c.expiry = std::chrono::milliseconds(cfg.credentials_validity_in_ms());
+    c.refresh = std::chrono::milliseconds(cfg.credentials_update_interval_in_ms());
+    return c;
+}
+
+void password_authenticator::update_cache_config() {
+    if (!_credentials_cache->update_config(credentials_cache_config())) {
+        plogger.error("Failed to apply credentials cache changes. Please read the documentation of these parameters");
+    }
 }
 
 static bool has_salted_hash(const cql3::untyped_result_set_row& row) {
@@ -123,6 +144,11 @@ future<> password_authenticator::create_default_if_missing() const {
 }
 
 future<> password_authenticator::start() {
+     _credentials_cache = std::make_unique<credentials_cache_type>(credentials_cache_config(), plogger, [this](const sstring& role_name) {
+         plogger.debug("Refreshing credentials for {}", role_name);
+         return read_salted_hash(role_name);
+     });
+
      return once_among_shards([this] {
          auto f = create_metadata_table_if_missing(
                  meta::roles_table::name,
@@ -157,7 +183,10 @@ future<> password_authenticator::start() {
 
 future<> password_authenticator::stop() {
     _as.request_abort();
-    return _stopped.handle_exception_type([] (const sleep_aborted&) { }).handle_exception_type([](const abort_requested_exception&) {});
+    auto f = _credentials_cache ? _credentials_cache->stop() : make_ready_future<>();
+    return f.then([this] {
+        return _stopped.handle_exception_type([] (const sleep_aborted&) { }).handle_exception_type([](const abort_requested_exception&) {});
+    });
 }
 
 db::consistency_level password_authenticator::consistency_for_user(std::string_view role_name) {
@@ -183,6 +212,33 @@ authentication_option_set password_authenticator::alterable_options() const {
     return authentication_option_set{authentication_option::password};
 }
 
+future<sstring> password_authenticator::read_salted_hash(const sstring& role_name) const {
+    // Here was a thread local, explicit cache of prepared statement. In normal execution this is
+    // fine, but since we in testing set up and tear down system over and over, we'd start using
+    // obsolete prepared statements pretty quickly.
+    // Rely on query processing caching statements instead, and lets assume
+    // that a map lookup string->statement is not gonna kill us much.
+    static const sstring query = format("SELECT {} FROM {} WHERE {} = ?",
+            SALTED_HASH,
+            meta::roles_table::qualified_name,
+            meta::roles_table::role_col_name);
+
+    return _qp.execute_internal(
+            query,
+            consistency_for_user(role_name),
+            internal_distributed_query_state(),
+            {role_name},
+            cql3::query_processor::cache_internal::yes).then([](::shared_ptr<cql3::untyped_result_set> res) {
+        // A role without a hash, or no role at all, is cached as an empty
+        // string. Caching the absence matters: a storm of connections with a
+        // bad username would otherwise bypass the cache entirely.
+        if (res->empty()) {
+            return sstring();
+        }
+        return res->one().get_or<sstring>(SALTED_HASH, "");
+    });
+}
+
 future<authenticated_user> password_authenticator::authenticate(
                 const credentials_map& credentials) const {
     if (!credentials.contains(USERNAME_KEY)) {
@@ -195,31 +251,16 @@ future<authenticated_user> password_authenticator::authenticate(
     auto& username = credentials.at(USERNAME_KEY);
     auto& password = credentials.at(PASSWORD_KEY);
 
-    // Here was a thread local, explicit cache of prepared statement. In normal execution this is
-    // fine, but since we in testing set up and tear down system over and over, we'd start using
-    // obsolete prepared statements pretty quickly.
-    // Rely on query processing caching statements instead, and lets assume
-    // that a map lookup string->statement is not gonna kill us much.
-    return futurize_invoke([this, username, password] {
-        static const sstring query = format("SELECT {} FROM {} WHERE {} = ?",
-                SALTED_HASH,
-                meta::roles_table::qualified_name,
-                meta::roles_table::role_col_name);
-
-        return _qp.execute_internal(
-                query,
-                consistency_for_user(username),
-                internal_distributed_query_state(),
-                {username},
-                cql3::query_processor::cache_internal::yes);
-    }).then_wrapped([=](future<::shared_ptr<cql3::untyped_result_set>> f) {
+    // The cache is a pass-through when disabled via config, so the lookup
+    // below always ends up in read_salted_hash() eventually. Note that a
+    // failed load is not cached, so replica errors are retried on the next
+    // attempt.
+    return futurize_invoke([this, username] {
+        return _credentials_cache->get(username);
+    }).then_wrapped([=](future<sstring> f) {
         try {
-            auto res = f.get0();
-            auto salted_hash = std::optional<sstring>();
-            if (!res->empty()) {
-                salted_hash = res->one().get_opt<sstring>(SALTED_HASH);
-            }
-            if (!salted_hash || !passwords::check(password, *salted_hash)) {
+            auto salted_hash = f.get0();
+            if (salted_hash.empty() || !passwords::check(password, salted_hash)) {
                 throw exceptions::authentication_exception("Username and/or password are incorrect");
             }
             return make_ready_future<authenticated_user>(username);
@@ -245,7 +286,11 @@ future<> password_authenticator::create(std::string_view role_name, const authen
             consistency_for_user(role_name),
             internal_distributed_query_state(),
             {passwords::hash(*options.password, rng_for_salt), sstring(role_name)},
-            cql3::query_processor::cache_internal::no).discard_result();
+            cql3::query_processor::cache_internal::no).discard_result().then([this, role_name = sstring(role_name)] {
+        // Login attempts made before the role existed may have cached its
+        // absence.
+        _credentials_cache->remove(role_name);
+    });
 }
 
 future<> password_authenticator::alter(std::string_view role_name, const authentication_options& options) const {
@@ -263,7 +308,12 @@ future<> password_authenticator::alter(std::string_view role_name, const authent
             consistency_for_user(role_name),
             internal_distributed_query_state(),
             {passwords::hash(*options.password, rng_for_salt), sstring(role_name)},
-            cql3::query_processor::cache_internal::no).discard_result();
+            cql3::query_processor::cache_internal::no).discard_result().then([this, role_name = sstring(role_name)] {
+        // Drop the stale hash on this shard right away; other shards and
+        // nodes pick up the change when their cached entry is refreshed or
+        // expires.
+        _credentials_cache->remove(role_name);
+    });
 }
 
 future<> password_authenticator::drop(std::string_view name) const {
@@ -276,7 +326,9 @@ future<> password_authenticator::drop(std::string_view name) const {
             query, consistency_for_user(name),
             internal_distributed_query_state(),
             {sstring(name)},
-            cql3::query_processor::cache_internal::no).discard_result();
+            cql3::query_processor::cache_internal::no).discard_result().then([this, name = sstring(name)] {
+        _credentials_cache->remove(name);
+    });
 }
 
 future<custom_options> password_authenticator::query_custom_options(std::string_view role_name) const {
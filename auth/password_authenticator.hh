@@ -13,6 +13,9 @@
 #include <seastar/core/abort_source.hh>
 
 #include "auth/authenticator.hh"
+#include "utils/loading_cache.hh"
+#include "utils/observable.hh"
+#include "utils/serialized_action.hh"
 
 namespace cql3 {
 
@@ -29,11 +32,34 @@ namespace auth {
 extern const std::string_view password_authenticator_name;
 
 class password_authenticator : public authenticator {
+    // Salted password hashes live in a replicated system table, so under a
+    // storm of new connections every authentication round-trips to the
+    // replicas for the same handful of roles. This per-shard cache keeps the
+    // hashes of recently authenticating roles, mirroring the permissions
+    // cache. The password presented by the client is still checked against
+    // the hash on every connection; only the hash lookup is cached. Sized
+    // and refreshed by the credentials_* config options.
+    using credentials_cache_type = utils::loading_cache<
+            sstring,
+            sstring,
+            1,
+            utils::loading_cache_reload_enabled::yes,
+            utils::simple_entry_size<sstring>>;
+
     cql3::query_processor& _qp;
     ::service::migration_manager& _migration_manager;
     future<> _stopped;
     seastar::abort_source _as;
 
+    std::unique_ptr<credentials_cache_type> _credentials_cache;
+
+    std::function<void(uint32_t)> _credentials_cache_cfg_cb;
+    serialized_action _credentials_cache_config_action;
+
+    utils::observer<uint32_t> _credentials_cache_max_entries_observer;
+    utils::observer<uint32_t> _credentials_update_interval_in_ms_observer;
+    utils::observer<uint32_t> _credentials_validity_in_ms_observer;
+
 public:
     static db::consistency_level consistency_for_user(std::string_view role_name);
 
@@ -68,6 +94,12 @@ public:
     virtual ::shared_ptr<sasl_challenge> new_sasl_challenge() const override;
 
 private:
+    future<sstring> read_salted_hash(const sstring& role_name) const;
+
+    utils::loading_cache_config credentials_cache_config() const;
+
+    void update_cache_config();
+
     bool legacy_metadata_exists() const;
 
     future<> migrate_legacy_metadata() const;
@@ -10,6 +10,7 @@
 
 #include "auth/authorizer.hh"
 #include "auth/common.hh"
+#include "auth/role_manager.hh"
 #include "auth/service.hh"
 
 namespace auth {
@@ -17,7 +18,17 @@ namespace auth {
 permissions_cache::permissions_cache(const utils::loading_cache_config& c, service& ser, logging::logger& log)
         : _cache(c, log, [&ser, &log](const key_type& k) {
               log.debug("Refreshing permissions for {}", k.first);
-              return ser.get_uncached_permissions(k.first, k.second);
+              return ser.get_uncached_permissions(k.first, k.second).handle_exception_type(
+                      [&log, &k](const nonexistant_role&) {
+                  // Cache the empty permission set for a role that does not
+                  // exist (e.g. was dropped while connections authenticated as
+                  // it were still alive). A failed load is not cached, so
+                  // without this every request made by such a role would hit
+                  // the system tables again. The negative entry ages out of
+                  // the cache like any other.
+                  log.debug("Role {} doesn't exist, caching empty permissions", k.first);
+                  return permission_set();
+              });
           }) {
 }
 
@@ -35,6 +35,14 @@
 // region, and aggressively in the third region.
 //
 // The constants q1 and q2 are used to determine the proportional factor at each stage.
+//
+// On top of the proportional response, the controller is deadline-aware: it tracks how fast the
+// backlog grows between adjustments and, while it is growing, acts on the backlog projected a few
+// intervals ahead rather than the instantaneous one. The boost this gives is proportional to the
+// growth rate, so it only becomes significant when the time left until the backlog saturates is
+// comparable to the lookahead window. This lets a process facing a near deadline (a flush about
+// to hit the dirty-memory hard limit, compaction about to drown in sstables) outbid the others
+// for disk bandwidth before the limit is breached, instead of reacting after the fact.
 class backlog_controller {
 public:
     struct scheduling_group {
@@ -57,8 +65,14 @@ protected:
         float output;
     };
 
+    // How far ahead, in units of the adjustment interval, the backlog is projected when it is
+    // growing. Larger values react earlier to an approaching saturation point, at the cost of
+    // more share fluctuation on short bursts.
+    static constexpr unsigned deadline_lookahead_intervals = 20;
+
     scheduling_group _scheduling_group;
     timer<> _update_timer;
+    std::chrono::milliseconds _interval;
 
     std::vector<control_point> _control_points;
 
@@ -70,6 +84,10 @@ protected:
     // When that option is deprecated we should remove this.
     float _static_shares;
 
+    // Backlog measured by the previous adjustment, used to estimate the growth rate.
+    float _last_backlog = 0;
+    timer<>::clock::time_point _last_adjust = {};
+
     virtual void update_controller(float quota);
 
     bool controller_disabled() const noexcept {
@@ -83,6 +101,7 @@ protected:
                        float static_shares = 0)
         : _scheduling_group(std::move(sg))
         , _update_timer([this] { adjust(); })
+        , _interval(interval)
         , _control_points()
         , _current_backlog(std::move(backlog))
         , _inflight_update(make_ready_future<>())
@@ -318,8 +318,16 @@ public:
         return _size == 0;
     }
 
+    // Sizes the first chunk for an expected total write size, so that up to
+    // size bytes of writes are served by a single allocation instead of a
+    // chain of doubling chunks. Only effective on an empty stream - chunks
+    // are never resized once written to - so it must be called before the
+    // first write. Useful when the total size is known up front, e.g. when
+    // copying a serialized payload of known length.
     void reserve(size_t size) {
-        // FIXME: implement
+        if (!_current) {
+            _initial_chunk_size = std::min<size_t>(std::max<size_t>(size + sizeof(chunk), _initial_chunk_size), max_alloc_size());
+        }
     }
 
     void append(const bytes_ostream& o) {
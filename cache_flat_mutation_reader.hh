@@ -150,6 +150,18 @@ class cache_flat_mutation_reader final : public flat_mutation_reader_v2::impl {
     // forward progress is not guaranteed in case iterators are getting constantly invalidated.
     bool _lower_bound_changed = false;
 
+    // Maximum number of bytes a single fill_buffer() may insert into the cache,
+    // snapshotted from cache_tracker::population_budget(). 0 means no limit.
+    // When exhausted, the rest of the fill is served from underlying without
+    // populating and the not-yet-populated range is left non-continuous, so
+    // that later reads resume population where this one stopped. This bounds
+    // allocation pressure on the cache region when a read misses on a very
+    // large partition, which would otherwise cause eviction storms affecting
+    // unrelated reads on the shard.
+    size_t _population_budget = 0;
+    // Bytes inserted into the cache by the current fill_buffer() call.
+    size_t _population_bytes = 0;
+
     // Points to the underlying reader conforming to _schema,
     // either to *_underlying_holder or _read_context.underlying().underlying().
     flat_mutation_reader_v2* _underlying = nullptr;
@@ -175,6 +187,9 @@ class cache_flat_mutation_reader final : public flat_mutation_reader_v2::impl {
     void start_reading_from_underlying();
     bool after_current_range(position_in_partition_view position);
     bool can_populate() const;
+    bool population_budget_exhausted() const noexcept {
+        return _population_budget && _population_bytes >= _population_budget;
+    }
     // Marks the range between _last_row (exclusive) and _next_row (exclusive) as continuous,
     // provided that the underlying reader still matches the latest version of the partition.
     // Invalidates _last_row.
@@ -247,6 +262,7 @@ public:
         , _rt_gen(*_schema)
         , _rt_merger(*_schema)
     {
+        _population_budget = cache._tracker.population_budget();
         clogger.trace("csm {}: table={}.{}, reversed={}, snap={}", fmt::ptr(this), _schema->ks_name(), _schema->cf_name(), _read_context.is_reversed(),
                       fmt::ptr(&*_snp));
         push_mutation_fragment(*_schema, _permit, partition_start(std::move(dk), _snp->partition_tombstone()));
@@ -321,6 +337,9 @@ void cache_flat_mutation_reader::touch_partition() {
 
 inline
 future<> cache_flat_mutation_reader::fill_buffer() {
+    // Each fill gets a fresh population budget, so a miss on a huge partition
+    // populates the cache incrementally, a buffer's worth of rows at a time.
+    _population_bytes = 0;
     if (_state == state::before_static_row) {
         touch_partition();
         auto after_static_row = [this] {
@@ -572,6 +591,17 @@ void cache_flat_mutation_reader::maybe_add_to_cache(const clustering_row& cr) {
         _read_context.cache().on_mispopulate();
         return;
     }
+    if (population_budget_exhausted()) {
+        // Keep serving the read from underlying, but stop inserting into the
+        // cache. Clearing _last_row prevents the interval which contains the
+        // skipped rows from being marked as continuous, so a later read can
+        // resume population from where this one stopped.
+        _last_row = nullptr;
+        _population_range_starts_before_all_rows = false;
+        _read_context.cache()._tracker.on_population_budget_cutoff();
+        return;
+    }
+    _population_bytes += cr.memory_usage(*_schema);
     auto rt_opt = _rt_assembler.flush(*_schema, position_in_partition::after_key(*_schema, cr.key()));
     clogger.trace("csm {}: populate({})", fmt::ptr(this), clustering_row::printer(*_schema, cr));
     _lsa_manager.run_in_update_section_with_allocator([this, &cr, &rt_opt] {
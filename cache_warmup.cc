@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/sleep.hh>
+
+#include "cache_warmup.hh"
+#include "db/system_keyspace.hh"
+#include "dht/i_partitioner.hh"
+#include "keys.hh"
+#include "log.hh"
+#include "replica/database.hh"
+
+static logging::logger cwlogger("cache_warmup");
+
+// Caps both the size of a system.cached_partitions row and the amount of
+// linear work a single dump does inside the cache's read section. The
+// hottest partitions gravitate to the front of the LRU anyway, so cutting
+// the tail loses little.
+static constexpr size_t max_keys_per_shard = 4096;
+
+void cache_warmup_service::start_dumping() {
+    // Proceeds in the background until stop(); failures of individual
+    // dumps are logged and the next period is attempted anyway.
+    (void)with_gate(_gate, [this] {
+        return dump_fiber();
+    });
+}
+
+future<> cache_warmup_service::dump_fiber() {
+    while (true) {
+        try {
+            co_await sleep_abortable(_dump_period, _as);
+        } catch (const sleep_aborted&) {
+            co_return;
+        }
+        try {
+            co_await dump_all();
+        } catch (...) {
+            cwlogger.warn("Saving the row caches' partition keys failed: {}", std::current_exception());
+        }
+    }
+}
+
+future<> cache_warmup_service::dump_all() {
+    // Snapshot the table list; it can change under us once we yield.
+    std::vector<table_id> ids;
+    for (auto& [id, cf] : _db.local().get_column_families()) {
+        if (!db::is_system_keyspace(cf->schema()->ks_name())) {
+            ids.push_back(id);
+        }
+    }
+    for (auto id : ids) {
+        for (unsigned shard = 0; shard < smp::count; ++shard) {
+            if (_as.abort_requested()) {
+                co_return;
+            }
+            auto raw_keys = co_await _db.invoke_on(shard, [id] (replica::database& db) {
+                std::vector<bytes> raw;
+                try {
+                    auto& cf = db.find_column_family(id);
+                    for (auto& dk : cf.get_row_cache().cached_partition_keys(max_keys_per_shard)) {
+                        raw.push_back(linearized(dk.key().representation()));
+                    }
+                } catch (const replica::no_such_column_family&) {
+                    // Dropped while we were iterating; leave raw empty so
+                    // the stale record is removed below.
+                }
+                return raw;
+            });
+            co_await _sys_ks.local().save_cached_partitions(id, shard, raw_keys);
+        }
+    }
+}
+
+future<> cache_warmup_service::warm_up() {
+    return with_gate(_gate, [this] {
+        return do_warm_up();
+    });
+}
+
+future<> cache_warmup_service::do_warm_up() {
+    std::vector<table_id> ids;
+    for (auto& [id, cf] : _db.local().get_column_families()) {
+        if (!db::is_system_keyspace(cf->schema()->ks_name())) {
+            ids.push_back(id);
+        }
+    }
+    size_t warmed_partitions = 0;
+    size_t warmed_tables = 0;
+    for (auto id : ids) {
+        if (_as.abort_requested()) {
+            break;
+        }
+        auto saved = co_await _sys_ks.local().load_cached_partitions(id);
+        bool any = false;
+        for (auto& [shard, raw_keys] : saved) {
+            if (shard >= smp::count || raw_keys.empty()) {
+                // The node may have restarted with fewer shards; the
+                // orphaned partitions become warm again only once
+                // client reads touch them on their new owner.
+                continue;
+            }
+            any = true;
+            warmed_partitions += co_await _db.invoke_on(shard, [id, &raw_keys] (replica::database& db) -> future<size_t> {
+                schema_ptr s;
+                try {
+                    s = db.find_column_family(id).schema();
+                } catch (const replica::no_such_column_family&) {
+                    co_return size_t(0);
+                }
+                // Cap each read so a huge partition doesn't blow the
+                // warm-up's memory or monopolize the cache; a prefix
+                // of the partition in cache is still a win.
+                auto slice = s->full_slice();
+                slice.options.set<query::partition_slice::option::allow_short_read>();
+                size_t done = 0;
+                for (auto& raw : raw_keys) {
+                    try {
+                        auto dk = dht::decorate_key(*s, partition_key::from_bytes(raw));
+                        dht::partition_range_vector ranges;
+                        ranges.emplace_back(dht::partition_range::make_singular(std::move(dk)));
+                        auto cmd = query::read_command(s->id(), s->version(), slice, query::max_result_size(1 << 20),
+                                query::tombstone_limit::max, query::row_limit(1024));
+                        co_await db.query(s, cmd, query::result_options::only_result(), ranges, nullptr, db::no_timeout);
+                        ++done;
+                    } catch (...) {
+                        cwlogger.debug("Failed to warm up a cached partition of {}: {}", id, std::current_exception());
+                    }
+                }
+                co_return done;
+            });
+        }
+        if (any) {
+            ++warmed_tables;
+        }
+    }
+    cwlogger.info("Row cache warm-up done: {} partitions across {} tables", warmed_partitions, warmed_tables);
+}
+
+future<> cache_warmup_service::stop() {
+    if (!_as.abort_requested()) {
+        _as.request_abort();
+    }
+    return _gate.close();
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/sharded.hh>
+
+#include "replica/database_fwd.hh"
+#include "seastarx.hh"
+
+namespace db {
+class system_keyspace;
+}
+
+// Saves and restores the row caches' warm state across restarts.
+//
+// While running, periodically records the partition keys (not the data)
+// held in each table's row cache into the system.cached_partitions table.
+// After a restart, warm_up() re-reads the recorded partitions through the
+// normal read path, one key at a time, so that the caches are populated
+// with roughly the working set the node served before it went down instead
+// of starting cold.
+//
+// The saved keys are only hints: they may be stale by up to a dump period,
+// and a recorded partition may have been deleted or moved meanwhile. Both
+// cases are harmless - re-reading such a key just does a small amount of
+// wasted work - so the dump doesn't try to stay consistent with writes.
+//
+// Runs on shard 0 and reaches the other shards with invoke_on(); each
+// shard's keys are dumped from and re-read on that same shard, since the
+// row cache is per-shard.
+class cache_warmup_service {
+    sharded<replica::database>& _db;
+    sharded<db::system_keyspace>& _sys_ks;
+    std::chrono::seconds _dump_period;
+    abort_source _as;
+    gate _gate;
+
+public:
+    cache_warmup_service(sharded<replica::database>& db, sharded<db::system_keyspace>& sys_ks, std::chrono::seconds dump_period)
+        : _db(db)
+        , _sys_ks(sys_ks)
+        , _dump_period(dump_period)
+    { }
+
+    // Starts the background fiber which dumps the caches' keys every
+    // dump period, until stop().
+    void start_dumping();
+
+    // Re-reads the partitions recorded by the previous run. Meant to be
+    // run in the background during startup; stop() interrupts it.
+    future<> warm_up();
+
+    // Aborts the dump fiber and any ongoing warm-up and waits for them.
+    // Safe to call even if neither was started.
+    future<> stop();
+
+private:
+    future<> dump_all();
+    future<> dump_fiber();
+    future<> do_warm_up();
+};
@@ -8,6 +8,7 @@
 
 #include <utility>
 #include <algorithm>
+#include <unordered_set>
 
 #include <boost/range/irange.hpp>
 #include <boost/algorithm/string/predicate.hpp>
@@ -1054,16 +1055,18 @@ struct process_row_visitor {
             return;
         }
 
-        managed_bytes value = get_managed_bytes(cell);
-
-        // delta
-        if (_generate_delta_values) {
-            _builder.set_value(_log_ck, cdef, value);
-        }
-
-        // images
         if (_enable_updating_state) {
+            // The value is retained for the pre/post-image state, so we have
+            // to materialize it; the delta cell is built from a view of it.
+            managed_bytes value = get_managed_bytes(cell);
+            if (_generate_delta_values) {
+                _builder.set_value(_log_ck, cdef, value);
+            }
             update_row_state(cdef, std::move(value));
+        } else if (_generate_delta_values) {
+            // No image state to keep - build the log cell straight from the
+            // base cell's value, without an intermediate copy.
+            _builder.set_value(_log_ck, cdef, cell.value());
         }
     }
 
@@ -1578,34 +1581,75 @@ public:
             db::consistency_level write_cl,
             const mutation& m)
     {
-        auto& p = m.partition();
-        if (p.clustered_rows().empty() && p.static_row().empty()) {
+        return pre_image_select(_ctx, _schema, client_state, write_cl, std::vector<const mutation*>{&m});
+    }
+
+    // Issues one preimage/postimage select covering all the given base
+    // mutations, which must belong to the given schema (but to distinct
+    // partitions), as produced e.g. by a batch statement. The partition
+    // slice is the union of the individual mutations' clustering keys and
+    // columns, so a partition may return rows that another member of the
+    // group asked for; the caller distributes the result rows to the
+    // individual mutations' transformers by partition key, and surplus
+    // rows are ignored by the image generation.
+    static future<lw_shared_ptr<cql3::untyped_result_set>> pre_image_select(
+            db_context ctx,
+            schema_ptr schema,
+            service::client_state& client_state,
+            db::consistency_level write_cl,
+            const std::vector<const mutation*>& muts)
+    {
+        dht::partition_range_vector partition_ranges;
+        bool any_static_row = false;
+        bool any_clustered_rows = false;
+        for (const mutation* mp : muts) {
+            auto& p = mp->partition();
+            if (p.clustered_rows().empty() && p.static_row().empty()) {
+                continue;
+            }
+            any_static_row |= !p.static_row().empty();
+            any_clustered_rows |= !p.clustered_rows().empty();
+            partition_ranges.emplace_back(dht::partition_range(mp->decorated_key()));
+        }
+        if (partition_ranges.empty()) {
             return make_ready_future<lw_shared_ptr<cql3::untyped_result_set>>();
         }
 
-        dht::partition_range_vector partition_ranges{dht::partition_range(m.decorated_key())};
-
-        auto&& pc = _schema->partition_key_columns();
-        auto&& cc = _schema->clustering_key_columns();
+        auto&& pc = schema->partition_key_columns();
+        auto&& cc = schema->clustering_key_columns();
 
         std::vector<query::clustering_range> bounds;
         uint64_t row_limit = query::max_rows;
 
-        const bool has_only_static_row = !p.static_row().empty() && p.clustered_rows().empty();
+        const bool has_only_static_row = any_static_row && !any_clustered_rows;
         if (cc.empty() || has_only_static_row) {
             bounds.push_back(query::clustering_range::make_open_ended_both_sides());
-            if (has_only_static_row) {
+            if (has_only_static_row && muts.size() == 1) {
                 row_limit = 1;
             }
         } else {
-            for (const rows_entry& r : p.clustered_rows()) {
-                auto& ck = r.key();
-                bounds.push_back(query::clustering_range::make_singular(ck));
+            for (const mutation* mp : muts) {
+                for (const rows_entry& r : mp->partition().clustered_rows()) {
+                    auto& ck = r.key();
+                    bounds.push_back(query::clustering_range::make_singular(ck));
+                }
+            }
+            if (muts.size() > 1) {
+                // The slice requires its clustering ranges to be sorted and
+                // disjoint, which holds per mutation but not for their
+                // concatenation.
+                clustering_key_prefix::tri_compare cmp(*schema);
+                std::sort(bounds.begin(), bounds.end(), [&] (const query::clustering_range& a, const query::clustering_range& b) {
+                    return cmp(a.start()->value(), b.start()->value()) < 0;
+                });
+                bounds.erase(std::unique(bounds.begin(), bounds.end(), [&] (const query::clustering_range& a, const query::clustering_range& b) {
+                    return cmp(a.start()->value(), b.start()->value()) == 0;
+                }), bounds.end());
             }
         }
 
         std::vector<const column_definition*> columns;
-        columns.reserve(_schema->all_columns().size());
+        columns.reserve(schema->all_columns().size());
 
         std::transform(pc.begin(), pc.end(), std::back_inserter(columns), [](auto& c) { return &c; });
         std::transform(cc.begin(), cc.end(), std::back_inserter(columns), [](auto& c) { return &c; });
@@ -1613,60 +1657,79 @@ public:
         query::column_id_vector static_columns, regular_columns;
 
         // TODO: this assumes all mutations touch the same set of columns. This might not be true, and we may need to do more horrible set operation here.
-        if (!p.static_row().empty()) {
+        if (any_static_row) {
             // for postimage we need everything...
-            if (_schema->cdc_options().postimage() || _schema->cdc_options().full_preimage()) {
-                for (const column_definition& c: _schema->static_columns()) {
+            if (schema->cdc_options().postimage() || schema->cdc_options().full_preimage()) {
+                for (const column_definition& c: schema->static_columns()) {
                     static_columns.emplace_back(c.id);
                     columns.emplace_back(&c);
                 }
             } else {
-                p.static_row().get().for_each_cell([&] (column_id id, const atomic_cell_or_collection&) {
-                    auto& cdef =_schema->column_at(column_kind::static_column, id);
-                    static_columns.emplace_back(id);
-                    columns.emplace_back(&cdef);
-                });
+                std::unordered_set<column_id> touched;
+                for (const mutation* mp : muts) {
+                    mp->partition().static_row().get().for_each_cell([&] (column_id id, const atomic_cell_or_collection&) {
+                        touched.insert(id);
+                    });
+                }
+                for (const column_definition& c: schema->static_columns()) {
+                    if (touched.contains(c.id)) {
+                        static_columns.emplace_back(c.id);
+                        columns.emplace_back(&c);
+                    }
+                }
             }
         }
-        if (!p.clustered_rows().empty()) {
-            const bool has_row_delete = std::any_of(p.clustered_rows().begin(), p.clustered_rows().end(), [] (const rows_entry& re) {
-                return re.row().deleted_at();
+        if (any_clustered_rows) {
+            const bool has_row_delete = std::any_of(muts.begin(), muts.end(), [] (const mutation* mp) {
+                return std::any_of(mp->partition().clustered_rows().begin(), mp->partition().clustered_rows().end(), [] (const rows_entry& re) {
+                    return re.row().deleted_at();
+                });
             });
             // for postimage we need everything...
-            if (has_row_delete || _schema->cdc_options().postimage() || _schema->cdc_options().full_preimage()) {
-                for (const column_definition& c: _schema->regular_columns()) {
+            if (has_row_delete || schema->cdc_options().postimage() || schema->cdc_options().full_preimage()) {
+                for (const column_definition& c: schema->regular_columns()) {
                     regular_columns.emplace_back(c.id);
                     columns.emplace_back(&c);
                 }
             } else {
-                p.clustered_rows().begin()->row().cells().for_each_cell([&] (column_id id, const atomic_cell_or_collection&) {
-                    const auto& cdef =_schema->column_at(column_kind::regular_column, id);
-                    regular_columns.emplace_back(id);
-                    columns.emplace_back(&cdef);
-                });
+                std::unordered_set<column_id> touched;
+                for (const mutation* mp : muts) {
+                    if (mp->partition().clustered_rows().empty()) {
+                        continue;
+                    }
+                    mp->partition().clustered_rows().begin()->row().cells().for_each_cell([&] (column_id id, const atomic_cell_or_collection&) {
+                        touched.insert(id);
+                    });
+                }
+                for (const column_definition& c: schema->regular_columns()) {
+                    if (touched.contains(c.id)) {
+                        regular_columns.emplace_back(c.id);
+                        columns.emplace_back(&c);
+                    }
+                }
             }
         }
-        
-        auto selection = cql3::selection::selection::for_columns(_schema, std::move(columns));
+
+        auto selection = cql3::selection::selection::for_columns(schema, std::move(columns));
 
         auto opts = selection->get_query_options();
         opts.set(query::partition_slice::option::collections_as_maps);
-        opts.set_if<query::partition_slice::option::always_return_static_content>(!p.static_row().empty());
+        opts.set_if<query::partition_slice::option::always_return_static_content>(any_static_row);
 
         auto partition_slice = query::partition_slice(std::move(bounds), std::move(static_columns), std::move(regular_columns), std::move(opts));
-        const auto max_result_size = _ctx._proxy.get_max_result_size(partition_slice);
-        const auto tombstone_limit = query::tombstone_limit(_ctx._proxy.get_tombstone_limit());
-        auto command = ::make_lw_shared<query::read_command>(_schema->id(), _schema->version(), partition_slice, query::max_result_size(max_result_size), tombstone_limit, query::row_limit(row_limit));
+        const auto max_result_size = ctx._proxy.get_max_result_size(partition_slice);
+        const auto tombstone_limit = query::tombstone_limit(ctx._proxy.get_tombstone_limit());
+        auto command = ::make_lw_shared<query::read_command>(schema->id(), schema->version(), partition_slice, query::max_result_size(max_result_size), tombstone_limit, query::row_limit(row_limit));
 
         const auto select_cl = adjust_cl(write_cl);
 
       try {
-        return _ctx._proxy.query(_schema, std::move(command), std::move(partition_ranges), select_cl, service::storage_proxy::coordinator_query_options(default_timeout(), empty_service_permit(), client_state)).then(
-                [s = _schema, partition_slice = std::move(partition_slice), selection = std::move(selection)] (service::storage_proxy::coordinator_query_result qr) -> lw_shared_ptr<cql3::untyped_result_set> {
+        return ctx._proxy.query(schema, std::move(command), std::move(partition_ranges), select_cl, service::storage_proxy::coordinator_query_options(default_timeout(), empty_service_permit(), client_state)).then(
+                [s = schema, partition_slice = std::move(partition_slice), selection = std::move(selection)] (service::storage_proxy::coordinator_query_result qr) -> lw_shared_ptr<cql3::untyped_result_set> {
             return make_lw_shared<cql3::untyped_result_set>(*s, std::move(qr.query_result), *selection, partition_slice);
         });
       } catch (exceptions::unavailable_exception& e) {
-        // `query` can throw `unavailable_exception`, which is seen by clients as ~ "NoHostAvailable". 
+        // `query` can throw `unavailable_exception`, which is seen by clients as ~ "NoHostAvailable".
         // So, we'll translate it to a `read_failure_exception` with custom message.
         cdc_log.debug("Preimage: translating a (read) `unavailable_exception` to `request_execution_exception` - {}", e);
         throw exceptions::read_failure_exception("CDC preimage query could not achieve the CL.",
@@ -1676,10 +1739,23 @@ public:
 
     // Note: this assumes that the results are from one partition only
     void load_preimage_results_into_state(lw_shared_ptr<cql3::untyped_result_set> preimage_set, bool static_only) {
+        std::vector<const cql3::untyped_result_set_row*> rows;
+        rows.reserve(preimage_set->size());
+        for (const auto& row : *preimage_set) {
+            rows.push_back(&row);
+        }
+        load_preimage_rows_into_state(rows, static_only);
+    }
+
+    // Loads the given preimage/postimage query result rows, which must all
+    // belong to this transformer's partition. Used directly when a grouped
+    // select (see the static `pre_image_select` overload) fetched several
+    // partitions' rows in one query.
+    void load_preimage_rows_into_state(const std::vector<const cql3::untyped_result_set_row*>& rows, bool static_only) {
         // static row
-        if (!preimage_set->empty()) {
+        if (!rows.empty()) {
             // There may be some static row data
-            const auto& row = preimage_set->front();
+            const auto& row = *rows.front();
             for (auto& c : _schema->static_columns()) {
                 if (auto maybe_cell_view = get_preimage_col_value(c, &row)) {
                     _static_row_state[&c] = std::move(*maybe_cell_view);
@@ -1692,10 +1768,12 @@ public:
         }
 
         // clustering rows
-        for (const auto& row : *preimage_set) {
+        for (const auto* rowp : rows) {
+            const auto& row = *rowp;
             // Construct the clustering key for this row
             std::vector<managed_bytes> ck_parts;
             ck_parts.reserve(_schema->clustering_key_size());
+            bool has_ck = true;
             for (auto& c : _schema->clustering_key_columns()) {
                 auto v = row.get_view_opt(c.name_as_text());
                 if (!v) {
@@ -1703,12 +1781,15 @@ public:
                     // - In preimage query, we requested the static row and some clustering rows,
                     // - The partition had some static row data, but did not have any requested clustering rows.
                     // In such case, the result set will have an artificial row that only contains static columns,
-                    // but no clustering columns. In such case, we can safely return from the function,
-                    // as there will be no clustering row data to load into the state.
-                    return;
+                    // but no clustering columns. Skip it - it carries no clustering row data to load into the state.
+                    has_ck = false;
+                    break;
                 }
                 ck_parts.emplace_back(managed_bytes(*v));
             }
+            if (!has_ck) {
+                continue;
+            }
             auto ck = clustering_key::from_exploded(std::move(ck_parts));
 
             // Collect regular rows
@@ -1736,6 +1817,94 @@ public:
     }
 };
 
+// Preimage/postimage query result rows fetched by a grouped select and
+// belonging to a single base mutation's partition.
+struct grouped_preimage {
+    // Keeps the rows below alive.
+    lw_shared_ptr<cql3::untyped_result_set> result_set;
+    std::vector<const cql3::untyped_result_set_row*> rows;
+};
+
+// When a batch contains several preimage/postimage-enabled modifications of
+// the same table, fetch their preimages with a single storage_proxy query
+// per table instead of one query per mutation. Fills `out` with an entry
+// for every mutation covered by a grouped select (possibly with no rows);
+// these mutations then skip the per-mutation select. Static-row-only
+// mutations are left to the per-mutation path, which bounds their read
+// with a row limit.
+static future<> select_grouped_preimages(
+        db_context ctx,
+        std::vector<mutation>& mutations,
+        service::query_state& qs,
+        db::consistency_level write_cl,
+        tracing::trace_state_ptr tr_state,
+        std::unordered_map<size_t, grouped_preimage>& out)
+{
+    std::unordered_map<const ::schema*, std::vector<size_t>> groups;
+    for (size_t idx = 0; idx < mutations.size(); ++idx) {
+        const auto& m = mutations[idx];
+        const auto& s = *m.schema();
+        if (!s.cdc_options().enabled() || !(s.cdc_options().preimage() || s.cdc_options().postimage())) {
+            continue;
+        }
+        if (m.partition().clustered_rows().empty()) {
+            continue;
+        }
+        groups[&s].push_back(idx);
+    }
+    std::erase_if(groups, [] (const auto& g) { return g.second.size() < 2; });
+    if (groups.empty()) {
+        return make_ready_future<>();
+    }
+    return do_with(std::move(groups), [ctx, &mutations, &qs, write_cl, tr_state, &out] (auto& groups) {
+        return parallel_for_each(groups, [ctx, &mutations, &qs, write_cl, tr_state, &out] (auto& group) {
+            auto s = mutations[group.second.front()].schema();
+            std::vector<const mutation*> muts;
+            muts.reserve(group.second.size());
+            for (auto idx : group.second) {
+                muts.push_back(&mutations[idx]);
+            }
+            tracing::trace(tr_state, "CDC: Selecting preimage for {} partitions of {}.{}", muts.size(), s->ks_name(), s->cf_name());
+            return transformer::pre_image_select(ctx, s, qs.get_client_state(), write_cl, muts).then_wrapped([ctx] (future<lw_shared_ptr<cql3::untyped_result_set>> f) {
+                auto& cdc_stats = ctx._proxy.get_cdc_stats();
+                cdc_stats.counters_total.preimage_selects++;
+                if (f.failed()) {
+                    cdc_stats.counters_failed.preimage_selects++;
+                }
+                return f;
+            }).then([&mutations, &out, s, &idxs = group.second] (lw_shared_ptr<cql3::untyped_result_set> rs) {
+                for (auto idx : idxs) {
+                    out.emplace(idx, grouped_preimage{rs, {}});
+                }
+                if (!rs) {
+                    return;
+                }
+                // Distribute the result rows to the individual mutations by
+                // partition key.
+                partition_key::equality pk_eq(*s);
+                for (const auto& row : *rs) {
+                    std::vector<managed_bytes> pk_parts;
+                    pk_parts.reserve(s->partition_key_size());
+                    for (auto& c : s->partition_key_columns()) {
+                        auto v = row.get_view_opt(c.name_as_text());
+                        if (!v) {
+                            throw std::logic_error("CDC: grouped preimage result row misses a partition key column");
+                        }
+                        pk_parts.emplace_back(managed_bytes(*v));
+                    }
+                    auto pk = partition_key::from_exploded(std::move(pk_parts));
+                    for (auto idx : idxs) {
+                        if (pk_eq(pk, mutations[idx].key())) {
+                            out[idx].rows.push_back(&row);
+                            break;
+                        }
+                    }
+                }
+            });
+        });
+    });
+}
+
 template <typename Func>
 future<std::vector<mutation>>
 transform_mutations(std::vector<mutation>& muts, decltype(muts.size()) batch_size, Func&& f) {
@@ -1762,9 +1931,10 @@ cdc::cdc_service::impl::augment_mutation_call(lowres_clock::time_point timeout,
     tracing::trace(tr_state, "CDC: Started generating mutations for log rows");
     mutations.reserve(2 * mutations.size());
 
-    return do_with(std::move(mutations), service::query_state(service::client_state::for_internal_calls(), empty_service_permit()), operation_details{},
-            [this, timeout, i, tr_state = std::move(tr_state), write_cl] (std::vector<mutation>& mutations, service::query_state& qs, operation_details& details) {
-        return transform_mutations(mutations, 1, [this, &mutations, timeout, &qs, tr_state = tr_state, &details, write_cl] (int idx) mutable {
+    return do_with(std::move(mutations), service::query_state(service::client_state::for_internal_calls(), empty_service_permit()), operation_details{}, std::unordered_map<size_t, grouped_preimage>{},
+            [this, timeout, i, tr_state = std::move(tr_state), write_cl] (std::vector<mutation>& mutations, service::query_state& qs, operation_details& details, std::unordered_map<size_t, grouped_preimage>& grouped) {
+        return select_grouped_preimages(_ctxt, mutations, qs, write_cl, tr_state, grouped).then([this, timeout, &mutations, &qs, &details, &grouped, tr_state, write_cl] {
+        return transform_mutations(mutations, 1, [this, &mutations, timeout, &qs, tr_state = tr_state, &details, &grouped, write_cl] (int idx) mutable {
             auto& m = mutations[idx];
             auto s = m.schema();
 
@@ -1775,10 +1945,10 @@ cdc::cdc_service::impl::augment_mutation_call(lowres_clock::time_point timeout,
             transformer trans(_ctxt, s, m.decorated_key());
 
             auto f = make_ready_future<lw_shared_ptr<cql3::untyped_result_set>>(nullptr);
-            if (s->cdc_options().preimage() || s->cdc_options().postimage()) {
-                // Note: further improvement here would be to coalesce the pre-image selects into one
-                // iff a batch contains several modifications to the same table. Otoh, batch is rare(?)
-                // so this is premature.
+            if ((s->cdc_options().preimage() || s->cdc_options().postimage()) && !grouped.contains(idx)) {
+                // Note: when a batch contains several modifications to the same table, the
+                // pre-image selects were already coalesced by select_grouped_preimages() above
+                // and this mutation's rows are waiting in `grouped`.
                 tracing::trace(tr_state, "CDC: Selecting preimage for {}", m.decorated_key());
                 f = trans.pre_image_select(qs.get_client_state(), write_cl, m).then_wrapped([this] (future<lw_shared_ptr<cql3::untyped_result_set>> f) {
                     auto& cdc_stats = _ctxt._proxy.get_cdc_stats();
@@ -1788,11 +1958,13 @@ cdc::cdc_service::impl::augment_mutation_call(lowres_clock::time_point timeout,
                     }
                     return f;
                 });
+            } else if (grouped.contains(idx)) {
+                tracing::trace(tr_state, "CDC: Using preimage fetched by grouped select for {}", m.decorated_key());
             } else {
                 tracing::trace(tr_state, "CDC: Preimage not enabled for the table, not querying current value of {}", m.decorated_key());
             }
 
-            return f.then([trans = std::move(trans), &mutations, idx, tr_state, &details] (lw_shared_ptr<cql3::untyped_result_set> rs) mutable {
+            return f.then([trans = std::move(trans), &mutations, idx, tr_state, &details, &grouped] (lw_shared_ptr<cql3::untyped_result_set> rs) mutable {
                 auto& m = mutations[idx];
                 auto& s = m.schema();
 
@@ -1800,6 +1972,8 @@ cdc::cdc_service::impl::augment_mutation_call(lowres_clock::time_point timeout,
                     const auto& p = m.partition();
                     const bool static_only = !p.static_row().empty() && p.clustered_rows().empty();
                     trans.load_preimage_results_into_state(std::move(rs), static_only);
+                } else if (auto it = grouped.find(idx); it != grouped.end()) {
+                    trans.load_preimage_rows_into_state(it->second.rows, false);
                 }
 
                 const bool preimage = s->cdc_options().preimage();
@@ -1828,6 +2002,7 @@ cdc::cdc_service::impl::augment_mutation_call(lowres_clock::time_point timeout,
             auto tracker = make_lw_shared<cdc::operation_result_tracker>(_ctxt._proxy.get_cdc_stats(), details);
             return make_ready_future<std::tuple<std::vector<mutation>, lw_shared_ptr<cdc::operation_result_tracker>>>(std::make_tuple(std::move(mutations), std::move(tracker)));
         });
+        });
     });
 }
 
@@ -30,6 +30,7 @@
 
 #include "dht/i_partitioner.hh"
 #include "sstables/sstables.hh"
+#include "sstables/hyperloglog.hh"
 #include "sstables/sstable_writer.hh"
 #include "sstables/progress_monitor.hh"
 #include "sstables/sstables_manager.hh"
@@ -469,6 +470,7 @@ protected:
     mutation_source_metadata _ms_metadata = {};
     compaction_sstable_replacer_fn _replacer;
     run_id _run_identifier;
+    std::optional<uint32_t> _compression_chunk_length;
     ::io_priority_class _io_priority;
     // optional clone of sstable set to be used for expiration purposes, so it will be set if expiration is enabled.
     std::optional<sstable_set> _sstable_set;
@@ -499,6 +501,7 @@ protected:
         , _can_split_large_partition(descriptor.can_split_large_partition)
         , _replacer(std::move(descriptor.replacer))
         , _run_identifier(descriptor.run_identifier)
+        , _compression_chunk_length(descriptor.compression_chunk_length)
         , _io_priority(descriptor.io_priority)
         , _sstable_set(std::move(descriptor.all_sstables_snapshot))
         , _selector(_sstable_set ? _sstable_set->make_incremental_selector() : std::optional<sstable_set::incremental_selector>{})
@@ -546,6 +549,7 @@ protected:
         cfg.max_sstable_size = _max_sstable_size;
         cfg.monitor = &default_write_monitor();
         cfg.run_identifier = _run_identifier;
+        cfg.compression_chunk_length = _compression_chunk_length;
         cfg.replay_position = _rp;
         cfg.sstable_level = _sstable_level;
         return cfg;
@@ -643,6 +647,11 @@ private:
         formatted_sstables_list formatted_msg;
         auto fully_expired = _table_s.fully_expired_sstables(_sstables, gc_clock::now());
         min_max_tracker<api::timestamp_type> timestamp_tracker;
+        // Merged cardinality estimator of the input sstables, for sizing the
+        // output's bloom filter and summary. Unusable if any input lacks
+        // cardinality metadata or uses an encoding we cannot read.
+        std::optional<hll::HyperLogLog> input_cardinality;
+        bool input_cardinality_usable = true;
 
         _input_sstable_generations.reserve(_sstables.size());
         for (auto& sst : _sstables) {
@@ -666,10 +675,24 @@ private:
 
             // We also capture the sstable, so we keep it alive while the read isn't done
             ssts->insert(sst);
-            // FIXME: If the sstables have cardinality estimation bitmaps, use that
-            // for a better estimate for the number of partitions in the merged
-            // sstable than just adding up the lengths of individual sstables.
             _estimated_partitions += sst->get_estimated_key_count();
+            if (input_cardinality_usable) {
+                try {
+                    const auto& cardinality = sst->get_compaction_metadata().cardinality.elements;
+                    temporary_buffer<uint8_t> buf(cardinality.size());
+                    std::copy(cardinality.begin(), cardinality.end(), buf.get_write());
+                    auto hll = hll::HyperLogLog::from_bytes(std::move(buf));
+                    if (input_cardinality) {
+                        input_cardinality->merge(hll);
+                    } else {
+                        input_cardinality.emplace(std::move(hll));
+                    }
+                } catch (...) {
+                    log_debug("Unusable cardinality metadata in {}: {}. Falling back to summing key count estimates",
+                              sst->get_filename(), std::current_exception());
+                    input_cardinality_usable = false;
+                }
+            }
             // TODO:
             // Note that this is not fully correct. Since we might be merging sstables that originated on
             // another shard (#cpu changed), we might be comparing RP:s with differing shard ids,
@@ -685,6 +708,20 @@ private:
                       _sstables.size() - ssts->all()->size(), _sstables.size());
         }
 
+        // Summing the inputs' key counts over-estimates the number of output
+        // partitions whenever the inputs overlap, which in turn over-sizes the
+        // output's bloom filter and summary. The merged HyperLogLog accounts
+        // for partitions present in more than one input, so prefer its
+        // estimate whenever all inputs provided one.
+        if (input_cardinality_usable && input_cardinality) {
+            auto estimate = std::max(uint64_t(1), uint64_t(input_cardinality->estimate()));
+            if (estimate < _estimated_partitions) {
+                log_debug("Using merged cardinality estimate of {} partitions instead of key count sum of {}",
+                          estimate, _estimated_partitions);
+                _estimated_partitions = estimate;
+            }
+        }
+
         _compacting = std::move(ssts);
 
         _ms_metadata.min_timestamp = timestamp_tracker.min();
@@ -157,6 +157,9 @@ struct compaction_descriptor {
     bool can_split_large_partition = false;
     // Run identifier of output sstables.
     sstables::run_id run_identifier;
+    // If engaged, output sstables are compressed with this chunk length (in
+    // bytes) instead of the one from the table's compression parameters.
+    std::optional<uint32_t> compression_chunk_length;
     // The options passed down to the compaction code.
     // This also selects the kind of compaction to do.
     compaction_type_options options = compaction_type_options::make_regular();
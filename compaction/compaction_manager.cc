@@ -22,6 +22,7 @@
 #include "utils/fb_utilities.hh"
 #include "utils/UUID_gen.hh"
 #include "db/system_keyspace.hh"
+#include <atomic>
 #include <cmath>
 #include <boost/algorithm/cxx11/any_of.hpp>
 #include <boost/range/algorithm/remove_if.hpp>
@@ -531,6 +532,40 @@ inline compaction_controller make_compaction_controller(const compaction_manager
     return compaction_controller(csg, static_shares, 250ms, std::move(fn));
 }
 
+// Normalized backlog of every shard, each slot written only by its owner
+// shard and read by all. Compaction work cannot migrate between shards --
+// every shard owns its sstables -- so when skewed token ownership leaves
+// one shard with hours of backlog while its neighbors idle, the only
+// resource the node can still throw at the problem is that shard's own
+// CPU. Shards whose backlog is far above the node average therefore steer
+// their controller into its aggressive region earlier.
+static std::vector<std::atomic<float>>& shard_normalized_backlogs() {
+    static std::vector<std::atomic<float>> backlogs(smp::count);
+    return backlogs;
+}
+
+// Returns the controller input, possibly boosted when this shard is the
+// node's compaction critical path.
+static float boost_backlog_for_skew(float b) {
+    auto& backlogs = shard_normalized_backlogs();
+    backlogs[this_shard_id()].store(b, std::memory_order_relaxed);
+    float total = 0;
+    for (const auto& sb : backlogs) {
+        total += sb.load(std::memory_order_relaxed);
+    }
+    auto average = total / smp::count;
+    constexpr float skew_threshold = 2.0f; // in units of the node average
+    constexpr float max_boost = 2.0f;
+    if (average > 0) {
+        auto skew = b / average;
+        if (skew > skew_threshold) {
+            b = std::min(b * std::min(skew / skew_threshold, max_boost),
+                         float(compaction_controller::normalization_factor));
+        }
+    }
+    return b;
+}
+
 compaction_manager::compaction_state::~compaction_state() {
     compaction_done.broken();
 }
@@ -657,7 +692,7 @@ compaction_manager::compaction_manager(config cfg, abort_source& as)
             // all strategies.
             return compaction_controller::normalization_factor;
         }
-        return b;
+        return boost_backlog_for_skew(b);
     }))
     , _backlog_manager(_compaction_controller)
     , _early_abort_subscription(as.subscribe([this] () noexcept {
@@ -760,10 +795,29 @@ future<> compaction_manager::postponed_compactions_reevaluation() {
         }
         // A task_state being reevaluated can re-insert itself into postponed list, which is the reason
         // for moving the list to be processed into a local.
-        auto postponed = std::exchange(_postponed, {});
+        auto postponed_set = std::exchange(_postponed, {});
+        // Resubmit the tables whose sstables currently serve the most reads
+        // first, so the compactions which reduce the most read fan-out get
+        // hold of the compaction concurrency before the cold ones.
+        auto table_hotness = [] (compaction::table_state* t) {
+            double hotness = 0;
+            t->main_sstable_set().for_each_sstable([&hotness] (const sstables::shared_sstable& sst) {
+                hotness += sst->read_hotness();
+            });
+            return hotness;
+        };
+        std::vector<std::pair<double, compaction::table_state*>> postponed;
+        postponed.reserve(postponed_set.size());
+        for (compaction::table_state* t : postponed_set) {
+            postponed.emplace_back(table_hotness(t), t);
+        }
+        postponed_set.clear();
+        std::sort(postponed.begin(), postponed.end(), [] (const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
         try {
             for (auto it = postponed.begin(); it != postponed.end();) {
-                compaction::table_state* t = *it;
+                compaction::table_state* t = it->second;
                 it = postponed.erase(it);
                 // skip reevaluation of a table_state that became invalid post its removal
                 if (!_compaction_state.contains(t)) {
@@ -775,7 +829,9 @@ future<> compaction_manager::postponed_compactions_reevaluation() {
                 co_await coroutine::maybe_yield();
             }
         } catch (...) {
-            _postponed.insert(postponed.begin(), postponed.end());
+            for (const auto& [hotness, t] : postponed) {
+                _postponed.insert(t);
+            }
         }
     }
 }
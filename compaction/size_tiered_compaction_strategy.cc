@@ -12,6 +12,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/adaptors.hpp>
 #include <boost/range/algorithm.hpp>
+#include <boost/range/numeric.hpp>
 
 namespace sstables {
 
@@ -29,6 +30,12 @@ size_tiered_compaction_strategy_options::size_tiered_compaction_strategy_options
 
     tmp_value = compaction_strategy_impl::get_value(options, COLD_READS_TO_OMIT_KEY);
     cold_reads_to_omit = property_definitions::to_double(COLD_READS_TO_OMIT_KEY, tmp_value, DEFAULT_COLD_READS_TO_OMIT);
+
+    tmp_value = compaction_strategy_impl::get_value(options, SSTABLE_SIZE_IN_MB_KEY);
+    auto max_sstable_size_in_mb = property_definitions::to_long(SSTABLE_SIZE_IN_MB_KEY, tmp_value, 0);
+    if (max_sstable_size_in_mb > 0) {
+        max_sstable_bytes = uint64_t(max_sstable_size_in_mb) * 1024 * 1024;
+    }
 }
 
 size_tiered_compaction_strategy_options::size_tiered_compaction_strategy_options() {
@@ -117,16 +124,25 @@ size_tiered_compaction_strategy::most_interesting_bucket(std::vector<std::vector
     std::vector<bucket_t> pruned_buckets;
     pruned_buckets.reserve(buckets.size());
 
-    // FIXME: add support to get hotness for each bucket.
+    auto bucket_hotness = [] (const bucket_t& bucket) {
+        return boost::accumulate(bucket | boost::adaptors::transformed([] (const sstables::shared_sstable& sst) {
+            return sst->read_hotness();
+        }), double(0));
+    };
 
     for (auto& bucket : buckets) {
-        // FIXME: the coldest sstables will be trimmed to meet the threshold, so we must add support to this feature
-        // by converting SizeTieredCompactionStrategy::trimToThresholdWithHotness.
-        // By the time being, we will only compact buckets that meet the threshold.
         if (!is_bucket_interesting(bucket, min_threshold)) {
             continue;
         }
-        bucket.resize(std::min(bucket.size(), size_t(max_threshold)));
+        if (bucket.size() > size_t(max_threshold)) {
+            // Trim the coldest sstables to meet the threshold
+            // (SizeTieredCompactionStrategy::trimToThresholdWithHotness).
+            std::partial_sort(bucket.begin(), bucket.begin() + max_threshold, bucket.end(),
+                    [] (const sstables::shared_sstable& i, const sstables::shared_sstable& j) {
+                return i->read_hotness() > j->read_hotness();
+            });
+            bucket.resize(max_threshold);
+        }
         pruned_buckets.push_back(std::move(bucket));
     }
 
@@ -134,14 +150,32 @@ size_tiered_compaction_strategy::most_interesting_bucket(std::vector<std::vector
         return std::vector<sstables::shared_sstable>();
     }
 
-    // Pick the bucket with more elements, as efficiency of same-tier compactions increases with number of files.
-    auto& max = *std::max_element(pruned_buckets.begin(), pruned_buckets.end(), [] (const bucket_t& i, const bucket_t& j) {
-        // FIXME: ignoring hotness by the time being.
+    // Prefer the bucket whose sstables currently serve the most reads, so
+    // compaction reduces read fan-out where it hurts; with no read activity
+    // to tell buckets apart, pick the one with more elements, as efficiency
+    // of same-tier compactions increases with number of files.
+    auto& max = *std::max_element(pruned_buckets.begin(), pruned_buckets.end(), [&] (const bucket_t& i, const bucket_t& j) {
+        auto i_hotness = bucket_hotness(i);
+        auto j_hotness = bucket_hotness(j);
+        if (i_hotness != j_hotness) {
+            return i_hotness < j_hotness;
+        }
         return i.size() < j.size();
     });
     return std::move(max);
 }
 
+compaction_descriptor
+size_tiered_compaction_strategy::make_compaction_job(std::vector<sstables::shared_sstable> sstables) const {
+    compaction_descriptor desc(std::move(sstables), service::get_local_compaction_priority(),
+            compaction_descriptor::default_level, _options.max_sstable_bytes);
+    // A size bound cannot always be respected at a partition boundary, so
+    // when one is set, allow the compacted-fragments writer to split a large
+    // partition across adjacent fragments of the output run.
+    desc.can_split_large_partition = _options.max_sstable_bytes != compaction_descriptor::default_max_sstable_bytes;
+    return desc;
+}
+
 compaction_descriptor
 size_tiered_compaction_strategy::get_sstables_for_compaction(table_state& table_s, strategy_control& control, std::vector<sstables::shared_sstable> candidates) {
     // make local copies so they can't be changed out from under us mid-method
@@ -155,13 +189,13 @@ size_tiered_compaction_strategy::get_sstables_for_compaction(table_state& table_
 
     if (is_any_bucket_interesting(buckets, min_threshold)) {
         std::vector<sstables::shared_sstable> most_interesting = most_interesting_bucket(std::move(buckets), min_threshold, max_threshold);
-        return sstables::compaction_descriptor(std::move(most_interesting), service::get_local_compaction_priority());
+        return make_compaction_job(std::move(most_interesting));
     }
 
     // If we are not enforcing min_threshold explicitly, try any pair of SStables in the same tier.
     if (!table_s.compaction_enforce_min_threshold() && is_any_bucket_interesting(buckets, 2)) {
         std::vector<sstables::shared_sstable> most_interesting = most_interesting_bucket(std::move(buckets), 2, max_threshold);
-        return sstables::compaction_descriptor(std::move(most_interesting), service::get_local_compaction_priority());
+        return make_compaction_job(std::move(most_interesting));
     }
 
     // if there is no sstable to compact in standard way, try compacting single sstable whose droppable tombstone
@@ -181,11 +215,21 @@ size_tiered_compaction_strategy::get_sstables_for_compaction(table_state& table_
         auto it = std::min_element(sstables.begin(), sstables.end(), [] (auto& i, auto& j) {
             return i->get_stats_metadata().min_timestamp < j->get_stats_metadata().min_timestamp;
         });
-        return sstables::compaction_descriptor({ *it }, service::get_local_compaction_priority());
+        return make_compaction_job({ *it });
     }
     return sstables::compaction_descriptor();
 }
 
+compaction_descriptor
+size_tiered_compaction_strategy::get_major_compaction_job(table_state& table_s, std::vector<sstables::shared_sstable> candidates) {
+    if (candidates.empty()) {
+        return compaction_descriptor();
+    }
+    auto desc = make_major_compaction_job(std::move(candidates), compaction_descriptor::default_level, _options.max_sstable_bytes);
+    desc.can_split_large_partition = _options.max_sstable_bytes != compaction_descriptor::default_max_sstable_bytes;
+    return desc;
+}
+
 int64_t size_tiered_compaction_strategy::estimated_pending_compactions(const std::vector<sstables::shared_sstable>& sstables,
         int min_threshold, int max_threshold, size_tiered_compaction_strategy_options options) {
     int64_t n = 0;
@@ -26,11 +26,18 @@ class size_tiered_compaction_strategy_options {
     const sstring BUCKET_LOW_KEY = "bucket_low";
     const sstring BUCKET_HIGH_KEY = "bucket_high";
     const sstring COLD_READS_TO_OMIT_KEY = "cold_reads_to_omit";
+    const sstring SSTABLE_SIZE_IN_MB_KEY = "sstable_size_in_mb";
 
     uint64_t min_sstable_size = DEFAULT_MIN_SSTABLE_SIZE;
     double bucket_low = DEFAULT_BUCKET_LOW;
     double bucket_high = DEFAULT_BUCKET_HIGH;
     double cold_reads_to_omit =  DEFAULT_COLD_READS_TO_OMIT;
+    // Threshold size for output sstables, unbounded by default. When set,
+    // compaction produces a run of bounded fragments instead of a single
+    // sstable as large as all its inputs combined, so the temporary space
+    // taken by a compaction is bounded by the fragment size rather than by
+    // the size of the whole tier.
+    uint64_t max_sstable_bytes = compaction_descriptor::default_max_sstable_bytes;
 public:
     size_tiered_compaction_strategy_options(const std::map<sstring, sstring>& options);
 
@@ -104,6 +111,10 @@ class size_tiered_compaction_strategy : public compaction_strategy_impl {
             return this->is_bucket_interesting(bucket, min_threshold);
         });
     }
+
+    // Creates a regular compaction job for a set of input sstables, bounding
+    // the size of output fragments if sstable_size_in_mb is set.
+    compaction_descriptor make_compaction_job(std::vector<sstables::shared_sstable> sstables) const;
 public:
     size_tiered_compaction_strategy() = default;
 
@@ -112,6 +123,8 @@ public:
 
     virtual compaction_descriptor get_sstables_for_compaction(table_state& table_s, strategy_control& control, std::vector<sstables::shared_sstable> candidates) override;
 
+    virtual compaction_descriptor get_major_compaction_job(table_state& table_s, std::vector<sstables::shared_sstable> candidates) override;
+
     virtual std::vector<compaction_descriptor> get_cleanup_compaction_jobs(table_state& table_s, std::vector<shared_sstable> candidates) const override;
 
     static int64_t estimated_pending_compactions(const std::vector<sstables::shared_sstable>& sstables,
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <seastar/core/aligned_buffer.hh>
+#include <seastar/core/align.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+
+#include "compress.hh"
+#include "log.hh"
+#include "throughput_calibration.hh"
+
+namespace sstables {
+
+static logging::logger calibration_logger("compaction_calibration");
+
+static constexpr size_t disk_alignment = 4096;
+
+// Fills the buffer with data that compresses roughly 2:1, like typical
+// serialized rows do - all-zero or purely random data would make the
+// compressor either trivially fast or pure overhead and skew the measurement.
+static void fill_sample_data(char* buf, size_t len) {
+    std::minstd_rand engine(42);
+    std::uniform_int_distribution<int> dist(0, 63);
+    for (size_t i = 0; i < len; ++i) {
+        buf[i] = char('0' + dist(engine) % 64);
+    }
+}
+
+future<uint32_t> calibrate_compaction_throughput(sstring dir, uint64_t sample_bytes) {
+    using clock = std::chrono::steady_clock;
+
+    compression_parameters cp;
+    auto compressor = cp.get_compressor();
+    const size_t chunk_len = cp.chunk_length();
+    // Chunks are written at a fixed, aligned stride so the read phase knows
+    // where to find them without an index.
+    const size_t stride = align_up(compressor->compress_max_size(chunk_len), disk_alignment);
+
+    auto path = dir + "/.compaction_calibration";
+    auto f = co_await open_file_dma(path, open_flags::rw | open_flags::create | open_flags::truncate);
+
+    std::exception_ptr ex;
+    uint32_t result = 0;
+    try {
+        auto input = allocate_aligned_buffer<char>(chunk_len, disk_alignment);
+        fill_sample_data(input.get(), chunk_len);
+        auto compressed = allocate_aligned_buffer<char>(stride, disk_alignment);
+        std::vector<size_t> chunk_sizes;
+
+        // Write phase: compress and sequentially write, like the compaction
+        // writer does.
+        auto write_start = clock::now();
+        uint64_t processed = 0;
+        uint64_t pos = 0;
+        while (processed < sample_bytes) {
+            size_t clen = compressor->compress(input.get(), chunk_len, compressed.get(), stride);
+            chunk_sizes.push_back(clen);
+            co_await f.dma_write(pos, compressed.get(), align_up(clen, disk_alignment));
+            pos += stride;
+            processed += chunk_len;
+        }
+        co_await f.flush();
+        auto write_seconds = std::chrono::duration<double>(clock::now() - write_start).count();
+
+        // Read phase: sequentially read back and decompress, like the
+        // compaction readers do.
+        auto output = allocate_aligned_buffer<char>(chunk_len, disk_alignment);
+        auto read_start = clock::now();
+        pos = 0;
+        for (size_t clen : chunk_sizes) {
+            co_await f.dma_read(pos, compressed.get(), align_up(clen, disk_alignment));
+            compressor->uncompress(compressed.get(), clen, output.get(), chunk_len);
+            pos += stride;
+        }
+        auto read_seconds = std::chrono::duration<double>(clock::now() - read_start).count();
+
+        double mb = double(processed) / (1 << 20);
+        double write_mbs = mb / write_seconds;
+        double read_mbs = mb / read_seconds;
+        // Compaction reads every byte it writes, so the sustainable rate is
+        // the harmonic combination of the two.
+        double combined_mbs = 1.0 / (1.0 / write_mbs + 1.0 / read_mbs);
+        calibration_logger.info("measured sequential throughput: write {:.0f} MB/s, read {:.0f} MB/s, sustainable compaction rate {:.0f} MB/s",
+                write_mbs, read_mbs, combined_mbs);
+        result = std::max<uint32_t>(1, uint32_t(combined_mbs));
+    } catch (...) {
+        ex = std::current_exception();
+    }
+
+    co_await f.close();
+    co_await remove_file(path);
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return result;
+}
+
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+#include "seastarx.hh"
+
+namespace sstables {
+
+// Measures the sequential throughput achievable by compaction on the disk
+// backing `dir` by pushing `sample_bytes` of synthetic data through the
+// default sstable compressor into a temporary file and reading it back.
+// Returns the sustainable compaction rate in MB/s - the harmonic combination
+// of the measured write and read rates, since compaction reads every byte it
+// writes. The temporary file is removed before the future resolves.
+//
+// Meant to be called once at startup, before the compaction manager is
+// configured; the result seeds compaction_throughput_mb_per_sec when
+// autotuning is enabled.
+future<uint32_t> calibrate_compaction_throughput(sstring dir, uint64_t sample_bytes);
+
+}
@@ -8,9 +8,11 @@
 
 #include "time_window_compaction_strategy.hh"
 #include "leveled_manifest.hh"
+#include "sstables/sstables_manager.hh"
 #include "mutation_writer/timestamp_based_splitting_writer.hh"
 #include "mutation_source_metadata.hh"
 
+#include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/range/algorithm/find.hpp>
 #include <boost/range/algorithm/remove_if.hpp>
 #include <boost/range/algorithm/min_element.hpp>
@@ -58,6 +60,34 @@ time_window_compaction_strategy_options::time_window_compaction_strategy_options
         }
     }
 
+    it = options.find(COLD_CACHE_EVICTION_WINDOWS_KEY);
+    if (it != options.end()) {
+        int windows = 0;
+        try {
+            windows = std::stoi(it->second);
+        } catch (const std::exception& e) {
+            throw exceptions::syntax_exception(sstring("Invalid integer value ") + it->second + " for " + COLD_CACHE_EVICTION_WINDOWS_KEY);
+        }
+        if (windows < 0) {
+            throw exceptions::configuration_exception(fmt::format("{} must not be negative for {}", windows, COLD_CACHE_EVICTION_WINDOWS_KEY));
+        }
+        cold_cache_eviction_windows = windows;
+    }
+
+    it = options.find(COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY);
+    if (it != options.end()) {
+        int chunk_length_in_kb = 0;
+        try {
+            chunk_length_in_kb = std::stoi(it->second);
+        } catch (const std::exception& e) {
+            throw exceptions::syntax_exception(sstring("Invalid integer value ") + it->second + " for " + COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY);
+        }
+        if (chunk_length_in_kb < 0 || (chunk_length_in_kb & (chunk_length_in_kb - 1))) {
+            throw exceptions::configuration_exception(fmt::format("{} must be a power of two for {}", chunk_length_in_kb, COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY));
+        }
+        cold_compression_chunk_length_in_kb = chunk_length_in_kb;
+    }
+
     it = options.find(TIMESTAMP_RESOLUTION_KEY);
     if (it != options.end()) {
         if (!valid_timestamp_resolutions.contains(it->second)) {
@@ -245,7 +275,9 @@ time_window_compaction_strategy::get_sstables_for_compaction(table_state& table_
 
     auto compaction_candidates = get_next_non_expired_sstables(table_s, control, std::move(candidates), compaction_time);
     clogger.debug("[{}] Going to compact {} non-expired sstables", fmt::ptr(this), compaction_candidates.size());
-    return compaction_descriptor(std::move(compaction_candidates), service::get_local_compaction_priority());
+    auto descriptor = compaction_descriptor(std::move(compaction_candidates), service::get_local_compaction_priority());
+    maybe_set_cold_compression_chunk_length(descriptor);
+    return descriptor;
 }
 
 time_window_compaction_strategy::bucket_compaction_mode
@@ -295,10 +327,57 @@ time_window_compaction_strategy::get_compaction_candidates(table_state& table_s,
 
     update_estimated_compaction_by_tasks(p.first, table_s.min_compaction_threshold(), table_s.schema()->max_compaction_threshold());
 
+    maybe_mark_cold_sstables(p.first);
+
     return newest_bucket(table_s, control, std::move(p.first), table_s.min_compaction_threshold(), table_s.schema()->max_compaction_threshold(),
         _highest_window_seen);
 }
 
+void
+time_window_compaction_strategy::maybe_mark_cold_sstables(const std::map<timestamp_type, std::vector<shared_sstable>>& buckets) {
+    if (!_options.cold_cache_eviction_windows || !_highest_window_seen) {
+        return;
+    }
+    using namespace std::chrono;
+    auto window_size_in_us = duration_cast<microseconds>(_options.sstable_window_size).count();
+    auto cold_bound = _highest_window_seen - timestamp_type(_options.cold_cache_eviction_windows) * window_size_in_us;
+    std::unordered_set<generation_type> cold_generations;
+    for (auto& [key, bucket] : buckets) {
+        // buckets are ordered by window lower bound, oldest first
+        if (key >= cold_bound) {
+            break;
+        }
+        for (auto& sst : bucket) {
+            cold_generations.insert(sst->generation());
+            if (!_cold_marked.contains(sst->generation())) {
+                clogger.debug("[{}] Evicting caches of cold sstable {} in window {}", fmt::ptr(this), sst->get_filename(), key);
+                sst->manager().mark_cold(sst);
+            }
+        }
+    }
+    // Forget generations that are no longer among the candidates (compacted
+    // or deleted), so the set doesn't grow without bound.
+    _cold_marked = std::move(cold_generations);
+}
+
+void
+time_window_compaction_strategy::maybe_set_cold_compression_chunk_length(compaction_descriptor& desc) const {
+    if (!_options.cold_compression_chunk_length_in_kb || desc.sstables.empty() || !_highest_window_seen) {
+        return;
+    }
+    // The active window keeps the schema's chunk length, since it still
+    // serves the bulk of the point reads. A compaction whose inputs all
+    // belong to older windows produces a long-lived, rarely-read sstable,
+    // which is better off with the larger chunks.
+    auto all_cold = boost::algorithm::all_of(desc.sstables, [this] (const shared_sstable& sst) {
+        auto ts = to_timestamp_type(_options.timestamp_resolution, sst->get_stats_metadata().max_timestamp);
+        return get_window_lower_bound(_options.sstable_window_size, ts) < _highest_window_seen;
+    });
+    if (all_cold) {
+        desc.compression_chunk_length = _options.cold_compression_chunk_length_in_kb * 1024;
+    }
+}
+
 timestamp_type
 time_window_compaction_strategy::get_window_lower_bound(std::chrono::seconds sstable_window_size, timestamp_type timestamp) {
     using namespace std::chrono;
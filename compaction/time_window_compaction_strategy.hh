@@ -16,6 +16,7 @@
 #include "timestamp.hh"
 #include "exceptions/exceptions.hh"
 #include "sstables/shared_sstable.hh"
+#include "sstables/generation_type.hh"
 #include "service/priority_manager.hh"
 
 namespace sstables {
@@ -36,6 +37,8 @@ public:
     static constexpr auto COMPACTION_WINDOW_UNIT_KEY = "compaction_window_unit";
     static constexpr auto COMPACTION_WINDOW_SIZE_KEY = "compaction_window_size";
     static constexpr auto EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS_KEY = "expired_sstable_check_frequency_seconds";
+    static constexpr auto COLD_CACHE_EVICTION_WINDOWS_KEY = "cold_cache_eviction_windows";
+    static constexpr auto COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY = "cold_compression_chunk_length_in_kb";
 private:
     const std::unordered_map<sstring, std::chrono::seconds> valid_window_units = { { "MINUTES", 60s }, { "HOURS", 3600s }, { "DAYS", 86400s } };
 
@@ -51,12 +54,25 @@ private:
     std::chrono::seconds sstable_window_size = DEFAULT_COMPACTION_WINDOW_UNIT * DEFAULT_COMPACTION_WINDOW_SIZE;
     db_clock::duration expired_sstable_check_frequency = DEFAULT_EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS();
     timestamp_resolutions timestamp_resolution = timestamp_resolutions::microsecond;
+    // Number of windows behind the most recent one after which an sstable is
+    // considered cold and its in-memory index caches are gently evicted, so
+    // rarely-read historical windows don't take memory away from the hot
+    // ones. 0 (the default) disables the eviction.
+    unsigned cold_cache_eviction_windows = 0;
+    // Compression chunk length (in KB) used for sstables written by
+    // compactions whose inputs all sit behind the most recent window.
+    // Those sstables are long-lived and rarely point-read, so larger
+    // chunks trade a little read amplification for a better compression
+    // ratio. 0 (the default) keeps the schema's chunk length everywhere.
+    unsigned cold_compression_chunk_length_in_kb = 0;
 public:
     time_window_compaction_strategy_options(const time_window_compaction_strategy_options&);
     time_window_compaction_strategy_options(time_window_compaction_strategy_options&&);
     time_window_compaction_strategy_options(const std::map<sstring, sstring>& options);
 
     std::chrono::seconds get_sstable_window_size() const { return sstable_window_size; }
+    unsigned get_cold_cache_eviction_windows() const { return cold_cache_eviction_windows; }
+    unsigned get_cold_compression_chunk_length_in_kb() const { return cold_compression_chunk_length_in_kb; }
 
     friend class time_window_compaction_strategy;
     friend class time_window_backlog_tracker;
@@ -72,6 +88,9 @@ class time_window_compaction_strategy : public compaction_strategy_impl {
     timestamp_type _highest_window_seen = 0;
     // Keep track of all recent active windows that still need to be compacted into a single SSTable
     std::unordered_set<timestamp_type> _recent_active_windows;
+    // Sstables already hinted as cold to the sstables manager, so their
+    // caches aren't re-evicted on every compaction poll.
+    std::unordered_set<generation_type> _cold_marked;
     size_tiered_compaction_strategy_options _stcs_options;
 public:
     // The maximum amount of buckets we segregate data into when writing into sstables.
@@ -112,6 +131,16 @@ private:
     get_next_non_expired_sstables(table_state& table_s, strategy_control& control, std::vector<shared_sstable> non_expiring_sstables, gc_clock::time_point compaction_time);
 
     std::vector<shared_sstable> get_compaction_candidates(table_state& table_s, strategy_control& control, std::vector<shared_sstable> candidate_sstables);
+
+    // Hints the sstables manager to evict the in-memory index caches of
+    // sstables sitting in windows more than cold_cache_eviction_windows
+    // behind the most recent one. No-op unless the option is set.
+    void maybe_mark_cold_sstables(const std::map<timestamp_type, std::vector<shared_sstable>>& buckets);
+
+    // Makes the descriptor write its output with the configured cold chunk
+    // length if every input sstable belongs to a window older than the most
+    // recent one. No-op unless cold_compression_chunk_length_in_kb is set.
+    void maybe_set_cold_compression_chunk_length(compaction_descriptor& desc) const;
 public:
     // Find the lowest timestamp for window of given size
     static timestamp_type
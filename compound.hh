@@ -25,8 +25,10 @@ class compound_type final {
 private:
     const std::vector<data_type> _types;
     const bool _byte_order_equal;
-    const bool _byte_order_comparable;
-    const bool _is_reversed;
+    // Engaged (non-empty) when every component type has a fixed-width,
+    // byte-order comparable serialized form, allowing compare() to walk the
+    // raw bytes without dispatching to the component types.
+    const std::vector<abstract_type::byte_order_comparable_layout> _memcmp_layout;
 public:
     static constexpr bool is_prefixable = AllowPrefixes == allow_prefixes::yes;
     using prefix_type = compound_type<allow_prefixes::yes>;
@@ -38,8 +40,7 @@ public:
         , _byte_order_equal(std::all_of(_types.begin(), _types.end(), [] (const auto& t) {
                 return t->is_byte_order_equal();
             }))
-        , _byte_order_comparable(false)
-        , _is_reversed(_types.size() == 1 && _types[0]->is_reversed())
+        , _memcmp_layout(make_memcmp_layout(_types))
     { }
 
     compound_type(compound_type&&) = default;
@@ -56,6 +57,61 @@ public:
         return prefix_type(_types);
     }
 private:
+    static std::vector<abstract_type::byte_order_comparable_layout> make_memcmp_layout(const std::vector<data_type>& types) {
+        std::vector<abstract_type::byte_order_comparable_layout> layout;
+        layout.reserve(types.size());
+        for (auto&& t : types) {
+            auto l = t->byte_order_comparable_fixed_layout();
+            if (!l) {
+                return {};
+            }
+            layout.push_back(*l);
+        }
+        return layout;
+    }
+
+    // Compares keys whose component types all have a fixed-width,
+    // byte-order comparable serialized form without dispatching to the
+    // component types. Returns disengaged when either key doesn't match the
+    // precomputed layout - an empty (zero-length) component value, which
+    // sorts before all proper values, is still legal for fixed-width types -
+    // in which case the caller must take the generic path.
+    std::optional<std::strong_ordering> try_compare_fixed_layout(bytes_view b1, bytes_view b2) const {
+        for (auto&& l : _memcmp_layout) {
+            if (b1.empty() || b2.empty()) {
+                // One of the keys is a proper prefix of the other; the
+                // prefix sorts first, like in the generic path.
+                break;
+            }
+            if (b1.size() < sizeof(size_type) + l.value_length || b2.size() < sizeof(size_type) + l.value_length) {
+                return std::nullopt;
+            }
+            const auto len1 = read_simple<size_type>(b1);
+            const auto len2 = read_simple<size_type>(b2);
+            if (len1 != l.value_length || len2 != l.value_length) {
+                return std::nullopt;
+            }
+            auto c = std::strong_ordering::equal;
+            if (l.flip_sign) {
+                c = (uint8_t(b1.front()) ^ 0x80u) <=> (uint8_t(b2.front()) ^ 0x80u);
+            }
+            if (c == 0) {
+                c = compare_unsigned(b1.substr(0, l.value_length), b2.substr(0, l.value_length));
+            }
+            if (c != 0) {
+                if (l.reversed) {
+                    return c < 0 ? std::strong_ordering::greater : std::strong_ordering::less;
+                }
+                return c;
+            }
+            b1.remove_prefix(l.value_length);
+            b2.remove_prefix(l.value_length);
+        }
+        // Exhausted one of the keys or all the components; mirrors the
+        // relations lexicographical_tri_compare() ends with.
+        return int(b2.empty()) <=> int(b1.empty());
+    }
+
     /*
      * Format:
      *   <len(value1)><value1><len(value2)><value2>...<len(value_n)><value_n>
@@ -243,11 +299,9 @@ public:
         });
     }
     std::strong_ordering compare(bytes_view b1, bytes_view b2) const {
-        if (_byte_order_comparable) {
-            if (_is_reversed) {
-                return compare_unsigned(b2, b1);
-            } else {
-                return compare_unsigned(b1, b2);
+        if (!_memcmp_layout.empty()) {
+            if (auto res = try_compare_fixed_layout(b1, b2)) {
+                return *res;
             }
         }
         return lexicographical_tri_compare(_types.begin(), _types.end(),
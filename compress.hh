@@ -100,6 +100,7 @@ public:
 
     compressor_ptr get_compressor() const { return _compressor; }
     int32_t chunk_length() const { return _chunk_length.value_or(int(DEFAULT_CHUNK_LENGTH)); }
+    void set_chunk_length(int32_t chunk_length) { _chunk_length = chunk_length; }
     double crc_check_chance() const { return _crc_check_chance.value_or(double(DEFAULT_CRC_CHECK_CHANCE)); }
 
     void validate();
@@ -399,6 +399,7 @@ scylla_tests = set([
     'test/boost/hash_test',
     'test/boost/hashers_test',
     'test/boost/hint_test',
+    'test/boost/hyperloglog_test',
     'test/boost/idl_test',
     'test/boost/input_stream_test',
     'test/boost/json_cql_query_test',
@@ -410,6 +411,7 @@ scylla_tests = set([
     'test/boost/linearizing_input_stream_test',
     'test/boost/loading_cache_test',
     'test/boost/log_heap_test',
+    'test/boost/lru_test',
     'test/boost/estimated_histogram_test',
     'test/boost/summary_test',
     'test/boost/logalloc_test',
@@ -657,8 +659,10 @@ scylla_raft_core = [
 ]
 
 scylla_core = (['message/messaging_service.cc',
+                'message/zstd_rpc_compressor.cc',
                 'replica/database.cc',
                 'replica/table.cc',
+                'replica/query_result_cache.cc',
                 'replica/distributed_loader.cc',
                 'replica/memtable.cc',
                 'replica/exceptions.cc',
@@ -678,6 +682,8 @@ scylla_core = (['message/messaging_service.cc',
                 'mutation_fragment.cc',
                 'partition_version.cc',
                 'row_cache.cc',
+                'cache_warmup.cc',
+                'db/compressed_cache_tier.cc',
                 'canonical_mutation.cc',
                 'frozen_mutation.cc',
                 'schema_mutations.cc',
@@ -723,7 +729,9 @@ scylla_core = (['message/messaging_service.cc',
                 'compaction/leveled_compaction_strategy.cc',
                 'compaction/time_window_compaction_strategy.cc',
                 'compaction/compaction_manager.cc',
+                'compaction/throughput_calibration.cc',
                 'sstables/integrity_checked_file_impl.cc',
+                'sstables/encrypted_file_impl.cc',
                 'sstables/prepended_input_stream.cc',
                 'sstables/m_format_read_helpers.cc',
                 'sstables/sstable_directory.cc',
@@ -989,6 +997,7 @@ scylla_core = (['message/messaging_service.cc',
                 'auth/sasl_challenge.cc',
                 'tracing/tracing.cc',
                 'tracing/trace_keyspace_helper.cc',
+                'tracing/trace_ringbuf_helper.cc',
                 'tracing/trace_state.cc',
                 'tracing/traced_file.cc',
                 'table_helper.cc',
@@ -1074,6 +1083,8 @@ api = ['api/api.cc',
        Json2Code('api/api-doc/config.json'),
        'api/error_injection.cc',
        Json2Code('api/api-doc/error_injection.json'),
+       'api/table_benchmark.cc',
+       Json2Code('api/api-doc/table_benchmark.json'),
        'api/authorization_cache.cc',
        Json2Code('api/api-doc/authorization_cache.json'),
        ]
@@ -1192,11 +1203,13 @@ pure_boost_tests = set([
     'test/boost/dynamic_bitset_test',
     'test/boost/enum_option_test',
     'test/boost/enum_set_test',
+    'test/boost/hyperloglog_test',
     'test/boost/idl_test',
     'test/boost/json_test',
     'test/boost/keys_test',
     'test/boost/like_matcher_test',
     'test/boost/linearizing_input_stream_test',
+    'test/boost/lru_test',
     'test/boost/map_difference_test',
     'test/boost/nonwrapping_range_test',
     'test/boost/observable_test',
@@ -1272,7 +1285,9 @@ deps['test/boost/UUID_test'] = ['utils/UUID_gen.cc', 'test/boost/UUID_test.cc',
 deps['test/boost/murmur_hash_test'] = ['bytes.cc', 'utils/murmur_hash.cc', 'test/boost/murmur_hash_test.cc']
 deps['test/boost/allocation_strategy_test'] = ['test/boost/allocation_strategy_test.cc', 'utils/logalloc.cc', 'utils/dynamic_bitset.cc']
 deps['test/boost/log_heap_test'] = ['test/boost/log_heap_test.cc']
+deps['test/boost/lru_test'] = ['test/boost/lru_test.cc']
 deps['test/boost/estimated_histogram_test'] = ['test/boost/estimated_histogram_test.cc']
+deps['test/boost/hyperloglog_test'] = ['test/boost/hyperloglog_test.cc', 'bytes.cc', 'utils/murmur_hash.cc']
 deps['test/boost/summary_test'] = ['test/boost/summary_test.cc']
 deps['test/boost/anchorless_list_test'] = ['test/boost/anchorless_list_test.cc']
 deps['test/perf/perf_fast_forward'] += ['seastar/tests/perf/linux_perf_event.cc']
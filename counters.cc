@@ -255,3 +255,41 @@ void transform_counter_updates_to_shards(mutation& m, const mutation* current_st
         transform_row_to_shards(column_kind::regular_column, cr.row().cells(), it->row().cells());
     }
 }
+
+bool is_pure_counter_update(const mutation& m) {
+    auto& p = m.partition();
+    if (p.partition_tombstone() || !p.row_tombstones().empty()) {
+        return false;
+    }
+    auto& s = *m.schema();
+    auto row_is_pure = [&s] (column_kind kind, const auto& cells) {
+        bool pure = true;
+        cells.for_each_cell_until([&] (column_id id, const atomic_cell_or_collection& ac_o_c) {
+            auto& cdef = s.column_at(kind, id);
+            if (!cdef.is_atomic() || !cdef.type->is_counter()) {
+                pure = false;
+                return stop_iteration::yes;
+            }
+            auto acv = ac_o_c.as_atomic_cell(cdef);
+            if (!acv.is_live() || !acv.is_counter_update()) {
+                pure = false;
+                return stop_iteration::yes;
+            }
+            return stop_iteration::no;
+        });
+        return pure;
+    };
+    if (!row_is_pure(column_kind::static_column, p.static_row())) {
+        return false;
+    }
+    for (auto& cr : p.clustered_rows()) {
+        auto& dr = cr.row();
+        if (dr.deleted_at() || !dr.marker().is_missing()) {
+            return false;
+        }
+        if (!row_is_pure(column_kind::regular_column, dr.cells())) {
+            return false;
+        }
+    }
+    return true;
+}
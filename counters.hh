@@ -369,6 +369,12 @@ struct counter_cell_mutable_view : basic_counter_cell_view<mutable_view::yes> {
 // If current_state is present it has to be in the same schema as dst.
 void transform_counter_updates_to_shards(mutation& dst, const mutation* current_state, uint64_t clock_offset, locator::host_id local_id);
 
+// Returns true iff the mutation carries nothing but live counter update cells,
+// i.e. no tombstones or row markers of any kind. Mutations satisfying this
+// predicate and targeting the same partition can be combined with
+// mutation::apply(), which sums their deltas.
+bool is_pure_counter_update(const mutation& m);
+
 template<>
 struct appending_hash<counter_shard_view> {
     template<typename Hasher>
@@ -26,9 +26,11 @@
 #include "cql3/util.hh"
 #include "index/secondary_index_manager.hh"
 #include "types/list.hh"
+#include "types/listlike_partial_deserializing_iterator.hh"
 #include "types/map.hh"
 #include "types/set.hh"
 #include "utils/like_matcher.hh"
+#include "utils/small_vector.hh"
 #include "query-result-reader.hh"
 #include "types/user.hh"
 #include "cql3/lists.hh"
@@ -166,7 +168,6 @@ get_value(const subscript& s, const evaluation_inputs& inputs) {
         // For null[i] we return null.
         return std::nullopt;
     }
-    const auto deserialized = cdef->type->deserialize(managed_bytes_view(*serialized));
     const auto key = evaluate(s.sub, inputs);
     auto&& key_type = col_type->is_map() ? col_type->name_comparator() : int32_type;
     if (key.is_null()) {
@@ -193,24 +194,29 @@ get_value(const subscript& s, const evaluation_inputs& inputs) {
                 cdef->name_as_text()));
     }
     if (col_type->is_map()) {
-        const auto& data_map = value_cast<map_type_impl::native_type>(deserialized);
+        // The serialized map is ordered by key, so a single element can be
+        // looked up with a binary search over the serialized form; no need
+        // to materialize the whole collection.
+        const auto& mtype = static_cast<const map_type_impl&>(*col_type);
         const auto found = key.view().with_linearized([&] (bytes_view key_bv) {
-            using entry = std::pair<data_value, data_value>;
-            return std::find_if(data_map.cbegin(), data_map.cend(), [&] (const entry& element) {
-                return key_type->compare(element.first.serialize_nonnull(), key_bv) == 0;
-            });
+            return mtype.find_value(managed_bytes_view(*serialized), managed_bytes_view(key_bv), cql_serialization_format::internal());
         });
-        return found == data_map.cend() ? std::nullopt : managed_bytes_opt(found->second.serialize_nonnull());
+        return found ? managed_bytes_opt(managed_bytes(*found)) : std::nullopt;
     } else if (col_type->is_list()) {
-        const auto& data_list = value_cast<list_type_impl::native_type>(deserialized);
         auto key_deserialized = key.view().with_linearized([&] (bytes_view key_bv) {
             return key_type->deserialize(key_bv);
         });
         auto key_int = value_cast<int32_t>(key_deserialized);
-        if (key_int < 0 || size_t(key_int) >= data_list.size()) {
+        auto sf = cql_serialization_format::internal();
+        auto in = managed_bytes_view(*serialized);
+        auto size = read_collection_size(in, sf);
+        if (key_int < 0 || key_int >= size) {
             return std::nullopt;
         }
-        return managed_bytes_opt(data_list[key_int].serialize_nonnull());
+        for (int32_t i = 0; i < key_int; ++i) {
+            read_collection_value(in, sf);
+        }
+        return managed_bytes_opt(managed_bytes(read_collection_value(in, sf)));
     } else {
         throw exceptions::invalid_request_exception(format("subscripting non-map, non-list column {}", cdef->name_as_text()));
     }
@@ -537,6 +543,55 @@ value_set intersection(value_set a, value_set b, const abstract_type* type) {
     return std::visit(intersection_visitor{type}, std::move(a), std::move(b));
 }
 
+/// Fast path for the most common filtering shape: `column op constant` with a
+/// plain comparison operator. Compares the column's serialized value against
+/// the constant's bytes directly, skipping the generic evaluate() round trip
+/// which copies both sides into raw_values and serializes a boolean per row.
+/// Returns nullopt when the expression doesn't match this shape, leaving it
+/// to the generic path.
+std::optional<bool> is_satisfied_by_simple_comparison(const binary_operator& opr, const evaluation_inputs& inputs) {
+    switch (opr.op) {
+    case oper_t::EQ:
+    case oper_t::NEQ:
+    case oper_t::LT:
+    case oper_t::LTE:
+    case oper_t::GT:
+    case oper_t::GTE:
+        break;
+    default:
+        return std::nullopt;
+    }
+    const column_value* col = as_if<column_value>(&opr.lhs);
+    const constant* rhs = as_if<constant>(&opr.rhs);
+    if (!col || !rhs || rhs->is_null() || rhs->is_unset_value()) {
+        // Null and unset constants keep their special handling in the
+        // generic path.
+        return std::nullopt;
+    }
+    managed_bytes_opt lhs_bytes = get_value(*col, inputs);
+    if (!lhs_bytes) {
+        // NULL doesn't satisfy any comparison.
+        return false;
+    }
+    return rhs->view().with_value([&] (const FragmentedView auto& rhs_view) -> std::optional<bool> {
+        if constexpr (std::is_same_v<std::decay_t<decltype(rhs_view)>, managed_bytes_view>) {
+            switch (opr.op) {
+            case oper_t::EQ:
+                return col->col->type->equal(managed_bytes_view(*lhs_bytes), rhs_view);
+            case oper_t::NEQ:
+                return !col->col->type->equal(managed_bytes_view(*lhs_bytes), rhs_view);
+            default:
+                return limits(managed_bytes_view(*lhs_bytes), opr.op, rhs_view, col->col->type->without_reversed());
+            }
+        } else {
+            // A constant stores its value as (managed_)bytes, so view()
+            // always yields a managed_bytes_view; this branch only exists to
+            // satisfy with_value()'s signature.
+            return std::nullopt;
+        }
+    });
+}
+
 bool is_satisfied_by(const binary_operator& opr, const evaluation_inputs& inputs) {
     if (is<token>(opr.lhs)) {
         // The RHS value was already used to ensure we fetch only rows in the specified
@@ -549,6 +604,10 @@ bool is_satisfied_by(const binary_operator& opr, const evaluation_inputs& inputs
         return true;
     }
 
+    if (auto fast_result = is_satisfied_by_simple_comparison(opr, inputs)) {
+        return *fast_result;
+    }
+
     raw_value binop_eval_result = evaluate(opr, inputs);
 
     if (binop_eval_result.is_null()) {
@@ -1938,7 +1997,9 @@ static cql3::raw_value evaluate(const tuple_constructor& tuple, const evaluation
             "evaluate(tuple_constructor) called with nullptr type, should be prepared first");
     }
 
-    std::vector<managed_bytes_opt> tuple_elements;
+    // Stack-allocate the element array; tuples are almost always small and
+    // this runs once per bound term on the write path.
+    utils::small_vector<managed_bytes_opt, 8> tuple_elements;
     tuple_elements.reserve(tuple.elements.size());
 
     for (size_t i = 0; i < tuple.elements.size(); i++) {
@@ -1983,7 +2044,7 @@ static managed_bytes serialize_listlike(const Range& elements, const char* colle
 static cql3::raw_value evaluate_list(const collection_constructor& collection,
                               const evaluation_inputs& inputs,
                               bool skip_null = false) {
-    std::vector<managed_bytes> evaluated_elements;
+    utils::small_vector<managed_bytes, 8> evaluated_elements;
     evaluated_elements.reserve(collection.elements.size());
 
     for (const expression& element : collection.elements) {
@@ -2116,7 +2177,7 @@ static cql3::raw_value evaluate(const usertype_constructor& user_val, const eval
             "evaluate(usertype_constructor) called with bad number of elements, should be prepared first");
     }
 
-    std::vector<managed_bytes_opt> field_values;
+    utils::small_vector<managed_bytes_opt, 8> field_values;
     field_values.reserve(utype.size());
 
     for (std::size_t i = 0; i < utype.size(); i++) {
@@ -10,6 +10,7 @@
 
 #include "bytes.hh"
 #include "types.hh"
+#include "types/list.hh"
 #include "types/tuple.hh"
 #include "cql3/functions/scalar_function.hh"
 #include "cql3/util.hh"
@@ -20,7 +21,9 @@
 #include "functions.hh"
 #include "native_aggregate_function.hh"
 #include "exceptions/exceptions.hh"
+#include "utils/estimated_histogram.hh"
 #include "utils/multiprecision_int.hh"
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
@@ -47,6 +50,9 @@ public:
     virtual void add_input(cql_serialization_format sf, const std::vector<opt_bytes>& values) override {
         ++_count;
     }
+    virtual void add_column_batch(cql_serialization_format sf, const std::vector<opt_bytes>& column) override {
+        _count += column.size();
+    }
     virtual void set_accumulator(const opt_bytes& acc) override {
         if (acc) {
             _count = value_cast<int64_t>(long_type->deserialize(bytes_view(*acc)));
@@ -228,6 +234,26 @@ public:
         }
         _sum += value_cast<Type>(data_type_for<Type>()->deserialize(*values[0]));
     }
+    virtual void add_column_batch(cql_serialization_format sf, const std::vector<opt_bytes>& column) override {
+        accumulator_type sum = _sum;
+        if constexpr (std::is_integral_v<Type>) {
+            // Fixed-width big-endian values; decode inline to keep the loop
+            // free of data_value boxing.
+            for (const opt_bytes& cell : column) {
+                if (cell) {
+                    sum += accumulator_type(read_simple_exactly<Type>(bytes_view(*cell)));
+                }
+            }
+        } else {
+            auto type = data_type_for<Type>();
+            for (const opt_bytes& cell : column) {
+                if (cell) {
+                    sum += value_cast<Type>(type->deserialize(*cell));
+                }
+            }
+        }
+        _sum = sum;
+    }
     virtual void set_accumulator(const opt_bytes& acc) override {
         if (acc) {
             _sum = accumulator_for<Type>::deserialize(acc);
@@ -407,6 +433,123 @@ make_avg_function() {
     return make_shared<avg_function_for<Type>>();
 }
 
+// The approx_pNN functions estimate the value at a fixed percentile of the
+// aggregated column. Inputs are counted into a utils::estimated_histogram
+// whose bucket offsets grow by 20% per step, and the result is the offset of
+// the bucket the requested percentile falls into, so the estimate carries a
+// relative error of up to 20%. The sketch is a flat array of bucket counts,
+// which lets replicas do the bucketing and ship only the counts to the
+// coordinator for merging (is_reducible()) instead of streaming raw rows.
+//
+// The bucket offsets start at 1 and are integral: zero and negative inputs
+// count towards the lowest bucket, and fractional inputs towards the bucket
+// of their integral part. This matches the intended use - latencies and
+// other non-negative measurements.
+
+// Enough buckets for the offsets to span the entire range of int64_t.
+constexpr int approx_percentile_bucket_count = 240;
+
+static data_type approx_percentile_accumulator_type() {
+    return list_type_impl::get_instance(long_type, false);
+}
+
+template <typename Type>
+class impl_approx_percentile_function : public aggregate_function::aggregate {
+protected:
+    utils::estimated_histogram _hist{approx_percentile_bucket_count};
+    double _percentile;
+public:
+    explicit impl_approx_percentile_function(double percentile) : _percentile(percentile) {}
+    virtual void reset() override {
+        _hist = utils::estimated_histogram(approx_percentile_bucket_count);
+    }
+    virtual opt_bytes compute(cql_serialization_format sf) override {
+        return long_type->decompose(_hist.percentile(_percentile));
+    }
+    virtual void add_input(cql_serialization_format sf, const std::vector<opt_bytes>& values) override {
+        if (!values[0]) {
+            return;
+        }
+        _hist.add(static_cast<int64_t>(value_cast<Type>(data_type_for<Type>()->deserialize(*values[0]))));
+    }
+    virtual opt_bytes get_accumulator() const override {
+        std::vector<data_value> counts;
+        counts.reserve(_hist.buckets.size());
+        for (int64_t b : _hist.buckets) {
+            counts.emplace_back(b);
+        }
+        return make_list_value(approx_percentile_accumulator_type(), std::move(counts)).serialize();
+    }
+    virtual void set_accumulator(const opt_bytes& acc) override {
+        reset();
+        reduce(cql_serialization_format::internal(), acc);
+    }
+    virtual void reduce(cql_serialization_format sf, const opt_bytes& acc) override {
+        if (!acc) {
+            return;
+        }
+        auto counts = value_cast<list_type_impl::native_type>(approx_percentile_accumulator_type()->deserialize(bytes_view(*acc)));
+        if (counts.size() != _hist.buckets.size()) {
+            throw std::runtime_error(format("approx percentile: cannot merge a sketch of {} buckets into one of {}",
+                    counts.size(), _hist.buckets.size()));
+        }
+        for (size_t i = 0; i < counts.size(); i++) {
+            _hist.buckets[i] += value_cast<int64_t>(counts[i]);
+        }
+    }
+};
+
+template <typename Type>
+class impl_reducible_approx_percentile_function final : public impl_approx_percentile_function<Type> {
+public:
+    using impl_approx_percentile_function<Type>::impl_approx_percentile_function;
+    virtual bytes_opt compute(cql_serialization_format sf) override {
+        return this->get_accumulator();
+    }
+};
+
+template <typename Type>
+class approx_percentile_function_for : public native_aggregate_function {
+protected:
+    const double _percentile;
+public:
+    approx_percentile_function_for(sstring name, double percentile)
+        : native_aggregate_function(std::move(name), long_type, { data_type_for<Type>() })
+        , _percentile(percentile) {}
+    approx_percentile_function_for(sstring name, double percentile, data_type return_type)
+        : native_aggregate_function(std::move(name), std::move(return_type), { data_type_for<Type>() })
+        , _percentile(percentile) {}
+
+    virtual bool is_reducible() const override {
+        return true;
+    }
+
+    virtual std::unique_ptr<aggregate> new_aggregate() override {
+        return std::make_unique<impl_approx_percentile_function<Type>>(_percentile);
+    }
+
+    virtual ::shared_ptr<aggregate_function> reducible_aggregate_function() override {
+        class reducible_approx_percentile_function : public approx_percentile_function_for<Type> {
+        public:
+            reducible_approx_percentile_function(sstring name, double percentile)
+                : approx_percentile_function_for<Type>(std::move(name), percentile, approx_percentile_accumulator_type()) {}
+
+            virtual std::unique_ptr<aggregate> new_aggregate() override {
+                return std::make_unique<impl_reducible_approx_percentile_function<Type>>(this->_percentile);
+            }
+        };
+
+        return ::make_shared<reducible_approx_percentile_function>(name().name, _percentile);
+    }
+};
+
+template <typename Type>
+static
+shared_ptr<aggregate_function>
+make_approx_percentile_function(const char* name, double percentile) {
+    return make_shared<approx_percentile_function_for<Type>>(name, percentile);
+}
+
 template <typename T>
 struct aggregate_type_for {
     using type = T;
@@ -730,6 +873,9 @@ public:
         }
         ++_count;
     }
+    virtual void add_column_batch(cql_serialization_format sf, const std::vector<opt_bytes>& column) override {
+        _count += std::count_if(column.begin(), column.end(), [] (const opt_bytes& cell) { return bool(cell); });
+    }
     virtual void set_accumulator(const opt_bytes& acc) override {
         if (acc) {
             _count = value_cast<int64_t>(long_type->deserialize(bytes_view(*acc)));
@@ -952,4 +1098,14 @@ void cql3::functions::add_agg_functions(declared_t& funcs) {
     declare(make_avg_function<double>());
     declare(make_avg_function<utils::multiprecision_int>());
     declare(make_avg_function<big_decimal>());
+
+    for (auto&& [name, percentile] : std::initializer_list<std::pair<const char*, double>>{
+            {"approx_p50", 0.50}, {"approx_p90", 0.90}, {"approx_p95", 0.95}, {"approx_p99", 0.99}}) {
+        declare(make_approx_percentile_function<int8_t>(name, percentile));
+        declare(make_approx_percentile_function<int16_t>(name, percentile));
+        declare(make_approx_percentile_function<int32_t>(name, percentile));
+        declare(make_approx_percentile_function<int64_t>(name, percentile));
+        declare(make_approx_percentile_function<float>(name, percentile));
+        declare(make_approx_percentile_function<double>(name, percentile));
+    }
 }
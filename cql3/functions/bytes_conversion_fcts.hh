@@ -63,6 +63,36 @@ make_varchar_as_blob_fct() {
     });
 }
 
+// Extracts a byte range from a blob on the server side. For large cells
+// (e.g. multi-megabyte blobs flagged by the large data handler) this lets
+// clients that only need a prefix or a header fetch just the requested
+// bytes instead of transferring the whole value:
+//   SELECT subblob(payload, 0, 65536) FROM media;
+// The range is clamped to the value's size, so asking past the end yields
+// the available suffix (possibly empty) rather than an error.
+inline
+shared_ptr<function>
+make_sub_blob_fct() {
+    return make_native_scalar_function<true>("subblob", bytes_type, { bytes_type, int32_type, int32_type },
+            [] (cql_serialization_format sf, const std::vector<bytes_opt>& parameters) -> bytes_opt {
+        auto&& val = parameters[0];
+        auto&& off = parameters[1];
+        auto&& len = parameters[2];
+        if (!val || !off || !len) {
+            return std::nullopt;
+        }
+        auto offset = value_cast<int32_t>(int32_type->deserialize(*off));
+        auto length = value_cast<int32_t>(int32_type->deserialize(*len));
+        if (offset < 0 || length < 0) {
+            using namespace exceptions;
+            throw invalid_request_exception(format("In call to function subblob, offset ({}) and length ({}) must be non-negative", offset, length));
+        }
+        auto begin = std::min(size_t(offset), val->size());
+        auto end = std::min(size_t(offset) + size_t(length), val->size());
+        return bytes(val->begin() + begin, val->begin() + end);
+    });
+}
+
 inline
 shared_ptr<function>
 make_blob_as_varchar_fct() {
@@ -109,6 +109,7 @@ functions::init() noexcept {
 
     declare(make_varchar_as_blob_fct());
     declare(make_blob_as_varchar_fct());
+    declare(make_sub_blob_fct());
     add_agg_functions(ret);
 
     declare(error_injection::make_enable_injection_function());
@@ -11,6 +11,7 @@
 #include "cql3/query_processor.hh"
 
 #include <seastar/core/metrics.hh>
+#include <seastar/core/with_scheduling_group.hh>
 
 #include "service/storage_proxy.hh"
 #include "cql3/CqlParser.hpp"
@@ -20,6 +21,7 @@
 #include "cql3/util.hh"
 #include "cql3/untyped_result_set.hh"
 #include "db/config.hh"
+#include "db/system_distributed_keyspace.hh"
 #include "data_dictionary/data_dictionary.hh"
 #include "hashers.hh"
 
@@ -466,16 +468,43 @@ future<::shared_ptr<result_message>>
 query_processor::execute_direct_without_checking_exception_message(const sstring_view& query_string, service::query_state& query_state, query_options& options) {
     log.trace("execute_direct: \"{}\"", query_string);
     tracing::trace(query_state.get_trace_state(), "Parsing a statement");
-    auto p = get_statement(query_string, query_state.get_client_state());
-    auto cql_statement = p->statement;
-    const auto warnings = std::move(p->warnings);
+    // Direct (unprepared) statements used to be parsed and prepared on every
+    // execution, and a paged query re-sends the same statement text for every
+    // page. Cache the prepared form under the same key PREPARE would use, so
+    // subsequent pages - and repeated unprepared statements in general - skip
+    // the parser. Entries are invalidated on schema changes together with
+    // client-prepared statements, and single-use statements stay in the
+    // cache's unprivileged section, where they cannot evict client-prepared
+    // statements.
+    auto& client_state = query_state.get_client_state();
+    return do_with(
+            compute_id(query_string, client_state.get_raw_keyspace()),
+            sstring(query_string),
+            [this, &query_state, &options, &client_state] (const prepared_cache_key_type& key, const sstring& query_string) {
+        return _prepared_cache.get(key, [this, &query_string, &client_state] {
+            return make_ready_future<std::unique_ptr<statements::prepared_statement>>(get_statement(query_string, client_state));
+        }).then([this, &query_state, &options] (statements::prepared_statement::checked_weak_ptr p) {
+            return do_execute_direct(*p, query_state, options);
+        }).handle_exception_type([this, &query_string, &query_state, &options] (const prepared_statements_cache::statement_is_too_big&) {
+            // Statements too big for the cache keep the old parse-per-execution
+            // path - unlike PREPARE, direct execution has no size limit.
+            auto p = get_statement(query_string, query_state.get_client_state());
+            return do_execute_direct(*p, query_state, options);
+        });
+    });
+}
+
+future<::shared_ptr<result_message>>
+query_processor::do_execute_direct(const statements::prepared_statement& p, service::query_state& query_state, query_options& options) {
+    auto cql_statement = p.statement;
+    auto warnings = p.warnings;
     if (cql_statement->get_bound_terms() != options.get_values_count()) {
         const auto msg = format("Invalid amount of bind variables: expected {:d} received {:d}",
                 cql_statement->get_bound_terms(),
                 options.get_values_count());
         throw exceptions::invalid_request_exception(msg);
     }
-    options.prepare(p->bound_names);
+    options.prepare(p.bound_names);
 
     warn(unimplemented::cause::METRICS);
 #if 0
@@ -504,6 +533,12 @@ query_processor::execute_prepared_without_checking_exception_message(
         bool needs_authorization) {
 
     ::shared_ptr<cql_statement> statement = prepared->statement;
+    // Keep a copy of the key only on the sampled executions, where it is
+    // needed to attribute the measured time after the statement completes.
+    std::optional<prepared_cache_key_type> sampled_key;
+    if (sample_statement_execution(cache_key, statement->raw_cql_statement)) {
+        sampled_key = cache_key;
+    }
     future<> fut = make_ready_future<>();
     if (needs_authorization) {
         fut = statement->check_access(*this, query_state.get_client_state()).then([this, &query_state, prepared = std::move(prepared), cache_key = std::move(cache_key)] () mutable {
@@ -514,8 +549,93 @@ query_processor::execute_prepared_without_checking_exception_message(
     }
     log.trace("execute_prepared: \"{}\"", statement->raw_cql_statement);
 
-    return fut.then([this, statement = std::move(statement), &query_state, &options] () mutable {
-        return process_authorized_statement(std::move(statement), query_state, options);
+    return fut.then([this, statement = std::move(statement), &query_state, &options, sampled_key = std::move(sampled_key)] () mutable {
+        if (!sampled_key) {
+            return process_authorized_statement(std::move(statement), query_state, options);
+        }
+        auto start = steady_clock_type::now();
+        return process_authorized_statement(std::move(statement), query_state, options).finally([this, key = std::move(*sampled_key), start] {
+            account_sampled_statement_execution(key, steady_clock_type::now() - start);
+        });
+    });
+}
+
+bool query_processor::sample_statement_execution(const prepared_cache_key_type& cache_key, const sstring& query_string) {
+    auto it = _statement_execution_stats.find(cache_key);
+    if (it == _statement_execution_stats.end()) {
+        if (_statement_execution_stats.size() >= max_tracked_statement_executions) {
+            return false;
+        }
+        it = _statement_execution_stats.emplace(cache_key, statement_execution_stats{.query_string = query_string}).first;
+    }
+    // Sampling the first execution rather than the 64th gives rarely executed
+    // statements a latency estimate too.
+    return it->second.executions++ % statement_execution_sampling_rate == 0;
+}
+
+void query_processor::account_sampled_statement_execution(const prepared_cache_key_type& cache_key, std::chrono::nanoseconds d) {
+    // Re-lookup instead of holding an iterator across the execution: a
+    // concurrent insertion may have rehashed the map in the meantime.
+    auto it = _statement_execution_stats.find(cache_key);
+    if (it != _statement_execution_stats.end()) {
+        ++it->second.samples;
+        it->second.sampled_execution_time += d;
+    }
+}
+
+void query_processor::store_prepared_statement_in_background(const prepared_cache_key_type& cache_key, const sstring& query_string, const service::client_state& client_state) noexcept {
+    const auto& id = prepared_cache_key_type::cql_id(cache_key);
+    if (id.empty()) {
+        // Thrift ids are sequential, not content-derived, so they cannot be
+        // looked up by another node.
+        return;
+    }
+    try {
+        static thread_local const sstring insert_query = format("INSERT INTO {}.{} (prepared_id, logged_keyspace, query_string) VALUES (?, ?, ?)",
+                db::system_distributed_keyspace::NAME, db::system_distributed_keyspace::PREPARED_STATEMENTS);
+        // The query string and bound values are consumed before execute_internal()
+        // first defers, so fire-and-forget with temporaries is safe here.
+        (void)execute_internal(insert_query, db::consistency_level::LOCAL_ONE,
+                {data_value(id), data_value(client_state.get_raw_keyspace()), data_value(query_string)}, cache_internal::yes)
+            .discard_result()
+            .handle_exception([] (std::exception_ptr ep) {
+                // Losing a replication is harmless - the client falls back to
+                // re-preparing. The table may legitimately not exist yet while
+                // the cluster is still upgrading.
+                log.debug("Failed to replicate prepared statement: {}", ep);
+            });
+    } catch (...) {
+        log.debug("Failed to replicate prepared statement: {}", std::current_exception());
+    }
+}
+
+future<bool> query_processor::recover_prepared_statement(const prepared_cache_key_type& cache_key, service::client_state& client_state) {
+    const auto& id = prepared_cache_key_type::cql_id(cache_key);
+    if (id.empty()) {
+        return make_ready_future<bool>(false);
+    }
+    static thread_local const sstring select_query = format("SELECT logged_keyspace, query_string FROM {}.{} WHERE prepared_id = ?",
+            db::system_distributed_keyspace::NAME, db::system_distributed_keyspace::PREPARED_STATEMENTS);
+    return execute_internal(select_query, db::consistency_level::LOCAL_ONE, {data_value(id)}, cache_internal::yes).then(
+            [this, &client_state] (::shared_ptr<untyped_result_set> rs) -> future<bool> {
+        if (rs->empty()) {
+            return make_ready_future<bool>(false);
+        }
+        const auto& row = rs->one();
+        auto keyspace = row.get_opt<sstring>("logged_keyspace").value_or(sstring());
+        if (keyspace != client_state.get_raw_keyspace()) {
+            // The statement was prepared under a different keyspace, so
+            // re-preparing it here would produce a different id (and
+            // unqualified table names could resolve differently). Let the
+            // client re-prepare.
+            return make_ready_future<bool>(false);
+        }
+        return prepare(row.get_as<sstring>("query_string"), client_state, false).then([] (auto&&) {
+            return true;
+        });
+    }).handle_exception([] (std::exception_ptr ep) {
+        log.debug("Failed to recover prepared statement: {}", ep);
+        return false;
     });
 }
 
@@ -527,13 +647,22 @@ query_processor::process_authorized_statement(const ::shared_ptr<cql_statement>
 
     statement->validate(*this, client_state);
 
-    auto fut = statement->execute_without_checking_exception_message(*this, query_state, options);
+    qos::service_level_controller* sl_controller = client_state.get_service_level_controller_ptr();
+    auto admitted = sl_controller ? sl_controller->wait_for_cpu_budget(client_state.get_service_level_name()) : make_ready_future<>();
 
-    return fut.then([statement] (auto msg) {
-        if (msg) {
-            return make_ready_future<::shared_ptr<result_message>>(std::move(msg));
-        }
-        return make_ready_future<::shared_ptr<result_message>>(::make_shared<result_message::void_message>());
+    return admitted.then([this, statement, &query_state, &options, sl_controller, &client_state] {
+        auto start = steady_clock_type::now();
+        auto fut = statement->execute_without_checking_exception_message(*this, query_state, options);
+
+        return fut.then([statement, sl_controller, &client_state, start] (auto msg) {
+            if (sl_controller) {
+                sl_controller->account_cpu_time(client_state.get_service_level_name(), steady_clock_type::now() - start);
+            }
+            if (msg) {
+                return make_ready_future<::shared_ptr<result_message>>(std::move(msg));
+            }
+            return make_ready_future<::shared_ptr<result_message>>(::make_shared<result_message::void_message>());
+        });
     });
 }
 
@@ -767,9 +896,21 @@ future<> query_processor::for_each_cql_result(
     });
 }
 
+// Internal queries are run in the default scheduling group, which
+// classify_request() (replica/database.cc) maps to the system reader
+// concurrency semaphore. This gives them a reserved permit pool, so
+// auth and topology lookups never queue behind user reads saturating
+// the statement group's semaphore.
+static future<::shared_ptr<cql_transport::messages::result_message>>
+execute_internal_statement(query_processor& qp, statements::prepared_statement& p, service::query_state& query_state, const query_options& opts) {
+    return with_scheduling_group(default_scheduling_group(), [&qp, &p, &query_state, &opts] {
+        return p.statement->execute(qp, query_state, opts);
+    });
+}
+
 future<::shared_ptr<untyped_result_set>>
 query_processor::execute_paged_internal(::shared_ptr<internal_query_state> state) {
-    return state->p->statement->execute(*this, *_internal_state, *state->opts).then(
+    return execute_internal_statement(*this, *state->p, *_internal_state, *state->opts).then(
             [state, this](::shared_ptr<cql_transport::messages::result_message> msg) mutable {
         class visitor : public result_message::visitor_base {
             ::shared_ptr<internal_query_state> _state;
@@ -843,7 +984,7 @@ query_processor::execute_with_params(
         const std::initializer_list<data_value>& values) {
     auto opts = make_internal_options(p, values, cl);
     return do_with(std::move(opts), [this, &query_state, p = std::move(p)](auto & opts) {
-        return p->statement->execute(*this, query_state, opts).then([](auto msg) {
+        return execute_internal_statement(*this, *p, query_state, opts).then([](auto msg) {
             return make_ready_future<::shared_ptr<untyped_result_set>>(::make_shared<untyped_result_set>(msg));
         });
     });
@@ -871,7 +1012,18 @@ query_processor::execute_batch_without_checking_exception_message(
                 }
                 log.trace("execute_batch({}): {}", batch->get_statements().size(), oss.str());
             }
-            return batch->execute(*this, query_state, options);
+            auto& client_state = query_state.get_client_state();
+            qos::service_level_controller* sl_controller = client_state.get_service_level_controller_ptr();
+            auto admitted = sl_controller ? sl_controller->wait_for_cpu_budget(client_state.get_service_level_name()) : make_ready_future<>();
+            return admitted.then([this, batch, &query_state, &options, sl_controller, &client_state] {
+                auto start = steady_clock_type::now();
+                return batch->execute(*this, query_state, options).then([sl_controller, &client_state, start] (auto msg) {
+                    if (sl_controller) {
+                        sl_controller->account_cpu_time(client_state.get_service_level_name(), steady_clock_type::now() - start);
+                    }
+                    return msg;
+                });
+            });
         });
     });
 }
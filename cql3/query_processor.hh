@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <string_view>
 #include <unordered_map>
 
@@ -90,6 +91,23 @@ public:
         size_t authorized_prepared_cache_size = 0;
     };
 
+    // Per-statement execution statistics, keyed by the prepared statement id
+    // in _statement_execution_stats and exposed through the
+    // system.prepared_statement_executions virtual table. All executions are
+    // counted, but wall-clock time is measured only for one in every
+    // statement_execution_sampling_rate of them; samples counts the
+    // executions that contributed to sampled_execution_time.
+    struct statement_execution_stats {
+        sstring query_string;
+        uint64_t executions = 0;
+        uint64_t samples = 0;
+        std::chrono::nanoseconds sampled_execution_time{0};
+    };
+    static constexpr uint64_t statement_execution_sampling_rate = 64;
+    // Upper bound on the number of distinct prepared statements tracked per
+    // shard. Executions of statements beyond this bound are not accounted.
+    static constexpr size_t max_tracked_statement_executions = 1024;
+
 private:
     std::unique_ptr<migration_subscriber> _migration_subscriber;
     service::storage_proxy& _proxy;
@@ -126,6 +144,12 @@ private:
     std::unordered_map<sstring, std::unique_ptr<statements::prepared_statement>> _internal_statements;
 
     wasm::instance_cache* _wasm_instance_cache;
+
+    // Entries are never expired: the map is bounded by
+    // max_tracked_statement_executions and an entry is only a query string
+    // plus a few counters, so a statement evicted from the prepared
+    // statements cache keeps its accumulated statistics.
+    std::unordered_map<prepared_cache_key_type, statement_execution_stats> _statement_execution_stats;
 public:
     static const sstring CQL_VERSION;
 
@@ -167,6 +191,10 @@ public:
         return _cql_stats;
     }
 
+    const std::unordered_map<prepared_cache_key_type, statement_execution_stats>& get_statement_execution_stats() const {
+        return _statement_execution_stats;
+    }
+
     wasm::instance_cache* get_wasm_instance_cache() {
         return _wasm_instance_cache;
     }
@@ -204,6 +232,13 @@ public:
         return _prepared_cache.find(key);
     }
 
+    /// Attempts to recover a prepared statement which is missing from the local
+    /// cache but may have been prepared on another node, by looking up its
+    /// query string in system_distributed.prepared_statements and re-preparing
+    /// it locally. Returns whether the statement was recovered; on success a
+    /// subsequent get_prepared() with the same key will hit.
+    future<bool> recover_prepared_statement(const prepared_cache_key_type& cache_key, service::client_state& client_state);
+
     service::raft_group0_client& get_group0_client() {
         return _group0_client;
     }
@@ -409,6 +444,27 @@ private:
     future<::shared_ptr<cql_transport::messages::result_message>>
     process_authorized_statement(const ::shared_ptr<cql_statement> statement, service::query_state& query_state, const query_options& options);
 
+    // Counts one execution of the given prepared statement and returns true
+    // if its wall-clock time should be measured this time around.
+    bool sample_statement_execution(const prepared_cache_key_type& cache_key, const sstring& query_string);
+
+    void account_sampled_statement_execution(const prepared_cache_key_type& cache_key, std::chrono::nanoseconds d);
+
+    // Replicates a freshly prepared statement to
+    // system_distributed.prepared_statements in the background, so that other
+    // nodes can recover it on an unknown-id EXECUTE without a client round trip.
+    void store_prepared_statement_in_background(const prepared_cache_key_type& cache_key, const sstring& query_string, const service::client_state& client_state) noexcept;
+
+    // Tail of execute_direct(): runs an already parsed and prepared direct
+    // statement. Everything needed from \c p is copied out before the first
+    // suspension, so the caller only has to keep it alive for the duration of
+    // the synchronous part of this call.
+    future<::shared_ptr<cql_transport::messages::result_message>>
+    do_execute_direct(
+            const statements::prepared_statement& p,
+            service::query_state& query_state,
+            query_options& options);
+
     /*!
      * \brief created a state object for paging
      *
@@ -468,7 +524,7 @@ private:
                 id_gen(query_string, client_state.get_raw_keyspace()),
                 std::move(query_string),
                 [this, &client_state, &id_getter](const prepared_cache_key_type& key, const sstring& query_string) {
-            return _prepared_cache.get(key, [this, &query_string, &client_state] {
+            return _prepared_cache.get(key, [this, &key, &query_string, &client_state] {
                 auto prepared = get_statement(query_string, client_state);
                 auto bound_terms = prepared->statement->get_bound_terms();
                 if (bound_terms > std::numeric_limits<uint16_t>::max()) {
@@ -478,6 +534,7 @@ private:
                                    std::numeric_limits<uint16_t>::max()));
                 }
                 assert(bound_terms == prepared->bound_names.size());
+                store_prepared_statement_in_background(key, query_string, client_state);
                 return make_ready_future<std::unique_ptr<statements::prepared_statement>>(std::move(prepared));
             }).then([&key, &id_getter, &client_state] (auto prep_ptr) {
                 const auto& warnings = prep_ptr->warnings;
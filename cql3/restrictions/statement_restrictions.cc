@@ -15,6 +15,7 @@
 #include <functional>
 #include <ranges>
 #include <stdexcept>
+#include <unordered_map>
 
 #include "cql3/expr/expression.hh"
 #include "query-result-reader.hh"
@@ -30,6 +31,7 @@
 #include "types/list.hh"
 #include "types/map.hh"
 #include "types/set.hh"
+#include "utils/hash.hh"
 
 namespace cql3 {
 namespace restrictions {
@@ -349,6 +351,7 @@ statement_restrictions::statement_restrictions(data_dictionary::database db,
         _single_column_nonprimary_key_restrictions = expr::get_single_column_restrictions_map(_nonprimary_key_restrictions);
         _clustering_prefix_restrictions = extract_clustering_prefix_restrictions(*_where, _schema);
         _partition_range_restrictions = extract_partition_range(*_where, _schema);
+        compute_range_plan();
     }
     auto cf = db.find_column_family(schema);
     auto& sim = cf.get_index_manager();
@@ -923,11 +926,92 @@ dht::partition_range_vector partition_ranges_from_token(const expr::expression&
     return {{std::move(start), std::move(end)}};
 }
 
+/// Tokens of recently used partition keys, kept per shard.
+///
+/// Every execution of a single-partition statement recomputes the key's token - a
+/// murmur3 hash of the key's legacy form - in range_from_bytes() below. Hot-key-skewed
+/// workloads hash the same handful of keys over and over, so remember recent results
+/// in a small LRU pool instead. A key's token never changes: a table's partitioner is
+/// fixed and partition key columns cannot be altered, so entries never have to be
+/// invalidated, only evicted to keep the pool small.
+class partition_token_cache {
+    static constexpr size_t max_entries = 1024;
+
+    using cache_key = std::pair<table_id, managed_bytes>;
+    using cache_key_view = std::pair<table_id, managed_bytes_view>;
+
+    struct key_hash {
+        using is_transparent = void;
+        size_t operator()(const cache_key_view& k) const {
+            return utils::hash_combine(std::hash<table_id>()(k.first), std::hash<managed_bytes_view>()(k.second));
+        }
+        size_t operator()(const cache_key& k) const {
+            return (*this)(cache_key_view(k.first, k.second));
+        }
+    };
+    struct key_eq {
+        using is_transparent = void;
+        bool operator()(const cache_key_view& a, const cache_key_view& b) const {
+            return a.first == b.first && a.second == b.second;
+        }
+        bool operator()(const cache_key& a, const cache_key_view& b) const {
+            return (*this)(cache_key_view(a.first, a.second), b);
+        }
+        bool operator()(const cache_key_view& a, const cache_key& b) const {
+            return (*this)(a, cache_key_view(b.first, b.second));
+        }
+        bool operator()(const cache_key& a, const cache_key& b) const {
+            return (*this)(cache_key_view(a.first, a.second), cache_key_view(b.first, b.second));
+        }
+    };
+
+    // Most recently used entries first. The list points at the map's keys,
+    // which stay put since unordered_map nodes are stable.
+    std::list<const cache_key*> _lru;
+    std::unordered_map<cache_key, std::pair<dht::token, std::list<const cache_key*>::iterator>, key_hash, key_eq> _entries;
+
+public:
+    std::optional<dht::token> find(const schema& s, const partition_key& key) {
+        auto it = _entries.find(cache_key_view(s.id(), key.representation()));
+        if (it == _entries.end()) {
+            return std::nullopt;
+        }
+        _lru.splice(_lru.begin(), _lru, it->second.second);
+        return it->second.first;
+    }
+
+    void insert(const schema& s, const partition_key& key, dht::token token) {
+        auto [it, inserted] = _entries.emplace(cache_key(s.id(), managed_bytes(key.representation())),
+                std::pair(token, _lru.end()));
+        if (!inserted) {
+            _lru.splice(_lru.begin(), _lru, it->second.second);
+            return;
+        }
+        try {
+            _lru.push_front(&it->first);
+        } catch (...) {
+            _entries.erase(it);
+            throw;
+        }
+        it->second.second = _lru.begin();
+        if (_entries.size() > max_entries) {
+            _entries.erase(*_lru.back());
+            _lru.pop_back();
+        }
+    }
+};
+
+thread_local partition_token_cache token_cache;
+
 /// Turns a partition-key value into a partition_range. \p pk must have elements for all partition columns.
 dht::partition_range range_from_bytes(const schema& schema, const std::vector<managed_bytes>& pk) {
-    const auto k = partition_key::from_exploded(pk);
-    const auto tok = dht::get_token(schema, k);
-    const query::ring_position pos(std::move(tok), std::move(k));
+    auto k = partition_key::from_exploded(pk);
+    auto tok = token_cache.find(schema, k);
+    if (!tok) {
+        tok = dht::get_token(schema, k);
+        token_cache.insert(schema, k, *tok);
+    }
+    query::ring_position pos(std::move(*tok), std::move(k));
     return dht::partition_range::make_singular(std::move(pos));
 }
 
@@ -939,29 +1023,29 @@ void error_if_exceeds(size_t size, size_t limit) {
 }
 
 /// Computes partition-key ranges from expressions, which contains EQ/IN for every partition column.
+/// \p columns holds the partition column restricted by each expression, resolved at prepare time.
 dht::partition_range_vector partition_ranges_from_singles(
-        const std::vector<expr::expression>& expressions, const query_options& options, const schema& schema) {
+        const std::vector<expr::expression>& expressions, const std::vector<const column_definition*>& columns,
+        const query_options& options, const schema& schema) {
     const size_t size_limit =
             options.get_cql_config().restrictions.partition_key_restrictions_max_cartesian_product_size;
     // Each element is a vector of that column's possible values:
     std::vector<std::vector<managed_bytes>> column_values(schema.partition_key_size());
     size_t product_size = 1;
-    for (const auto& e : expressions) {
-        if (const auto arbitrary_binop = find_binop(e, [] (const binary_operator&) { return true; })) {
-            if (auto cv = expr::as_if<expr::column_value>(&arbitrary_binop->lhs)) {
-                const value_set vals = possible_lhs_values(cv->col, e, options);
-                if (auto lst = std::get_if<value_list>(&vals)) {
-                    if (lst->empty()) {
-                        return {};
-                    }
-                    product_size *= lst->size();
-                    error_if_exceeds(product_size, size_limit);
-                    column_values[schema.position(*cv->col)] = std::move(*lst);
-                } else {
-                    throw exceptions::invalid_request_exception(
-                            "Only EQ and IN relation are supported on the partition key "
-                            "(unless you use the token() function or allow filtering)");
+    for (size_t i = 0; i < expressions.size(); ++i) {
+        if (const auto col = columns[i]) {
+            const value_set vals = possible_lhs_values(col, expressions[i], options);
+            if (auto lst = std::get_if<value_list>(&vals)) {
+                if (lst->empty()) {
+                    return {};
                 }
+                product_size *= lst->size();
+                error_if_exceeds(product_size, size_limit);
+                column_values[schema.position(*col)] = std::move(*lst);
+            } else {
+                throw exceptions::invalid_request_exception(
+                        "Only EQ and IN relation are supported on the partition key "
+                        "(unless you use the token() function or allow filtering)");
             }
         }
     }
@@ -973,12 +1057,14 @@ dht::partition_range_vector partition_ranges_from_singles(
 
 /// Computes partition-key ranges from EQ restrictions on each partition column.  Returns a single singleton range if
 /// the EQ restrictions are not mutually conflicting.  Otherwise, returns an empty vector.
+/// \p columns holds the partition column restricted by each expression, resolved at prepare time.
 dht::partition_range_vector partition_ranges_from_EQs(
-        const std::vector<expr::expression>& eq_expressions, const query_options& options, const schema& schema) {
+        const std::vector<expr::expression>& eq_expressions, const std::vector<const column_definition*>& columns,
+        const query_options& options, const schema& schema) {
     std::vector<managed_bytes> pk_value(schema.partition_key_size());
-    for (const auto& e : eq_expressions) {
-        const auto col = expr::get_subscripted_column(find(e, oper_t::EQ)->lhs).col;
-        const auto vals = std::get<value_list>(possible_lhs_values(col, e, options));
+    for (size_t i = 0; i < eq_expressions.size(); ++i) {
+        const auto col = columns[i];
+        const auto vals = std::get<value_list>(possible_lhs_values(col, eq_expressions[i], options));
         if (vals.empty()) { // Case of C=1 AND C=2.
             return {};
         }
@@ -989,22 +1075,67 @@ dht::partition_range_vector partition_ranges_from_EQs(
 
 } // anonymous namespace
 
+void statement_restrictions::compute_range_plan() {
+    if (!_partition_range_restrictions.empty()) {
+        if (has_token(_partition_range_restrictions[0])) {
+            if (_partition_range_restrictions.size() != 1) {
+                on_internal_error(
+                        rlogger,
+                        format("Unexpected size of token restrictions: {}", _partition_range_restrictions.size()));
+            }
+            _range_plan.pk = range_plan::pk_kind::token;
+        } else {
+            _range_plan.pk = _partition_range_is_simple ? range_plan::pk_kind::single_eq
+                    : range_plan::pk_kind::cartesian_product;
+            _range_plan.pk_columns.reserve(_partition_range_restrictions.size());
+            for (const auto& e : _partition_range_restrictions) {
+                const column_definition* col = nullptr;
+                if (_partition_range_is_simple) {
+                    col = expr::get_subscripted_column(find(e, expr::oper_t::EQ)->lhs).col;
+                } else if (const auto binop = find_binop(e, [] (const expr::binary_operator&) { return true; })) {
+                    if (auto cv = expr::as_if<expr::column_value>(&binop->lhs)) {
+                        col = cv->col;
+                    }
+                }
+                _range_plan.pk_columns.push_back(col);
+            }
+        }
+    }
+    if (!_clustering_prefix_restrictions.empty()) {
+        if (find_binop(_clustering_prefix_restrictions[0], expr::is_multi_column)) {
+            _range_plan.ck = range_plan::ck_kind::multi_column;
+            for (const auto& r : _clustering_prefix_restrictions) {
+                const auto& binop = expr::as<expr::binary_operator>(r);
+                if (expr::is_clustering_order(binop)) {
+                    _range_plan.ck = range_plan::ck_kind::raw_bounds;
+                    break;
+                }
+                for (const auto& element : expr::as<expr::tuple_constructor>(binop.lhs).elements) {
+                    const auto& cv = expr::as<expr::column_value>(element);
+                    if (cv.col->type->is_reversed()) {
+                        _range_plan.ck_all_natural = false;
+                    } else {
+                        _range_plan.ck_all_reverse = false;
+                    }
+                }
+            }
+        } else {
+            _range_plan.ck = range_plan::ck_kind::single_column;
+        }
+    }
+}
+
 dht::partition_range_vector statement_restrictions::get_partition_key_ranges(const query_options& options) const {
     if (_partition_range_restrictions.empty()) {
         return {dht::partition_range::make_open_ended_both_sides()};
     }
-    if (has_token(_partition_range_restrictions[0])) {
-        if (_partition_range_restrictions.size() != 1) {
-            on_internal_error(
-                    rlogger,
-                    format("Unexpected size of token restrictions: {}", _partition_range_restrictions.size()));
-        }
+    if (_range_plan.pk == range_plan::pk_kind::token) {
         return partition_ranges_from_token(_partition_range_restrictions[0], options);
-    } else if (_partition_range_is_simple) {
+    } else if (_range_plan.pk == range_plan::pk_kind::single_eq) {
         // Special case to avoid extra allocations required for a Cartesian product.
-        return partition_ranges_from_EQs(_partition_range_restrictions, options, *_schema);
+        return partition_ranges_from_EQs(_partition_range_restrictions, _range_plan.pk_columns, options, *_schema);
     }
-    return partition_ranges_from_singles(_partition_range_restrictions, options, *_schema);
+    return partition_ranges_from_singles(_partition_range_restrictions, _range_plan.pk_columns, options, *_schema);
 }
 
 namespace {
@@ -1611,28 +1742,14 @@ query::clustering_range range_from_raw_bounds(
 } // anonymous namespace
 
 std::vector<query::clustering_range> statement_restrictions::get_clustering_bounds(const query_options& options) const {
-    if (_clustering_prefix_restrictions.empty()) {
+    switch (_range_plan.ck) {
+    case range_plan::ck_kind::open_ended:
         return {query::clustering_range::make_open_ended_both_sides()};
-    }
-    if (find_binop(_clustering_prefix_restrictions[0], expr::is_multi_column)) {
-        bool all_natural = true, all_reverse = true; ///< Whether column types are reversed or natural.
-        for (auto& r : _clustering_prefix_restrictions) { // TODO: move to constructor, do only once.
-            using namespace expr;
-            const auto& binop = expr::as<binary_operator>(r);
-            if (is_clustering_order(binop)) {
-                return {range_from_raw_bounds(_clustering_prefix_restrictions, options, *_schema)};
-            }
-            for (auto& element : expr::as<tuple_constructor>(binop.lhs).elements) {
-                auto& cv = expr::as<column_value>(element);
-                if (cv.col->type->is_reversed()) {
-                    all_natural = false;
-                } else {
-                    all_reverse = false;
-                }
-            }
-        }
+    case range_plan::ck_kind::raw_bounds:
+        return {range_from_raw_bounds(_clustering_prefix_restrictions, options, *_schema)};
+    case range_plan::ck_kind::multi_column: {
         auto bounds = get_multi_column_clustering_bounds(options, _schema, _clustering_prefix_restrictions);
-        if (!all_natural && !all_reverse) {
+        if (!_range_plan.ck_all_natural && !_range_plan.ck_all_reverse) {
             std::vector<query::clustering_range> bounds_in_clustering_order;
             for (const auto& b : bounds) {
                 const auto eqv = get_equivalent_ranges(b, *_schema);
@@ -1640,15 +1757,17 @@ std::vector<query::clustering_range> statement_restrictions::get_clustering_boun
             }
             return bounds_in_clustering_order;
         }
-        if (all_reverse) {
+        if (_range_plan.ck_all_reverse) {
             for (auto& crange : bounds) {
                 crange = query::clustering_range(crange.end(), crange.start());
             }
         }
         return bounds;
-    } else {
+    }
+    case range_plan::ck_kind::single_column:
         return get_single_column_clustering_bounds(options, *_schema, _clustering_prefix_restrictions);
     }
+    on_internal_error(rlogger, format("get_clustering_bounds: unhandled plan kind {}", unsigned(_range_plan.ck)));
 }
 
 namespace {
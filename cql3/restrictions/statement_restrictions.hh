@@ -110,6 +110,38 @@ private:
 
     bool _partition_range_is_simple; ///< False iff _partition_range_restrictions imply a Cartesian product.
 
+    /// Execution plan for computing ranges from _partition_range_restrictions and
+    /// _clustering_prefix_restrictions. The shape of the restrictions of a prepared
+    /// statement is fixed at prepare time -- only bound values change between
+    /// executions -- so the classification of the restrictions and the resolution
+    /// of the restricted columns are done once here instead of being rediscovered
+    /// by get_partition_key_ranges() and get_clustering_bounds() on every execution.
+    struct range_plan {
+        enum class pk_kind : uint8_t {
+            open_ended, ///< No restrictions defining the partition range.
+            token, ///< token() restrictions; _partition_range_restrictions has one element.
+            single_eq, ///< EQ on every partition column, defining a single range.
+            cartesian_product, ///< EQ/IN on every partition column.
+        };
+        pk_kind pk = pk_kind::open_ended;
+        /// For single_eq and cartesian_product: the partition column restricted by
+        /// the corresponding element of _partition_range_restrictions, or nullptr
+        /// if that element contains no binary operator.
+        std::vector<const column_definition*> pk_columns;
+        enum class ck_kind : uint8_t {
+            open_ended, ///< No restrictions defining the clustering slice.
+            single_column, ///< Single-column restrictions on a clustering-key prefix.
+            multi_column, ///< Multi-column (tuple) restrictions.
+            raw_bounds, ///< Multi-column restrictions carrying raw clustering bounds.
+        };
+        ck_kind ck = ck_kind::open_ended;
+        /// For multi_column: whether none (resp. all) of the restricted clustering
+        /// columns have a reversed type.
+        bool ck_all_natural = true;
+        bool ck_all_reverse = true;
+    };
+    range_plan _range_plan;
+
 public:
     /**
      * Creates a new empty <code>StatementRestrictions</code>.
@@ -260,6 +292,10 @@ private:
 
     void process_partition_key_restrictions(bool for_view, bool allow_filtering);
 
+    /// Classifies _partition_range_restrictions and _clustering_prefix_restrictions
+    /// into _range_plan. Call after both are fully built.
+    void compute_range_plan();
+
     /**
      * Processes the clustering column restrictions.
      *
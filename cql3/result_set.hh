@@ -44,6 +44,14 @@ public:
     // (CASSANDRA-4911). So the serialization code will exclude any columns in name whose index is >= columnCount.
         std::vector<lw_shared_ptr<column_specification>> _names;
         uint32_t _column_count;
+        // Lazily filled by the transport layer with the wire-serialized column
+        // specifications, which are constant for a given selection. Responses
+        // for subsequent pages and executions append this one blob instead of
+        // re-encoding every column (see cql_server::response::write()).
+        // Empty means not filled yet; valid only for the GLOBAL_TABLES_SPEC
+        // flavor recorded alongside it.
+        bytes _serialized_specs;
+        bool _serialized_specs_global_tables_spec = false;
 
         column_info(std::vector<lw_shared_ptr<column_specification>> names, uint32_t column_count)
             : _names(std::move(names))
@@ -91,6 +99,10 @@ public:
     const std::vector<lw_shared_ptr<column_specification>>& get_names() const {
         return _column_info->_names;
     }
+
+    const lw_shared_ptr<column_info>& get_column_info() const {
+        return _column_info;
+    }
 };
 
 ::shared_ptr<const cql3::metadata> make_empty_metadata();
@@ -19,12 +19,41 @@ namespace selection {
 
 class aggregate_function_selector : public abstract_function_selector_for<functions::aggregate_function> {
     std::unique_ptr<functions::aggregate_function::aggregate> _aggregate;
+    // Pending single-argument inputs, handed to the aggregate in one
+    // add_column_batch() call so that counting/summing millions of rows is
+    // a tight loop instead of one virtual call per row. Used only for
+    // native aggregates taking at most one argument.
+    std::vector<bytes_opt> _batch;
+    bool _batching;
+
+    static constexpr size_t max_batch_size = 256;
+
+    void flush_batch(cql_serialization_format sf) {
+        if (!_batch.empty()) {
+            _aggregate->add_column_batch(sf, _batch);
+            _batch.clear();
+        }
+    }
 public:
     virtual bool is_aggregate() const override {
         return true;
     }
 
     virtual void add_input(cql_serialization_format sf, result_set_builder& rs) override {
+        if (_batching) {
+            bytes_opt cell;
+            if (!_arg_selectors.empty()) {
+                auto&& s = _arg_selectors[0];
+                s->add_input(sf, rs);
+                cell = s->get_output(sf);
+                s->reset();
+            }
+            _batch.push_back(std::move(cell));
+            if (_batch.size() >= max_batch_size) {
+                flush_batch(sf);
+            }
+            return;
+        }
         // Aggregation of aggregation is not supported
         size_t m = _arg_selectors.size();
         for (size_t i = 0; i < m; ++i) {
@@ -37,10 +66,12 @@ public:
     }
 
     virtual bytes_opt get_output(cql_serialization_format sf) override {
+        flush_batch(sf);
         return _aggregate->compute(sf);
     }
 
     virtual void reset() override {
+        _batch.clear();
         _aggregate->reset();
     }
 
@@ -48,7 +79,14 @@ public:
                 std::vector<shared_ptr<selector>> arg_selectors)
             : abstract_function_selector_for<functions::aggregate_function>(
                     dynamic_pointer_cast<functions::aggregate_function>(func), std::move(arg_selectors))
-            , _aggregate(fun()->new_aggregate()) {
+            , _aggregate(fun()->new_aggregate())
+            // User aggregates run user functions per input anyway, and their
+            // argument count is unconstrained, so they keep the row-at-a-time
+            // path.
+            , _batching(_arg_selectors.size() <= 1 && !dynamic_pointer_cast<functions::user_aggregate>(fun())) {
+        if (_batching) {
+            _batch.reserve(max_batch_size);
+        }
     }
 };
 
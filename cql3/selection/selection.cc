@@ -430,17 +430,26 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
         return false;
     }
 
+    // Materializing the values of all static and regular columns is relatively
+    // expensive, so do it at most once per row, and only if some restriction
+    // actually needs them.
+    std::optional<std::vector<managed_bytes_opt>> static_and_regular_columns;
+    auto get_static_and_regular_columns = [&] () -> const std::vector<managed_bytes_opt>* {
+        if (!static_and_regular_columns) {
+            static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
+        }
+        return &*static_and_regular_columns;
+    };
+
     const expr::expression& clustering_columns_restrictions = _restrictions->get_clustering_columns_restrictions();
     if (expr::contains_multi_column_restriction(clustering_columns_restrictions)) {
         clustering_key_prefix ckey = clustering_key_prefix::from_exploded(clustering_key);
-        // FIXME: push to upper layer so it happens once per row
-        auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
         bool multi_col_clustering_satisfied = expr::is_satisfied_by(
                 clustering_columns_restrictions,
                 expr::evaluation_inputs{
                     .partition_key = &partition_key,
                     .clustering_key = &clustering_key,
-                    .static_and_regular_columns = &static_and_regular_columns,
+                    .static_and_regular_columns = get_static_and_regular_columns(),
                     .selection = &selection,
                     .options = &_options,
                 });
@@ -465,14 +474,12 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
                 continue;
             }
             const expr::expression& single_col_restriction = restr_it->second;
-            // FIXME: push to upper layer so it happens once per row
-            auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
             bool regular_restriction_matches = expr::is_satisfied_by(
                     single_col_restriction,
                     expr::evaluation_inputs{
                         .partition_key = &partition_key,
                         .clustering_key = &clustering_key,
-                        .static_and_regular_columns = &static_and_regular_columns,
+                        .static_and_regular_columns = get_static_and_regular_columns(),
                         .selection = &selection,
                         .options = &_options,
                     });
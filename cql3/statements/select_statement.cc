@@ -662,36 +662,56 @@ indexed_table_select_statement::do_execute_base_query(
 
     query::result_merger merger(cmd->get_row_limit(), query::max_partitions);
     std::vector<primary_key> keys = std::move(primary_keys);
-    std::vector<primary_key>::iterator key_it(keys.begin());
+
+    // Group consecutive keys sharing a base partition so all requested rows
+    // of that partition are fetched with a single read instead of one round
+    // trip per row. The posting list yields keys sorted by partition and
+    // clustering, so equal partitions are adjacent and the merged result
+    // preserves row order.
+    struct base_read {
+        dht::decorated_key partition;
+        std::vector<query::clustering_range> row_ranges;
+        bool whole_partition = false;
+    };
+    std::vector<base_read> reads;
+    for (auto& key : keys) {
+        if (reads.empty() || !reads.back().partition.equal(*_schema, key.partition)) {
+            reads.push_back(base_read{std::move(key.partition), {}});
+        }
+        if (key.clustering) {
+            reads.back().row_ranges.push_back(query::clustering_range::make_singular(std::move(key.clustering)));
+        } else {
+            reads.back().whole_partition = true;
+        }
+    }
+
+    std::vector<base_read>::iterator read_it(reads.begin());
     size_t previous_result_size = 0;
     size_t next_iteration_size = 0;
 
     const bool is_paged = bool(paging_state);
-    while (key_it != keys.end()) {
-        // Starting with 1 key, we check if the result was a short read, and if not,
-        // we continue exponentially, asking for 2x more key than before
-        auto already_done = std::distance(keys.begin(), key_it);
+    while (read_it != reads.end()) {
+        // Starting with 1 partition, we check if the result was a short read, and if not,
+        // we continue exponentially, asking for 2x more partitions than before
+        auto already_done = std::distance(reads.begin(), read_it);
         // If the previous result already provided 1MB worth of data,
         // stop increasing the number of fetched partitions
         if (previous_result_size < query::result_memory_limiter::maximum_result_size) {
             next_iteration_size = already_done + 1;
         }
-        next_iteration_size = std::min<size_t>({next_iteration_size, keys.size() - already_done, max_base_table_query_concurrency});
-        auto key_it_end = key_it + next_iteration_size;
-        auto command = ::make_lw_shared<query::read_command>(*cmd);
+        next_iteration_size = std::min<size_t>({next_iteration_size, reads.size() - already_done, max_base_table_query_concurrency});
+        auto read_it_end = read_it + next_iteration_size;
 
         query::result_merger oneshot_merger(cmd->get_row_limit(), query::max_partitions);
-        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(key_it, key_it_end, coroutine::lambda([&] (auto& key)
+        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(read_it, read_it_end, coroutine::lambda([&] (auto& read)
                 -> future<coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>>> {
             auto command = ::make_lw_shared<query::read_command>(*cmd);
-            // for each partition, read just one clustering row (TODO: can
-            // get all needed rows of one partition at once.)
             command->slice._row_ranges.clear();
-            if (key.clustering) {
-                command->slice._row_ranges.push_back(query::clustering_range::make_singular(key.clustering));
+            if (!read.whole_partition) {
+                command->slice._row_ranges = read.row_ranges;
             }
             coordinator_result<service::storage_proxy::coordinator_query_result> rqr
-                    = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(key.partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
+                    = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(read.partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
             if (!rqr.has_value()) {
                 co_return std::move(rqr).as_failure();
             }
@@ -706,7 +726,7 @@ indexed_table_select_statement::do_execute_base_query(
         const bool page_limit_reached = is_paged && result->buf().size() >= query::result_memory_limiter::maximum_result_size;
         previous_result_size = result->buf().size();
         merger(std::move(result));
-        key_it = key_it_end;
+        read_it = read_it_end;
         if (is_short_read || page_limit_reached) {
             break;
         }
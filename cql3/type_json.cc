@@ -18,61 +18,65 @@
 #include "types/listlike_partial_deserializing_iterator.hh"
 #include "utils/managed_bytes.hh"
 #include "exceptions/exceptions.hh"
+#include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 #include <boost/algorithm/string/trim_all.hpp>
 #include <boost/algorithm/string.hpp>
 
-static inline bool is_control_char(char c) {
-    return c >= 0 && c <= 0x1F;
-}
+namespace {
+
+// Table-driven JSON string escaper. Entries are null for bytes which can be
+// emitted as-is; only the control characters, '"' and '\\' need escaping.
+// Bytes above 0x7F are parts of UTF-8 sequences and are passed through.
+struct json_escape_table {
+    char control[0x20][8];
+    const char* table[256] = {};
+    json_escape_table() {
+        for (int i = 0; i < 0x20; ++i) {
+            snprintf(control[i], sizeof(control[i]), "\\u%04X", i);
+            table[i] = control[i];
+        }
+        table[unsigned('\b')] = "\\b";
+        table[unsigned('\f')] = "\\f";
+        table[unsigned('\n')] = "\\n";
+        table[unsigned('\r')] = "\\r";
+        table[unsigned('\t')] = "\\t";
+        table[unsigned('"')] = "\\\"";
+        table[unsigned('\\')] = "\\\\";
+    }
+};
+
+const json_escape_table json_escapes;
 
-static inline bool needs_escaping(const sstring& s) {
-    return std::any_of(s.begin(), s.end(), [](char c) {return is_control_char(c) || c == '"' || c == '\\';});
 }
 
+static void write_json_raw(bytes_ostream& out, std::string_view s) {
+    out.write(s.data(), s.size());
+}
 
-static sstring quote_json_string(const sstring& value) {
-    if (!needs_escaping(value)) {
-        return format("\"{}\"", value);
-    }
-    std::ostringstream oss;
-    oss << std::hex << std::uppercase << std::setfill('0');
-    oss.put('"');
-    for (char c : value) {
-        switch (c) {
-        case '"':
-            oss.put('\\').put('"');
-            break;
-        case '\\':
-            oss.put('\\').put('\\');
-            break;
-        case '\b':
-            oss.put('\\').put('b');
-            break;
-        case '\f':
-            oss.put('\\').put('f');
-            break;
-        case '\n':
-            oss.put('\\').put('n');
-            break;
-        case '\r':
-            oss.put('\\').put('r');
-            break;
-        case '\t':
-            oss.put('\\').put('t');
-            break;
-        default:
-            if (is_control_char(c)) {
-                oss.put('\\').put('u') << std::setw(4) << static_cast<int>(c);
-            } else {
-                oss.put(c);
+// Writes s as a quoted JSON string, escaping as it goes. Unescaped runs are
+// copied in one piece.
+static void write_json_quoted(bytes_ostream& out, std::string_view s) {
+    out.write("\"", 1);
+    auto run_start = s.data();
+    auto cur = s.data();
+    auto end = s.data() + s.size();
+    while (cur != end) {
+        if (const char* esc = json_escapes.table[uint8_t(*cur)]) {
+            if (cur != run_start) {
+                out.write(run_start, cur - run_start);
             }
-            break;
+            out.write(esc, strlen(esc));
+            run_start = cur + 1;
         }
+        ++cur;
+    }
+    if (cur != run_start) {
+        out.write(run_start, cur - run_start);
     }
-    oss.put('"');
-    return oss.str();
+    out.write("\"", 1);
 }
 
 
@@ -342,189 +346,208 @@ template <typename T> static T compose_value(const integer_type_impl<T>& t, byte
     return read_be<T>(reinterpret_cast<const char*>(bv.data()));
 }
 
-static sstring to_json_string_aux(const map_type_impl& t, bytes_view bv) {
-    std::ostringstream out;
+static void to_json_aux(const map_type_impl& t, bytes_view bv, bytes_ostream& out) {
     auto sf = cql_serialization_format::internal();
 
-    out << '{';
+    out.write("{", 1);
     auto size = read_collection_size(bv, sf);
     for (int i = 0; i < size; ++i) {
         auto kb = read_collection_value(bv, sf);
         auto vb = read_collection_value(bv, sf);
 
         if (i > 0) {
-            out << ", ";
+            out.write(", ", 2);
         }
 
-        // Valid keys in JSON map must be quoted strings
-        sstring string_key = to_json_string(*t.get_keys_type(), kb);
-        bool is_unquoted = string_key.empty() || string_key[0] != '"';
+        // Valid keys in JSON map must be quoted strings. Whether the key's
+        // JSON form is already quoted depends on its type, so it is written
+        // to a side buffer first.
+        bytes_ostream key_out;
+        to_json(*t.get_keys_type(), kb, key_out);
+        auto key = key_out.linearize();
+        bool is_unquoted = key.empty() || key[0] != '"';
         if (is_unquoted) {
-            out << '"';
+            out.write("\"", 1);
         }
-        out << string_key;
+        out.write(key);
         if (is_unquoted) {
-            out << '"';
+            out.write("\"", 1);
         }
-        out << ": ";
-        out << to_json_string(*t.get_values_type(), vb);
+        out.write(": ", 2);
+        to_json(*t.get_values_type(), vb, out);
     }
-    out << '}';
-    return out.str();
+    out.write("}", 1);
 }
 
-static sstring to_json_string_aux(const set_type_impl& t, bytes_view bv) {
+static void to_json_aux(const set_type_impl& t, bytes_view bv, bytes_ostream& out) {
     using llpdi = listlike_partial_deserializing_iterator;
-    std::ostringstream out;
     bool first = true;
     auto sf = cql_serialization_format::internal();
-    out << '[';
+    out.write("[", 1);
     managed_bytes_view mbv(bv);
     std::for_each(llpdi::begin(mbv, sf), llpdi::end(mbv, sf), [&first, &out, &t] (const managed_bytes_view& e) {
         if (first) {
             first = false;
         } else {
-            out << ", ";
+            out.write(", ", 2);
         }
-        out << to_json_string(*t.get_elements_type(), e);
+        to_json(*t.get_elements_type(), e, out);
     });
-    out << ']';
-    return out.str();
+    out.write("]", 1);
 }
 
-static sstring to_json_string_aux(const list_type_impl& t, bytes_view bv) {
+static void to_json_aux(const list_type_impl& t, bytes_view bv, bytes_ostream& out) {
     using llpdi = listlike_partial_deserializing_iterator;
-    std::ostringstream out;
     bool first = true;
     auto sf = cql_serialization_format::internal();
-    out << '[';
+    out.write("[", 1);
     managed_bytes_view mbv(bv);
     std::for_each(llpdi::begin(mbv, sf), llpdi::end(mbv, sf), [&first, &out, &t] (const managed_bytes_view& e) {
         if (first) {
             first = false;
         } else {
-            out << ", ";
+            out.write(", ", 2);
         }
-        out << to_json_string(*t.get_elements_type(), e);
+        to_json(*t.get_elements_type(), e, out);
     });
-    out << ']';
-    return out.str();
+    out.write("]", 1);
 }
 
-static sstring to_json_string_aux(const tuple_type_impl& t, bytes_view bv) {
-    std::ostringstream out;
-    out << '[';
+static void to_json_aux(const tuple_type_impl& t, bytes_view bv, bytes_ostream& out) {
+    out.write("[", 1);
 
     auto ti = t.all_types().begin();
     auto vi = tuple_deserializing_iterator::start(bv);
     while (ti != t.all_types().end() && vi != tuple_deserializing_iterator::finish(bv)) {
         if (ti != t.all_types().begin()) {
-            out << ", ";
+            out.write(", ", 2);
         }
         if (*vi) {
-            // TODO(sarna): We can avoid copying if to_json_string accepted bytes_view
-            out << to_json_string(**ti, **vi);
+            to_json(**ti, **vi, out);
         } else {
-            out << "null";
+            out.write("null", 4);
         }
         ++ti;
         ++vi;
     }
 
-    out << ']';
-    return out.str();
+    out.write("]", 1);
 }
 
-static sstring to_json_string_aux(const user_type_impl& t, bytes_view bv) {
-    std::ostringstream out;
-    out << '{';
+static void to_json_aux(const user_type_impl& t, bytes_view bv, bytes_ostream& out) {
+    out.write("{", 1);
 
     auto ti = t.all_types().begin();
     auto vi = tuple_deserializing_iterator::start(bv);
     int i = 0;
     while (ti != t.all_types().end() && vi != tuple_deserializing_iterator::finish(bv)) {
         if (ti != t.all_types().begin()) {
-            out << ", ";
+            out.write(", ", 2);
         }
-        out << quote_json_string(t.field_name_as_string(i)) << ": ";
+        auto field_name = t.field_name_as_string(i);
+        write_json_quoted(out, field_name);
+        out.write(": ", 2);
         if (*vi) {
-            //TODO(sarna): We can avoid copying if to_json_string accepted bytes_view
-            out << to_json_string(**ti, **vi);
+            to_json(**ti, **vi, out);
         } else {
-            out << "null";
+            out.write("null", 4);
         }
         ++ti;
         ++i;
         ++vi;
     }
 
-    out << '}';
-    return out.str();
+    out.write("}", 1);
 }
 
 namespace {
-struct to_json_string_visitor {
+struct to_json_visitor {
     bytes_view bv;
-    sstring operator()(const reversed_type_impl& t) { return to_json_string(*t.underlying_type(), bv); }
-    template <typename T> sstring operator()(const integer_type_impl<T>& t) { return to_sstring(compose_value(t, bv)); }
-    template <typename T> sstring operator()(const floating_type_impl<T>& t) {
+    bytes_ostream& out;
+    void operator()(const reversed_type_impl& t) { to_json(*t.underlying_type(), bv, out); }
+    template <typename T> void operator()(const integer_type_impl<T>& t) { write_json_raw(out, to_sstring(compose_value(t, bv))); }
+    template <typename T> void operator()(const floating_type_impl<T>& t) {
         if (bv.empty()) {
             throw exceptions::invalid_request_exception("Cannot create JSON string - deserialization error");
         }
         auto v = t.deserialize(bv);
         T d = value_cast<T>(v);
         if (std::isnan(d) || std::isinf(d)) {
-            return "null";
-        }
-        return to_sstring(d);
-    }
-    sstring operator()(const uuid_type_impl& t) { return quote_json_string(t.to_string(bv)); }
-    sstring operator()(const inet_addr_type_impl& t) { return quote_json_string(t.to_string(bv)); }
-    sstring operator()(const string_type_impl& t) { return quote_json_string(t.to_string(bv)); }
-    sstring operator()(const bytes_type_impl& t) { return quote_json_string("0x" + t.to_string(bv)); }
-    sstring operator()(const boolean_type_impl& t) { return t.to_string(bv); }
-    sstring operator()(const timestamp_date_base_class& t) { return quote_json_string(t.to_string(bv)); }
-    sstring operator()(const timeuuid_type_impl& t) { return quote_json_string(t.to_string(bv)); }
-    sstring operator()(const map_type_impl& t) { return to_json_string_aux(t, bv); }
-    sstring operator()(const set_type_impl& t) { return to_json_string_aux(t, bv); }
-    sstring operator()(const list_type_impl& t) { return to_json_string_aux(t, bv); }
-    sstring operator()(const tuple_type_impl& t) { return to_json_string_aux(t, bv); }
-    sstring operator()(const user_type_impl& t) { return to_json_string_aux(t, bv); }
-    sstring operator()(const simple_date_type_impl& t) { return quote_json_string(t.to_string(bv)); }
-    sstring operator()(const time_type_impl& t) { return t.to_string(bv); }
-    sstring operator()(const empty_type_impl& t) { return "null"; }
-    sstring operator()(const duration_type_impl& t) {
+            write_json_raw(out, "null");
+            return;
+        }
+        write_json_raw(out, to_sstring(d));
+    }
+    void operator()(const uuid_type_impl& t) { write_json_quoted(out, t.to_string(bv)); }
+    void operator()(const inet_addr_type_impl& t) { write_json_quoted(out, t.to_string(bv)); }
+    void operator()(const string_type_impl& t) {
+        // The serialized form of a string is the string itself, no need to
+        // go through to_string().
+        write_json_quoted(out, std::string_view(reinterpret_cast<const char*>(bv.data()), bv.size()));
+    }
+    void operator()(const bytes_type_impl& t) {
+        // Hex digits never need escaping.
+        out.write("\"0x", 3);
+        write_json_raw(out, t.to_string(bv));
+        out.write("\"", 1);
+    }
+    void operator()(const boolean_type_impl& t) { write_json_raw(out, t.to_string(bv)); }
+    void operator()(const timestamp_date_base_class& t) { write_json_quoted(out, t.to_string(bv)); }
+    void operator()(const timeuuid_type_impl& t) { write_json_quoted(out, t.to_string(bv)); }
+    void operator()(const map_type_impl& t) { to_json_aux(t, bv, out); }
+    void operator()(const set_type_impl& t) { to_json_aux(t, bv, out); }
+    void operator()(const list_type_impl& t) { to_json_aux(t, bv, out); }
+    void operator()(const tuple_type_impl& t) { to_json_aux(t, bv, out); }
+    void operator()(const user_type_impl& t) { to_json_aux(t, bv, out); }
+    void operator()(const simple_date_type_impl& t) { write_json_quoted(out, t.to_string(bv)); }
+    void operator()(const time_type_impl& t) { write_json_raw(out, t.to_string(bv)); }
+    void operator()(const empty_type_impl& t) { write_json_raw(out, "null"); }
+    void operator()(const duration_type_impl& t) {
         auto v = t.deserialize(bv);
         if (v.is_null()) {
             throw exceptions::invalid_request_exception("Cannot create JSON string - deserialization error");
         }
-        return quote_json_string(t.to_string(bv));
+        write_json_quoted(out, t.to_string(bv));
     }
-    sstring operator()(const counter_type_impl& t) {
+    void operator()(const counter_type_impl& t) {
         // It will be called only from cql3 layer while processing query results.
-        return to_json_string(*counter_cell_view::total_value_type(), bv);
+        to_json(*counter_cell_view::total_value_type(), bv, out);
     }
-    sstring operator()(const decimal_type_impl& t) {
+    void operator()(const decimal_type_impl& t) {
         if (bv.empty()) {
             throw exceptions::invalid_request_exception("Cannot create JSON string - deserialization error");
         }
         auto v = t.deserialize(bv);
-        return value_cast<big_decimal>(v).to_string();
+        write_json_raw(out, value_cast<big_decimal>(v).to_string());
     }
-    sstring operator()(const varint_type_impl& t) {
+    void operator()(const varint_type_impl& t) {
         if (bv.empty()) {
             throw exceptions::invalid_request_exception("Cannot create JSON string - deserialization error");
         }
         auto v = t.deserialize(bv);
-        return value_cast<utils::multiprecision_int>(v).str();
+        write_json_raw(out, value_cast<utils::multiprecision_int>(v).str());
     }
 };
 }
 
+void to_json(const abstract_type& t, bytes_view bv, bytes_ostream& out) {
+    visit(t, to_json_visitor{bv, out});
+}
+
+void to_json(const abstract_type& t, const managed_bytes_view& mbv, bytes_ostream& out) {
+    visit(t, to_json_visitor{linearized(mbv), out});
+}
+
 sstring to_json_string(const abstract_type& t, bytes_view bv) {
-    return visit(t, to_json_string_visitor{bv});
+    bytes_ostream out;
+    visit(t, to_json_visitor{bv, out});
+    auto lin = out.linearize();
+    return sstring(reinterpret_cast<const char*>(lin.data()), lin.size());
 }
 
 sstring to_json_string(const abstract_type& t, const managed_bytes_view& mbv) {
-    return visit(t, to_json_string_visitor{linearized(mbv)});
+    bytes_ostream out;
+    to_json(t, mbv, out);
+    auto lin = out.linearize();
+    return sstring(reinterpret_cast<const char*>(lin.data()), lin.size());
 }
@@ -10,8 +10,23 @@
 
 #include "types.hh"
 #include "utils/rjson.hh"
+#include "bytes_ostream.hh"
 
 bytes from_json_object(const abstract_type &t, const rjson::value& value, cql_serialization_format sf);
+
+// Streaming writers: append the JSON representation of a serialized value
+// directly to 'out', without materializing an intermediate string per value.
+void to_json(const abstract_type& t, bytes_view bv, bytes_ostream& out);
+void to_json(const abstract_type& t, const managed_bytes_view& mbv, bytes_ostream& out);
+
+inline void to_json(const abstract_type& t, const bytes_opt& b, bytes_ostream& out) {
+    if (b) {
+        to_json(t, bytes_view(*b), out);
+    } else {
+        out.write("null", 4);
+    }
+}
+
 sstring to_json_string(const abstract_type &t, bytes_view bv);
 sstring to_json_string(const abstract_type &t, const managed_bytes_view& bv);
 
@@ -155,7 +155,12 @@ future<> db::batchlog_manager::replay_all_failed_batches() {
     auto throttle = _replay_rate / _qp.proxy().get_token_metadata_ptr()->count_normal_token_owners();
     auto limiter = make_lw_shared<utils::rate_limiter>(throttle);
 
-    auto batch = [this, limiter](const cql3::untyped_result_set::row& row) {
+    // Deletions of successfully replayed batchlog entries are accumulated
+    // here and applied in bulk once per page, instead of a local mutation
+    // round per batch.
+    auto removals = make_lw_shared<std::vector<mutation>>();
+
+    auto batch = [this, limiter, removals](const cql3::untyped_result_set::row& row) {
         auto written_at = row.get_as<db_clock::time_point>("written_at");
         auto id = row.get_as<utils::UUID>("id");
         // enough time for the actual write + batchlog entry mutation delivery (two separate requests).
@@ -242,7 +247,7 @@ future<> db::batchlog_manager::replay_all_failed_batches() {
                 // See below, we use retry on write failure.
                 return _qp.proxy().mutate(mutations, db::consistency_level::ALL, db::no_timeout, nullptr, empty_service_permit(), db::allow_per_partition_rate_limit::no);
             });
-        }).then_wrapped([this, id](future<> batch_result) {
+        }).then_wrapped([this, removals, id](future<> batch_result) {
             try {
                 batch_result.get();
             } catch (data_dictionary::no_such_keyspace& ex) {
@@ -255,29 +260,35 @@ future<> db::batchlog_manager::replay_all_failed_batches() {
                 // we have to resort to keeping this batch to next lap.
                 return make_ready_future<>();
             }
-            // delete batch
+            // queue the batch deletion; it is applied when the page is done
             auto schema = _qp.db().find_schema(system_keyspace::NAME, system_keyspace::BATCHLOG);
             auto key = partition_key::from_singular(*schema, id);
             mutation m(schema, key);
             auto now = service::client_state(service::client_state::internal_tag()).get_timestamp();
             m.partition().apply_delete(*schema, clustering_key_prefix::make_empty(), tombstone(now, gc_clock::now()));
-            return _qp.proxy().mutate_locally(m, tracing::trace_state_ptr(), db::commitlog::force_sync::no);
+            removals->emplace_back(std::move(m));
+            return make_ready_future<>();
         });
     };
 
-    return seastar::with_gate(_gate, [this, batch = std::move(batch)] {
+    return seastar::with_gate(_gate, [this, batch = std::move(batch), removals] {
         blogger.debug("Started replayAllFailedBatches (cpu {})", this_shard_id());
 
         typedef ::shared_ptr<cql3::untyped_result_set> page_ptr;
         sstring query = format("SELECT id, data, written_at, version FROM {}.{} LIMIT {:d}", system_keyspace::NAME, system_keyspace::BATCHLOG, page_size);
-        return _qp.execute_internal(query, cql3::query_processor::cache_internal::yes).then([this, batch = std::move(batch)](page_ptr page) {
-            return do_with(std::move(page), [this, batch = std::move(batch)](page_ptr & page) mutable {
-                return repeat([this, &page, batch = std::move(batch)]() mutable {
+        return _qp.execute_internal(query, cql3::query_processor::cache_internal::yes).then([this, batch = std::move(batch), removals](page_ptr page) {
+            return do_with(std::move(page), [this, batch = std::move(batch), removals](page_ptr & page) mutable {
+                return repeat([this, &page, batch = std::move(batch), removals]() mutable {
                     if (page->empty()) {
                         return make_ready_future<stop_iteration>(stop_iteration::yes);
                     }
                     auto id = page->back().get_as<utils::UUID>("id");
-                    return parallel_for_each(*page, batch).then([this, &page, id]() {
+                    return parallel_for_each(*page, batch).then([this, removals] {
+                        if (removals->empty()) {
+                            return make_ready_future<>();
+                        }
+                        return _qp.proxy().mutate_locally(std::exchange(*removals, {}), tracing::trace_state_ptr());
+                    }).then([this, &page, id]() {
                         if (page->size() < page_size) {
                             return make_ready_future<stop_iteration>(stop_iteration::yes); // we've exhausted the batchlog, next query would be empty.
                         }
@@ -10,6 +10,7 @@
 
 #include "utils/lru.hh"
 #include "utils/logalloc.hh"
+#include "db/compressed_cache_tier.hh"
 #include "partition_version.hh"
 #include "mutation_cleaner.hh"
 
@@ -57,6 +58,7 @@ public:
         uint64_t partitions;
         uint64_t rows;
         uint64_t mispopulations;
+        uint64_t population_budget_cutoffs;
         uint64_t underlying_recreations;
         uint64_t underlying_partition_skips;
         uint64_t underlying_row_skips;
@@ -79,6 +81,10 @@ private:
     mutation_cleaner _garbage;
     mutation_cleaner _memtable_cleaner;
     mutation_application_stats& _app_stats;
+    compressed_cache_tier _compressed_tier;
+    // Maximum amount of data a single reader may insert into the cache per
+    // buffer fill. 0 means no limit. See row_cache_population_budget_in_kb.
+    size_t _population_budget = 0;
 private:
     void setup_metrics();
 public:
@@ -105,6 +111,7 @@ public:
     void on_row_miss() noexcept;
     void on_miss_already_populated() noexcept;
     void on_mispopulate() noexcept;
+    void on_population_budget_cutoff() noexcept;
     void on_row_processed_from_memtable() noexcept { ++_stats.rows_processed_from_memtable; }
     void on_row_dropped_from_memtable() noexcept { ++_stats.rows_dropped_from_memtable; }
     void on_row_merged_from_memtable() noexcept { ++_stats.rows_merged_from_memtable; }
@@ -115,10 +122,14 @@ public:
     logalloc::region& region() noexcept;
     const logalloc::region& region() const noexcept;
     mutation_cleaner& cleaner() noexcept { return _garbage; }
+    compressed_cache_tier& compressed_tier() noexcept { return _compressed_tier; }
+    const compressed_cache_tier& compressed_tier() const noexcept { return _compressed_tier; }
     mutation_cleaner& memtable_cleaner() noexcept { return _memtable_cleaner; }
     uint64_t partitions() const noexcept { return _stats.partitions; }
     const stats& get_stats() const noexcept { return _stats; }
     void set_compaction_scheduling_group(seastar::scheduling_group);
+    void set_population_budget(size_t bytes) noexcept { _population_budget = bytes; }
+    size_t population_budget() const noexcept { return _population_budget; }
     lru& get_lru() { return _lru; }
 };
 
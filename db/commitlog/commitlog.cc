@@ -108,6 +108,7 @@ db::commitlog::config db::commitlog::config::from_db_config(const db::config& cf
     c.extensions = &cfg.extensions();
     c.use_o_dsync = cfg.commitlog_use_o_dsync();
     c.allow_going_over_size_limit = !cfg.commitlog_use_hard_size_limit();
+    c.min_reserve_segments = cfg.commitlog_min_reserve_segments();
 
     if (cfg.commitlog_flush_threshold_in_mb() >= 0) {
         c.commitlog_flush_threshold_in_mb = cfg.commitlog_flush_threshold_in_mb();
@@ -1034,9 +1035,16 @@ public:
             });
 
             for (;;) {
-                auto current = *view.begin();
+                // Submit all fragments of the buffer as one vectored write,
+                // so a cycle costs a single I/O submission and completion no
+                // matter how fragmented the buffer got, instead of a
+                // sequential dma_write per fragment.
+                std::vector<iovec> iov;
+                for (bytes_view frag : view) {
+                    iov.emplace_back(iovec{ const_cast<bytes_view::value_type*>(frag.data()), frag.size() });
+                }
                 try {
-                    auto bytes = co_await _file.dma_write(off, current.data(), current.size(), priority_class);
+                    auto bytes = co_await _file.dma_write(off, std::move(iov), priority_class);
                     _segment_manager->totals.bytes_written += bytes;
                     _segment_manager->totals.active_size_on_disk += bytes;
                     ++_segment_manager->totals.cycle_count;
@@ -1381,7 +1389,10 @@ db::commitlog::segment_manager::segment_manager(config c)
     // than default_size at the end of the allocation, that allows for every valid mutation to
     // always be admitted for processing.
     , _request_controller(max_request_controller_units(), request_controller_timeout_exception_factory{})
-    , _reserve_segments(1)
+    // start the reserve at min_reserve_segments so the replenisher pre-creates
+    // that many segments right away instead of growing the pool only after a
+    // rollover finds it empty.
+    , _reserve_segments(std::max<size_t>(1, std::min(cfg.min_reserve_segments, cfg.max_reserve_segments)))
     , _recycled_segments(std::numeric_limits<size_t>::max())
     , _reserve_replenisher(make_ready_future<>())
     , _background_sync(make_ready_future<>())
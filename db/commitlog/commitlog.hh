@@ -98,6 +98,11 @@ public:
         // Max number of segments to keep in pre-alloc reserve.
         // Not (yet) configurable from scylla.conf.
         uint64_t max_reserve_segments = 12;
+        // Min number of segments to keep in pre-alloc reserve.
+        // By default the reserve starts at one segment and only grows when a
+        // rollover finds it empty; raising this keeps segments pre-created
+        // ahead of write bursts. Clamped to max_reserve_segments.
+        uint64_t min_reserve_segments = 0;
         // Max active flushes. Default value
         // zero means try to figure it out ourselves
         uint64_t max_active_flushes = 0;
@@ -11,8 +11,46 @@
 #include "idl/commitlog.dist.hh"
 #include "idl/commitlog.dist.impl.hh"
 
+#include <seastar/core/print.hh>
 #include <seastar/core/simple-stream.hh>
 
+#include <zstd.h>
+
+// A compressed entry is [magic][serialized size][zstd frame], with both
+// words little-endian. A plain entry starts with the IDL size word of
+// commitlog_entry, which equals the entry size and so can never be
+// 0xffffffff (segments are capped far below 4GB); the reader uses the
+// first word to tell the two formats apart.
+static constexpr uint32_t compressed_entry_magic = 0xffffffffu;
+static constexpr size_t compressed_entry_header_size = 2 * sizeof(uint32_t);
+
+// Entries are mutation-sized, so like for internode traffic the default
+// level is past the point of diminishing returns; cheaper levels mostly
+// give up ratio without making the store noticeably faster.
+static constexpr int compression_level = 3;
+
+static ZSTD_CCtx* compression_context() {
+    struct cctx_deleter {
+        void operator()(ZSTD_CCtx* ctx) const noexcept { ZSTD_freeCCtx(ctx); }
+    };
+    static thread_local std::unique_ptr<ZSTD_CCtx, cctx_deleter> ctx(ZSTD_createCCtx());
+    if (!ctx) {
+        throw std::bad_alloc();
+    }
+    return ctx.get();
+}
+
+static ZSTD_DCtx* decompression_context() {
+    struct dctx_deleter {
+        void operator()(ZSTD_DCtx* ctx) const noexcept { ZSTD_freeDCtx(ctx); }
+    };
+    static thread_local std::unique_ptr<ZSTD_DCtx, dctx_deleter> ctx(ZSTD_createDCtx());
+    if (!ctx) {
+        throw std::bad_alloc();
+    }
+    return ctx.get();
+}
+
 template<typename Output>
 void commitlog_entry_writer::serialize(Output& out) const {
     [this, wr = ser::writer_of_commitlog_entry<Output>(out)] () mutable {
@@ -28,16 +66,65 @@ void commitlog_entry_writer::compute_size() {
     seastar::measuring_output_stream ms;
     serialize(ms);
     _size = ms.size();
+    if (_compression == compression::yes) {
+        maybe_compress();
+    }
+}
+
+void commitlog_entry_writer::maybe_compress() {
+    _serialized_size = _size;
+    bytes plain(bytes::initialized_later(), _serialized_size);
+    auto plain_out = seastar::simple_memory_output_stream(reinterpret_cast<char*>(plain.data()), plain.size());
+    serialize(plain_out);
+    bytes compressed(bytes::initialized_later(), ZSTD_compressBound(plain.size()));
+    auto len = ZSTD_compressCCtx(compression_context(), compressed.data(), compressed.size(),
+            plain.data(), plain.size(), compression_level);
+    if (ZSTD_isError(len) || compressed_entry_header_size + len >= _serialized_size) {
+        // Didn't shrink (or zstd failed, which only incompressible input
+        // can cause here) - store the entry plain.
+        _compressed = {};
+        return;
+    }
+    compressed.resize(len);
+    _compressed = std::move(compressed);
+    _size = compressed_entry_header_size + len;
 }
 
 void commitlog_entry_writer::write(typename seastar::memory_output_stream<std::vector<temporary_buffer<char>>::iterator>& out) const {
+    if (!_compressed.empty()) {
+        ser::serialize(out, compressed_entry_magic);
+        ser::serialize(out, static_cast<uint32_t>(_serialized_size));
+        out.write(reinterpret_cast<const char*>(_compressed.data()), _compressed.size());
+        return;
+    }
     serialize(out);
 }
 
-commitlog_entry_reader::commitlog_entry_reader(const fragmented_temporary_buffer& buffer)
-    : _ce([&] {
+static commitlog_entry deserialize_entry(const fragmented_temporary_buffer& buffer) {
     auto in = seastar::fragmented_memory_input_stream(fragmented_temporary_buffer::view(buffer).begin(), buffer.size_bytes());
+    if (buffer.size_bytes() >= compressed_entry_header_size) {
+        auto compressed_in = in;
+        if (ser::deserialize(compressed_in, boost::type<uint32_t>()) == compressed_entry_magic) {
+            auto serialized_size = ser::deserialize(compressed_in, boost::type<uint32_t>());
+            bytes compressed(bytes::initialized_later(), buffer.size_bytes() - compressed_entry_header_size);
+            compressed_in.read(reinterpret_cast<char*>(compressed.data()), compressed.size());
+            bytes plain(bytes::initialized_later(), serialized_size);
+            auto len = ZSTD_decompressDCtx(decompression_context(), plain.data(), plain.size(),
+                    compressed.data(), compressed.size());
+            if (ZSTD_isError(len)) {
+                throw std::runtime_error(format("Corrupted compressed commitlog entry: {}", ZSTD_getErrorName(len)));
+            }
+            if (len != serialized_size) {
+                throw std::runtime_error(format("Corrupted compressed commitlog entry: expected {} bytes, got {}", serialized_size, len));
+            }
+            auto plain_in = seastar::simple_input_stream(reinterpret_cast<const char*>(plain.data()), plain.size());
+            return ser::deserialize(plain_in, boost::type<commitlog_entry>());
+        }
+    }
     return ser::deserialize(in, boost::type<commitlog_entry>());
-}())
+}
+
+commitlog_entry_reader::commitlog_entry_reader(const fragmented_temporary_buffer& buffer)
+    : _ce(deserialize_entry(buffer))
 {
 }
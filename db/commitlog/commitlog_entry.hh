@@ -10,6 +10,7 @@
 
 #include <optional>
 
+#include "bytes.hh"
 #include "commitlog_types.hh"
 #include "frozen_mutation.hh"
 #include "schema_fwd.hh"
@@ -28,19 +29,27 @@ public:
 class commitlog_entry_writer {
 public:
     using force_sync = db::commitlog_force_sync;
+    using compression = db::commitlog_entry_compression;
 private:
     schema_ptr _schema;
     const frozen_mutation& _mutation;
     bool _with_schema = true;
     size_t _size = std::numeric_limits<size_t>::max();
     force_sync _sync;
+    compression _compression;
+    // When compression is requested and actually shrinks the entry, holds
+    // the zstd frame which write() emits instead of the plain serialization,
+    // and _serialized_size remembers the plain size for the envelope.
+    bytes _compressed;
+    size_t _serialized_size = 0;
 private:
     template<typename Output>
     void serialize(Output&) const;
     void compute_size();
+    void maybe_compress();
 public:
-    commitlog_entry_writer(schema_ptr s, const frozen_mutation& fm, force_sync sync)
-        : _schema(std::move(s)), _mutation(fm), _sync(sync)
+    commitlog_entry_writer(schema_ptr s, const frozen_mutation& fm, force_sync sync, compression c = compression::no)
+        : _schema(std::move(s)), _mutation(fm), _sync(sync), _compression(c)
     {}
 
     void set_with_schema(bool value) {
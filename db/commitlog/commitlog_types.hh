@@ -16,4 +16,6 @@ namespace db {
 
 using commitlog_force_sync = bool_class<class force_sync_tag>;
 
+using commitlog_entry_compression = bool_class<class entry_compression_tag>;
+
 }
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include "db/compressed_cache_tier.hh"
+#include "compress.hh"
+#include "frozen_mutation.hh"
+#include "mutation.hh"
+
+size_t compressed_cache_tier::footprint(const entry& e) const noexcept {
+    return e.compressed.size() + e.key.key().external_memory_usage() + entry_overhead;
+}
+
+void compressed_cache_tier::remove(lru_type::iterator it, bool is_eviction) {
+    _stats.used_bytes -= footprint(*it);
+    --_stats.entries;
+    if (is_eviction) {
+        ++_stats.evictions;
+    } else {
+        ++_stats.removals;
+    }
+    // The table sub-map is left in place even when it becomes empty; it is
+    // erased when the table is dropped (invalidate(table)).
+    _tables.find(it->table)->second.erase(it->key);
+    _lru.erase(it);
+}
+
+void compressed_cache_tier::evict_to_fit(size_t incoming) {
+    while (!_lru.empty() && _stats.used_bytes + incoming > _capacity) {
+        remove(std::prev(_lru.end()), true);
+    }
+}
+
+void compressed_cache_tier::set_capacity(size_t bytes) {
+    _capacity = bytes;
+    evict_to_fit(0);
+}
+
+void compressed_cache_tier::insert(schema_ptr s, const dht::decorated_key& dk, const frozen_mutation& fm) {
+    if (!enabled()) {
+        return;
+    }
+    const bytes_ostream& repr = fm.representation();
+    bytes linear(bytes::initialized_later(), repr.size());
+    auto out = linear.begin();
+    for (bytes_view frag : repr.fragments()) {
+        out = std::copy(frag.begin(), frag.end(), out);
+    }
+    const compressor& comp = *compressor::lz4;
+    bytes buf(bytes::initialized_later(), comp.compress_max_size(linear.size()));
+    size_t compressed_size = comp.compress(reinterpret_cast<const char*>(linear.data()), linear.size(),
+            reinterpret_cast<char*>(buf.data()), buf.size());
+    entry e{s->id(), dk, s, bytes(buf.data(), compressed_size), linear.size()};
+    size_t size = footprint(e);
+    if (size > _capacity) {
+        return;
+    }
+    auto [t, created] = _tables.try_emplace(e.table, dht::decorated_key::less_comparator(s));
+    auto i = t->second.find(dk);
+    if (i != t->second.end()) {
+        remove(i->second, false);
+    }
+    evict_to_fit(size);
+    _lru.push_front(std::move(e));
+    t->second.emplace(_lru.front().key, _lru.begin());
+    _stats.used_bytes += size;
+    ++_stats.entries;
+    ++_stats.insertions;
+}
+
+std::optional<mutation> compressed_cache_tier::take(const utils::UUID& table, const dht::decorated_key& dk) {
+    if (!enabled()) {
+        return std::nullopt;
+    }
+    auto t = _tables.find(table);
+    if (t == _tables.end()) {
+        ++_stats.misses;
+        return std::nullopt;
+    }
+    auto i = t->second.find(dk);
+    if (i == t->second.end()) {
+        ++_stats.misses;
+        return std::nullopt;
+    }
+    entry& e = *i->second;
+    const compressor& comp = *compressor::lz4;
+    bytes linear(bytes::initialized_later(), e.uncompressed_size);
+    comp.uncompress(reinterpret_cast<const char*>(e.compressed.data()), e.compressed.size(),
+            reinterpret_cast<char*>(linear.data()), linear.size());
+    bytes_ostream repr;
+    repr.write(bytes_view(linear));
+    auto m = frozen_mutation(std::move(repr)).unfreeze(e.schema);
+    remove(i->second, false);
+    ++_stats.hits;
+    return m;
+}
+
+void compressed_cache_tier::invalidate(const utils::UUID& table, const dht::decorated_key& dk) {
+    auto t = _tables.find(table);
+    if (t == _tables.end()) {
+        return;
+    }
+    auto i = t->second.find(dk);
+    if (i != t->second.end()) {
+        remove(i->second, false);
+    }
+}
+
+void compressed_cache_tier::invalidate(const utils::UUID& table, const dht::partition_range& range) {
+    auto t = _tables.find(table);
+    if (t == _tables.end()) {
+        return;
+    }
+    partitions_type& p = t->second;
+    auto begin = range.start()
+            ? (range.start()->is_inclusive() ? p.lower_bound(range.start()->value()) : p.upper_bound(range.start()->value()))
+            : p.begin();
+    auto end = range.end()
+            ? (range.end()->is_inclusive() ? p.upper_bound(range.end()->value()) : p.lower_bound(range.end()->value()))
+            : p.end();
+    while (begin != end) {
+        auto cur = begin++;
+        remove(cur->second, false);
+    }
+}
+
+void compressed_cache_tier::invalidate(const utils::UUID& table) {
+    auto t = _tables.find(table);
+    if (t == _tables.end()) {
+        return;
+    }
+    for (auto&& [key, it] : t->second) {
+        _stats.used_bytes -= footprint(*it);
+        --_stats.entries;
+        ++_stats.removals;
+        _lru.erase(it);
+    }
+    _tables.erase(t);
+}
+
+void compressed_cache_tier::clear() {
+    _stats.removals += _stats.entries;
+    _stats.entries = 0;
+    _stats.used_bytes = 0;
+    _tables.clear();
+    _lru.clear();
+}
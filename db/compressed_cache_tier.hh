@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+#include "bytes.hh"
+#include "dht/i_partitioner.hh"
+#include "schema_fwd.hh"
+#include "utils/UUID.hh"
+
+class frozen_mutation;
+class mutation;
+
+// A second cache tier which keeps whole partitions in frozen,
+// LZ4-compressed form, outside the LSA region used by row_cache.
+//
+// The tier is populated when a single-partition read misses row_cache and
+// streams a complete partition from the underlying mutation source. When a
+// later read misses row_cache again (e.g. because the entry was evicted),
+// the compressed copy is decompressed and promoted back through the regular
+// population path, turning what would have been a disk read into a
+// decompression. Compressed partitions are several times smaller than their
+// deserialized form, so the tier extends cache residency of the long tail.
+//
+// Entries always reflect the current underlying snapshot: row_cache purges
+// the affected keys whenever the underlying mutation source changes
+// (memtable flush, invalidation, table drop). Eviction is LRU within a
+// fixed byte budget, with a clock independent from that of the
+// uncompressed tier.
+//
+// All methods are synchronous and must be called from the owning shard.
+class compressed_cache_tier final {
+public:
+    struct stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        uint64_t removals = 0;
+        uint64_t used_bytes = 0;
+        uint64_t entries = 0;
+    };
+private:
+    struct entry {
+        utils::UUID table;
+        dht::decorated_key key;
+        schema_ptr schema; // the schema the mutation was frozen with
+        bytes compressed;
+        size_t uncompressed_size;
+    };
+    // Rough footprint of an entry beyond the compressed blob itself
+    // (list node, map node, decorated key).
+    static constexpr size_t entry_overhead = 128;
+    using lru_type = std::list<entry>;
+    using partitions_type = std::map<dht::decorated_key, lru_type::iterator, dht::decorated_key::less_comparator>;
+private:
+    lru_type _lru; // front is the most recently used
+    std::unordered_map<utils::UUID, partitions_type> _tables;
+    size_t _capacity = 0;
+    stats _stats;
+private:
+    size_t footprint(const entry&) const noexcept;
+    void remove(lru_type::iterator, bool is_eviction);
+    void evict_to_fit(size_t incoming);
+public:
+    // Sets the total byte budget. Zero disables the tier and drops all entries.
+    void set_capacity(size_t bytes);
+    size_t capacity() const noexcept { return _capacity; }
+    bool enabled() const noexcept { return _capacity != 0; }
+
+    // Stores a complete partition, replacing any previous entry for the key.
+    // The frozen mutation must represent the whole partition as present in
+    // the current underlying snapshot. No-op when disabled or when the
+    // partition alone exceeds the budget.
+    void insert(schema_ptr, const dht::decorated_key&, const frozen_mutation&);
+
+    // Takes the partition for the given key out of the tier, if present.
+    // The caller is expected to promote the result into the uncompressed tier.
+    std::optional<mutation> take(const utils::UUID& table, const dht::decorated_key&);
+
+    void invalidate(const utils::UUID& table, const dht::decorated_key&);
+    void invalidate(const utils::UUID& table, const dht::partition_range&);
+    // Drops all entries of the given table.
+    void invalidate(const utils::UUID& table);
+    void clear();
+
+    const stats& get_stats() const noexcept { return _stats; }
+};
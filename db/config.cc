@@ -374,6 +374,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , compaction_throughput_mb_per_sec(this, "compaction_throughput_mb_per_sec", liveness::LiveUpdate, value_status::Used, 0,
         "Throttles compaction to the specified total throughput across the entire system. The faster you insert data, the faster you need to compact in order to keep the SSTable count down. The recommended Value is 16 to 32 times the rate of write throughput (in MBs/second). Setting the value to 0 disables compaction throttling.\n"
         "Related information: Configuring compaction")
+    , compaction_throughput_autotune(this, "compaction_throughput_autotune", value_status::Used, false,
+        "Measure the sequential read, write and compression throughput achievable by compaction with a short micro-benchmark at startup, and override compaction_throughput_mb_per_sec with the measured value. Useful on fleets spanning several hardware generations where no static setting fits all nodes.")
     , compaction_large_partition_warning_threshold_mb(this, "compaction_large_partition_warning_threshold_mb", liveness::LiveUpdate, value_status::Used, 1000,
         "Log a warning when writing partitions larger than this value")
     , compaction_large_row_warning_threshold_mb(this, "compaction_large_row_warning_threshold_mb", liveness::LiveUpdate, value_status::Used, 10,
@@ -436,6 +438,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Whether or not to use O_DSYNC mode for commitlog segments IO. Can improve commitlog latency on some file systems.\n")
     , commitlog_use_hard_size_limit(this, "commitlog_use_hard_size_limit", value_status::Used, false,
         "Whether or not to use a hard size limit for commitlog disk usage. Default is false. Enabling this can cause latency spikes, whereas the default can lead to occasional disk usage peaks.\n")
+    , commitlog_min_reserve_segments(this, "commitlog_min_reserve_segments", value_status::Used, 0,
+        "Minimum number of pre-allocated commitlog segments to keep in reserve, per shard. With the default of 0 the reserve starts at one segment and grows on demand, so a write burst can stall on segment creation at rollover. Setting this keeps the given number of segments created and pre-extended ahead of time at the cost of the corresponding disk space, making rollover a rename plus a header write.\n")
     /* Compaction settings */
     /* Related information: Configuring compaction */
     , compaction_preheat_key_cache(this, "compaction_preheat_key_cache", value_status::Unused, true,
@@ -488,6 +492,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Throttles all streaming file transfer between the data centers. This setting allows throttles streaming throughput betweens data centers in addition to throttling all network stream traffic as configured with stream_throughput_outbound_megabits_per_sec.")
     , stream_io_throughput_mb_per_sec(this, "stream_io_throughput_mb_per_sec", liveness::LiveUpdate, value_status::Used, 0,
         "Throttles streaming I/O to the specified total throughput (in MiBs/s) across the entire system. Streaming I/O includes the one performed by repair and both RBNO and legacy topology operations such as adding or removing a node. Setting the value to 0 disables stream throttling")
+    , stream_max_concurrent_transfers(this, "stream_max_concurrent_transfers", liveness::LiveUpdate, value_status::Used, 4,
+        "Upper bound on the number of tables a streaming session sends in parallel. A session starts with a single transfer and raises the parallelism by one each time a transfer completes without streaming reads queueing up; when they do queue, the parallelism is halved. Set to 1 for the previous strictly serial behavior.")
     , trickle_fsync(this, "trickle_fsync", value_status::Unused, false,
         "When doing sequential writing, enabling this option tells fsync to force the operating system to flush the dirty buffers at a set interval trickle_fsync_interval_in_kb. Enable this parameter to avoid sudden dirty buffer flushing from impacting read latencies. Recommended to use on SSDs, but not on HDDs.")
     , trickle_fsync_interval_in_kb(this, "trickle_fsync_interval_in_kb", value_status::Unused, 10240,
@@ -565,6 +571,22 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "The maximum number of tombstones a query can scan before aborting.")
     , query_tombstone_page_limit(this, "query_tombstone_page_limit", liveness::LiveUpdate, value_status::Used, 10000,
         "The number of tombstones after which a query cuts a page, even if not full or even empty.")
+    , query_page_prefetch(this, "query_page_prefetch", liveness::LiveUpdate, value_status::Used, false,
+        "After serving a page of a paged query, speculatively read the next page in the background so a sequentially "
+        "paging client finds it ready on the coordinator. Hides per-page read latency for bulk scans at the cost of "
+        "one page of lookahead per active paging session; the speculative read reflects the data as of the time it ran.")
+    , query_page_size_in_bytes(this, "query_page_size_in_bytes", liveness::LiveUpdate, value_status::Used, 1024 * 1024,
+        "Byte budget for a single page of a paged query. Clients request page sizes in rows; with large rows a "
+        "row-based page can grow far past what a single response should carry. The coordinator estimates the "
+        "average row size from the pages it has already served and caps the row count of subsequent pages so that "
+        "a page stays near this budget. Pages are only ever shrunk, never grown past the client's requested row "
+        "count. Set to 0 to disable the cap.")
+    , write_coalescing_window_in_us(this, "write_coalescing_window_in_us", liveness::LiveUpdate, value_status::Used, 0,
+        "When positive, a coordinator write holds back for this many microseconds and other writes to the same "
+        "partition arriving within the window are merged into it, so replicas apply one combined mutation and the "
+        "merged writes share one round of acknowledgments. Helps hot-partition ingest workloads at the cost of the "
+        "window's worth of added write latency. Does not apply to counter writes, LWT or CDC-enabled tables. "
+        "Set to 0 (the default) to disable.")
     /* Network timeout settings */
     , range_request_timeout_in_ms(this, "range_request_timeout_in_ms", value_status::Used, 10000,
         "The time in milliseconds that the coordinator waits for sequential or index scans to complete.")
@@ -572,6 +594,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "The time that the coordinator waits for read operations to complete")
     , counter_write_request_timeout_in_ms(this, "counter_write_request_timeout_in_ms", value_status::Used, 5000,
         "The time that the coordinator waits for counter writes to complete.")
+    , counter_write_combining_window_in_ms(this, "counter_write_combining_window_in_ms", value_status::Used, 0,
+        "Window in milliseconds during which counter updates to the same partition are combined into a single read-modify-write on the counter leader. "
+        "Combining reduces the number of read-before-write cycles for workloads which increment the same counters at a high rate, at the cost of up to "
+        "the window's worth of extra write latency. Set to 0 (the default) to disable combining.")
     , cas_contention_timeout_in_ms(this, "cas_contention_timeout_in_ms", value_status::Used, 1000,
         "The time that the coordinator continues to retry a CAS (compare and set) operation that contends with other proposals for the same row.")
     , truncate_request_timeout_in_ms(this, "truncate_request_timeout_in_ms", value_status::Used, 60000,
@@ -582,6 +608,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , request_timeout_in_ms(this, "request_timeout_in_ms", value_status::Used, 10000,
         "The default timeout for other, miscellaneous operations.\n"
         "Related information: About hinted handoff writes")
+    , mutation_forwarding_in_local_dc(this, "mutation_forwarding_in_local_dc", liveness::LiveUpdate, value_status::Used, false,
+        "Have a write coordinator serialize and send each mutation once per datacenter, including its own: one local replica receives it and forwards it to the remaining local replicas, as is always done for remote datacenters. This saves coordinator CPU and outgoing bandwidth on large writes at the cost of an extra network hop of latency for the forwarded replicas.")
     /* Inter-node settings */
     , cross_node_timeout(this, "cross_node_timeout", value_status::Unused, false,
         "Enable or disable operation timeout information exchange between nodes (to accurately measure request timeouts). If disabled Cassandra assumes the request was forwarded to the replica instantly by the coordinator.\n"
@@ -603,6 +631,11 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "\tall: All traffic is compressed.\n"
         "\tdc : Traffic between data centers is compressed.\n"
         "\tnone : No compression.")
+    , internode_compression_zstd(this, "internode_compression_zstd", value_status::Used, false,
+        "Use zstd instead of lz4 for compressed traffic between data centers. Trades more CPU for a "
+        "noticeably better compression ratio, which usually pays off on bandwidth-bound (and often "
+        "metered) cross-DC links. Traffic within a data center keeps using lz4. Negotiated per "
+        "connection, so it is safe to enable during a rolling upgrade.")
     , inter_dc_tcp_nodelay(this, "inter_dc_tcp_nodelay", value_status::Used, false,
         "Enable or disable tcp_nodelay for inter-data center communication. When disabled larger, but fewer, network packets are sent. This reduces overhead from the TCP protocol itself. However, if cross data-center responses are blocked, it will increase latency.")
     , streaming_socket_timeout_in_ms(this, "streaming_socket_timeout_in_ms", value_status::Unused, 0,
@@ -629,6 +662,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Idle threads are stopped after 30 seconds.\n")
     , native_transport_max_frame_size_in_mb(this, "native_transport_max_frame_size_in_mb", value_status::Unused, 256,
         "The maximum size of allowed frame. Frame (requests) larger than this are rejected as invalid.")
+    , native_transport_connection_setup_shares(this, "native_transport_connection_setup_shares", value_status::Used, 200,
+        "CPU shares of the scheduling group in which new CQL connections are set up. The setup phase covers the TLS handshake (driven by the first read on the socket), so reconnect storms of full handshakes compete with each other for this group's shares instead of with statement execution on established connections. Set to 0 to run connection setup inline in the statement scheduling group.")
     /* RPC (remote procedure call) settings */
     /* Settings for configuring and tuning client connections. */
     , broadcast_rpc_address(this, "broadcast_rpc_address", value_status::Used, {/* unset */},
@@ -676,6 +711,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Related information: Failure detection and recovery")
     , max_hints_delivery_threads(this, "max_hints_delivery_threads", value_status::Invalid, 2,
         "Number of threads with which to deliver hints. In multiple data-center deployments, consider increasing this number because cross data-center handoff is generally slower.")
+    , hints_compression_enabled(this, "hints_compression_enabled", liveness::LiveUpdate, value_status::Used, false,
+        "Compress hints with zstd before they are written to disk. Hints carry whole mutations, so this typically shrinks hint files severalfold at a small CPU cost. Files written with compression enabled stay readable after the option is turned off, and vice versa.")
     , batchlog_replay_throttle_in_kb(this, "batchlog_replay_throttle_in_kb", value_status::Unused, 1024,
         "Total maximum throttle. Throttling is reduced proportionally to the number of nodes in the cluster.")
     /* Request scheduler properties */
@@ -733,6 +770,12 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Refresh interval for permissions cache (if enabled). After this interval, cache entries become eligible for refresh. An async reload is scheduled every permissions_update_interval_in_ms time period and the old value is returned until it completes. If permissions_validity_in_ms has a non-zero value, then this property must also have a non-zero value. It's recommended to set this value to be at least 3 times smaller than the permissions_validity_in_ms.")
     , permissions_cache_max_entries(this, "permissions_cache_max_entries", liveness::LiveUpdate, value_status::Used, 1000,
         "Maximum cached permission entries. Must have a non-zero value if permissions caching is enabled (see a permissions_validity_in_ms description).")
+    , credentials_validity_in_ms(this, "credentials_validity_in_ms", liveness::LiveUpdate, value_status::Used, 2000,
+        "How long the salted password hashes cached by PasswordAuthenticator remain valid. Every authentication attempt otherwise reads the role's hash from the system tables, which makes connection storms expensive. Credentials caching is disabled when this property is set to 0. A password change is picked up by other nodes when the cached entry expires or is refreshed, so keep this short.")
+    , credentials_update_interval_in_ms(this, "credentials_update_interval_in_ms", liveness::LiveUpdate, value_status::Used, 2000,
+        "Refresh interval for the credentials cache (if enabled). After this interval, cache entries become eligible for refresh. An async reload is scheduled every credentials_update_interval_in_ms time period and the old value is returned until it completes. If credentials_validity_in_ms has a non-zero value, then this property must also have a non-zero value.")
+    , credentials_cache_max_entries(this, "credentials_cache_max_entries", liveness::LiveUpdate, value_status::Used, 1000,
+        "Maximum cached credentials entries. Must have a non-zero value if credentials caching is enabled (see a credentials_validity_in_ms description).")
     , server_encryption_options(this, "server_encryption_options", value_status::Used, {/*none*/},
         "Enable or disable inter-node encryption. You must also generate keys and provide the appropriate key and trust store locations and passwords. The available options are:\n"
         "\n"
@@ -778,6 +821,16 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "The SSL port for encrypted communication. Unused unless enabled in encryption_options.")
     , enable_in_memory_data_store(this, "enable_in_memory_data_store", value_status::Used, false, "Enable in memory mode (system tables are always persisted)")
     , enable_cache(this, "enable_cache", value_status::Used, true, "Enable cache")
+    , compressed_row_cache_size_in_mb(this, "compressed_row_cache_size_in_mb", value_status::Used, 0,
+        "Per-shard size in MB of the compressed row cache tier, which keeps recently read partitions in frozen, LZ4-compressed form outside the row cache proper. 0 disables the tier.")
+    , row_cache_population_budget_in_kb(this, "row_cache_population_budget_in_kb", value_status::Used, 0,
+        "Maximum amount of data in KB which a single read may insert into the row cache per buffer fill. Bounds cache allocation pressure when reads miss on very large partitions; rows beyond the budget are still returned to the client but left uncached, to be populated incrementally by later reads. 0 disables the limit.")
+    , query_result_cache_size_in_mb(this, "query_result_cache_size_in_mb", value_status::Used, 0,
+        "Per-shard size in MB of the query result cache, which serves repeated identical single-partition data reads from cached serialized pages. 0 disables the cache.")
+    , adaptive_concurrent_reads(this, "adaptive_concurrent_reads", value_status::Used, false,
+        "Adjust the concurrency limit of user reads dynamically based on the measured admission wait time, instead of always admitting up to the static per-shard maximum. Tightens concurrency when the disk is saturated and opens it up when it is idle.")
+    , adaptive_reader_memory(this, "adaptive_reader_memory", value_status::Used, false,
+        "Shift memory budget between the row cache and user read permits based on permit queueing and the cache hit rate. Lets scan-heavy periods use more permit memory at the expense of a cache that is not producing hits, and gives the memory back to the cache when the scans stop.")
     , enable_commitlog(this, "enable_commitlog", value_status::Used, true, "Enable commitlog")
     , volatile_system_keyspace_for_testing(this, "volatile_system_keyspace_for_testing", value_status::Used, false, "Don't persist system keyspace - testing only!")
     , api_port(this, "api_port", value_status::Used, 10000, "Http Rest API port")
@@ -813,6 +866,35 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , unspooled_dirty_soft_limit(this, "unspooled_dirty_soft_limit", value_status::Used, 0.6, "Soft limit of unspooled dirty memory expressed as a portion of the hard limit")
     , sstable_summary_ratio(this, "sstable_summary_ratio", value_status::Used, 0.0005, "Enforces that 1 byte of summary is written for every N (2000 by default) "
         "bytes written to data file. Value must be between 0 and 1.")
+    , sstable_range_scan_read_ahead(this, "sstable_range_scan_read_ahead", liveness::LiveUpdate, value_status::Used, 8,
+        "Number of buffers read ahead of the consumer by sequential sstable data file scans issued by queries and streaming. "
+        "Larger windows keep analytics full-table scans fed while other work shares the disk, at the cost of memory and possibly wasted reads.")
+    , sstable_compaction_read_ahead(this, "sstable_compaction_read_ahead", liveness::LiveUpdate, value_status::Used, 4,
+        "Number of buffers read ahead of the consumer by sstable data file scans issued by compaction. "
+        "Sized separately from query scans so compaction readahead doesn't compete with latency-sensitive reads.")
+    , sstable_compaction_read_buffer_size_in_kb(this, "sstable_compaction_read_buffer_size_in_kb", liveness::LiveUpdate, value_status::Used, 1024,
+        "Buffer size, in KiB, of sstable data file reads issued by compaction. Compaction merges many inputs at once, "
+        "so with small buffers the disk sees their reads finely interleaved; larger buffers make each input advance in "
+        "long sequential bursts, which modern disks serve at much higher bandwidth. Memory in flight per input is this "
+        "size times sstable_compaction_read_ahead.")
+    , sstable_index_cache_warmup(this, "sstable_index_cache_warmup", value_status::Used, false,
+        "Re-populate the sstable index page caches in the background after startup, newest sstables first, under a small memory budget. "
+        "Reduces the elevated read latency right after a restart, when the first reads against each sstable stall on cold index caches.")
+    , row_cache_warmup(this, "row_cache_warmup", value_status::Used, false,
+        "Periodically save the partition keys held in each table's row cache to a system table, and re-read those partitions "
+        "through the normal read path in the background after startup. Restores the caches' warm working set after a restart "
+        "instead of waiting for client reads to rebuild it.")
+    , row_cache_warmup_dump_period_in_seconds(this, "row_cache_warmup_dump_period_in_seconds", value_status::Used, 600,
+        "How often to save the row caches' partition keys when row_cache_warmup is enabled. "
+        "The dump only records keys, not data, so it is cheap; shorter periods keep the saved working set fresher.")
+    , sstable_compressed_chunk_cache_size_in_mb(this, "sstable_compressed_chunk_cache_size_in_mb", value_status::Used, 0,
+        "Per-shard capacity, in MiB, of the cache of compressed sstable data chunks, held outside the LSA-managed caches. "
+        "A hit serves the chunk from memory instead of disk but still pays for decompression, making this a cheap middle tier "
+        "for workloads whose compressed working set fits in memory while the uncompressed one does not. Set to 0 (the default) to disable.")
+    , components_memory_reclaim_threshold(this, "components_memory_reclaim_threshold", liveness::LiveUpdate, value_status::Used, 0.2,
+        "Ratio of a shard's memory that the in-memory bloom filters of its sstables may occupy. Above the threshold, filters are "
+        "reclaimed, largest first, until the total fits again. A reclaimed filter treats every key as possibly present, so reads of "
+        "keys an sstable does not hold fall back to its index; reads stay correct. Set to 1 to never reclaim.")
     , large_memory_allocation_warning_threshold(this, "large_memory_allocation_warning_threshold", value_status::Used, size_t(1) << 20, "Warn about memory allocations above this size; set to zero to disable")
     , enable_deprecated_partitioners(this, "enable_deprecated_partitioners", value_status::Used, false, "Enable the byteordered and random partitioners. These partitioners are deprecated and will be removed in a future version.")
     , enable_keyspace_column_family_metrics(this, "enable_keyspace_column_family_metrics", value_status::Used, false, "Enable per keyspace and per column family metrics reporting")
@@ -844,8 +926,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
             "This is the hard limit, queries violating this limit will be aborted.")
     , twcs_max_window_count(this, "twcs_max_window_count", liveness::LiveUpdate, value_status::Used, 50,
             "The maximum number of compaction windows allowed when making use of TimeWindowCompactionStrategy. A setting of 0 effectively disables the restriction.")
-    , initial_sstable_loading_concurrency(this, "initial_sstable_loading_concurrency", value_status::Used, 4u,
-            "Maximum amount of sstables to load in parallel during initialization. A higher number can lead to more memory consumption. You should not need to touch this")
+    , initial_sstable_loading_concurrency(this, "initial_sstable_loading_concurrency", value_status::Used, 16u,
+            "Maximum amount of sstables to load in parallel during initialization. Component opens during startup are many small reads, so a deep queue keeps the disk busy and shortens cold boot on nodes with many sstables. A higher number can lead to more memory consumption. You should not need to touch this")
     , enable_3_1_0_compatibility_mode(this, "enable_3_1_0_compatibility_mode", value_status::Used, false,
         "Set to true if the cluster was initially installed from 3.1.0. If it was upgraded from an earlier version,"
         " or installed from a later version, leave this set to false. This adjusts the communication protocol to"
@@ -858,6 +940,12 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Time period in seconds after which unused schema versions will be evicted from the local schema registry cache. Default is 1 second.")
     , max_concurrent_requests_per_shard(this, "max_concurrent_requests_per_shard",liveness::LiveUpdate, value_status::Used, std::numeric_limits<uint32_t>::max(),
         "Maximum number of concurrent requests a single shard can handle before it starts shedding extra load. By default, no requests will be shed.")
+    , max_queued_requests_per_shard(this, "max_queued_requests_per_shard", liveness::LiveUpdate, value_status::Used, std::numeric_limits<uint32_t>::max(),
+        "Maximum number of CQL requests that may be queued waiting for a shard's request memory before further interactive requests are rejected with an Overloaded error right after the frame header, before their bodies are read. By default the queue is unbounded.")
+    , shed_queued_requests_reactor_utilization(this, "shed_queued_requests_reactor_utilization", liveness::LiveUpdate, value_status::Used, 0,
+        "When CQL requests are already queued waiting for a shard's request memory and the reactor utilization is at or above this fraction (between 0 and 1), further interactive requests are rejected with an Overloaded error right after the frame header, before their bodies are read. 0 (the default) disables the check.")
+    , service_level_cpu_budget_ms_per_second(this, "service_level_cpu_budget_ms_per_second", liveness::LiveUpdate, value_status::Used, 0,
+        "Milliseconds of statement execution time each service level may consume per shard per second of wall-clock time. Statements of a service level that overdrew its budget are delayed at admission until the budget recovers, so a runaway workload cannot starve other service levels. 0 (the default) disables the enforcement; execution time is still metered and exposed per service level.")
     , cdc_dont_rewrite_streams(this, "cdc_dont_rewrite_streams", value_status::Used, false,
             "Disable rewriting streams from cdc_streams_descriptions to cdc_streams_descriptions_v2. Should not be necessary, but the procedure is expensive and prone to failures; this config option is left as a backdoor in case some user requires manual intervention.")
     , strict_allow_filtering(this, "strict_allow_filtering", liveness::LiveUpdate, value_status::Used, strict_allow_filtering_default(), "Match Cassandra in requiring ALLOW FILTERING on slow queries. Can be true, false, or warn. When false, Scylla accepts some slow queries even without ALLOW FILTERING that Cassandra rejects. Warn is same as false, but with warning.")
@@ -865,10 +953,18 @@ db::config::config(std::shared_ptr<db::extensions> exts)
             "Bypass in-memory data cache (the row cache) when performing reversed queries.")
     , enable_optimized_reversed_reads(this, "enable_optimized_reversed_reads", liveness::LiveUpdate, value_status::Used, true,
             "Use a new optimized algorithm for performing reversed reads.")
+    , memtable_flush_streams(this, "memtable_flush_streams", liveness::LiveUpdate, value_status::Used, 1,
+            "Number of concurrent output streams a single memtable flush is split into. Values above 1 partition the memtable by token into that many sub-ranges, each written to its own sstable concurrently, and register the outputs as one sstable run. Improves flush parallelism on drives with multiple channels; small memtables are still flushed as a single stream.")
+    , write_dedup_window_size(this, "write_dedup_window_size", liveness::LiveUpdate, value_status::Used, 0,
+            "Number of recent writes per table and shard whose hashes are remembered to suppress exact duplicate mutations (same partition, same cells, same timestamps) before they reach the commitlog and memtable. Only safe for workloads whose writes carry explicit timestamps and are idempotent, e.g. aggressively retrying producers. 0 (the default) disables the filter.")
     , enable_cql_config_updates(this, "enable_cql_config_updates", liveness::LiveUpdate, value_status::Used, true,
             "Make the system.config table UPDATEable")
     , enable_parallelized_aggregation(this, "enable_parallelized_aggregation", liveness::LiveUpdate, value_status::Used, true,
             "Use on a new, parallel algorithm for performing aggregate queries.")
+    , tracing_backend(this, "tracing_backend", value_status::Used, "trace_keyspace_helper",
+            "The tracing backend to use. \"trace_keyspace_helper\" writes trace events to the system_traces keyspace; \"trace_ringbuf_helper\" serializes them into a per-shard ring buffer of binary records flushed in bulk to per-shard trace files, which is cheap enough to keep sampled tracing always on.")
+    , bloom_filter_level_aware_sizing(this, "bloom_filter_level_aware_sizing", liveness::LiveUpdate, value_status::Used, true,
+            "Loosen the bloom filter false positive chance for sstables written to deep leveled compaction strategy levels, which are rarely probed, reducing filter memory consumption. Takes effect when the sstables are (re)written.")
     , alternator_port(this, "alternator_port", value_status::Used, 0, "Alternator API port")
     , alternator_https_port(this, "alternator_https_port", value_status::Used, 0, "Alternator API HTTPS port")
     , alternator_address(this, "alternator_address", value_status::Used, "0.0.0.0", "Alternator API listening address")
@@ -911,6 +1007,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Keep SSTable index pages in the global cache after a SSTable read. Expected to improve performance for workloads with big partitions, but may degrade performance for workloads with small partitions.")
     , x_log2_compaction_groups(this, "x_log2_compaction_groups", value_status::Used, 0, "Controls static number of compaction groups per table per shard. For X groups, set the option to log (base 2) of X. Example: Value of 3 implies 8 groups.")
      , consistent_cluster_management(this, "consistent_cluster_management", value_status::Used, false, "Use RAFT for cluster management and DDL")
+    , raft_group_commit_window_in_ms(this, "raft_group_commit_window_in_ms", value_status::Used, 0, "Coalesce Raft log appends arriving within this window into a single batch write, trading a small latency floor for fewer commitlog syncs under schema-change-heavy workloads. 0 (the default) persists every append individually.")
+    , sstable_background_compression(this, "sstable_background_compression", value_status::Used, false, "Compress chunks of sstable data files of tables using ZstdCompressor in a dedicated scheduling group, behind a bounded queue, instead of inline in the writer. Keeps memtable flush and compaction write latency flat with expensive compression levels.")
+    , sstable_background_decompression(this, "sstable_background_decompression", value_status::Used, false, "Decompress chunks of multi-chunk sequential reads of ZstdCompressor data files in the background compression scheduling group instead of the reading fiber's group. Stops cold analytic scans of zstd tables from competing for CPU with latency-sensitive statements; single-chunk point reads always decompress inline.")
     , wasm_cache_memory_fraction(this, "wasm_cache_memory_fraction", value_status::Used, 0.01, "Maximum total size of all WASM instances stored in the cache as fraction of total shard memory")
     , wasm_cache_timeout_in_ms(this, "wasm_cache_timeout_in_ms", value_status::Used, 5000, "Time after which an instance is evicted from the cache")
     , wasm_cache_instance_size_limit(this, "wasm_cache_instance_size_limit", value_status::Used, 1024*1024, "Instances with size above this limit will not be stored in the cache")
@@ -160,6 +160,7 @@ public:
     named_value<bool> rpc_interface_prefer_ipv6;
     named_value<seed_provider_type> seed_provider;
     named_value<uint32_t> compaction_throughput_mb_per_sec;
+    named_value<bool> compaction_throughput_autotune;
     named_value<uint32_t> compaction_large_partition_warning_threshold_mb;
     named_value<uint32_t> compaction_large_row_warning_threshold_mb;
     named_value<uint32_t> compaction_large_cell_warning_threshold_mb;
@@ -182,6 +183,7 @@ public:
     named_value<int64_t> commitlog_flush_threshold_in_mb;
     named_value<bool> commitlog_use_o_dsync;
     named_value<bool> commitlog_use_hard_size_limit;
+    named_value<uint32_t> commitlog_min_reserve_segments;
     named_value<bool> compaction_preheat_key_cache;
     named_value<uint32_t> concurrent_compactors;
     named_value<uint32_t> in_memory_compaction_limit_in_mb;
@@ -204,6 +206,7 @@ public:
     named_value<uint32_t> stream_throughput_outbound_megabits_per_sec;
     named_value<uint32_t> inter_dc_stream_throughput_outbound_megabits_per_sec;
     named_value<uint32_t> stream_io_throughput_mb_per_sec;
+    named_value<uint32_t> stream_max_concurrent_transfers;
     named_value<bool> trickle_fsync;
     named_value<uint32_t> trickle_fsync_interval_in_kb;
     named_value<bool> auto_bootstrap;
@@ -229,17 +232,23 @@ public:
     named_value<uint32_t> tombstone_warn_threshold;
     named_value<uint32_t> tombstone_failure_threshold;
     named_value<uint64_t> query_tombstone_page_limit;
+    named_value<bool> query_page_prefetch;
+    named_value<uint32_t> query_page_size_in_bytes;
+    named_value<uint32_t> write_coalescing_window_in_us;
     named_value<uint32_t> range_request_timeout_in_ms;
     named_value<uint32_t> read_request_timeout_in_ms;
     named_value<uint32_t> counter_write_request_timeout_in_ms;
+    named_value<uint32_t> counter_write_combining_window_in_ms;
     named_value<uint32_t> cas_contention_timeout_in_ms;
     named_value<uint32_t> truncate_request_timeout_in_ms;
     named_value<uint32_t> write_request_timeout_in_ms;
     named_value<uint32_t> request_timeout_in_ms;
+    named_value<bool> mutation_forwarding_in_local_dc;
     named_value<bool> cross_node_timeout;
     named_value<uint32_t> internode_send_buff_size_in_bytes;
     named_value<uint32_t> internode_recv_buff_size_in_bytes;
     named_value<sstring> internode_compression;
+    named_value<bool> internode_compression_zstd;
     named_value<bool> inter_dc_tcp_nodelay;
     named_value<uint32_t> streaming_socket_timeout_in_ms;
     named_value<bool> start_native_transport;
@@ -249,6 +258,7 @@ public:
     named_value<uint16_t> native_shard_aware_transport_port_ssl;
     named_value<uint32_t> native_transport_max_threads;
     named_value<uint32_t> native_transport_max_frame_size_in_mb;
+    named_value<uint32_t> native_transport_connection_setup_shares;
     named_value<sstring> broadcast_rpc_address;
     named_value<uint16_t> rpc_port;
     named_value<bool> start_rpc;
@@ -267,6 +277,7 @@ public:
     named_value<uint32_t> hinted_handoff_throttle_in_kb;
     named_value<uint32_t> max_hint_window_in_ms;
     named_value<uint32_t> max_hints_delivery_threads;
+    named_value<bool> hints_compression_enabled;
     named_value<uint32_t> batchlog_replay_throttle_in_kb;
     named_value<sstring> request_scheduler;
     named_value<sstring> request_scheduler_id;
@@ -280,12 +291,20 @@ public:
     named_value<uint32_t> permissions_validity_in_ms;
     named_value<uint32_t> permissions_update_interval_in_ms;
     named_value<uint32_t> permissions_cache_max_entries;
+    named_value<uint32_t> credentials_validity_in_ms;
+    named_value<uint32_t> credentials_update_interval_in_ms;
+    named_value<uint32_t> credentials_cache_max_entries;
     named_value<string_map> server_encryption_options;
     named_value<string_map> client_encryption_options;
     named_value<string_map> alternator_encryption_options;
     named_value<uint32_t> ssl_storage_port;
     named_value<bool> enable_in_memory_data_store;
     named_value<bool> enable_cache;
+    named_value<uint32_t> compressed_row_cache_size_in_mb;
+    named_value<uint32_t> row_cache_population_budget_in_kb;
+    named_value<uint32_t> query_result_cache_size_in_mb;
+    named_value<bool> adaptive_concurrent_reads;
+    named_value<bool> adaptive_reader_memory;
     named_value<bool> enable_commitlog;
     named_value<bool> volatile_system_keyspace_for_testing;
     named_value<uint16_t> api_port;
@@ -320,6 +339,14 @@ public:
     named_value<unsigned> murmur3_partitioner_ignore_msb_bits;
     named_value<double> unspooled_dirty_soft_limit;
     named_value<double> sstable_summary_ratio;
+    named_value<uint32_t> sstable_range_scan_read_ahead;
+    named_value<uint32_t> sstable_compaction_read_ahead;
+    named_value<uint32_t> sstable_compaction_read_buffer_size_in_kb;
+    named_value<bool> sstable_index_cache_warmup;
+    named_value<bool> row_cache_warmup;
+    named_value<uint32_t> row_cache_warmup_dump_period_in_seconds;
+    named_value<uint32_t> sstable_compressed_chunk_cache_size_in_mb;
+    named_value<double> components_memory_reclaim_threshold;
     named_value<size_t> large_memory_allocation_warning_threshold;
     named_value<bool> enable_deprecated_partitioners;
     named_value<bool> enable_keyspace_column_family_metrics;
@@ -347,12 +374,19 @@ public:
     named_value<unsigned> user_defined_function_contiguous_allocation_limit_bytes;
     named_value<uint32_t> schema_registry_grace_period;
     named_value<uint32_t> max_concurrent_requests_per_shard;
+    named_value<uint32_t> max_queued_requests_per_shard;
+    named_value<double> shed_queued_requests_reactor_utilization;
+    named_value<uint32_t> service_level_cpu_budget_ms_per_second;
     named_value<bool> cdc_dont_rewrite_streams;
     named_value<tri_mode_restriction> strict_allow_filtering;
     named_value<bool> reversed_reads_auto_bypass_cache;
     named_value<bool> enable_optimized_reversed_reads;
+    named_value<uint32_t> memtable_flush_streams;
+    named_value<uint32_t> write_dedup_window_size;
     named_value<bool> enable_cql_config_updates;
     named_value<bool> enable_parallelized_aggregation;
+    named_value<sstring> tracing_backend;
+    named_value<bool> bloom_filter_level_aware_sizing;
 
     named_value<uint16_t> alternator_port;
     named_value<uint16_t> alternator_https_port;
@@ -392,6 +426,9 @@ public:
     named_value<unsigned> x_log2_compaction_groups;
 
     named_value<bool> consistent_cluster_management;
+    named_value<uint32_t> raft_group_commit_window_in_ms;
+    named_value<bool> sstable_background_compression;
+    named_value<bool> sstable_background_decompression;
 
     named_value<double> wasm_cache_memory_fraction;
     named_value<uint32_t> wasm_cache_timeout_in_ms;
@@ -11,6 +11,7 @@
 #include "readers/filtering.hh"
 #include "db_clock.hh"
 
+#include <algorithm>
 #include <tuple>
 
 extern logging::logger dblog;
@@ -114,6 +115,91 @@ toppartitions_data_listener::localize(const global_top_k::results& r) {
     return n;
 }
 
+hot_partitions_tracker::hot_partitions_tracker(replica::database& db)
+        : _db(db)
+        , _window_start(lowres_clock::now()) {
+    dblog.debug("hot_partitions_tracker: installing {}", fmt::ptr(this));
+    _db.data_listeners().install(this);
+}
+
+hot_partitions_tracker::~hot_partitions_tracker() {
+    dblog.debug("hot_partitions_tracker: uninstalling {}", fmt::ptr(this));
+    _db.data_listeners().uninstall(this);
+}
+
+flat_mutation_reader_v2 hot_partitions_tracker::on_read(const schema_ptr& s, const dht::partition_range& range,
+        const query::partition_slice& slice, flat_mutation_reader_v2&& rd) {
+    if (++_reads % sample_period != 0) {
+        return std::move(rd);
+    }
+    return make_filtering_reader(std::move(rd), [zis = this->weak_from_this(), s] (const dht::decorated_key& dk) {
+        // The data query may be executing after the tracker has been removed on shutdown, so check
+        if (zis) {
+            zis->_top_k_read.append(toppartitions_item_key{s, dk});
+            ++zis->_sampled_reads[{s->ks_name(), s->cf_name()}];
+        }
+        return true;
+    });
+}
+
+void hot_partitions_tracker::on_write(const schema_ptr& s, const frozen_mutation& m) {
+    if (++_writes % sample_period != 0) {
+        return;
+    }
+    _top_k_write.append(toppartitions_item_key{s, m.decorated_key(*s)});
+    ++_sampled_writes[{s->ks_name(), s->cf_name()}];
+}
+
+hot_partitions_tracker::shard_results hot_partitions_tracker::results(size_t list_size) const {
+    shard_results res;
+    res.read = toppartitions_data_listener::globalize(_top_k_read.top(list_size));
+    res.write = toppartitions_data_listener::globalize(_top_k_write.top(list_size));
+    // The sketches see only sampled operations; scale them back to estimates
+    // of the true operation counts.
+    for (auto* r : {&res.read, &res.write}) {
+        for (auto& e : *r) {
+            e.count *= sample_period;
+            e.error *= sample_period;
+        }
+    }
+    // lowres_clock has a ~10ms granularity, so clamp the window to avoid
+    // division by zero right after a reset.
+    auto secs = std::max(std::chrono::duration<double>(lowres_clock::now() - _window_start).count(), 0.01);
+    for (auto& [table, count] : _sampled_reads) {
+        res.read_rates.emplace(table, double(count) * sample_period / secs);
+    }
+    for (auto& [table, count] : _sampled_writes) {
+        res.write_rates.emplace(table, double(count) * sample_period / secs);
+    }
+    return res;
+}
+
+void hot_partitions_tracker::reset() {
+    _top_k_read = top_k(sketch_capacity);
+    _top_k_write = top_k(sketch_capacity);
+    _sampled_reads.clear();
+    _sampled_writes.clear();
+    _window_start = lowres_clock::now();
+}
+
+future<hot_partitions_results> query_hot_partitions(distributed<replica::database>& db, unsigned results_size) {
+    auto map = [results_size] (replica::database& db) {
+        return make_foreign(std::make_unique<hot_partitions_tracker::shard_results>(db.hot_partitions_tracker().results(results_size)));
+    };
+    auto reduce = [] (hot_partitions_results res, foreign_ptr<std::unique_ptr<hot_partitions_tracker::shard_results>> shard) {
+        res.read.append(toppartitions_data_listener::localize(shard->read));
+        res.write.append(toppartitions_data_listener::localize(shard->write));
+        for (auto& [table, rate] : shard->read_rates) {
+            res.read_rates[table] += rate;
+        }
+        for (auto& [table, rate] : shard->write_rates) {
+            res.write_rates[table] += rate;
+        }
+        return res;
+    };
+    return db.map_reduce0(map, hot_partitions_results{results_size}, reduce);
+}
+
 toppartitions_query::toppartitions_query(distributed<replica::database>& xdb, std::unordered_set<std::tuple<sstring, sstring>, utils::tuple_hash>&& table_filters,
         std::unordered_set<sstring>&& keyspace_filters, std::chrono::milliseconds duration, size_t list_size, size_t capacity)
         : _xdb(xdb), _table_filters(std::move(table_filters)), _keyspace_filters(std::move(keyspace_filters)), _duration(duration), _list_size(list_size), _capacity(capacity),
@@ -11,6 +11,7 @@
 #include <seastar/core/distributed.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/distributed.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/weak_ptr.hh>
 
 #include "utils/hash.hh"
@@ -138,6 +139,76 @@ public:
     future<> stop();
 };
 
+// Always-on, sampled hot-partition profiler.
+//
+// Unlike toppartitions_data_listener, which is installed only for the duration
+// of a `nodetool toppartitions` invocation and inspects every operation, one
+// instance of this listener lives on each shard for the lifetime of the
+// database object and records only one out of every sample_period writes (and
+// read streams) into a space-saving top-k sketch, keeping the steady-state
+// overhead negligible. The current sketch contents, together with a
+// sampling-corrected per-table operation rate, can be fetched at any time via
+// the /storage_service/hot_partitions REST endpoint.
+class hot_partitions_tracker : public data_listener, public weakly_referencable<hot_partitions_tracker> {
+public:
+    using top_k = toppartitions_data_listener::top_k;
+    using global_top_k = toppartitions_data_listener::global_top_k;
+    // Estimated operations per second, per {keyspace, table}.
+    using table_rates = std::unordered_map<std::tuple<sstring, sstring>, double, utils::tuple_hash>;
+
+    // One out of every sample_period writes (and read streams) is recorded.
+    static constexpr uint64_t sample_period = 128;
+    // Maximum number of partitions tracked by each per-shard sketch.
+    static constexpr size_t sketch_capacity = 256;
+
+    // Snapshot of one shard's sketches, safe to transport across shards.
+    struct shard_results {
+        global_top_k::results read;
+        global_top_k::results write;
+        table_rates read_rates;
+        table_rates write_rates;
+    };
+
+private:
+    replica::database& _db;
+    top_k _top_k_read{sketch_capacity};
+    top_k _top_k_write{sketch_capacity};
+    uint64_t _reads = 0;
+    uint64_t _writes = 0;
+    std::unordered_map<std::tuple<sstring, sstring>, uint64_t, utils::tuple_hash> _sampled_reads;
+    std::unordered_map<std::tuple<sstring, sstring>, uint64_t, utils::tuple_hash> _sampled_writes;
+    lowres_clock::time_point _window_start;
+
+public:
+    explicit hot_partitions_tracker(replica::database& db);
+    ~hot_partitions_tracker();
+
+    virtual flat_mutation_reader_v2 on_read(const schema_ptr& s, const dht::partition_range& range,
+            const query::partition_slice& slice, flat_mutation_reader_v2&& rd) override;
+
+    virtual void on_write(const schema_ptr& s, const frozen_mutation& m) override;
+
+    // Returns this shard's top list_size partitions with counts and rates
+    // corrected for sampling.
+    shard_results results(size_t list_size) const;
+
+    // Drops the accumulated sketches and starts a new rate window.
+    void reset();
+};
+
+// Node-wide view of the per-shard hot_partitions_tracker sketches.
+struct hot_partitions_results {
+    toppartitions_data_listener::top_k read;
+    toppartitions_data_listener::top_k write;
+    hot_partitions_tracker::table_rates read_rates;
+    hot_partitions_tracker::table_rates write_rates;
+
+    hot_partitions_results(size_t capacity) : read(capacity), write(capacity) {}
+};
+
+// Merges the hot_partitions_tracker sketches of all shards.
+future<hot_partitions_results> query_hot_partitions(distributed<replica::database>& db, unsigned results_size = 256);
+
 class toppartitions_query {
     distributed<replica::database>& _xdb;
     std::unordered_set<std::tuple<sstring, sstring>, utils::tuple_hash> _table_filters;
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2023-present ScyllaDB
+ */
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "serializer.hh"
+#include "schema.hh"
+#include "log.hh"
+
+extern logging::logger dblog;
+
+namespace db {
+
+/**
+ * \brief Schema extension which represents the `disable_commitlog` per-table option.
+ *
+ * When set to `true`, mutations applied to the table skip the commitlog and
+ * go to memtables only, like a table in a keyspace with `durable_writes = false`.
+ * Data is durable only once it has been flushed to sstables, so the option is
+ * meant for bulk-ingest tables whose source is replayable (the load can be
+ * re-run from upstream after a crash); a flush provides the durability barrier
+ * once the load has finished.
+ *
+ * This is a per-table refinement of the keyspace-level `durable_writes`
+ * option: a bypassed table can live next to durable tables in the same
+ * keyspace.
+ */
+class disable_commitlog_extension : public schema_extension {
+    bool _disabled = false;
+public:
+    static constexpr auto NAME = "disable_commitlog";
+
+    disable_commitlog_extension() = default;
+
+    explicit disable_commitlog_extension(bool disabled)
+        : _disabled(disabled)
+    {}
+
+    explicit disable_commitlog_extension(const std::map<sstring, sstring>& map) {
+        on_internal_error(dblog, "Cannot create disable_commitlog_extension from map");
+    }
+
+    explicit disable_commitlog_extension(bytes b) : _disabled(deserialize(b))
+    {}
+
+    explicit disable_commitlog_extension(const sstring& s)
+        : _disabled(parse(s))
+    {}
+
+    bytes serialize() const override {
+        return ser::serialize_to_buffer<bytes>(_disabled);
+    }
+
+    static bool deserialize(const bytes_view& buffer) {
+        return ser::deserialize_from_buffer(buffer, boost::type<bool>());
+    }
+
+    static bool parse(const sstring& v) {
+        if (strcasecmp(v.c_str(), "true") == 0) {
+            return true;
+        }
+        if (strcasecmp(v.c_str(), "false") == 0) {
+            return false;
+        }
+        throw std::invalid_argument(format("Invalid value for {}: '{}'; must be 'true' or 'false'", NAME, v));
+    }
+
+    bool is_disabled() const {
+        return _disabled;
+    }
+};
+
+} // namespace db
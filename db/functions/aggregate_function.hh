@@ -68,6 +68,25 @@ public:
          */
         virtual void add_input(cql_serialization_format sf, const std::vector<opt_bytes>& values) = 0;
 
+        /**
+         * Adds a batch of inputs to this aggregate, one element per input
+         * row. Each element is the value of the aggregate's only argument
+         * in that row; aggregates taking no arguments (count(*)) are fed
+         * disengaged elements, and only the size of the batch matters.
+         *
+         * Equivalent to calling add_input() once per element, but lets
+         * implementations consume the whole batch in a tight loop, free of
+         * per-row virtual dispatch. Must not be used for aggregates taking
+         * more than one argument.
+         */
+        virtual void add_column_batch(cql_serialization_format sf, const std::vector<opt_bytes>& column) {
+            std::vector<opt_bytes> values(1);
+            for (const opt_bytes& cell : column) {
+                values[0] = cell;
+                add_input(sf, values);
+            }
+        }
+
         /**
          * Computes and returns the aggregate current value.
          *
@@ -17,6 +17,7 @@
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <boost/range/adaptors.hpp>
 #include "utils/div_ceil.hh"
+#include "db/config.hh"
 #include "db/extensions.hh"
 #include "service/storage_proxy.hh"
 #include "gms/versioned_value.hh"
@@ -225,7 +226,8 @@ bool manager::end_point_hints_manager::store_hint(schema_ptr s, lw_shared_ptr<co
 
             return with_shared(file_update_mutex(), [this, fm, s, tr_state] () mutable -> future<> {
                 return get_or_load().then([this, fm = std::move(fm), s = std::move(s), tr_state] (hints_store_ptr log_ptr) mutable {
-                    commitlog_entry_writer cew(s, *fm, db::commitlog::force_sync::no);
+                    auto compress = commitlog_entry_writer::compression(_shard_manager.local_db().get_config().hints_compression_enabled());
+                    commitlog_entry_writer cew(s, *fm, db::commitlog::force_sync::no, compress);
                     return log_ptr->add_entry(s->id(), cew, db::timeout_clock::now() + _shard_manager.hint_file_write_timeout);
                 }).then([this, tr_state] (db::rp_handle rh) {
                     auto rp = rh.release();
@@ -873,7 +875,9 @@ future<> manager::end_point_hints_manager::sender::send_one_hint(lw_shared_ptr<s
                     return make_ready_future<>();
                 }
 
-                return this->send_one_mutation(std::move(m)).then([this, rp, ctx_ptr] {
+                auto send_start = std::chrono::steady_clock::now();
+                return this->send_one_mutation(std::move(m)).then([this, rp, ctx_ptr, send_start] {
+                    _resource_manager.on_hint_send_latency(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - send_start));
                     ++this->shard_stats().sent;
                 }).handle_exception([this, ctx_ptr, rp] (auto eptr) {
                     manager_logger.trace("send_one_hint(): failed to send to {}: {}", end_point_key(), eptr);
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: AGPL-3.0-or-later
  */
 
+#include <algorithm>
 #include "resource_manager.hh"
 #include "manager.hh"
 #include "log.hh"
@@ -41,11 +42,13 @@ future<bool> is_mountpoint(const fs::path& path) {
 
 future<semaphore_units<named_semaphore::exception_factory>> resource_manager::get_send_units_for(size_t buf_size) {
     // In order to impose a limit on the number of hints being sent concurrently,
-    // require each hint to reserve at least 1/(max concurrency) of the shard budget
+    // require each hint to reserve at least 1/(max concurrency) of the shard budget.
+    // When no explicit limit is configured the concurrency adapts to the observed
+    // send latency (see on_hint_send_latency()).
     const size_t per_node_concurrency_limit = _max_hints_send_queue_length();
     const size_t per_shard_concurrency_limit = (per_node_concurrency_limit > 0)
             ? div_ceil(per_node_concurrency_limit, smp::count)
-            : default_per_shard_concurrency_limit;
+            : _adaptive_send_concurrency;
     const size_t min_send_hint_budget = _max_send_in_flight_memory / per_shard_concurrency_limit;
     // Let's approximate the memory size the mutation is going to consume by the size of its serialized form
     size_t hint_memory_budget = std::max(min_send_hint_budget, buf_size);
@@ -59,6 +62,42 @@ size_t resource_manager::sending_queue_length() const {
     return _send_limiter.waiters();
 }
 
+void resource_manager::on_hint_send_latency(std::chrono::microseconds latency) noexcept {
+    // EWMA with alpha = 1/8.
+    if (_send_latency_ewma.count() == 0) {
+        _send_latency_ewma = latency;
+    } else {
+        _send_latency_ewma += (latency - _send_latency_ewma) / 8;
+    }
+    _window_min_latency = std::min(_window_min_latency, latency);
+
+    // Adjust the window once per 64 completed sends, not on every sample.
+    constexpr uint64_t adjustment_period = 64;
+    if (++_send_latency_samples % adjustment_period != 0) {
+        return;
+    }
+
+    // The baseline tracks the best latency the targets have shown. Let it
+    // drift up slowly, so that a single fast sample observed long ago does
+    // not keep the window shrunk forever once the target got busier.
+    if (_send_latency_baseline.count() == 0 || _window_min_latency < _send_latency_baseline) {
+        _send_latency_baseline = _window_min_latency;
+    } else {
+        _send_latency_baseline += _send_latency_baseline / 8;
+    }
+    _window_min_latency = std::chrono::microseconds::max();
+
+    if (_send_latency_ewma <= 2 * _send_latency_baseline) {
+        _adaptive_send_concurrency = std::min(_adaptive_send_concurrency + 1, max_adaptive_concurrency_limit);
+    } else if (_send_latency_ewma >= 4 * _send_latency_baseline) {
+        // Never shrink below the static default, so replay cannot become
+        // slower than it was with the fixed concurrency limit.
+        _adaptive_send_concurrency = std::max(_adaptive_send_concurrency / 2, default_per_shard_concurrency_limit);
+    }
+    resource_manager_logger.trace("adaptive hint send concurrency: {} (latency ewma {}us, baseline {}us)",
+            _adaptive_send_concurrency, _send_latency_ewma.count(), _send_latency_baseline.count());
+}
+
 const std::chrono::seconds space_watchdog::_watchdog_period = std::chrono::seconds(1);
 
 space_watchdog::space_watchdog(shard_managers_set& managers, per_device_limits_map& per_device_limits_map)
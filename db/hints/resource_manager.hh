@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <seastar/core/abort_source.hh>
@@ -160,10 +161,25 @@ class resource_manager {
 
     future<> prepare_per_device_limits(manager& shard_manager);
 
+    // Adaptive send concurrency, used when max_hints_send_queue_length is
+    // not set. Senders report the latency of every completed hint send and
+    // the per-shard concurrency limit follows the targets' write latency
+    // AIMD-style: while the latency EWMA stays close to the best latency
+    // observed, the window grows additively; when it deteriorates, the
+    // window is halved. This lets replay after a short outage ramp up well
+    // past the static default on a healthy target, while backing off as
+    // soon as the extra concurrency starts queueing up remotely.
+    std::chrono::microseconds _send_latency_ewma{0};
+    std::chrono::microseconds _send_latency_baseline{0};
+    std::chrono::microseconds _window_min_latency{std::chrono::microseconds::max()};
+    uint64_t _send_latency_samples = 0;
+    size_t _adaptive_send_concurrency = default_per_shard_concurrency_limit;
+
 public:
     static constexpr size_t hint_segment_size_in_mb = 32;
     static constexpr size_t max_hints_per_ep_size_mb = 128; // 4 files 32MB each
     static constexpr size_t default_per_shard_concurrency_limit = 8;
+    static constexpr size_t max_adaptive_concurrency_limit = 128;
 
 public:
     resource_manager(size_t max_send_in_flight_memory, utils::updateable_value<uint32_t> max_hint_sending_concurrency)
@@ -180,6 +196,9 @@ public:
     future<semaphore_units<named_semaphore::exception_factory>> get_send_units_for(size_t buf_size);
     size_t sending_queue_length() const;
 
+    /// \brief Feed the latency of a completed hint send into the adaptive concurrency controller.
+    void on_hint_send_latency(std::chrono::microseconds latency) noexcept;
+
     future<> start(shared_ptr<service::storage_proxy> proxy_ptr, shared_ptr<gms::gossiper> gossiper_ptr);
     future<> stop() noexcept;
 
@@ -783,6 +783,121 @@ future<table_schema_version> calculate_schema_digest(distributed<service::storag
     return calculate_schema_digest(proxy, features, std::not_fn(&is_system_keyspace));
 }
 
+// Cache of per-keyspace schema sub-digests, used when the cluster runs with
+// the PER_KEYSPACE_SCHEMA_DIGEST feature. It lives on shard 0 only, where
+// schema mutations are merged under the merge lock, so do_merge_schema() can
+// reliably mark the keyspaces it touches as dirty. System keyspaces are also
+// written outside the merge path (during boot and upgrades), so their
+// sub-digests are refreshed on every calculation instead of trusting the
+// cache.
+struct schema_digest_cache {
+    // keyspace name -> md5 of its schema mutations, in schema table order.
+    std::map<sstring, bytes> sub_digests;
+    // The feature set the sub-digests were computed with; digests depend on
+    // it, so a change invalidates the whole cache.
+    schema_features::mask_type features_mask = 0;
+    bool valid = false;
+    // Keyspaces whose schema was merged since their sub-digest was cached.
+    std::set<sstring> dirty;
+};
+static thread_local schema_digest_cache the_schema_digest_cache;
+
+static void mark_keyspace_dirty_for_schema_digest(const sstring& keyspace_name) {
+    the_schema_digest_cache.dirty.emplace(keyspace_name);
+}
+
+// Computes the sub-digest of a single keyspace: the hash of its partitions in
+// every schema table, in schema table order. Returns nullopt when the
+// keyspace contributes nothing to the digest (it does not exist, or all its
+// partitions compact away).
+static future<std::optional<bytes>> calculate_keyspace_schema_sub_digest(distributed<service::storage_proxy>& proxy, schema_features features, const sstring& keyspace_name)
+{
+    md5_hasher hash;
+    bool fed = false;
+    for (auto& table : all_table_names(features)) {
+        auto s = proxy.local().get_db().local().find_schema(NAME, table);
+        auto range = dht::partition_range::make_singular(dht::decorate_key(*s, partition_key::from_singular(*s, keyspace_name)));
+        auto slice = s->full_slice();
+        auto cmd = make_lw_shared<query::read_command>(s->id(), s->version(), std::move(slice), proxy.local().get_max_result_size(slice),
+                query::tombstone_limit::max, query::row_limit(query::max_rows));
+        auto res_hit_rate = co_await proxy.local().query_mutations_locally(s, std::move(cmd), range, db::no_timeout, tracing::trace_state_ptr{});
+        auto&& [res, hit_rate] = res_hit_rate;
+        for (auto&& p : res->partitions()) {
+            auto mut = redact_columns_for_missing_features(p.mut().unfreeze(s), features);
+            fed |= feed_hash_for_schema_digest(hash, mut, features);
+        }
+    }
+    if (!fed) {
+        co_return std::nullopt;
+    }
+    co_return hash.finalize();
+}
+
+/**
+ * Like calculate_schema_digest(), but composes the digest from per-keyspace
+ * sub-digests (combined in keyspace name order), which makes it cacheable:
+ * after the first full calculation, only the keyspaces touched by schema
+ * merges since the previous calculation are rehashed, so the cost of a DDL
+ * statement is proportional to the size of the changed keyspace instead of
+ * the whole schema. The resulting digest differs from the non-composed one,
+ * so this may only be used when the whole cluster computes it this way.
+ */
+static future<table_schema_version> calculate_schema_digest_per_keyspace(distributed<service::storage_proxy>& proxy, schema_features features, noncopyable_function<bool(std::string_view)> accept_keyspace)
+{
+    auto& cache = the_schema_digest_cache;
+    const bool use_cache = this_shard_id() == 0;
+    if (use_cache && cache.valid && cache.features_mask == features.mask()) {
+        auto dirty = std::exchange(cache.dirty, {});
+        for (const auto& [keyspace_name, sub_digest] : cache.sub_digests) {
+            if (is_system_keyspace(keyspace_name)) {
+                dirty.emplace(keyspace_name);
+            }
+        }
+        for (const auto& keyspace_name : dirty) {
+            auto sub_digest = co_await calculate_keyspace_schema_sub_digest(proxy, features, keyspace_name);
+            if (sub_digest) {
+                cache.sub_digests[keyspace_name] = std::move(*sub_digest);
+            } else {
+                cache.sub_digests.erase(keyspace_name);
+            }
+        }
+    } else {
+        // Full rebuild: one pass over the schema tables, bucketing every
+        // partition into its keyspace's hasher.
+        std::map<sstring, md5_hasher> hashers;
+        std::set<sstring> fed;
+        for (auto& table : all_table_names(features)) {
+            auto rs = co_await db::system_keyspace::query_mutations(proxy, NAME, table);
+            auto s = proxy.local().get_db().local().find_schema(NAME, table);
+            for (auto&& p : rs->partitions()) {
+                auto mut = p.mut().unfreeze(s);
+                auto keyspace_name = value_cast<sstring>(utf8_type->deserialize(mut.key().get_component(*s, 0)));
+                mut = redact_columns_for_missing_features(std::move(mut), features);
+                if (feed_hash_for_schema_digest(hashers[keyspace_name], mut, features)) {
+                    fed.emplace(keyspace_name);
+                }
+            }
+        }
+        cache.sub_digests.clear();
+        for (auto& [keyspace_name, hasher] : hashers) {
+            if (fed.contains(keyspace_name)) {
+                cache.sub_digests.emplace(keyspace_name, hasher.finalize());
+            }
+        }
+        cache.features_mask = features.mask();
+        cache.dirty.clear();
+        cache.valid = use_cache;
+    }
+    md5_hasher hash;
+    for (const auto& [keyspace_name, sub_digest] : cache.sub_digests) {
+        if (accept_keyspace(keyspace_name)) {
+            feed_hash(hash, keyspace_name);
+            feed_hash(hash, sub_digest);
+        }
+    }
+    co_return utils::UUID_gen::get_name_UUID(hash.finalize());
+}
+
 future<std::vector<canonical_mutation>> convert_schema_to_mutations(distributed<service::storage_proxy>& proxy, schema_features features)
 {
     auto map = [&proxy, features] (sstring table) -> future<std::vector<canonical_mutation>> {
@@ -923,8 +1038,10 @@ static future<> with_merge_lock(noncopyable_function<future<> ()> func) {
 }
 
 static
-future<> update_schema_version_and_announce(sharded<db::system_keyspace>& sys_ks, distributed<service::storage_proxy>& proxy, schema_features features) {
-    auto uuid = co_await calculate_schema_digest(proxy, features);
+future<> update_schema_version_and_announce(sharded<db::system_keyspace>& sys_ks, distributed<service::storage_proxy>& proxy, schema_features features, bool per_keyspace_digest) {
+    auto uuid = per_keyspace_digest
+            ? co_await calculate_schema_digest_per_keyspace(proxy, features, std::not_fn(&is_system_keyspace))
+            : co_await calculate_schema_digest(proxy, features);
     co_await sys_ks.local().update_schema_version(uuid);
     co_await proxy.local().get_db().invoke_on_all([uuid] (replica::database& db) {
         db.update_version(uuid);
@@ -945,7 +1062,8 @@ future<> merge_schema(sharded<db::system_keyspace>& sys_ks, distributed<service:
 {
     if (this_shard_id() != 0) {
         // mutations must be applied on the owning shard (0).
-        co_await smp::submit_to(0, [&, fmuts = freeze(mutations)] () mutable -> future<> {
+        auto fmuts = co_await freeze_gently(mutations);
+        co_await smp::submit_to(0, [&, fmuts = std::move(fmuts)] () mutable -> future<> {
             return merge_schema(sys_ks, proxy, feat, unfreeze(fmuts));
         });
         co_return;
@@ -953,13 +1071,13 @@ future<> merge_schema(sharded<db::system_keyspace>& sys_ks, distributed<service:
     co_await with_merge_lock([&] () mutable -> future<> {
         bool flush_schema = proxy.local().get_db().local().get_config().flush_schema_tables_after_modification();
         co_await do_merge_schema(proxy, std::move(mutations), flush_schema);
-        co_await update_schema_version_and_announce(sys_ks, proxy, feat.cluster_schema_features());
+        co_await update_schema_version_and_announce(sys_ks, proxy, feat.cluster_schema_features(), bool(feat.per_keyspace_schema_digest));
     });
 }
 
 future<> recalculate_schema_version(sharded<db::system_keyspace>& sys_ks, distributed<service::storage_proxy>& proxy, gms::feature_service& feat) {
     co_await with_merge_lock([&] () -> future<> {
-        co_await update_schema_version_and_announce(sys_ks, proxy, feat.cluster_schema_features());
+        co_await update_schema_version_and_announce(sys_ks, proxy, feat.cluster_schema_features(), bool(feat.per_keyspace_schema_digest));
     });
 }
 
@@ -1006,11 +1124,13 @@ mutation compact_for_schema_digest(const mutation& m) {
     return m_compacted;
 }
 
-void feed_hash_for_schema_digest(hasher& h, const mutation& m, schema_features features) {
+bool feed_hash_for_schema_digest(hasher& h, const mutation& m, schema_features features) {
     auto compacted = compact_for_schema_digest(m);
     if (!features.contains<schema_feature::DIGEST_INSENSITIVE_TO_EXPIRY>() || !compacted.partition().empty()) {
         feed_hash(h, compacted);
+        return true;
     }
+    return false;
 }
 
 // Applies deletion of the "version" column to a system_schema.scylla_tables mutation.
@@ -1109,6 +1229,9 @@ static future<> do_merge_schema(distributed<service::storage_proxy>& proxy, std:
         // schema may be a mix of the old and new schemas.
         delete_schema_version(mutation);
     }
+    for (auto& keyspace_name : keyspaces) {
+        mark_keyspace_dirty_for_schema_digest(keyspace_name);
+    }
 
     // current state of the schema
     auto&& old_keyspaces = co_await read_schema_for_keyspaces(proxy, KEYSPACES, keyspaces);
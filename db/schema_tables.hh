@@ -265,7 +265,10 @@ index_metadata_kind deserialize_index_kind(sstring kind);
 
 mutation compact_for_schema_digest(const mutation& m);
 
-void feed_hash_for_schema_digest(hasher&, const mutation&, schema_features);
+// Feeds the mutation's digest representation into the hasher. Returns false
+// when the mutation contributes nothing to the digest (it compacts away and
+// the digest is insensitive to expiry).
+bool feed_hash_for_schema_digest(hasher&, const mutation&, schema_features);
 
 template<typename K, typename V>
 std::optional<std::map<K, V>> get_map(const query::result_set_row& row, const sstring& name) {
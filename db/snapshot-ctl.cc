@@ -120,6 +120,20 @@ snapshot_ctl::get_snapshot_details() {
     }));
 }
 
+future<std::vector<snapshot_ctl::snapshot_diff_entry>> snapshot_ctl::get_snapshot_diff(sstring from_tag, sstring to_tag) {
+    if (from_tag.empty() || to_tag.empty()) {
+        throw std::runtime_error("You must supply both snapshot tags.");
+    }
+
+    co_return co_await run_snapshot_list_operation(coroutine::lambda([this, from_tag = std::move(from_tag), to_tag = std::move(to_tag)] () -> future<std::vector<snapshot_diff_entry>> {
+        std::vector<snapshot_diff_entry> result;
+        for (auto& f : co_await _db.local().get_snapshot_diff(from_tag, to_tag)) {
+            result.push_back(snapshot_diff_entry{std::move(f.ks), std::move(f.cf), std::move(f.name), f.size});
+        }
+        co_return result;
+    }));
+}
+
 future<int64_t> snapshot_ctl::true_snapshots_size() {
     co_return co_await run_snapshot_list_operation(coroutine::lambda([this] () -> future<int64_t> {
         int64_t total = 0;
@@ -87,6 +87,21 @@ public:
 
     future<std::unordered_map<sstring, std::vector<snapshot_details>>> get_snapshot_details();
 
+    // One file a backup agent has to upload on top of an existing backup of
+    // snapshot from_tag to obtain a full backup of snapshot to_tag. Files
+    // present in both snapshots are hardlinks to the same immutable sstable
+    // component, so only the returned set needs to be shipped.
+    struct snapshot_diff_entry {
+        sstring ks;
+        sstring cf;
+        sstring name;
+        int64_t size;
+
+        bool operator==(const snapshot_diff_entry&) const = default;
+    };
+
+    future<std::vector<snapshot_diff_entry>> get_snapshot_diff(sstring from_tag, sstring to_tag);
+
     future<int64_t> true_snapshots_size();
 private:
     sharded<replica::database>& _db;
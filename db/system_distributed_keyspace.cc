@@ -152,6 +152,23 @@ schema_ptr service_levels() {
     return schema;
 }
 
+schema_ptr prepared_statements() {
+    static thread_local auto schema = [] {
+        auto id = generate_legacy_id(system_distributed_keyspace::NAME, system_distributed_keyspace::PREPARED_STATEMENTS);
+        return schema_builder(system_distributed_keyspace::NAME, system_distributed_keyspace::PREPARED_STATEMENTS, std::make_optional(id))
+                /* The deterministic prepared id (MD5 of keyspace + query string), so that
+                 * the same statement prepared on any node maps to the same partition. */
+                .with_column("prepared_id", bytes_type, column_kind::partition_key)
+                /* The keyspace the connection was logged into when the statement was
+                 * prepared (empty if none); needed to recompute the same id on recovery. */
+                .with_column("logged_keyspace", utf8_type)
+                .with_column("query_string", utf8_type)
+                .with_version(db::system_keyspace::generate_schema_version(id))
+                .build();
+    }();
+    return schema;
+}
+
 // This is the set of tables which this node ensures to exist in the cluster.
 // It does that by announcing the creation of these schemas on initialization
 // of the `system_distributed_keyspace` service (see `start()`), unless it first
@@ -169,6 +186,7 @@ static std::vector<schema_ptr> ensured_tables() {
         cdc_desc(),
         cdc_timestamps(),
         service_levels(),
+        prepared_statements(),
     };
 }
 
@@ -190,7 +208,7 @@ bool system_distributed_keyspace::is_extra_durable(const sstring& cf_name) {
 }
 
 std::vector<schema_ptr> system_distributed_keyspace::all_distributed_tables() {
-    return {view_build_status(), cdc_desc(), cdc_timestamps(), service_levels()};
+    return {view_build_status(), cdc_desc(), cdc_timestamps(), service_levels(), prepared_statements()};
 }
 
 std::vector<schema_ptr> system_distributed_keyspace::all_everywhere_tables() {
@@ -45,6 +45,11 @@ public:
     static constexpr auto VIEW_BUILD_STATUS = "view_build_status";
     static constexpr auto SERVICE_LEVELS = "service_levels";
 
+    /* Prepared statements replicated cluster-wide, keyed by the deterministic
+     * prepared id, so a node can recover a statement prepared on another node
+     * without a client round trip. */
+    static constexpr auto PREPARED_STATEMENTS = "prepared_statements";
+
     /* Nodes use this table to communicate new CDC stream generations to other nodes. */
     static constexpr auto CDC_TOPOLOGY_DESCRIPTION = "cdc_generation_descriptions";
 
@@ -277,6 +277,22 @@ schema_ptr system_keyspace::repair_history() {
     return schema;
 }
 
+schema_ptr system_keyspace::cached_partitions() {
+    static thread_local auto schema = [] {
+        auto id = generate_legacy_id(NAME, CACHED_PARTITIONS);
+        return schema_builder(NAME, CACHED_PARTITIONS, std::optional(id))
+            .with_column("table_uuid", uuid_type, column_kind::partition_key)
+            .with_column("shard", int32_type, column_kind::clustering_key)
+            // Serialized partition keys, in no particular order
+            .with_column("keys", set_type_impl::get_instance(bytes_type, true))
+            .set_comment("Partition keys cached by each shard, used to re-warm the row cache after a restart")
+            .set_gc_grace_seconds(0)
+            .with_version(generate_schema_version(id))
+            .build();
+    }();
+    return schema;
+}
+
 schema_ptr system_keyspace::built_indexes() {
     static thread_local auto built_indexes = [] {
         schema_builder builder(generate_legacy_id(NAME, BUILT_INDEXES), NAME, BUILT_INDEXES,
@@ -1477,6 +1493,36 @@ future<db_clock::time_point> system_keyspace::get_truncated_at(table_id cf_id) {
     });
 }
 
+future<> system_keyspace::save_cached_partitions(table_id id, unsigned shard, const std::vector<bytes>& raw_keys) {
+    if (raw_keys.empty()) {
+        sstring req = format("DELETE FROM system.{} WHERE table_uuid = ? AND shard = ?", CACHED_PARTITIONS);
+        co_return co_await execute_cql(req, id.uuid(), int32_t(shard)).discard_result();
+    }
+    set_type_impl::native_type kset;
+    kset.reserve(raw_keys.size());
+    for (auto& k : raw_keys) {
+        kset.push_back(data_value(k));
+    }
+    sstring req = format("INSERT INTO system.{} (table_uuid, shard, keys) VALUES (?, ?, ?)", CACHED_PARTITIONS);
+    auto set_type = set_type_impl::get_instance(bytes_type, true);
+    co_await execute_cql(req, id.uuid(), int32_t(shard), make_set_value(set_type, std::move(kset))).discard_result();
+}
+
+future<std::map<unsigned, std::vector<bytes>>> system_keyspace::load_cached_partitions(table_id id) {
+    sstring req = format("SELECT shard, keys FROM system.{} WHERE table_uuid = ?", CACHED_PARTITIONS);
+    auto rs = co_await execute_cql(req, id.uuid());
+    std::map<unsigned, std::vector<bytes>> ret;
+    for (const auto& row : *rs) {
+        if (!row.has("keys")) {
+            continue;
+        }
+        auto shard = unsigned(row.get_as<int32_t>("shard"));
+        auto keys = row.get_set<bytes>("keys");
+        ret.emplace(shard, std::vector<bytes>(keys.begin(), keys.end()));
+    }
+    co_return ret;
+}
+
 static set_type_impl::native_type prepare_tokens(const std::unordered_set<dht::token>& tokens) {
     set_type_impl::native_type tset;
     for (auto& t: tokens) {
@@ -1843,7 +1889,9 @@ private:
 public:
     cluster_status_table(service::storage_service& ss, gms::gossiper& g)
             : memtable_filling_virtual_table(build_schema())
-            , _ss(ss), _gossiper(g) {}
+            , _ss(ss), _gossiper(g) {
+        _result_ttl = std::chrono::seconds(1);
+    }
 
     static schema_ptr build_schema() {
         auto id = generate_legacy_id(system_keyspace::NAME, "cluster_status");
@@ -2124,6 +2172,7 @@ public:
         : memtable_filling_virtual_table(build_schema())
         , _ss(ss) {
         _shard_aware = true;
+        _result_ttl = std::chrono::seconds(1);
     }
 
     static schema_ptr build_schema() {
@@ -2250,6 +2299,7 @@ public:
         , _db(db)
         , _ss(ss) {
         _shard_aware = true;
+        _result_ttl = std::chrono::seconds(1);
         _generic_key = maybe_make_key("generic");
     }
 
@@ -2383,6 +2433,8 @@ public:
     explicit versions_table()
         : memtable_filling_virtual_table(build_schema()) {
         _shard_aware = false;
+        // The contents are fixed at build time.
+        _result_ttl = std::chrono::hours(1);
     }
 
     static schema_ptr build_schema() {
@@ -2653,10 +2705,213 @@ public:
     }
 };
 
+// Sampled execution statistics of prepared statements, as collected by the
+// query processor. Each partition is one prepared statement, keyed by its
+// prepared statement id, with one row per shard that executed it.
+// `executions` counts every execution on the shard, while
+// `sampled_execution_time_us` is the summed wall-clock time of only the
+// `samples` executions that were measured, so the average statement latency
+// on a shard is sampled_execution_time_us / samples. Thrift prepared ids are
+// 32-bit integers rather than MD5 digests and are exposed as a 4-byte blob.
+class prepared_statement_executions_table : public streaming_virtual_table {
+    sharded<cql3::query_processor>& _qp;
+
+    struct stmt_stats {
+        bytes statement_id;
+        int32_t shard;
+        sstring query_string;
+        int64_t executions;
+        int64_t samples;
+        int64_t sampled_execution_time_us;
+    };
+
+    static schema_ptr build_schema() {
+        auto id = generate_legacy_id(system_keyspace::NAME, "prepared_statement_executions");
+        return schema_builder(system_keyspace::NAME, "prepared_statement_executions", std::make_optional(id))
+            .with_column("statement_id", bytes_type, column_kind::partition_key)
+            .with_column("shard_id", int32_type, column_kind::clustering_key)
+            .with_column("query_string", utf8_type)
+            .with_column("executions", long_type)
+            .with_column("samples", long_type)
+            .with_column("sampled_execution_time_us", long_type)
+            .with_version(system_keyspace::generate_schema_version(id))
+            .build();
+    }
+
+    static bytes statement_id_bytes(const cql3::prepared_cache_key_type& key) {
+        const auto& cql_id = cql3::prepared_cache_key_type::cql_id(key);
+        if (!cql_id.empty()) {
+            return cql_id;
+        }
+        return int32_type->decompose(cql3::prepared_cache_key_type::thrift_id(key));
+    }
+
+    dht::decorated_key make_partition_key(const bytes& statement_id) {
+        return dht::decorate_key(*_s, partition_key::from_single_value(*_s, data_value(statement_id).serialize_nonnull()));
+    }
+
+    future<> execute(reader_permit permit, result_collector& result, const query_restrictions& qr) override {
+        // Collect
+        using shard_stats_vec = std::vector<stmt_stats>;
+        std::vector<foreign_ptr<std::unique_ptr<shard_stats_vec>>> ss_vec;
+        ss_vec.resize(smp::count);
+
+        co_await _qp.invoke_on_all([&ss_vec_ = ss_vec] (cql3::query_processor& qp) {
+            auto& ss_vec = ss_vec_;
+
+            auto sv = std::make_unique<shard_stats_vec>();
+            for (const auto& [key, st] : qp.get_statement_execution_stats()) {
+                sv->emplace_back(stmt_stats{
+                    statement_id_bytes(key),
+                    int32_t(this_shard_id()),
+                    st.query_string,
+                    int64_t(st.executions),
+                    int64_t(st.samples),
+                    std::chrono::duration_cast<std::chrono::microseconds>(st.sampled_execution_time).count(),
+                });
+            }
+            ss_vec[this_shard_id()] = make_foreign(std::move(sv));
+        });
+
+        // Partition
+        struct decorated_id {
+            dht::decorated_key key;
+            bytes statement_id;
+
+            struct compare {
+                dht::ring_position_less_comparator less;
+                explicit compare(const class schema& s) : less(s) {}
+                bool operator()(const decorated_id& a, const decorated_id& b) const {
+                    return less(a.key, b.key);
+                }
+            };
+        };
+
+        decorated_id::compare cmp(*_s);
+        std::set<decorated_id, decorated_id::compare> ids(cmp);
+        std::unordered_map<bytes, std::vector<stmt_stats>> stats_map;
+        for (unsigned i = 0; i < smp::count; i++) {
+            for (auto&& st : *ss_vec[i]) {
+                if (stats_map.contains(st.statement_id)) {
+                    stats_map[st.statement_id].emplace_back(std::move(st));
+                } else {
+                    dht::decorated_key key = make_partition_key(st.statement_id);
+                    if (this_shard_owns(key) && contains_key(qr.partition_range(), key)) {
+                        ids.insert(decorated_id{std::move(key), st.statement_id});
+                        stats_map[st.statement_id].emplace_back(std::move(st));
+                    }
+                }
+                co_await coroutine::maybe_yield();
+            }
+        }
+
+        // Emit
+        for (const auto& did : ids) {
+            co_await result.emit_partition_start(did.key);
+            auto& stats = stats_map[did.statement_id];
+
+            boost::sort(stats, [] (const stmt_stats& a, const stmt_stats& b) {
+                return a.shard < b.shard;
+            });
+
+            for (const auto& st : stats) {
+                clustering_row cr(clustering_key::from_single_value(*_s, data_value(st.shard).serialize_nonnull()));
+                set_cell(cr.cells(), "query_string", st.query_string);
+                set_cell(cr.cells(), "executions", st.executions);
+                set_cell(cr.cells(), "samples", st.samples);
+                set_cell(cr.cells(), "sampled_execution_time_us", st.sampled_execution_time_us);
+                co_await result.emit_row(std::move(cr));
+            }
+            co_await result.emit_partition_end();
+        }
+    }
+
+public:
+    explicit prepared_statement_executions_table(sharded<cql3::query_processor>& qp)
+            : streaming_virtual_table(build_schema())
+            , _qp(qp)
+    {
+        _shard_aware = true;
+    }
+};
+
+// A probabilistic partition-key existence check that never reads from disk:
+// only the memtables and the sstable bloom filters of the checked table are
+// consulted. Queried with a fully specified key:
+//
+//   SELECT may_exist FROM system.partition_existence
+//       WHERE keyspace_name = ? AND table_name = ? AND partition_key = ?;
+//
+// where partition_key is the serialized form of the checked table's partition
+// key. may_exist=false means the key is certainly absent, may_exist=true
+// means a regular read is needed to tell. A bloom-only "no" is orders of
+// magnitude cheaper than a full point read, which is what deduplication
+// pipelines issuing large volumes of existence checks care about. Scans that
+// don't pin down a single key, or keys naming an unknown table or carrying a
+// malformed partition_key, produce an empty result.
+class partition_existence_table : public streaming_virtual_table {
+    distributed<replica::database>& _db;
+public:
+    explicit partition_existence_table(distributed<replica::database>& db)
+            : streaming_virtual_table(build_schema())
+            , _db(db)
+    { }
+
+    static schema_ptr build_schema() {
+        auto id = generate_legacy_id(system_keyspace::NAME, "partition_existence");
+        return schema_builder(system_keyspace::NAME, "partition_existence", std::make_optional(id))
+            .with_column("keyspace_name", utf8_type, column_kind::partition_key)
+            .with_column("table_name", utf8_type, column_kind::partition_key)
+            .with_column("partition_key", bytes_type, column_kind::partition_key)
+            .with_column("may_exist", boolean_type)
+            .set_comment("Bloom-filter-backed partition key existence checks, false positives possible but no false negatives.")
+            .with_version(system_keyspace::generate_schema_version(id))
+            .build();
+    }
+
+    future<> execute(reader_permit permit, result_collector& result, const query_restrictions& qr) override {
+        const auto& pr = qr.partition_range();
+        if (!pr.is_singular() || !pr.start()->value().has_key()) {
+            // Only a fully specified key can be checked - there is nothing
+            // meaningful to enumerate for a scan.
+            co_return;
+        }
+        auto dk = dht::decorate_key(*_s, *pr.start()->value().key());
+        auto exploded = dk.key().explode(*_s);
+        auto ks_name = value_cast<sstring>(utf8_type->deserialize(exploded[0]));
+        auto cf_name = value_cast<sstring>(utf8_type->deserialize(exploded[1]));
+        auto target_key_bytes = exploded[2];
+
+        bool may_exist;
+        try {
+            auto target_schema = _db.local().find_schema(ks_name, cf_name);
+            auto target_pk = partition_key::from_bytes(target_key_bytes);
+            target_pk.validate(*target_schema);
+            auto shard = dht::shard_of(*target_schema, dht::get_token(*target_schema, target_pk));
+            may_exist = co_await _db.invoke_on(shard, [ks_name, cf_name, target_key_bytes] (replica::database& db) {
+                auto& t = db.find_column_family(ks_name, cf_name);
+                return t.may_contain_key(dht::decorate_key(*t.schema(), partition_key::from_bytes(target_key_bytes)));
+            });
+        } catch (const replica::no_such_keyspace&) {
+            co_return;
+        } catch (const replica::no_such_column_family&) {
+            co_return;
+        } catch (const marshal_exception&) {
+            co_return;
+        }
+
+        co_await result.emit_partition_start(dk);
+        clustering_row cr(clustering_key::make_empty());
+        set_cell(cr.cells(), "may_exist", may_exist);
+        co_await result.emit_row(std::move(cr));
+        co_await result.emit_partition_end();
+    }
+};
+
 // Map from table's schema ID to table itself. Helps avoiding accidental duplication.
 static thread_local std::map<table_id, std::unique_ptr<virtual_table>> virtual_tables;
 
-void register_virtual_tables(distributed<replica::database>& dist_db, distributed<service::storage_service>& dist_ss, sharded<gms::gossiper>& dist_gossiper, db::config& cfg) {
+void register_virtual_tables(distributed<replica::database>& dist_db, distributed<service::storage_service>& dist_ss, sharded<gms::gossiper>& dist_gossiper, db::config& cfg, sharded<cql3::query_processor>& qp) {
     auto add_table = [] (std::unique_ptr<virtual_table>&& tbl) {
         virtual_tables[tbl->schema()->id()] = std::move(tbl);
     };
@@ -2669,11 +2924,13 @@ void register_virtual_tables(distributed<replica::database>& dist_db, distribute
     add_table(std::make_unique<cluster_status_table>(ss, gossiper));
     add_table(std::make_unique<token_ring_table>(db, ss));
     add_table(std::make_unique<snapshots_table>(dist_db));
+    add_table(std::make_unique<partition_existence_table>(dist_db));
     add_table(std::make_unique<protocol_servers_table>(ss));
     add_table(std::make_unique<runtime_info_table>(dist_db, ss));
     add_table(std::make_unique<versions_table>());
     add_table(std::make_unique<db_config_table>(cfg));
     add_table(std::make_unique<clients_table>(ss));
+    add_table(std::make_unique<prepared_statement_executions_table>(qp));
 }
 
 std::vector<schema_ptr> system_keyspace::all_tables(const db::config& cfg) {
@@ -2685,7 +2942,7 @@ std::vector<schema_ptr> system_keyspace::all_tables(const db::config& cfg) {
                     compactions_in_progress(), compaction_history(),
                     sstable_activity(), size_estimates(), large_partitions(), large_rows(), large_cells(),
                     scylla_local(), db::schema_tables::scylla_table_schema_history(),
-                    repair_history(),
+                    repair_history(), cached_partitions(),
                     v3::views_builds_in_progress(), v3::built_views(),
                     v3::scylla_views_builds_in_progress(),
                     v3::truncated(),
@@ -2731,9 +2988,9 @@ static bool maybe_write_in_user_memory(schema_ptr s) {
             || s == system_keyspace::raft();
 }
 
-future<> system_keyspace_make(db::system_keyspace& sys_ks, distributed<replica::database>& dist_db, distributed<service::storage_service>& dist_ss, sharded<gms::gossiper>& dist_gossiper, db::config& cfg, table_selector& tables) {
+future<> system_keyspace_make(db::system_keyspace& sys_ks, distributed<replica::database>& dist_db, distributed<service::storage_service>& dist_ss, sharded<gms::gossiper>& dist_gossiper, db::config& cfg, table_selector& tables, sharded<cql3::query_processor>& qp) {
     if (tables.contains_keyspace(system_keyspace::NAME)) {
-        register_virtual_tables(dist_db, dist_ss, dist_gossiper, cfg);
+        register_virtual_tables(dist_db, dist_ss, dist_gossiper, cfg, qp);
     }
 
     auto& db = dist_db.local();
@@ -2770,7 +3027,7 @@ future<> system_keyspace_make(db::system_keyspace& sys_ks, distributed<replica::
 }
 
 future<> system_keyspace::make(distributed<replica::database>& db, distributed<service::storage_service>& ss, sharded<gms::gossiper>& g, db::config& cfg, table_selector& tables) {
-    return system_keyspace_make(*this, db, ss, g, cfg, tables);
+    return system_keyspace_make(*this, db, ss, g, cfg, tables, _qp);
 }
 
 future<locator::host_id> system_keyspace::load_local_host_id() {
@@ -137,6 +137,7 @@ public:
     static constexpr auto RAFT_SNAPSHOTS = "raft_snapshots";
     static constexpr auto RAFT_CONFIG = "raft_config";
     static constexpr auto REPAIR_HISTORY = "repair_history";
+    static constexpr auto CACHED_PARTITIONS = "cached_partitions";
     static constexpr auto GROUP0_HISTORY = "group0_history";
     static constexpr auto DISCOVERY = "discovery";
     static constexpr auto BROADCAST_KV_STORE = "broadcast_kv_store";
@@ -221,6 +222,7 @@ public:
     static schema_ptr raft();
     static schema_ptr raft_snapshots();
     static schema_ptr repair_history();
+    static schema_ptr cached_partitions();
     static schema_ptr group0_history();
     static schema_ptr discovery();
     static schema_ptr broadcast_kv_store();
@@ -335,6 +337,12 @@ public:
     static future<db_clock::time_point> get_truncated_at(table_id);
     static future<truncation_record> get_truncation_record(table_id cf_id);
 
+    // Saves/loads the serialized partition keys held in a table's row cache
+    // on a given shard, used to re-warm the cache after a restart.
+    // An empty key set removes the record.
+    future<> save_cached_partitions(table_id, unsigned shard, const std::vector<bytes>& raw_keys);
+    future<std::map<unsigned, std::vector<bytes>>> load_cached_partitions(table_id);
+
     /**
      * Return a map of stored tokens to IP addresses
      *
@@ -1219,6 +1219,7 @@ future<stop_iteration> view_update_builder::stop() const {
 }
 
 future<std::optional<utils::chunked_vector<frozen_mutation_and_schema>>> view_update_builder::build_some() {
+    _batch_bytes = 0;
     (void)co_await advance_all();
     if (!_update && !_existing) {
         // Tell the caller there is no more data to build.
@@ -1270,6 +1271,8 @@ void view_update_builder::generate_update(clustering_row&& update, std::optional
     update.marker().compact_and_expire(update.tomb().tomb(), _now, always_gc, gc_before);
     update.cells().compact_and_expire(*_schema, column_kind::regular_column, update.tomb(), _now, always_gc, gc_before, update.marker());
 
+    _batch_bytes += (update.memory_usage(*_schema) + (existing ? existing->memory_usage(*_schema) : 0)) * _view_updates.size();
+
     const auto update_row = clustering_or_static_row(std::move(update));
     const auto existing_row = existing
             ? std::make_optional<clustering_or_static_row>(std::move(*existing))
@@ -1297,6 +1300,8 @@ void view_update_builder::generate_update(static_row&& update, const tombstone&
 
     update.cells().compact_and_expire(*_schema, column_kind::static_column, row_tombstone(update_tomb), _now, always_gc, gc_before);
 
+    _batch_bytes += (update.memory_usage(*_schema) + (existing ? existing->memory_usage(*_schema) : 0)) * _view_updates.size();
+
     const auto update_row = clustering_or_static_row(std::move(update));
     const auto existing_row = existing
             ? std::make_optional<clustering_or_static_row>(std::move(*existing))
@@ -1308,10 +1313,18 @@ void view_update_builder::generate_update(static_row&& update, const tombstone&
 
 future<stop_iteration> view_update_builder::on_results() {
     constexpr size_t max_rows_for_view_updates = 100;
+    // The row limit alone does not bound the size of a batch: 100 very wide
+    // base rows, multiplied by the number of views, can hold hundreds of MB.
+    // Also cut the batch when the rows consumed so far (scaled by the number
+    // of views, which is what the generated updates are derived from) exceed
+    // a fixed byte budget, so peak memory stays flat regardless of how wide
+    // the base partition is.
+    constexpr size_t max_bytes_for_view_updates = 1024 * 1024;
     size_t rows_for_view_updates = std::accumulate(_view_updates.begin(), _view_updates.end(), 0, [] (size_t acc, const view_updates& vu) {
         return acc + vu.op_count();
     });
-    const bool stop_updates = rows_for_view_updates >= max_rows_for_view_updates;
+    const bool stop_updates = rows_for_view_updates >= max_rows_for_view_updates
+            || _batch_bytes >= max_bytes_for_view_updates;
 
     if (_update && !_update->is_end_of_partition() && _existing && !_existing->is_end_of_partition()) {
         auto cmp = position_in_partition::tri_compare(*_schema)(_update->position(), _existing->position());
@@ -1521,6 +1534,37 @@ bool needs_static_row(const mutation_partition& mp, const std::vector<view_and_b
     return mp.partition_tombstone() || !mp.static_row().empty();
 }
 
+// Ring state shared by every view update generated from one base write.
+// All views live in the base table's keyspace, so the replication map,
+// topology and the (datacenter-filtered) base replica list are the same for
+// the whole batch; resolving them once amortizes the ring walks over the
+// view fan-out instead of repeating them for each generated update.
+struct base_write_context {
+    locator::effective_replication_map_ptr erm;
+    gms::inet_address my_address;
+    sstring my_datacenter;
+    bool network_topology;
+    std::vector<gms::inet_address> base_endpoints;
+};
+
+static base_write_context
+make_base_write_context(const sstring& keyspace_name, const dht::token& base_token) {
+    auto& db = service::get_local_storage_proxy().local_db();
+    auto& ks = db.find_keyspace(keyspace_name);
+    base_write_context ctx;
+    ctx.erm = ks.get_effective_replication_map();
+    ctx.my_address = utils::fb_utilities::get_broadcast_address();
+    auto& topology = ctx.erm->get_token_metadata_ptr()->get_topology();
+    ctx.my_datacenter = topology.get_datacenter();
+    ctx.network_topology = dynamic_cast<const locator::network_topology_strategy*>(&ks.get_replication_strategy());
+    for (auto&& base_endpoint : ctx.erm->get_natural_endpoints(base_token)) {
+        if (!ctx.network_topology || topology.get_datacenter(base_endpoint) == ctx.my_datacenter) {
+            ctx.base_endpoints.push_back(base_endpoint);
+        }
+    }
+    return ctx;
+}
+
 // Calculate the node ("natural endpoint") to which this node should send
 // a view update.
 //
@@ -1542,26 +1586,15 @@ bool needs_static_row(const mutation_partition& mp, const std::vector<view_and_b
 // If the assumption that the given base token belongs to this replica
 // does not hold, we return an empty optional.
 static std::optional<gms::inet_address>
-get_view_natural_endpoint(const sstring& keyspace_name,
-        const dht::token& base_token, const dht::token& view_token) {
-    auto &db = service::get_local_storage_proxy().local_db();
-    auto& ks = db.find_keyspace(keyspace_name);
-    auto erm = ks.get_effective_replication_map();
-    auto& topology = erm->get_token_metadata_ptr()->get_topology();
-    auto my_address = utils::fb_utilities::get_broadcast_address();
-    auto my_datacenter = topology.get_datacenter();
-    bool network_topology = dynamic_cast<const locator::network_topology_strategy*>(&ks.get_replication_strategy());
-    std::vector<gms::inet_address> base_endpoints, view_endpoints;
-    for (auto&& base_endpoint : erm->get_natural_endpoints(base_token)) {
-        if (!network_topology || topology.get_datacenter(base_endpoint) == my_datacenter) {
-            base_endpoints.push_back(base_endpoint);
-        }
-    }
+get_view_natural_endpoint(const base_write_context& ctx, const dht::token& view_token) {
+    auto& topology = ctx.erm->get_token_metadata_ptr()->get_topology();
+    auto base_endpoints = ctx.base_endpoints;
+    std::vector<gms::inet_address> view_endpoints;
 
-    for (auto&& view_endpoint : erm->get_natural_endpoints(view_token)) {
+    for (auto&& view_endpoint : ctx.erm->get_natural_endpoints(view_token)) {
         // If this base replica is also one of the view replicas, we use
         // ourselves as the view replica.
-        if (view_endpoint == my_address) {
+        if (view_endpoint == ctx.my_address) {
             return view_endpoint;
         }
         // We have to remove any endpoint which is shared between the base
@@ -1571,13 +1604,13 @@ get_view_natural_endpoint(const sstring& keyspace_name,
             view_endpoint);
         if (it != base_endpoints.end()) {
             base_endpoints.erase(it);
-        } else if (!network_topology || topology.get_datacenter(view_endpoint) == my_datacenter) {
+        } else if (!ctx.network_topology || topology.get_datacenter(view_endpoint) == ctx.my_datacenter) {
             view_endpoints.push_back(view_endpoint);
         }
     }
 
     assert(base_endpoints.size() == view_endpoints.size());
-    auto base_it = std::find(base_endpoints.begin(), base_endpoints.end(), my_address);
+    auto base_it = std::find(base_endpoints.begin(), base_endpoints.end(), ctx.my_address);
     if (base_it == base_endpoints.end()) {
         // This node is not a base replica of this key, so we return empty
         return {};
@@ -1623,13 +1656,19 @@ future<> mutate_MV(
         service::allow_hints allow_hints,
         wait_for_all_updates wait_for_all)
 {
+    if (view_updates.empty()) {
+        co_return;
+    }
+    // The whole batch pertains to one base write, so the base-side ring
+    // state is resolved once here rather than per generated update.
+    auto ctx = make_base_write_context(view_updates.front().s->ks_name(), base_token);
     static constexpr size_t max_concurrent_updates = 128;
     co_await max_concurrent_for_each(view_updates, max_concurrent_updates,
-            [base_token, &stats, &cf_stats, tr_state, &pending_view_updates, allow_hints, wait_for_all] (frozen_mutation_and_schema mut) mutable -> future<> {
+            [base_token, &ctx, &stats, &cf_stats, tr_state, &pending_view_updates, allow_hints, wait_for_all] (frozen_mutation_and_schema mut) mutable -> future<> {
         auto view_token = dht::get_token(*mut.s, mut.fm.key());
         auto& keyspace_name = mut.s->ks_name();
-        auto target_endpoint = get_view_natural_endpoint(keyspace_name, base_token, view_token);
-        auto remote_endpoints = service::get_local_storage_proxy().get_token_metadata_ptr()->pending_endpoints_for(view_token, keyspace_name);
+        auto target_endpoint = get_view_natural_endpoint(ctx, view_token);
+        auto remote_endpoints = ctx.erm->get_token_metadata_ptr()->pending_endpoints_for(view_token, keyspace_name);
         auto sem_units = pending_view_updates.split(mut.fm.representation().size());
 
         const bool update_synchronously = should_update_synchronously(*mut.s);
@@ -1644,7 +1683,7 @@ future<> mutate_MV(
         // First, find the local endpoint and ensure that if it exists,
         // it will be the target endpoint. That way, all endpoints in the
         // remote_endpoints list are guaranteed to be remote.
-        auto my_address = utils::fb_utilities::get_broadcast_address();
+        auto my_address = ctx.my_address;
         auto remote_it = std::find(remote_endpoints.begin(), remote_endpoints.end(), my_address);
         if (remote_it != remote_endpoints.end()) {
             if (!target_endpoint) {
@@ -1850,7 +1889,11 @@ future<> view_builder::drain() {
             // ignored
         }).finally([this] {
             return parallel_for_each(_base_to_build_step, [] (std::pair<const table_id, build_step>& p) {
-                return p.second.reader.close();
+                return p.second.reader.close().then([&p] {
+                    return std::exchange(p.second.pending_flush, make_ready_future<>()).handle_exception([] (std::exception_ptr ep) {
+                        vlogger.warn("Error applying view updates during drain: {}. Ignored.", ep);
+                    });
+                });
             });
         });
     });
@@ -2217,9 +2260,16 @@ future<> view_builder::do_build_step() {
             }
             if (_current_step->second.build_status.empty()) {
                 auto base = _current_step->second.base->schema();
+                // Keep the base table alive until the in-flight view updates
+                // are done with it.
+                auto base_cf = _current_step->second.base;
                 auto reader = std::move(_current_step->second.reader);
+                auto pending_flush = std::move(_current_step->second.pending_flush);
                 _current_step = _base_to_build_step.erase(_current_step);
                 reader.close().get();
+                pending_flush.handle_exception([] (std::exception_ptr ep) {
+                    vlogger.warn("Error applying the final batch of view updates: {}. Ignored.", ep);
+                }).get();
             } else {
                 ++_current_step;
             }
@@ -2385,12 +2435,19 @@ public:
             auto reader = make_flat_mutation_reader_from_fragments(_step.reader.schema(), _builder._permit, std::move(_fragments));
             auto close_reader = defer([&reader] { reader.close().get(); });
             reader.upgrade_schema(base_schema);
-            _step.base->populate_views(
+            // Wait for the previous batch's view updates to be applied,
+            // propagating their failure, and apply this batch's in the
+            // background, so generating and applying view updates overlaps
+            // with reading the next batch from the base table. At most one
+            // batch is in flight, which both bounds the extra memory to one
+            // batch and keeps the updates applied in read order.
+            std::exchange(_step.pending_flush, make_ready_future<>()).get();
+            close_reader.cancel();
+            _step.pending_flush = _step.base->populate_views(
                     std::move(views),
                     _step.current_token(),
                     std::move(reader),
-                    _now).get();
-            close_reader.cancel();
+                    _now);
             _fragments.clear();
             _fragments_memory_usage = 0;
         }
@@ -2436,6 +2493,9 @@ void view_builder::execute(build_step& step, exponential_backoff_retry r) {
             query::max_partitions);
     auto consumer = compact_for_query_v2<view_builder::consumer>(compaction_state, view_builder::consumer{*this, step, now});
     auto built = step.reader.consume_in_thread(std::move(consumer));
+    // The last batch of view updates may still be in flight; the build
+    // progress must not be recorded before it has been applied.
+    std::exchange(step.pending_flush, make_ready_future<>()).get();
     if (auto ds = std::move(*compaction_state).detach_state()) {
         if (ds->current_tombstone) {
             step.reader.unpop_mutation_fragment(mutation_fragment_v2(*step.reader.schema(), step.reader.permit(), std::move(*ds->current_tombstone)));
@@ -259,6 +259,10 @@ class view_update_builder {
     mutation_fragment_v2_opt _existing;
     gc_clock::time_point _now;
     partition_key _key = partition_key::make_empty();
+    // Size of the base rows consumed by the current batch, scaled by the
+    // number of views, used to bound the memory a batch of generated view
+    // updates can hold. See on_results().
+    size_t _batch_bytes = 0;
 public:
 
     view_update_builder(const replica::table& base, schema_ptr s,
@@ -277,7 +281,9 @@ public:
 
 
     // build_some() works on batches of 100 (max_rows_for_view_updates)
-    // updated rows, but can_skip_view_updates() can decide that some of
+    // updated rows, or fewer if the rows are wide enough to hit the batch
+    // memory bound (max_bytes_for_view_updates), but
+    // can_skip_view_updates() can decide that some of
     // these rows do not effect the view, and as a result build_some() can
     // fewer than 100 rows - in extreme cases even zero (see issue #12297).
     // So we can't use an empty returned vector to signify that the view
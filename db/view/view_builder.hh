@@ -138,6 +138,10 @@ class view_builder final : public service::migration_listener::only_view_notific
         flat_mutation_reader_v2 reader{nullptr};
         dht::decorated_key current_key{dht::minimum_token(), partition_key::make_empty()};
         std::vector<view_build_status> build_status;
+        // The application of the last flushed batch of view updates, which
+        // proceeds in the background while the next batch is read from the
+        // base table; see consumer::flush_fragments().
+        future<> pending_flush = make_ready_future<>();
 
         const dht::token& current_token() const {
             return current_key.token();
@@ -54,14 +54,8 @@ mutation_source memtable_filling_virtual_table::as_mutation_source() {
 
         auto units = make_lw_shared<my_units>(permit.consume_memory(0));
 
-        auto populate = [this, mt = make_lw_shared<replica::memtable>(schema()), s, units, range, slice, pc, trace_state, fwd, fwd_mr] () mutable {
-            auto mutation_sink = [units, mt] (mutation m) mutable {
-                mt->apply(m);
-                units->units.add(units->units.permit().consume_memory(mt->occupancy().used_space() - units->memory_used));
-                units->memory_used = mt->occupancy().used_space();
-            };
-
-            return execute(mutation_sink).then([this, mt, s, units, &range, &slice, &pc, &trace_state, &fwd, &fwd_mr] () {
+        auto populate = [this, s, units, range, slice, pc, trace_state, fwd, fwd_mr] () mutable {
+            auto make_reader = [this, s, units, &range, &slice, &pc, &trace_state, &fwd, &fwd_mr] (lw_shared_ptr<replica::memtable> mt) {
                 auto rd = mt->as_data_source().make_reader_v2(s, units->units.permit(), range, slice, pc, trace_state, fwd, fwd_mr);
 
                 if (!_shard_aware) {
@@ -71,6 +65,27 @@ mutation_source memtable_filling_virtual_table::as_mutation_source() {
                 }
 
                 return rd;
+            };
+
+            if (_result_ttl.count() && _cached_result && lowres_clock::now() - _cached_at < _result_ttl) {
+                auto mt = _cached_result;
+                units->units.add(units->units.permit().consume_memory(mt->occupancy().used_space()));
+                return make_ready_future<flat_mutation_reader_v2>(make_reader(std::move(mt)));
+            }
+
+            auto mt = make_lw_shared<replica::memtable>(schema());
+            auto mutation_sink = [units, mt] (mutation m) mutable {
+                mt->apply(m);
+                units->units.add(units->units.permit().consume_memory(mt->occupancy().used_space() - units->memory_used));
+                units->memory_used = mt->occupancy().used_space();
+            };
+
+            return execute(mutation_sink).then([this, mt, make_reader = std::move(make_reader)] () {
+                if (_result_ttl.count()) {
+                    _cached_result = mt;
+                    _cached_at = lowres_clock::now();
+                }
+                return make_reader(std::move(mt));
             });
         };
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <seastar/core/lowres_clock.hh>
 #include "readers/filtering.hh"
 #include "replica/memtable.hh"
 #include "schema.hh"
@@ -51,6 +52,20 @@ public:
 // Produces results by filling a memtable on each read.
 // Use when the amount of data is not significant relative to shard's memory size.
 class memtable_filling_virtual_table : public virtual_table {
+    // Result set built by an earlier read, served to later reads while it is
+    // no older than _result_ttl. Since execute() always generates the
+    // complete result set and the reader slices it afterwards, a cached
+    // result is valid for any query restrictions.
+    lw_shared_ptr<replica::memtable> _cached_result;
+    lowres_clock::time_point _cached_at;
+
+protected: // opt-ins
+    // When set to a non-zero duration, reads arriving within that time of a
+    // result set being generated are served from it instead of regenerating
+    // an identical one. Intended for tables which are scraped periodically
+    // by monitoring and whose consumers tolerate slightly stale answers.
+    lowres_clock::duration _result_ttl{0};
+
 public:
     using virtual_table::virtual_table;
 
@@ -25,6 +25,13 @@
 
 namespace dht {
 
+void i_partitioner::get_tokens(const std::vector<bytes_view>& keys, std::vector<token>& out) const {
+    out.reserve(out.size() + keys.size());
+    for (auto& key : keys) {
+        out.push_back(get_token(sstables::key_view(key)));
+    }
+}
+
 sharder::sharder(unsigned shard_count, unsigned sharding_ignore_msb_bits)
     : _shard_count(shard_count)
     // if one shard, ignore sharding_ignore_msb_bits as they will just cause needless
@@ -67,6 +67,7 @@ public:
     }
 
     struct less_comparator {
+        using is_transparent = void;
         schema_ptr s;
         less_comparator(schema_ptr s);
         bool operator()(const decorated_key& k1, const decorated_key& k2) const;
@@ -149,6 +150,16 @@ public:
     virtual token get_token(const schema& s, partition_key_view key) const = 0;
     virtual token get_token(const sstables::key_view& key) const = 0;
 
+    /**
+     * Computes tokens for a batch of serialized keys, in the same form
+     * accepted by get_token(const sstables::key_view&).
+     *
+     * Equivalent to hashing each key individually, but lets the
+     * partitioner pipeline the hashing of independent keys. Appends one
+     * token per key, in order, to `out`.
+     */
+    virtual void get_tokens(const std::vector<bytes_view>& keys, std::vector<token>& out) const;
+
     // FIXME: token.tokenFactory
     //virtual token.tokenFactory gettokenFactory() = 0;
 
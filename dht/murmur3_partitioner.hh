@@ -20,6 +20,7 @@ public:
     virtual const sstring name() const override { return "org.apache.cassandra.dht.Murmur3Partitioner"; }
     virtual token get_token(const schema& s, partition_key_view key) const override;
     virtual token get_token(const sstables::key_view& key) const override;
+    virtual void get_tokens(const std::vector<bytes_view>& keys, std::vector<token>& out) const override;
 private:
     token get_token(bytes_view key) const;
     token get_token(uint64_t value) const;
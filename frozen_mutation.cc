@@ -7,6 +7,7 @@
  */
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/thread.hh>
 #include "frozen_mutation.hh"
 #include "schema_registry.hh"
 #include "mutation_partition.hh"
@@ -74,6 +75,10 @@ frozen_mutation::frozen_mutation(bytes_ostream&& b, partition_key pk)
 }
 
 frozen_mutation::frozen_mutation(const mutation& m)
+    : frozen_mutation(m, utils::can_yield::no)
+{ }
+
+frozen_mutation::frozen_mutation(const mutation& m, utils::can_yield can_yield)
     : _pk(m.key())
 {
     mutation_partition_serializer part_ser(*m.schema(), m.partition());
@@ -83,7 +88,7 @@ frozen_mutation::frozen_mutation(const mutation& m)
                   .write_schema_version(m.schema()->version())
                   .write_key(m.key())
                   .partition([&] (auto wr) {
-                      part_ser.write(std::move(wr));
+                      part_ser.write(std::move(wr), can_yield);
                   }).end_mutation();
     _bytes.reduce_chunk_count();
 }
@@ -144,6 +149,23 @@ std::vector<mutation> unfreeze(const std::vector<frozen_mutation>& muts) {
     }));
 }
 
+future<frozen_mutation> freeze_gently(const mutation& m) {
+    return seastar::async([&m] {
+        return frozen_mutation(m, utils::can_yield::yes);
+    });
+}
+
+future<std::vector<frozen_mutation>> freeze_gently(const std::vector<mutation>& muts) {
+    return seastar::async([&muts] {
+        std::vector<frozen_mutation> fmuts;
+        fmuts.reserve(muts.size());
+        for (const mutation& m : muts) {
+            fmuts.emplace_back(m, utils::can_yield::yes);
+        }
+        return fmuts;
+    });
+}
+
 mutation_partition_view frozen_mutation::partition() const {
     return mutation_partition_view::from_view(mutation_view().partition());
 }
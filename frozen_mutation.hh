@@ -16,6 +16,7 @@
 #include "mutation_consumer_concepts.hh"
 #include "range_tombstone_change_generator.hh"
 #include "schema.hh"
+#include "utils/maybe_yield.hh"
 
 class mutation;
 class flat_mutation_reader_v2;
@@ -164,6 +165,9 @@ private:
     ser::mutation_view mutation_view() const;
 public:
     explicit frozen_mutation(const mutation& m);
+    // With can_yield::yes the caller must run in a seastar thread;
+    // serialization then yields between rows. See freeze_gently().
+    frozen_mutation(const mutation& m, utils::can_yield);
     explicit frozen_mutation(bytes_ostream&& b);
     frozen_mutation(bytes_ostream&& b, partition_key key);
     frozen_mutation(frozen_mutation&& m) = default;
@@ -233,6 +237,13 @@ frozen_mutation freeze(const mutation& m);
 std::vector<frozen_mutation> freeze(const std::vector<mutation>&);
 std::vector<mutation> unfreeze(const std::vector<frozen_mutation>&);
 
+// Like freeze(), but yields between rows while serializing, so an
+// oversized mutation doesn't stall the reactor for the whole time it
+// takes to freeze it. The mutations must stay alive until the returned
+// future resolves.
+future<frozen_mutation> freeze_gently(const mutation& m);
+future<std::vector<frozen_mutation>> freeze_gently(const std::vector<mutation>&);
+
 struct frozen_mutation_and_schema {
     frozen_mutation fm;
     schema_ptr s;
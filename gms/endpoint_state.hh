@@ -14,6 +14,7 @@
 #include "gms/heart_beat_state.hh"
 #include "gms/application_state.hh"
 #include "gms/versioned_value.hh"
+#include <algorithm>
 #include <optional>
 #include <chrono>
 
@@ -30,6 +31,11 @@ private:
     heart_beat_state _heart_beat_state;
     std::map<application_state, versioned_value> _application_state;
     /* fields below do not get serialized */
+    // Highest version across _application_state, maintained incrementally so
+    // that building gossip digests does not have to walk the whole map for
+    // every endpoint on every round. Application state versions come from a
+    // monotonic generator, so a value is never replaced by an older one.
+    int _max_app_state_version = 0;
     clk::time_point _update_timestamp;
     bool _is_alive;
     bool _is_normal = false;
@@ -62,6 +68,9 @@ public:
         , _application_state(application_state)
         , _update_timestamp(clk::now())
         , _is_alive(true) {
+        for (const auto& [key, value] : _application_state) {
+            _max_app_state_version = std::max(_max_app_state_version, value.version);
+        }
         update_is_normal();
     }
 
@@ -95,15 +104,27 @@ public:
     }
 
     void add_application_state(application_state key, versioned_value value) {
+        _max_app_state_version = std::max(_max_app_state_version, value.version);
         _application_state[key] = std::move(value);
         update_is_normal();
     }
 
     void add_application_state(const endpoint_state& es) {
         _application_state = es._application_state;
+        _max_app_state_version = es._max_app_state_version;
         update_is_normal();
     }
 
+    /**
+     * @return the highest version of any piece of this state - the heart beat
+     * or any of the application states. This is what gossip digests advertise
+     * and compare, so it must be cheap: it is derived from the incrementally
+     * maintained maximum instead of scanning the application state map.
+     */
+    int get_max_version() const noexcept {
+        return std::max(_heart_beat_state.get_heart_beat_version(), _max_app_state_version);
+    }
+
     /* getters and setters */
     /**
      * @return System.nanoTime() when state was updated last time.
@@ -113,6 +113,11 @@ public:
     gms::feature collection_indexing { *this, "COLLECTION_INDEXING"sv };
     gms::feature large_collection_detection { *this, "LARGE_COLLECTION_DETECTION"sv };
     gms::feature secondary_indexes_on_static_columns { *this, "SECONDARY_INDEXES_ON_STATIC_COLUMNS"sv };
+    // The schema version digest is computed from per-keyspace sub-digests
+    // instead of one hash over all schema mutations, so recalculating it
+    // after a DDL statement only rehashes the affected keyspaces. This
+    // changes the digest values, so all nodes must switch together.
+    gms::feature per_keyspace_schema_digest { *this, "PER_KEYSPACE_SCHEMA_DIGEST"sv };
 
 public:
 
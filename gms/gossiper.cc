@@ -473,7 +473,7 @@ gossiper::handle_get_endpoint_states_msg(gossip_get_endpoint_states_request requ
         const std::map<application_state, versioned_value>& apps = state.get_application_state_map();
         for (const auto& app : apps) {
             if (application_states_wanted.count(app.first) > 0) {
-                state_wanted.get_application_state_map().emplace(app);
+                state_wanted.add_application_state(app.first, app.second);
             }
         }
         map.emplace(node, std::move(state_wanted));
@@ -965,6 +965,7 @@ void gossiper::run() {
                         for (auto&& e : es) {
                             local_gossiper._endpoint_state_map[e.first].set_alive(e.second.is_alive());
                         }
+                        local_gossiper.refresh_live_members_snapshot();
                     }
                 }).get();
             }
@@ -1072,13 +1073,8 @@ std::set<inet_address> gossiper::get_unreachable_members() const {
     return ret;
 }
 
-int gossiper::get_max_endpoint_state_version(endpoint_state state) const noexcept {
-    int max_version = state.get_heart_beat_state().get_heart_beat_version();
-    for (auto& entry : state.get_application_state_map()) {
-        auto& value = entry.second;
-        max_version = std::max(max_version, value.version);
-    }
-    return max_version;
+int gossiper::get_max_endpoint_state_version(const endpoint_state& state) const noexcept {
+    return state.get_max_version();
 }
 
 future<> gossiper::evict_from_membership(inet_address endpoint) {
@@ -1086,6 +1082,7 @@ future<> gossiper::evict_from_membership(inet_address endpoint) {
     _unreachable_endpoints.erase(endpoint);
     co_await container().invoke_on_all([endpoint] (auto& g) {
         g._endpoint_state_map.erase(endpoint);
+        g.refresh_live_members_snapshot();
     });
     _expire_time_endpoint_map.erase(endpoint);
     quarantine_endpoint(endpoint);
@@ -1532,6 +1529,7 @@ future<> gossiper::real_mark_alive(inet_address addr, endpoint_state& local_stat
 
     local_state.mark_alive();
     local_state.update_timestamp(); // prevents do_status_check from racing us and evicting if it was down > A_VERY_LONG_TIME
+    refresh_live_members_snapshot();
 
     logger.debug("removing expire time for endpoint : {}", addr);
     _unreachable_endpoints.erase(addr);
@@ -1566,6 +1564,7 @@ future<> gossiper::real_mark_alive(inet_address addr, endpoint_state& local_stat
 future<> gossiper::mark_dead(inet_address addr, endpoint_state& local_state) {
     logger.trace("marking as down {}", addr);
     local_state.mark_dead();
+    refresh_live_members_snapshot();
     endpoint_state state = local_state;
     _live_endpoints.resize(std::distance(_live_endpoints.begin(), std::remove(_live_endpoints.begin(), _live_endpoints.end(), addr)));
     co_await update_live_endpoints_version();
@@ -1592,6 +1591,7 @@ future<> gossiper::handle_major_state_change(inet_address ep, const endpoint_sta
     }
     logger.trace("Adding endpoint state for {}, status = {}", ep, get_gossip_status(eps));
     _endpoint_state_map[ep] = eps;
+    refresh_live_members_snapshot();
     co_await replicate(ep, eps);
 
     if (is_in_shadow_round()) {
@@ -2005,6 +2005,7 @@ future<> gossiper::add_saved_endpoint(inet_address ep) {
     }
     ep_state.mark_dead();
     _endpoint_state_map[ep] = ep_state;
+    refresh_live_members_snapshot();
     co_await replicate(ep, ep_state);
     _unreachable_endpoints[ep] = now();
     logger.trace("Adding saved endpoint {} {}", ep, ep_state.get_heart_beat_state().get_generation());
@@ -2217,6 +2218,18 @@ bool gossiper::is_alive(inet_address ep) const {
     return false;
 }
 
+void gossiper::refresh_live_members_snapshot() {
+    std::unordered_set<inet_address> live;
+    live.reserve(_endpoint_state_map.size() + 1);
+    live.insert(get_broadcast_address());
+    for (const auto& [ep, eps] : _endpoint_state_map) {
+        if (eps.is_alive()) {
+            live.insert(ep);
+        }
+    }
+    _live_members_snapshot = make_lw_shared<const std::unordered_set<inet_address>>(std::move(live));
+}
+
 future<> gossiper::wait_alive(std::vector<gms::inet_address> nodes, std::chrono::milliseconds timeout) {
     auto start_time = std::chrono::steady_clock::now();
     for (;;) {
@@ -225,6 +225,15 @@ private:
     std::unordered_map<inet_address, clk::time_point> _shadow_unreachable_endpoints;
     utils::chunked_vector<inet_address> _shadow_live_endpoints;
 
+    // An immutable per-shard snapshot of the set of endpoints whose
+    // endpoint_state is marked alive, plus the local node. Rebuilt and
+    // swapped whenever this shard learns of a liveness change; see
+    // get_live_members_snapshot().
+    lw_shared_ptr<const std::unordered_set<inet_address>> _live_members_snapshot =
+            make_lw_shared<const std::unordered_set<inet_address>>();
+
+    void refresh_live_members_snapshot();
+
     void run();
     // Replicates given endpoint_state to all other shards.
     // The state state doesn't have to be kept alive around until completes.
@@ -254,6 +263,18 @@ public:
 
     std::set<inet_address> get_live_members() const;
 
+    // Returns an immutable snapshot of the live member set as seen by this
+    // shard. Unlike is_alive(), a lookup in the snapshot touches no gossiper
+    // state, so it is fit for per-request replica selection on the read and
+    // write hot paths. The snapshot is refreshed on gossip events and can
+    // lag is_alive() by at most a gossip round - the same staleness the
+    // alive bits of non-zero shards already have. The local node is always
+    // a member.
+    using live_members_ptr = lw_shared_ptr<const std::unordered_set<inet_address>>;
+    live_members_ptr get_live_members_snapshot() const noexcept {
+        return _live_members_snapshot;
+    }
+
     std::set<inet_address> get_live_token_owners() const;
 
     /**
@@ -279,7 +300,7 @@ public:
      * @param ep_state
      * @return
      */
-    int get_max_endpoint_state_version(endpoint_state state) const noexcept;
+    int get_max_endpoint_state_version(const endpoint_state& state) const noexcept;
 
 
 private:
@@ -10,6 +10,8 @@
 #include "utils/class_registrator.hh"
 #include "exceptions/exceptions.hh"
 #include <boost/range/algorithm/remove_if.hpp>
+#include <algorithm>
+#include <numeric>
 #include <seastar/core/coroutine.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/coroutine/parallel_for_each.hh>
@@ -63,9 +65,7 @@ sstring abstract_replication_strategy::to_qualified_class_name(std::string_view
 }
 
 inet_address_vector_replica_set abstract_replication_strategy::get_natural_endpoints(const token& search_token, const effective_replication_map& erm) const {
-    const token& key_token = erm.get_token_metadata_ptr()->first_token(search_token);
-    auto res = erm.get_replication_map().find(key_token);
-    return res->second;
+    return erm.find_natural_endpoints(search_token);
 }
 
 inet_address_vector_replica_set effective_replication_map::get_natural_endpoints_without_node_being_replaced(const token& search_token) const {
@@ -342,7 +342,76 @@ inet_address_vector_replica_set effective_replication_map::get_natural_endpoints
     return _rs->get_natural_endpoints(search_token, *this);
 }
 
+void effective_replication_map::memoize_last_hit(size_t first_token_index, const inet_address_vector_replica_set& endpoints) const {
+    if (first_token_index == 0) {
+        // The range owned by the first ring token wraps around the
+        // minimum token; skip it rather than complicate the hit test.
+        return;
+    }
+    const auto& sorted_tokens = _tmptr->sorted_tokens();
+    _last_hit_range_start = sorted_tokens[first_token_index - 1];
+    _last_hit_range_end = sorted_tokens[first_token_index];
+    _last_hit_endpoints = &endpoints;
+}
+
+const inet_address_vector_replica_set& effective_replication_map::find_natural_endpoints(const token& search_token) const {
+    if (_last_hit_endpoints && _last_hit_range_start < search_token && search_token <= _last_hit_range_end) {
+        return *_last_hit_endpoints;
+    }
+    const auto index = _tmptr->first_token_index(search_token);
+    const token& key_token = _tmptr->sorted_tokens()[index];
+    const auto& endpoints = _replication_map.find(key_token)->second;
+    memoize_last_hit(index, endpoints);
+    return endpoints;
+}
+
+void effective_replication_map::get_natural_endpoints(const std::vector<token>& search_tokens, std::vector<inet_address_vector_replica_set>& out) const {
+    out.resize(search_tokens.size());
+    if (search_tokens.empty()) {
+        return;
+    }
+    if (!_rs->natural_endpoints_depend_on_token()) {
+        auto endpoints = _rs->get_natural_endpoints(search_tokens.front(), *this);
+        std::fill(out.begin(), out.end(), endpoints);
+        return;
+    }
+
+    // Visit the search tokens in ring order so the ring is walked once,
+    // front to back, instead of binary-searched from scratch per token.
+    auto order = std::vector<size_t>(search_tokens.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [&search_tokens] (size_t a, size_t b) {
+        return search_tokens[a] < search_tokens[b];
+    });
+
+    const auto& sorted_tokens = _tmptr->sorted_tokens();
+    if (sorted_tokens.empty()) {
+        // Same failure mode as the single-token lookup.
+        _tmptr->first_token(search_tokens.front());
+    }
+    auto ring_it = sorted_tokens.begin();
+    const inet_address_vector_replica_set* endpoints = nullptr;
+    size_t key_index = 0;
+    for (auto i : order) {
+        const token& t = search_tokens[i];
+        // Tokens of a batch tend to cluster; consecutive ones often fall
+        // into the vnode range we already resolved.
+        if (!endpoints || ring_it == sorted_tokens.end() || *ring_it < t) {
+            if (endpoints && ring_it != sorted_tokens.end()) {
+                ++ring_it; // t is past the current key; resume the walk after it
+            }
+            ring_it = std::lower_bound(ring_it, sorted_tokens.end(), t);
+            const token& key_token = ring_it == sorted_tokens.end() ? sorted_tokens.front() : *ring_it;
+            key_index = ring_it == sorted_tokens.end() ? 0 : ring_it - sorted_tokens.begin();
+            endpoints = &_replication_map.find(key_token)->second;
+        }
+        out[i] = *endpoints;
+    }
+    memoize_last_hit(key_index, *endpoints);
+}
+
 future<> effective_replication_map::clear_gently() noexcept {
+    _last_hit_endpoints = nullptr;
     co_await utils::clear_gently(_replication_map);
     co_await utils::clear_gently(_tmptr);
 }
@@ -160,6 +160,16 @@ private:
     std::optional<factory_key> _factory_key = std::nullopt;
     effective_replication_map_factory* _factory = nullptr;
 
+    // Memoization of the vnode range hit by the last ring lookup.
+    // The replication map and token ring are immutable for the lifetime
+    // of this object, so a cached entry never goes stale; it just gets
+    // replaced when a lookup lands in a different range. Wrap-around
+    // ranges are not cached so the hit test stays two token comparisons.
+    // The map is per-shard, so this needs no synchronization.
+    mutable const inet_address_vector_replica_set* _last_hit_endpoints = nullptr;
+    mutable token _last_hit_range_start; // exclusive
+    mutable token _last_hit_range_end;   // inclusive
+
     friend class abstract_replication_strategy;
     friend class effective_replication_map_factory;
 public:
@@ -204,6 +214,15 @@ public:
     inet_address_vector_replica_set get_natural_endpoints(const token& search_token) const;
     inet_address_vector_replica_set get_natural_endpoints_without_node_being_replaced(const token& search_token) const;
 
+    // Batched variant of get_natural_endpoints(). Resolves the natural
+    // endpoints of all search_tokens with a single ordered walk over the
+    // token ring instead of one independent binary search per token, and
+    // fills the results into the caller-provided vector, with out[i]
+    // holding the endpoints of search_tokens[i]. out is resized to match
+    // search_tokens; reusing one vector across batches reuses the
+    // small_vector storage of previous results.
+    void get_natural_endpoints(const std::vector<token>& search_tokens, std::vector<inet_address_vector_replica_set>& out) const;
+
     // get_ranges() returns the list of ranges held by the given endpoint.
     // The list is sorted, and its elements are non overlapping and non wrap-around.
     // It the analogue of Origin's getAddressRanges().get(endpoint).
@@ -235,6 +254,13 @@ public:
 private:
     dht::token_range_vector do_get_ranges(noncopyable_function<bool(inet_address_vector_replica_set)> should_add_range) const;
 
+    // The default, token-dependent ring lookup: find the vnode range owning
+    // search_token and return its replicas from the replication map.
+    // Remembers the range that was hit so that subsequent lookups falling
+    // into the same range skip the ring binary search.
+    const inet_address_vector_replica_set& find_natural_endpoints(const token& search_token) const;
+    void memoize_last_hit(size_t first_token_index, const inet_address_vector_replica_set& endpoints) const;
+
 public:
     static factory_key make_factory_key(const abstract_replication_strategy::ptr_type& rs, const token_metadata_ptr& tmptr);
 
@@ -25,6 +25,7 @@ future<> topology::clear_gently() noexcept {
     co_await utils::clear_gently(_dc_racks);
     co_await utils::clear_gently(_current_locations);
     _datacenters.clear();
+    _local_proximity_rank.clear();
     co_return;
 }
 
@@ -55,6 +56,7 @@ future<topology> topology::clone_gently() const {
     }
     co_await coroutine::maybe_yield();
     ret._datacenters = _datacenters;
+    ret._local_proximity_rank = _local_proximity_rank;
     ret._sort_by_proximity = _sort_by_proximity;
     co_return ret;
 }
@@ -75,6 +77,7 @@ void topology::update_endpoint(const inet_address& ep, endpoint_dc_rack dr)
     _dc_racks[dr.dc][dr.rack].insert(ep);
     _datacenters.insert(dr.dc);
     _current_locations[ep] = std::move(dr);
+    recalculate_local_proximity_ranks();
 }
 
 void topology::remove_endpoint(inet_address ep)
@@ -113,6 +116,7 @@ void topology::remove_endpoint(inet_address ep)
     if (ep != utils::fb_utilities::get_broadcast_address()) {
         _current_locations.erase(cur_dc_rack);
     }
+    recalculate_local_proximity_ranks();
 }
 
 bool topology::has_endpoint(inet_address ep) const
@@ -158,12 +162,57 @@ sstring topology::get_datacenter(inet_address ep) const {
     return get_location(ep).dc;
 }
 
+void topology::recalculate_local_proximity_ranks() {
+    auto local = utils::fb_utilities::get_broadcast_address();
+    _local_proximity_rank.clear();
+    auto local_it = _current_locations.find(local);
+    if (local_it == _current_locations.end()) {
+        return;
+    }
+    const auto& local_loc = local_it->second;
+    _local_proximity_rank.reserve(_current_locations.size());
+    for (const auto& [ep, loc] : _current_locations) {
+        uint8_t rank = 3;
+        if (ep == local) {
+            rank = 0;
+        } else if (loc.dc == local_loc.dc) {
+            rank = loc.rack == local_loc.rack ? 1 : 2;
+        }
+        _local_proximity_rank.emplace(ep, rank);
+    }
+}
+
+uint8_t topology::local_proximity_rank(const inet_address& ep) const {
+    if (auto it = _local_proximity_rank.find(ep); it != _local_proximity_rank.end()) {
+        return it->second;
+    }
+    // Endpoint missing from the topology; classify it the way
+    // compare_endpoints() would, through get_location()'s fallback.
+    const auto& local_loc = get_location(utils::fb_utilities::get_broadcast_address());
+    const auto& loc = get_location(ep);
+    if (loc.dc != local_loc.dc) {
+        return 3;
+    }
+    return loc.rack == local_loc.rack ? 1 : 2;
+}
+
 void topology::sort_by_proximity(inet_address address, inet_address_vector_replica_set& addresses) const {
-    if (_sort_by_proximity) {
-        std::sort(addresses.begin(), addresses.end(), [this, &address](inet_address& a1, inet_address& a2) {
-            return compare_endpoints(address, a1, a2) < 0;
+    if (!_sort_by_proximity) {
+        return;
+    }
+    if (address == utils::fb_utilities::get_broadcast_address() && !_local_proximity_rank.empty()) {
+        // The common case: coordinator read planning sorts replicas by
+        // proximity to the local node on every read. The memoized ranks
+        // make each comparison an integer compare instead of DC and rack
+        // string hashing.
+        std::sort(addresses.begin(), addresses.end(), [this](const inet_address& a1, const inet_address& a2) {
+            return local_proximity_rank(a1) < local_proximity_rank(a2);
         });
+        return;
     }
+    std::sort(addresses.begin(), addresses.end(), [this, &address](inet_address& a1, inet_address& a2) {
+        return compare_endpoints(address, a1, a2) < 0;
+    });
 }
 
 int topology::compare_endpoints(const inet_address& address, const inet_address& a1, const inet_address& a2) const {
@@ -103,6 +103,17 @@ private:
      */
     int compare_endpoints(const inet_address& address, const inet_address& a1, const inet_address& a2) const;
 
+    /**
+     * Proximity class of ep relative to the local node: 0 - the local node
+     * itself, 1 - same DC and rack, 2 - same DC, 3 - everything else.
+     * compare_endpoints() orders endpoints by exactly these classes when the
+     * reference address is the local node, so the hot sorting path can look
+     * the class up in _local_proximity_rank instead of hashing DC and rack
+     * strings on every comparison.
+     */
+    uint8_t local_proximity_rank(const inet_address& ep) const;
+    void recalculate_local_proximity_ranks();
+
     /** multi-map: DC -> endpoints in that DC */
     std::unordered_map<sstring,
                        std::unordered_set<inet_address>>
@@ -117,6 +128,13 @@ private:
     /** reverse-lookup map: endpoint -> current known dc/rack assignment */
     std::unordered_map<inet_address, endpoint_dc_rack> _current_locations;
 
+    /**
+     * map: endpoint -> proximity class relative to the local node, memoized
+     * because it only changes when the topology does. Rebuilt by every
+     * update_endpoint()/remove_endpoint(), which are the only mutations.
+     */
+    std::unordered_map<inet_address, uint8_t> _local_proximity_rank;
+
     bool _sort_by_proximity = true;
 
     // pre-calculated
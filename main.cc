@@ -62,9 +62,12 @@
 #include "db/view/view_update_generator.hh"
 #include "service/cache_hitrate_calculator.hh"
 #include "compaction/compaction_manager.hh"
+#include "compaction/throughput_calibration.hh"
 #include "sstables/sstables.hh"
+#include "sstables/sstables_manager.hh"
 #include "gms/feature_service.hh"
 #include "replica/distributed_loader.hh"
+#include "cache_warmup.hh"
 #include "sstables_loader.hh"
 #include "cql3/cql_config.hh"
 #include "transport/controller.hh"
@@ -87,6 +90,7 @@
 #include "alternator/ttl.hh"
 #include "tools/entry_point.hh"
 #include "db/per_partition_rate_limit_extension.hh"
+#include "db/disable_commitlog_extension.hh"
 #include "lang/wasm_instance_cache.hh"
 
 #include "service/raft/raft_address_map.hh"
@@ -469,6 +473,7 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
     ext->add_schema_extension<db::paxos_grace_seconds_extension>(db::paxos_grace_seconds_extension::NAME);
     ext->add_schema_extension<tombstone_gc_extension>(tombstone_gc_extension::NAME);
     ext->add_schema_extension<db::per_partition_rate_limit_extension>(db::per_partition_rate_limit_extension::NAME);
+    ext->add_schema_extension<db::disable_commitlog_extension>(db::disable_commitlog_extension::NAME);
 
     auto cfg = make_lw_shared<db::config>(ext);
     auto init = app.get_options_description().add_options();
@@ -779,7 +784,7 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             // });
 
             supervisor::notify("creating tracing");
-            tracing::tracing::create_tracing("trace_keyspace_helper").get();
+            tracing::tracing::create_tracing(cfg->tracing_backend()).get();
             auto destroy_tracing = defer_verbose_shutdown("tracing instance", [] {
                 tracing::tracing::tracing_instance().stop().get();
             });
@@ -787,6 +792,12 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             auto api_addr = utils::resolve(cfg->api_address || cfg->rpc_address, family, preferred).get0();
             supervisor::notify("starting API server");
             ctx.http_server.start("API").get();
+            // The sstable upload endpoint streams request bodies instead of
+            // accumulating them in memory. No other endpoint reads a request
+            // body, so enabling streaming server-wide is safe.
+            ctx.http_server.server().invoke_on_all([] (httpd::http_server& server) {
+                server.set_content_streaming(true);
+            }).get();
             auto stop_http_server = defer_verbose_shutdown("API server", [&ctx] {
                 ctx.http_server.stop().get();
             });
@@ -807,6 +818,7 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             dbcfg.memtable_scheduling_group = make_sched_group("memtable", 1000);
             dbcfg.memtable_to_cache_scheduling_group = make_sched_group("memtable_to_cache", 200);
             dbcfg.gossip_scheduling_group = make_sched_group("gossip", 1000);
+            dbcfg.background_compression_scheduling_group = make_sched_group("background_compression", 200);
             dbcfg.available_memory = memory::stats().total_memory();
 
             netw::messaging_service::config mscfg;
@@ -835,6 +847,7 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             } else if (compress_what == "dc") {
                 mscfg.compress = netw::messaging_service::compress_what::dc;
             }
+            mscfg.compress_zstd = cfg->internode_compression_zstd();
 
             if (encrypt == "all") {
                 mscfg.encrypt = netw::messaging_service::encrypt_what::all;
@@ -856,6 +869,9 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             qos::service_level_options default_service_level_configuration;
             sl_controller.start(std::ref(auth_service), default_service_level_configuration).get();
             sl_controller.invoke_on_all(&qos::service_level_controller::start).get();
+            sl_controller.invoke_on_all([&cfg] (qos::service_level_controller& sl) {
+                sl.set_cpu_budget(utils::updateable_value<uint32_t>(cfg->service_level_cpu_budget_ms_per_second));
+            }).get();
             auto stop_sl_controller = defer_verbose_shutdown("service level controller", [] {
                 sl_controller.stop().get();
             });
@@ -1008,6 +1024,13 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
                 task_manager.stop().get();
             });
 
+            if (cfg->compaction_throughput_autotune() && !cfg->data_file_directories().empty()) {
+                supervisor::notify("calibrating compaction throughput");
+                auto mbs = sstables::calibrate_compaction_throughput(cfg->data_file_directories()[0], 64 << 20).get0();
+                startlog.info("Compaction throughput calibrated to {} MB/s", mbs);
+                cfg->compaction_throughput_mb_per_sec.set(mbs);
+            }
+
             supervisor::notify("starting compaction_manager");
             // get_cm_cfg is called on each shard when starting a sharded<compaction_manager>
             // we need the getter since updateable_value is not shard-safe (#7316)
@@ -1090,6 +1113,9 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
 
             raft_gr.start(cfg->consistent_cluster_management(),
                 std::ref(raft_address_map), std::ref(messaging), std::ref(gossiper), std::ref(fd)).get();
+            raft_gr.invoke_on_all([&cfg] (service::raft_group_registry& raft_gr) {
+                raft_gr.set_log_sync_window(std::chrono::milliseconds(cfg->raft_group_commit_window_in_ms()));
+            }).get();
 
             // group0 client exists only on shard 0.
             // The client has to be created before `stop_raft` since during
@@ -1240,6 +1266,30 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             supervisor::notify("loading non-system sstables");
             replica::distributed_loader::init_non_system_keyspaces(db, proxy, sys_ks).get();
 
+            if (cfg->sstable_index_cache_warmup()) {
+                // Proceeds in the background while startup continues; each
+                // shard stops as soon as its budget is spent or shutdown
+                // begins.
+                (void)db.invoke_on_all([] (replica::database& db) {
+                    return db.get_user_sstables_manager().warm_up_index_caches();
+                }).handle_exception([] (std::exception_ptr ep) {
+                    startlog.warn("sstable index cache warm-up failed: {}", ep);
+                });
+            }
+
+            cache_warmup_service cache_warmup(db, sys_ks, std::chrono::seconds(cfg->row_cache_warmup_dump_period_in_seconds()));
+            auto stop_cache_warmup = defer_verbose_shutdown("cache warm-up service", [&cache_warmup] {
+                cache_warmup.stop().get();
+            });
+            if (cfg->row_cache_warmup()) {
+                // Re-reads the previously recorded working set in the
+                // background while startup continues.
+                (void)cache_warmup.warm_up().handle_exception([] (std::exception_ptr ep) {
+                    startlog.warn("row cache warm-up failed: {}", ep);
+                });
+                cache_warmup.start_dumping();
+            }
+
             supervisor::notify("starting view update generator");
             view_update_generator.start(std::ref(db)).get();
 
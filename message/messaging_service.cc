@@ -104,6 +104,7 @@
 #include <seastar/rpc/lz4_compressor.hh>
 #include <seastar/rpc/lz4_fragmented_compressor.hh>
 #include <seastar/rpc/multi_algo_compressor_factory.hh>
+#include "message/zstd_rpc_compressor.hh"
 #include "partition_range_compat.hh"
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indirected.hpp>
@@ -131,10 +132,24 @@ using namespace std::chrono_literals;
 
 static rpc::lz4_fragmented_compressor::factory lz4_fragmented_compressor_factory;
 static rpc::lz4_compressor::factory lz4_compressor_factory;
+static zstd_rpc_compressor::factory zstd_compressor_factory;
+static zstd_stream_rpc_compressor::factory zstd_stream_compressor_factory;
 static rpc::multi_algo_compressor_factory compressor_factory {
     &lz4_fragmented_compressor_factory,
     &lz4_compressor_factory,
 };
+// Advertises zstd in addition to lz4, with zstd preferred. The client
+// offers this set only on cross-DC links, which are bandwidth-bound, so
+// intra-DC links keep the cheaper lz4 no matter what the server supports.
+// The streaming variant, which reuses the compression window across
+// messages, is preferred over the per-message one; peers which predate
+// it negotiate plain ZSTD.
+static rpc::multi_algo_compressor_factory wan_compressor_factory {
+    &zstd_stream_compressor_factory,
+    &zstd_compressor_factory,
+    &lz4_fragmented_compressor_factory,
+    &lz4_compressor_factory,
+};
 
 struct messaging_service::rpc_protocol_server_wrapper : public rpc_protocol::server { using rpc_protocol::server::server; };
 
@@ -277,7 +292,10 @@ void messaging_service::do_start_listen() {
     bool listen_to_bc = _cfg.listen_on_broadcast_address && _cfg.ip != utils::fb_utilities::get_broadcast_address();
     rpc::server_options so;
     if (_cfg.compress != compress_what::none) {
-        so.compressor_factory = &compressor_factory;
+        // The choice of algorithm is driven by the connecting client, which
+        // knows whether the link crosses a DC; the server merely has to
+        // support everything the clients may offer.
+        so.compressor_factory = _cfg.compress_zstd ? &wan_compressor_factory : &compressor_factory;
     }
     so.load_balancing_algorithm = server_socket::load_balancing_algorithm::port;
 
@@ -804,7 +822,17 @@ shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::ge
     // send keepalive messages each minute if connection is idle, drop connection after 10 failures
     opts.keepalive = std::optional<net::tcp_keepalive_params>({60s, 60s, 10});
     if (must_compress) {
-        opts.compressor_factory = &compressor_factory;
+        // Cross-DC links (and links whose locality we don't know yet) are
+        // bandwidth-bound, so offer zstd there; intra-DC links are CPU-bound
+        // and stick to lz4. The per-DC distinction is the same one used for
+        // the encryption and nodelay settings above. Streaming connections
+        // offer zstd regardless of locality: topology operations move whole
+        // sstables and are throughput-bound even inside a DC, and the
+        // streaming zstd variant compresses each chunk against the history
+        // of the previous ones.
+        auto is_streaming = _scheduling_info_for_connection_index[idx].isolation_cookie == "streaming";
+        auto use_zstd = _cfg.compress_zstd && (is_streaming || !has_topology() || !is_same_dc(id.addr));
+        opts.compressor_factory = use_zstd ? &wan_compressor_factory : &compressor_factory;
     }
     opts.tcp_nodelay = must_tcp_nodelay;
     opts.reuseaddr = true;
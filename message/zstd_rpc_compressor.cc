@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include <variant>
+#include <vector>
+
+#include <seastar/core/byteorder.hh>
+#include <seastar/core/print.hh>
+
+#include "message/zstd_rpc_compressor.hh"
+
+namespace netw {
+
+static const sstring ZSTD_FEATURE = "ZSTD";
+
+// Size of the length prefix in front of every message.
+static constexpr size_t header_size = 4;
+
+// Level 3 (the library default) compresses internode traffic to roughly
+// half of what lz4 leaves, at a CPU cost which is still small next to the
+// per-message serialization work. Higher levels buy little extra ratio on
+// mutation-sized messages while their CPU cost grows quickly.
+static constexpr int compression_level = 3;
+
+zstd_rpc_compressor::zstd_rpc_compressor()
+    : _cctx(ZSTD_createCCtx())
+    , _dctx(ZSTD_createDCtx())
+{
+    if (!_cctx || !_dctx) {
+        throw std::bad_alloc();
+    }
+    ZSTD_CCtx_setParameter(_cctx.get(), ZSTD_c_compressionLevel, compression_level);
+}
+
+sstring zstd_rpc_compressor::name() const {
+    return ZSTD_FEATURE;
+}
+
+const sstring& zstd_rpc_compressor::factory::supported() const {
+    return ZSTD_FEATURE;
+}
+
+std::unique_ptr<rpc::compressor> zstd_rpc_compressor::factory::negotiate(sstring feature, bool is_server) const {
+    return feature == ZSTD_FEATURE ? std::make_unique<zstd_rpc_compressor>() : nullptr;
+}
+
+template <typename Buf>
+static void copy_fragments(char* dst, const Buf& data) {
+    if (auto* one = std::get_if<temporary_buffer<char>>(&data.bufs)) {
+        std::copy_n(one->get(), one->size(), dst);
+        return;
+    }
+    for (auto& frag : std::get<std::vector<temporary_buffer<char>>>(data.bufs)) {
+        dst = std::copy_n(frag.get(), frag.size(), dst);
+    }
+}
+
+// Returns a contiguous view of the buffer's payload, copying into scratch
+// only when it is actually fragmented.
+template <typename Buf>
+static const char* linearize(const Buf& data, temporary_buffer<char>& scratch) {
+    if (auto* one = std::get_if<temporary_buffer<char>>(&data.bufs)) {
+        return one->get();
+    }
+    scratch = temporary_buffer<char>(data.size);
+    copy_fragments(scratch.get_write(), data);
+    return scratch.get();
+}
+
+// Scatters [src, src + size) into a snd_buf, chunked like the rpc layer
+// expects so no single allocation exceeds the chunk size.
+static rpc::snd_buf make_snd_buf(const char* src, size_t size) {
+    rpc::snd_buf out(size);
+    if (auto* one = std::get_if<temporary_buffer<char>>(&out.bufs)) {
+        std::copy_n(src, size, one->get_write());
+        return out;
+    }
+    for (auto& frag : std::get<std::vector<temporary_buffer<char>>>(out.bufs)) {
+        std::copy_n(src, frag.size(), frag.get_write());
+        src += frag.size();
+    }
+    return out;
+}
+
+rpc::snd_buf zstd_rpc_compressor::compress(size_t head_space, rpc::snd_buf data) {
+    // The input and the compressed output are linearized; messages are
+    // bounded by the rpc memory limit, so the transient buffers are small,
+    // and only cross-DC links pay for them at all.
+    temporary_buffer<char> scratch;
+    const char* src = linearize(data, scratch);
+
+    temporary_buffer<char> out(head_space + header_size + ZSTD_compressBound(data.size));
+    char* dst = out.get_write() + head_space;
+    size_t ret = ZSTD_compress2(_cctx.get(), dst + header_size, out.size() - head_space - header_size,
+            src, data.size);
+    if (ZSTD_isError(ret) || ret >= data.size) {
+        // Incompressible (or pathological) message: store it raw rather
+        // than growing it. A zero size prefix marks this case.
+        seastar::write_le<uint32_t>(dst, 0);
+        std::copy_n(src, data.size, dst + header_size);
+        return make_snd_buf(out.get(), head_space + header_size + data.size);
+    }
+    seastar::write_le<uint32_t>(dst, data.size);
+    return make_snd_buf(out.get(), head_space + header_size + ret);
+}
+
+rpc::rcv_buf zstd_rpc_compressor::decompress(rpc::rcv_buf data) {
+    if (data.size < header_size) {
+        return rpc::rcv_buf();
+    }
+    temporary_buffer<char> scratch;
+    const char* src = linearize(data, scratch);
+
+    auto uncompressed_size = seastar::read_le<uint32_t>(src);
+    if (!uncompressed_size) {
+        return rpc::rcv_buf(temporary_buffer<char>(src + header_size, data.size - header_size));
+    }
+    temporary_buffer<char> out(uncompressed_size);
+    size_t ret = ZSTD_decompressDCtx(_dctx.get(), out.get_write(), uncompressed_size,
+            src + header_size, data.size - header_size);
+    if (ZSTD_isError(ret) || ret != uncompressed_size) {
+        throw std::runtime_error(format("RPC frame decompression failure: {}",
+                ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "truncated frame"));
+    }
+    return rpc::rcv_buf(std::move(out));
+}
+
+static const sstring ZSTD_STREAM_FEATURE = "ZSTD_STREAM";
+
+// Bounds the compression window, and with it the per-connection memory
+// held by both sides: 128 KiB of history per direction. Larger windows
+// help little for mutation-sized messages while multiplying the cost
+// across the many connections of a big cluster.
+static constexpr int window_log = 17;
+
+zstd_stream_rpc_compressor::zstd_stream_rpc_compressor()
+    : _cctx(ZSTD_createCCtx())
+    , _dctx(ZSTD_createDCtx())
+{
+    if (!_cctx || !_dctx) {
+        throw std::bad_alloc();
+    }
+    ZSTD_CCtx_setParameter(_cctx.get(), ZSTD_c_compressionLevel, compression_level);
+    ZSTD_CCtx_setParameter(_cctx.get(), ZSTD_c_windowLog, window_log);
+    ZSTD_DCtx_setParameter(_dctx.get(), ZSTD_d_windowLogMax, window_log);
+}
+
+sstring zstd_stream_rpc_compressor::name() const {
+    return ZSTD_STREAM_FEATURE;
+}
+
+const sstring& zstd_stream_rpc_compressor::factory::supported() const {
+    return ZSTD_STREAM_FEATURE;
+}
+
+std::unique_ptr<rpc::compressor> zstd_stream_rpc_compressor::factory::negotiate(sstring feature, bool is_server) const {
+    return feature == ZSTD_STREAM_FEATURE ? std::make_unique<zstd_stream_rpc_compressor>() : nullptr;
+}
+
+rpc::snd_buf zstd_stream_rpc_compressor::compress(size_t head_space, rpc::snd_buf data) {
+    temporary_buffer<char> scratch;
+    const char* src = linearize(data, scratch);
+
+    // Every message must go through the stream, even an incompressible
+    // one, so that the receiver's window stays in sync with ours; there
+    // is no raw fallback here. ZSTD_e_flush completes the blocks of this
+    // message without resetting the window.
+    temporary_buffer<char> out(head_space + header_size + ZSTD_compressBound(data.size));
+    char* dst = out.get_write() + head_space;
+    ZSTD_outBuffer ob{dst + header_size, out.size() - head_space - header_size, 0};
+    ZSTD_inBuffer ib{src, data.size, 0};
+    size_t ret = ZSTD_compressStream2(_cctx.get(), &ob, &ib, ZSTD_e_flush);
+    if (ZSTD_isError(ret) || ret != 0 || ib.pos != ib.size) {
+        // With a compressBound()-sized output buffer the flush cannot be
+        // left incomplete; treat it as a broken stream.
+        throw std::runtime_error(format("RPC frame compression failure: {}",
+                ZSTD_isError(ret) ? ZSTD_getErrorName(ret) : "incomplete flush"));
+    }
+    seastar::write_le<uint32_t>(dst, data.size);
+    return make_snd_buf(out.get(), head_space + header_size + ob.pos);
+}
+
+rpc::rcv_buf zstd_stream_rpc_compressor::decompress(rpc::rcv_buf data) {
+    if (data.size < header_size) {
+        return rpc::rcv_buf();
+    }
+    temporary_buffer<char> scratch;
+    const char* src = linearize(data, scratch);
+
+    auto uncompressed_size = seastar::read_le<uint32_t>(src);
+    temporary_buffer<char> out(uncompressed_size);
+    ZSTD_outBuffer ob{out.get_write(), uncompressed_size, 0};
+    ZSTD_inBuffer ib{src + header_size, data.size - header_size, 0};
+    while (ib.pos < ib.size) {
+        size_t ret = ZSTD_decompressStream(_dctx.get(), &ob, &ib);
+        if (ZSTD_isError(ret)) {
+            throw std::runtime_error(format("RPC frame decompression failure: {}", ZSTD_getErrorName(ret)));
+        }
+        if (ob.pos == ob.size && ib.pos < ib.size) {
+            throw std::runtime_error("RPC frame decompression failure: frame larger than advertised");
+        }
+    }
+    if (ob.pos != uncompressed_size) {
+        throw std::runtime_error("RPC frame decompression failure: truncated frame");
+    }
+    return rpc::rcv_buf(std::move(out));
+}
+
+}
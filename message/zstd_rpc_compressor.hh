@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <seastar/rpc/rpc_types.hh>
+
+#include <zstd.h>
+
+#include "seastarx.hh"
+
+namespace netw {
+
+// Message-level zstd compression for internode RPC.
+//
+// Trades more CPU for a better compression ratio than lz4, which pays off
+// on bandwidth-bound cross-DC links; the client offers it only for those,
+// so intra-DC links keep the cheaper lz4. Negotiated by name like the
+// other algorithms, so mixed clusters fall back to lz4 against peers
+// which don't know it.
+//
+// Each message is an independent zstd frame, prefixed with the
+// uncompressed size; a zero size marks a message stored raw because
+// compression didn't shrink it. The compression and decompression
+// contexts live as long as the connection and are reused across
+// messages, which skips the per-message context setup cost.
+class zstd_rpc_compressor : public rpc::compressor {
+    struct cctx_deleter {
+        void operator()(ZSTD_CCtx* ctx) const noexcept { ZSTD_freeCCtx(ctx); }
+    };
+    struct dctx_deleter {
+        void operator()(ZSTD_DCtx* ctx) const noexcept { ZSTD_freeDCtx(ctx); }
+    };
+    std::unique_ptr<ZSTD_CCtx, cctx_deleter> _cctx;
+    std::unique_ptr<ZSTD_DCtx, dctx_deleter> _dctx;
+public:
+    zstd_rpc_compressor();
+
+    rpc::snd_buf compress(size_t head_space, rpc::snd_buf data) override;
+    rpc::rcv_buf decompress(rpc::rcv_buf data) override;
+    sstring name() const override;
+
+    class factory : public rpc::compressor::factory {
+    public:
+        const sstring& supported() const override;
+        std::unique_ptr<rpc::compressor> negotiate(sstring feature, bool is_server) const override;
+    };
+};
+
+// Streaming variant of zstd_rpc_compressor: the compression window is
+// carried across messages of a connection instead of starting cold on
+// every message, so repeated structure - column names, keys with shared
+// prefixes, thousands of chunks of the same sstable during streaming -
+// is compressed against the history of the previous messages. The
+// receiver's decompression context mirrors the sender's window, which
+// is sound because rpc frames are compressed and decompressed in
+// connection order.
+//
+// Negotiated under its own feature name, so peers which only know the
+// per-message ZSTD format keep working against it.
+class zstd_stream_rpc_compressor : public rpc::compressor {
+    struct cctx_deleter {
+        void operator()(ZSTD_CCtx* ctx) const noexcept { ZSTD_freeCCtx(ctx); }
+    };
+    struct dctx_deleter {
+        void operator()(ZSTD_DCtx* ctx) const noexcept { ZSTD_freeDCtx(ctx); }
+    };
+    std::unique_ptr<ZSTD_CCtx, cctx_deleter> _cctx;
+    std::unique_ptr<ZSTD_DCtx, dctx_deleter> _dctx;
+public:
+    zstd_stream_rpc_compressor();
+
+    rpc::snd_buf compress(size_t head_space, rpc::snd_buf data) override;
+    rpc::rcv_buf decompress(rpc::rcv_buf data) override;
+    sstring name() const override;
+
+    class factory : public rpc::compressor::factory {
+    public:
+        const sstring& supported() const override;
+        std::unique_ptr<rpc::compressor> negotiate(sstring feature, bool is_server) const override;
+    };
+};
+
+}
@@ -152,36 +152,55 @@ void mutation_fragment::destroy_data() noexcept
     }
 }
 
+std::unique_ptr<mutation_fragment_v2::data> mutation_fragment_v2::data::make(reader_permit permit) {
+    void* p = permit.alloc_fragment_shell(sizeof(data));
+    try {
+        return std::unique_ptr<data>(new (p) data(std::move(permit)));
+    } catch (...) {
+        // The permit was moved into the failed constructor, so the shell
+        // cannot be returned to its pool; pool chunks come from the global
+        // allocator, so freeing there is fine.
+        ::operator delete(p);
+        throw;
+    }
+}
+
+void mutation_fragment_v2::data::operator delete(data* p, std::destroying_delete_t) noexcept {
+    auto permit = p->_memory.permit();
+    p->~data();
+    permit.free_fragment_shell(p, sizeof(data));
+}
+
 mutation_fragment_v2::mutation_fragment_v2(const schema& s, reader_permit permit, static_row&& r)
-    : _kind(kind::static_row), _data(std::make_unique<data>(std::move(permit)))
+    : _kind(kind::static_row), _data(data::make(std::move(permit)))
 {
     new (&_data->_static_row) static_row(std::move(r));
     _data->_memory.reset(reader_resources::with_memory(calculate_memory_usage(s)));
 }
 
 mutation_fragment_v2::mutation_fragment_v2(const schema& s, reader_permit permit, clustering_row&& r)
-    : _kind(kind::clustering_row), _data(std::make_unique<data>(std::move(permit)))
+    : _kind(kind::clustering_row), _data(data::make(std::move(permit)))
 {
     new (&_data->_clustering_row) clustering_row(std::move(r));
     _data->_memory.reset(reader_resources::with_memory(calculate_memory_usage(s)));
 }
 
 mutation_fragment_v2::mutation_fragment_v2(const schema& s, reader_permit permit, range_tombstone_change&& r)
-    : _kind(kind::range_tombstone_change), _data(std::make_unique<data>(std::move(permit)))
+    : _kind(kind::range_tombstone_change), _data(data::make(std::move(permit)))
 {
     new (&_data->_range_tombstone_chg) range_tombstone_change(std::move(r));
     _data->_memory.reset(reader_resources::with_memory(calculate_memory_usage(s)));
 }
 
 mutation_fragment_v2::mutation_fragment_v2(const schema& s, reader_permit permit, partition_start&& r)
-        : _kind(kind::partition_start), _data(std::make_unique<data>(std::move(permit)))
+        : _kind(kind::partition_start), _data(data::make(std::move(permit)))
 {
     new (&_data->_partition_start) partition_start(std::move(r));
     _data->_memory.reset(reader_resources::with_memory(calculate_memory_usage(s)));
 }
 
 mutation_fragment_v2::mutation_fragment_v2(const schema& s, reader_permit permit, partition_end&& r)
-        : _kind(kind::partition_end), _data(std::make_unique<data>(std::move(permit)))
+        : _kind(kind::partition_end), _data(data::make(std::move(permit)))
 {
     new (&_data->_partition_end) partition_end(std::move(r));
     _data->_memory.reset(reader_resources::with_memory(calculate_memory_usage(s)));
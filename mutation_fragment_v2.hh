@@ -12,6 +12,7 @@
 #include "mutation_fragment.hh"
 #include "position_in_partition.hh"
 
+#include <new>
 #include <optional>
 #include <seastar/util/optimized_optional.hh>
 
@@ -140,6 +141,12 @@ private:
         data(reader_permit permit) :  _memory(permit.consume_memory()) { }
         ~data() { }
 
+        // Shells are allocated through the permit, which recycles them
+        // across the fragments of a read instead of hitting the allocator
+        // once per fragment.
+        static std::unique_ptr<data> make(reader_permit permit);
+        void operator delete(data* p, std::destroying_delete_t) noexcept;
+
         reader_permit::resource_units _memory;
         union {
             static_row _static_row;
@@ -165,7 +172,7 @@ public:
     template<typename... Args>
     mutation_fragment_v2(clustering_row_tag_t, const schema& s, reader_permit permit, Args&&... args)
         : _kind(kind::clustering_row)
-        , _data(std::make_unique<data>(std::move(permit)))
+        , _data(data::make(std::move(permit)))
     {
         new (&_data->_clustering_row) clustering_row(std::forward<Args>(args)...);
         _data->_memory.reset(reader_resources::with_memory(calculate_memory_usage(s)));
@@ -178,7 +185,7 @@ public:
     mutation_fragment_v2(const schema& s, reader_permit permit, partition_end&& r);
 
     mutation_fragment_v2(const schema& s, reader_permit permit, const mutation_fragment_v2& o)
-        : _kind(o._kind), _data(std::make_unique<data>(std::move(permit))) {
+        : _kind(o._kind), _data(data::make(std::move(permit))) {
         switch (_kind) {
             case kind::static_row:
                 new (&_data->_static_row) static_row(s, o._data->_static_row);
@@ -412,9 +412,19 @@ stop_iteration mutation_partition::apply_monotonically(const schema& s, mutation
         if (i != _rows.end()) {
             auto x = cmp(*i, src_e);
             if (x < 0) {
-                bool match;
-                i = _rows.lower_bound(src_e, match, cmp);
-                miss = !match;
+                // Workloads which insert rows in clustering order (e.g. time
+                // series) always land after the current last entry. Check the
+                // rightmost entry first to turn that case into a constant-time
+                // append instead of a tree descent. Evictable versions never
+                // take this path because their last entry is the after-all-rows
+                // dummy, which no row sorts after.
+                if (cmp(*std::prev(_rows.end()), src_e) < 0) {
+                    i = _rows.end();
+                } else {
+                    bool match;
+                    i = _rows.lower_bound(src_e, match, cmp);
+                    miss = !match;
+                }
             } else {
                 miss = x > 0;
             }
@@ -2052,7 +2062,13 @@ uint64_t mutation_querier::consume_end_of_stream() {
         auto live_rows = std::max(_live_clustering_rows, uint64_t(1));
         _pw.row_count() += live_rows;
         _pw.partition_count() += 1;
-        std::move(*_rows_wr).end_rows().end_qr_partition();
+        if (_pw.requested_result()) {
+            std::move(*_rows_wr).end_rows().end_qr_partition();
+        } else {
+            // Digest-only query; the serialized result is thrown away at
+            // build(), so don't let the scaffolding accumulate.
+            _pw.discard_serialized_result();
+        }
         return live_rows;
     }
 }
@@ -146,12 +146,13 @@ auto write_row_marker(Writer&& writer, const row_marker& marker)
 }
 
 template <typename RowTombstones>
-static void write_tombstones(const schema& s, RowTombstones& row_tombstones, const range_tombstone_list& rt_list)
+static void write_tombstones(const schema& s, RowTombstones& row_tombstones, const range_tombstone_list& rt_list, utils::can_yield can_yield = utils::can_yield::no)
 {
     for (auto&& rte : rt_list) {
         auto& rt = rte.tombstone();
         row_tombstones.add().write_start(rt.start).write_tomb(rt.tomb).write_start_kind(rt.start_kind)
             .write_end(rt.end).write_end_kind(rt.end_kind).end_range_tombstone();
+        utils::maybe_yield(can_yield);
     }
 }
 
@@ -170,14 +171,15 @@ static auto write_row(Writer&& writer, const schema& s, const clustering_key_pre
 }
 
 template<typename Writer>
-void mutation_partition_serializer::write_serialized(Writer&& writer, const schema& s, const mutation_partition& mp)
+void mutation_partition_serializer::write_serialized(Writer&& writer, const schema& s, const mutation_partition& mp, utils::can_yield can_yield)
 {
     auto srow_writer = std::move(writer).write_tomb(mp.partition_tombstone()).start_static_row();
     auto row_tombstones = write_row_cells(std::move(srow_writer), mp.static_row().get(), s, column_kind::static_column).end_static_row().start_range_tombstones();
-    write_tombstones(s, row_tombstones, mp.row_tombstones());
+    write_tombstones(s, row_tombstones, mp.row_tombstones(), can_yield);
     auto clustering_rows = std::move(row_tombstones).end_range_tombstones().start_rows();
     for (auto&& cr : mp.non_dummy_rows()) {
         write_row(clustering_rows.add(), s, cr.key(), cr.row().cells(), cr.row().marker(), cr.row().deleted_at()).end_deletable_row();
+        utils::maybe_yield(can_yield);
     }
     std::move(clustering_rows).end_rows().end_mutation_partition();
 }
@@ -187,13 +189,13 @@ mutation_partition_serializer::mutation_partition_serializer(const schema& schem
 { }
 
 void
-mutation_partition_serializer::write(bytes_ostream& out) const {
-    write(ser::writer_of_mutation_partition<bytes_ostream>(out));
+mutation_partition_serializer::write(bytes_ostream& out, utils::can_yield can_yield) const {
+    write(ser::writer_of_mutation_partition<bytes_ostream>(out), can_yield);
 }
 
-void mutation_partition_serializer::write(ser::writer_of_mutation_partition<bytes_ostream>&& wr) const
+void mutation_partition_serializer::write(ser::writer_of_mutation_partition<bytes_ostream>&& wr, utils::can_yield can_yield) const
 {
-    write_serialized(std::move(wr), _schema, _p);
+    write_serialized(std::move(wr), _schema, _p, can_yield);
 }
 
 void serialize_mutation_fragments(const schema& s, tombstone partition_tombstone,
@@ -11,6 +11,7 @@
 #include "replica/database_fwd.hh"
 #include "bytes_ostream.hh"
 #include "mutation_fragment.hh"
+#include "utils/maybe_yield.hh"
 
 namespace ser {
 template<typename Output>
@@ -26,13 +27,16 @@ private:
     const mutation_partition& _p;
 private:
     template<typename Writer>
-    static void write_serialized(Writer&& out, const schema&, const mutation_partition&);
+    static void write_serialized(Writer&& out, const schema&, const mutation_partition&, utils::can_yield);
 public:
     using count_type = uint32_t;
     mutation_partition_serializer(const schema&, const mutation_partition&);
 public:
-    void write(bytes_ostream&) const;
-    void write(ser::writer_of_mutation_partition<bytes_ostream>&&) const;
+    // When can_yield::yes is passed the caller must run in a seastar
+    // thread; serialization then yields between rows so that freezing
+    // a very large partition doesn't stall the reactor.
+    void write(bytes_ostream&, utils::can_yield = utils::can_yield::no) const;
+    void write(ser::writer_of_mutation_partition<bytes_ostream>&&, utils::can_yield = utils::can_yield::no) const;
 };
 
 void serialize_mutation_fragments(const schema& s, tombstone partition_tombstone,
@@ -7,6 +7,7 @@
  */
 
 #include <boost/range/algorithm/heap_algorithm.hpp>
+#include <iterator>
 
 #include "partition_version.hh"
 #include "row_cache.hh"
@@ -423,12 +424,15 @@ utils::coroutine partition_entry::apply_to_incomplete(const schema& s,
             dst_snp = std::move(dst_snp),
             prev_snp = std::move(prev_snp),
             src_snp = std::move(src_snp),
+            version_no = size_t(0),
+            rt_applied = size_t(0),
+            src_version_count = unsigned(-1),
             static_done = false] () mutable {
         auto&& allocator = reg.allocator();
         return alloc(reg, [&] {
             size_t dirty_size = 0;
 
-            if (!static_done) {
+            if (!static_done && !preemptible) {
                 partition_version& dst = *dst_snp->version();
                 bool static_row_continuous = dst_snp->static_row_continuous();
                 auto current = &*src_snp->version();
@@ -447,7 +451,6 @@ utils::coroutine partition_entry::apply_to_incomplete(const schema& s,
                     }
                     dirty_size += current->partition().row_tombstones().external_memory_usage(s);
                     range_tombstone_list& tombstones = dst.partition().mutable_row_tombstones();
-                    // FIXME: defer while applying range tombstones
                     if (can_move) {
                         tombstones.apply_monotonically(s, std::move(current->partition().mutable_row_tombstones()));
                     } else {
@@ -458,6 +461,68 @@ utils::coroutine partition_entry::apply_to_incomplete(const schema& s,
                 }
                 acc.unpin_memory(dirty_size);
                 static_done = true;
+            } else if (!static_done) {
+                // Bounded work per resumption: apply one version's partition
+                // tombstone and static row, then its range tombstones one
+                // entry at a time, checking for preemption as we go. Wide
+                // partitions can carry range tombstone lists large enough for
+                // a one-shot application to stall the reactor (this used to
+                // be a FIXME here).
+                //
+                // Pointers into the source chain are not stable across
+                // preemption points, so progress is tracked with indices. The
+                // cleaner may merge source versions while we're away, which
+                // invalidates the indices; every application below is an
+                // idempotent copy (can_move is never set when preemptible),
+                // so in that rare case the phase simply starts over.
+                partition_version& dst = *dst_snp->version();
+                bool static_row_continuous = dst_snp->static_row_continuous();
+                if (src_snp->version_count() != src_version_count) {
+                    src_version_count = src_snp->version_count();
+                    version_no = 0;
+                    rt_applied = 0;
+                }
+                partition_version* current = &*src_snp->version();
+                for (size_t i = 0; i < version_no; ++i) {
+                    current = current->next();
+                }
+                while (current) {
+                    if (!rt_applied) {
+                        dst.partition().apply(current->partition().partition_tombstone());
+                        if (static_row_continuous) {
+                            dst.partition().static_row().apply(s, column_kind::static_column,
+                                current->partition().static_row());
+                        }
+                    }
+                    const range_tombstone_list& src_rts = const_cast<const mutation_partition&>(current->partition()).row_tombstones();
+                    range_tombstone_list& tombstones = dst.partition().mutable_row_tombstones();
+                    auto it = src_rts.begin();
+                    std::advance(it, rt_applied);
+                    while (it != src_rts.end()) {
+                        tombstones.apply(s, it->tombstone());
+                        ++it;
+                        ++rt_applied;
+                        if (it != src_rts.end() && need_preempt()) {
+                            return stop_iteration::no;
+                        }
+                    }
+                    current = current->next();
+                    ++version_no;
+                    rt_applied = 0;
+                    if (current && need_preempt()) {
+                        return stop_iteration::no;
+                    }
+                }
+                // Unpin the whole static part at once, like the
+                // non-preemptible path does; per-version unpinning would
+                // double-count if the phase restarts.
+                for (current = &*src_snp->version(); current; current = current->next()) {
+                    dirty_size += allocator.object_memory_size_in_allocator(current)
+                        + current->partition().static_row().external_memory_usage(s, column_kind::static_column)
+                        + current->partition().row_tombstones().external_memory_usage(s);
+                }
+                acc.unpin_memory(dirty_size);
+                static_done = true;
             }
 
             if (!src_cur.maybe_refresh_static()) {
@@ -333,11 +333,25 @@ std::optional<Querier> querier_cache::lookup_querier(
     const auto can_be_used = can_be_used_for_page(q, s, ranges.front(), slice);
     if (can_be_used == can_use::yes) {
         tracing::trace(trace_state, "Reusing querier");
+        ++stats.hits;
         return std::optional<Querier>(std::move(q));
     }
 
     tracing::trace(trace_state, "Dropping querier because {}", cannot_use_reason(can_be_used));
     ++stats.drops;
+    switch (can_be_used) {
+        case can_use::no_schema_version_mismatch:
+            ++stats.drops_schema_version_mismatch;
+            break;
+        case can_use::no_ring_pos_mismatch:
+            ++stats.drops_ring_pos_mismatch;
+            break;
+        case can_use::no_clustering_pos_mismatch:
+            ++stats.drops_clustering_pos_mismatch;
+            break;
+        case can_use::yes:
+            break;
+    }
 
     // Close and drop the querier in the background.
     // It is safe to do so, since _closing_gate is closed and
@@ -299,9 +299,15 @@ public:
         uint64_t lookups = 0;
         // The subset of lookups that missed.
         uint64_t misses = 0;
+        // The subset of lookups that found a querier that could be reused.
+        uint64_t hits = 0;
         // The subset of lookups that hit but the looked up querier had to be
         // dropped due to position mismatch.
         uint64_t drops = 0;
+        // Breakdown of `drops` by cause.
+        uint64_t drops_schema_version_mismatch = 0;
+        uint64_t drops_ring_pos_mismatch = 0;
+        uint64_t drops_clustering_pos_mismatch = 0;
         // The number of queriers evicted due to their TTL expiring.
         uint64_t time_based_evictions = 0;
         // The number of queriers evicted to free up resources to be able to
@@ -80,6 +80,15 @@ public:
         _pw.rollback(_pos);
     }
 
+    // Drops the bytes serialized for this partition, keeping the digest and
+    // counters intact. For digest-only queries the serialized result is
+    // discarded at build(), so there is no point in accumulating it across
+    // partitions. Call in the same state as retract(); do not use this
+    // writer after that.
+    void discard_serialized_result() {
+        _pw.rollback(_pos);
+    }
+
     const clustering_row_ranges& ranges() const {
         return _ranges;
     }
@@ -440,11 +440,32 @@ bool range_tombstone_list::equal(const schema& s, const range_tombstone_list& ot
 
 stop_iteration range_tombstone_list::apply_monotonically(const schema& s, range_tombstone_list&& list, is_preemptible preemptible) {
     auto del = current_deleter<range_tombstone_entry>();
+    position_in_partition::tri_compare cmp(s);
     auto it = list.begin();
     while (it != list.end()) {
-        // FIXME: Optimize by stealing the entry
-        apply_monotonically(s, it->tombstone());
-        it = list._tombstones.erase_and_dispose(it, del);
+        // Steal the entry whenever it neither overlaps nor has to be merged
+        // with its would-be neighbours - the common case when merging lists
+        // carrying many disjoint range deletes - sparing the allocation and
+        // the bound copies of the generic merge path.
+        auto next = _tombstones.lower_bound(it->position(), pos_order_by_start{s});
+        bool can_steal = true;
+        if (next != _tombstones.end()) {
+            auto c = cmp(it->end_position(), next->position());
+            can_steal = c < 0 || (c == 0 && it->tombstone().tomb != next->tombstone().tomb);
+        }
+        if (can_steal && next != _tombstones.begin()) {
+            auto prev = std::prev(next);
+            auto c = cmp(prev->end_position(), it->position());
+            can_steal = c < 0 || (c == 0 && prev->tombstone().tomb != it->tombstone().tomb);
+        }
+        if (can_steal) {
+            auto& e = *it;
+            it = list._tombstones.erase(it);
+            _tombstones.insert_before(next, e);
+        } else {
+            apply_monotonically(s, it->tombstone());
+            it = list._tombstones.erase_and_dispose(it, del);
+        }
         if (preemptible && need_preempt()) {
             return stop_iteration::no;
         }
@@ -84,6 +84,18 @@ class reader_permit::impl
     query::max_result_size _max_result_size{query::result_memory_limiter::unlimited_result_size};
     uint64_t _sstables_read = 0;
 
+    // Free-list of recycled mutation fragment shells, threaded through the
+    // freed chunks themselves. All shells allocated against a permit have
+    // the same size (the pool is keyed on the first size seen); shells of
+    // any other size bypass the pool.
+    struct fragment_shell {
+        fragment_shell* next;
+    };
+    fragment_shell* _fragment_shell_pool = nullptr;
+    size_t _fragment_shell_pool_size = 0;
+    size_t _fragment_shell_size = 0;
+    static constexpr size_t max_pooled_fragment_shells = 128;
+
 private:
     void on_permit_used() {
         _semaphore.on_permit_used();
@@ -140,6 +152,10 @@ public:
         _semaphore.on_permit_created(*this);
     }
     ~impl() {
+        while (_fragment_shell_pool) {
+            ::operator delete(std::exchange(_fragment_shell_pool, _fragment_shell_pool->next));
+        }
+
         if (_base_resources_consumed) {
             signal(_base_resources);
         }
@@ -347,6 +363,26 @@ public:
             --_semaphore._stats.disk_reads;
         }
     }
+
+    void* alloc_fragment_shell(size_t size) {
+        if (size == _fragment_shell_size && _fragment_shell_pool) {
+            --_fragment_shell_pool_size;
+            return std::exchange(_fragment_shell_pool, _fragment_shell_pool->next);
+        }
+        if (!_fragment_shell_size) {
+            _fragment_shell_size = size;
+        }
+        return ::operator new(size);
+    }
+
+    void free_fragment_shell(void* p, size_t size) noexcept {
+        if (size == _fragment_shell_size && size >= sizeof(fragment_shell) && _fragment_shell_pool_size < max_pooled_fragment_shells) {
+            _fragment_shell_pool = new (p) fragment_shell{_fragment_shell_pool};
+            ++_fragment_shell_pool_size;
+            return;
+        }
+        ::operator delete(p);
+    }
 };
 
 static_assert(std::is_nothrow_copy_constructible_v<reader_permit>);
@@ -407,6 +443,14 @@ reader_permit::resource_units reader_permit::consume_resources(reader_resources
     return resource_units(*this, res);
 }
 
+void* reader_permit::alloc_fragment_shell(size_t size) {
+    return _impl->alloc_fragment_shell(size);
+}
+
+void reader_permit::free_fragment_shell(void* p, size_t size) noexcept {
+    _impl->free_fragment_shell(p, size);
+}
+
 reader_resources reader_permit::consumed_resources() const {
     return _impl->resources();
 }
@@ -802,6 +846,9 @@ std::runtime_error reader_concurrency_semaphore::stopped_exception() {
 future<> reader_concurrency_semaphore::stop() noexcept {
     assert(!_stopped);
     _stopped = true;
+    if (_adaptive_admission) {
+        _adaptive_admission->tick_timer.cancel();
+    }
     co_await stop_ext_pre();
     clear_inactive_reads();
     co_await _close_readers_gate.close();
@@ -969,6 +1016,9 @@ void reader_concurrency_semaphore::maybe_admit_waiters() noexcept {
         try {
             x.permit.on_admission();
             ++_stats.reads_admitted;
+            ++_stats.reads_admitted_from_queue;
+            _stats.total_admission_wait_time_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - x.enqueued_at).count();
             if (x.func) {
                 _ready_list.push(std::move(x));
             } else {
@@ -1059,6 +1109,41 @@ future<> reader_concurrency_semaphore::with_ready_permit(reader_permit permit, r
     return fut;
 }
 
+void reader_concurrency_semaphore::enable_adaptive_admission(int min_count, std::chrono::milliseconds interval) {
+    _adaptive_admission.emplace();
+    auto& ctl = *_adaptive_admission;
+    ctl.min_count = min_count;
+    ctl.max_count = _initial_resources.count;
+    ctl.tick_timer.set_callback([this] { adaptive_admission_tick(); });
+    ctl.tick_timer.arm_periodic(interval);
+}
+
+void reader_concurrency_semaphore::adaptive_admission_tick() noexcept {
+    auto& ctl = *_adaptive_admission;
+    const auto wait_us = _stats.total_admission_wait_time_us
+            - std::exchange(ctl.last_admission_wait_time_us, _stats.total_admission_wait_time_us);
+    const auto admissions = _stats.reads_admitted_from_queue
+            - std::exchange(ctl.last_reads_admitted_from_queue, _stats.reads_admitted_from_queue);
+    const auto avg_wait_us = admissions ? wait_us / admissions : 0;
+
+    auto count = _initial_resources.count;
+    if (avg_wait_us > admission_wait_high_watermark_us) {
+        // Admitted reads spent long in the wait queue - the backing store
+        // cannot keep up with the current concurrency. Back off
+        // multiplicatively so an overload clears quickly.
+        count = std::max(ctl.min_count, count * 3 / 4);
+    } else if (_wait_list.empty() && avg_wait_us < admission_wait_low_watermark_us) {
+        // No queue buildup - there is headroom. Probe upwards one read at
+        // a time, up to the configured maximum.
+        count = std::min(ctl.max_count, count + 1);
+    }
+    if (count != _initial_resources.count) {
+        rcslog.debug("{}: adaptive admission: adjusting count limit {} -> {} (avg admission wait {}us)",
+                _name, _initial_resources.count, count, avg_wait_us);
+        set_resources({count, _initial_resources.memory});
+    }
+}
+
 void reader_concurrency_semaphore::set_resources(resources r) {
     auto delta = r - _initial_resources;
     _initial_resources = r;
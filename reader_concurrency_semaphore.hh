@@ -13,6 +13,7 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/queue.hh>
 #include <seastar/core/expiring_fifo.hh>
+#include <seastar/core/timer.hh>
 #include "reader_permit.hh"
 #include "readers/flat_mutation_reader_v2.hh"
 
@@ -87,6 +88,11 @@ public:
         uint64_t disk_reads = 0;
         // The number of sstables read currently.
         uint64_t sstables_read = 0;
+        // Total number of reads admitted from the wait queue (as opposed to
+        // reads admitted immediately).
+        uint64_t reads_admitted_from_queue = 0;
+        // Total time [us] admitted reads spent waiting in the wait queue.
+        uint64_t total_admission_wait_time_us = 0;
     };
 
     using permit_list_type = bi::list<
@@ -103,6 +109,7 @@ private:
         promise<> pr;
         reader_permit permit;
         read_func func;
+        std::chrono::steady_clock::time_point enqueued_at = std::chrono::steady_clock::now();
         entry(promise<>&& pr, reader_permit permit, read_func func)
             : pr(std::move(pr)), permit(std::move(permit)), func(std::move(func)) {}
     };
@@ -185,6 +192,22 @@ private:
     inactive_reads_type _inactive_reads;
     stats _stats;
     permit_list_type _permit_list;
+    // State of the adaptive admission controller, engaged by
+    // enable_adaptive_admission().
+    struct adaptive_admission_control {
+        int min_count = 0;
+        int max_count = 0;
+        timer<lowres_clock> tick_timer;
+        uint64_t last_admission_wait_time_us = 0;
+        uint64_t last_reads_admitted_from_queue = 0;
+    };
+
+    // Average admission wait above this means the backend cannot keep up
+    // with the current concurrency, below the low watermark it has headroom.
+    static constexpr uint64_t admission_wait_high_watermark_us = 2000;
+    static constexpr uint64_t admission_wait_low_watermark_us = 500;
+
+    std::optional<adaptive_admission_control> _adaptive_admission;
     bool _stopped = false;
     bool _evicting = false;
     gate _close_readers_gate;
@@ -234,6 +257,8 @@ private:
 
     future<> execution_loop() noexcept;
 
+    void adaptive_admission_tick() noexcept;
+
 public:
     struct no_limits { };
 
@@ -405,6 +430,18 @@ public:
     /// optimal then just using \ref with_permit().
     future<> with_ready_permit(reader_permit permit, read_func func);
 
+    /// Enable the adaptive admission controller.
+    ///
+    /// Instead of admitting reads up to the statically configured count
+    /// limit, periodically retune the limit between \p min_count and the
+    /// configured maximum with an AIMD rule driven by the measured
+    /// admission wait time: when admitted reads spent long in the wait
+    /// queue the backing store is saturated and the limit is decreased
+    /// multiplicatively; when the queue drains without waiting the limit
+    /// is probed upwards one read at a time. The limit is applied via
+    /// \ref set_resources() (count only, the memory limit is untouched).
+    void enable_adaptive_admission(int min_count, std::chrono::milliseconds interval);
+
     /// Set the total resources of the semaphore to \p r.
     ///
     /// After this call, \ref initial_resources() will reflect the new value.
@@ -143,6 +143,16 @@ public:
 
     resource_units consume_resources(reader_resources res);
 
+    /// Memory for the fixed-size shell of a mutation fragment.
+    ///
+    /// Shells freed against this permit are recycled by later allocations,
+    /// saving an allocator round-trip per fragment on the hot read paths,
+    /// where each reader layer creates fragments at a high rate.
+    /// This is raw memory only -- fragments account their footprint
+    /// separately, via consume_memory().
+    void* alloc_fragment_shell(size_t size);
+    void free_fragment_shell(void* p, size_t size) noexcept;
+
     reader_resources consumed_resources() const;
 
     reader_resources base_resources() const;
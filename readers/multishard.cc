@@ -7,6 +7,7 @@
  */
 
 #include <boost/range/algorithm/heap_algorithm.hpp>
+#include <boost/range/irange.hpp>
 #include <seastar/core/coroutine.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/closeable.hh>
@@ -944,6 +945,10 @@ class multishard_combining_reader_v2 : public flat_mutation_reader_v2::impl {
     // into a min-heap. Used to select the shard with the smallest token each
     // time a shard reader produces a new partition.
     std::vector<shard_and_token> _shard_selection_min_heap;
+    // Which shards the current partition range maps onto. Shards not in this
+    // set are never selected while the current range is being read, so their
+    // readers don't have to be fast-forwarded to it either.
+    std::vector<bool> _shards_touched_by_range;
     unsigned _current_shard;
     bool _crossed_shards;
     unsigned _concurrency = 1;
@@ -980,9 +985,11 @@ public:
 void multishard_combining_reader_v2::on_partition_range_change(const dht::partition_range& pr) {
     _shard_selection_min_heap.clear();
     _shard_selection_min_heap.reserve(_sharder.shard_count());
+    _shards_touched_by_range.assign(_sharder.shard_count(), false);
 
     auto token = pr.start() ? pr.start()->value().token() : dht::minimum_token();
     _current_shard = _sharder.shard_of(token);
+    _shards_touched_by_range[_current_shard] = true;
 
     auto sharder = dht::ring_position_range_sharder(_sharder, pr);
 
@@ -993,8 +1000,15 @@ void multishard_combining_reader_v2::on_partition_range_change(const dht::partit
     // We stop earlier if the sharder has no ranges for the remaining shards.
     for (next = sharder.next(*_schema); next && next->shard != _current_shard; next = sharder.next(*_schema)) {
         _shard_selection_min_heap.push_back(shard_and_token{next->shard, next->ring_range.start()->value().token()});
+        _shards_touched_by_range[next->shard] = true;
         boost::push_heap(_shard_selection_min_heap);
     }
+
+    if (next) {
+        // The range wraps all the way around the shard ring, every shard has
+        // at least one sub-range of it.
+        _shards_touched_by_range.assign(_sharder.shard_count(), true);
+    }
 }
 
 bool multishard_combining_reader_v2::maybe_move_to_next_shard(const dht::token* const t) {
@@ -1103,8 +1117,17 @@ future<> multishard_combining_reader_v2::fast_forward_to(const dht::partition_ra
     clear_buffer();
     _end_of_stream = false;
     on_partition_range_change(pr);
-    return parallel_for_each(_shard_readers, [&pr] (std::unique_ptr<shard_reader_v2>& sr) {
-        return sr->fast_forward_to(pr);
+    // Only shards the new range maps onto have to be notified. This matters
+    // a lot for multi-partition (IN) queries, where each range is singular:
+    // only the shard owning the partition is contacted, instead of paying a
+    // cross-shard round trip to every shard for every key. Shards left behind
+    // are not selected until a later range lands on them, at which point their
+    // readers get fast-forwarded, dropping any state from the old range.
+    return parallel_for_each(boost::irange(0u, unsigned(_shard_readers.size())), [this, &pr] (unsigned shard) {
+        if (!_shards_touched_by_range[shard]) {
+            return make_ready_future<>();
+        }
+        return _shard_readers[shard]->fast_forward_to(pr);
     });
 }
 
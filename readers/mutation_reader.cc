@@ -409,10 +409,13 @@ future<bool> flat_mutation_reader_v2::impl::fill_buffer_from(Source& source) {
             return fill_buffer_from(source);
         });
     } else {
-        while (!source.is_buffer_empty() && !is_buffer_full()) {
-            push_mutation_fragment(source.pop_mutation_fragment());
-        }
-        return make_ready_future<bool>(source.is_end_of_stream() && source.is_buffer_empty());
+        // Take the source's buffer wholesale instead of moving fragments one
+        // at a time through push/pop, which pays per-fragment accounting. Our
+        // buffer was not full on entry and the source filled its buffer
+        // against the same soft limit, so the overshoot is bounded by one
+        // buffer's worth - the same as what delegating readers already do.
+        source.move_buffer_content_to(*this);
+        return make_ready_future<bool>(source.is_end_of_stream());
     }
 }
 
@@ -27,6 +27,7 @@
 #include "readers/nonforwardable.hh"
 #include "readers/queue.hh"
 #include "readers/reversing_v2.hh"
+#include "readers/tee.hh"
 #include "readers/upgrading_consumer.hh"
 #include "tombstone_gc.hh"
 #include <seastar/core/coroutine.hh>
@@ -503,9 +504,7 @@ public:
     virtual future<> fill_buffer() override {
         return do_until([this] { return is_end_of_stream() || !is_buffer_empty(); }, [this] {
             return _reader.fill_buffer().then([this] () {
-                while (!_reader.is_buffer_empty()) {
-                    push_mutation_fragment(_reader.pop_mutation_fragment());
-                }
+                _reader.move_buffer_content_to(*this);
                 if (!_reader.is_end_of_stream()) {
                     return make_ready_future<>();
                 }
@@ -1380,6 +1379,89 @@ std::pair<flat_mutation_reader_v2, queue_reader_handle_v2> make_queue_reader_v2(
 
 namespace {
 
+class tee_reader_v2 final : public flat_mutation_reader_v2::impl {
+    flat_mutation_reader_v2 _source;
+    queue_reader_handle_v2 _sink;
+    bool _sink_alive = true;
+    bool _sink_ended = false;
+private:
+    void drop_sink() noexcept {
+        // The secondary consumer went away; keep serving the primary one.
+        _sink_alive = false;
+    }
+    future<> tee_fragment(const mutation_fragment_v2& mf) {
+        if (!_sink_alive) {
+            return make_ready_future<>();
+        }
+        try {
+            return _sink.push(mutation_fragment_v2(*_schema, _permit, mf)).handle_exception([this] (std::exception_ptr) {
+                drop_sink();
+            });
+        } catch (...) {
+            drop_sink();
+            return make_ready_future<>();
+        }
+    }
+public:
+    tee_reader_v2(flat_mutation_reader_v2 source, queue_reader_handle_v2 sink)
+        : impl(source.schema(), source.permit())
+        , _source(std::move(source))
+        , _sink(std::move(sink)) {
+    }
+    virtual future<> fill_buffer() override {
+        if (_end_of_stream || !is_buffer_empty()) {
+            return make_ready_future<>();
+        }
+        return _source.fill_buffer().then([this] {
+            return do_until([this] { return _source.is_buffer_empty(); }, [this] {
+                auto mf = _source.pop_mutation_fragment();
+                auto tee_fut = tee_fragment(mf);
+                push_mutation_fragment(std::move(mf));
+                return tee_fut;
+            }).then([this] {
+                if (_source.is_end_of_stream() && _source.is_buffer_empty()) {
+                    _end_of_stream = true;
+                    if (_sink_alive && !std::exchange(_sink_ended, true)) {
+                        try {
+                            _sink.push_end_of_stream();
+                        } catch (...) {
+                            drop_sink();
+                        }
+                    }
+                }
+            });
+        });
+    }
+    virtual future<> next_partition() override {
+        // Skipping fragments would make the two consumers diverge.
+        return make_exception_future<>(make_backtraced_exception_ptr<std::bad_function_call>());
+    }
+    virtual future<> fast_forward_to(const dht::partition_range&) override {
+        return make_exception_future<>(make_backtraced_exception_ptr<std::bad_function_call>());
+    }
+    virtual future<> fast_forward_to(position_range) override {
+        return make_exception_future<>(make_backtraced_exception_ptr<std::bad_function_call>());
+    }
+    virtual future<> close() noexcept override {
+        if (_sink_alive && !_sink_ended) {
+            try {
+                _sink.abort(std::make_exception_ptr(std::runtime_error("tee_reader_v2: source closed before end of stream")));
+            } catch (...) {
+            }
+            drop_sink();
+        }
+        return _source.close();
+    }
+};
+
+} // anonymous namespace
+
+flat_mutation_reader_v2 make_tee_reader_v2(flat_mutation_reader_v2 source, queue_reader_handle_v2 sink) {
+    return make_flat_mutation_reader_v2<tee_reader_v2>(std::move(source), std::move(sink));
+}
+
+namespace {
+
 class compacting_reader : public flat_mutation_reader_v2::impl {
     friend class compact_mutation_state<compact_for_sstables::yes>;
 
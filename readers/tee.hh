@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "readers/flat_mutation_reader_v2.hh"
+#include "readers/queue.hh"
+
+/// Creates a reader which transparently duplicates the stream of `source`
+/// into `sink` while serving it to its own consumer.
+///
+/// This lets two consumers share a single pass over the underlying data:
+/// the primary consumer reads the returned reader as usual, while the
+/// secondary one reads the queue reader paired with `sink` (see
+/// make_queue_reader_v2()). A fragment is handed to the primary consumer
+/// only after the sink accepted a copy, so the primary read is throttled
+/// by the slower of the two consumers.
+///
+/// When the source reaches end-of-stream the sink is terminated as well.
+/// If the returned reader is closed before end-of-stream, the sink is
+/// aborted, since the secondary consumer must not mistake a truncated
+/// stream for a complete one. Conversely, if the sink is aborted (the
+/// secondary consumer went away), the tee detaches from it and keeps
+/// serving the primary consumer unaffected.
+///
+/// The returned reader does not support fast_forward_to() or
+/// next_partition() - the stream must be consumed in full, otherwise the
+/// two consumers would diverge.
+flat_mutation_reader_v2 make_tee_reader_v2(flat_mutation_reader_v2 source, queue_reader_handle_v2 sink);
@@ -82,14 +82,30 @@ future<redis_server::result> redis_server::connection::process_request_internal(
     return _process_request_stage(this, _parser.get_request(), seastar::ref(_options), empty_service_permit());
 }
 
+future<> redis_server::connection::write_exception_message(sstring message)
+{
+    return redis_message::exception(message).then([this] (auto&& result) {
+        auto m = result.message();
+        return _write_buf.write(std::move(*m));
+    });
+}
+
+future<> redis_server::connection::maybe_flush()
+{
+    // Within a pipelined burst more replies are about to be appended to
+    // the response chain right behind us, so leave flushing to the last
+    // writer in the chain - a flush per reply caps pipelining throughput.
+    if (_requests_in_pipeline == 0) {
+        return _write_buf.flush();
+    }
+    return make_ready_future<>();
+}
+
 void redis_server::connection::write_reply(const redis_exception& e)
 {
     _ready_to_respond = _ready_to_respond.then([this, exception_message = e.what_message()] () mutable {
-        return redis_message::exception(exception_message).then([this] (auto&& result) {
-            auto m = result.message();
-            return _write_buf.write(std::move(*m)).then([this] {
-                return _write_buf.flush();
-            });
+        return write_exception_message(std::move(exception_message)).then([this] {
+            return maybe_flush();
         });
     });
 }
@@ -99,40 +115,78 @@ void redis_server::connection::write_reply(redis_server::result result)
     _ready_to_respond = _ready_to_respond.then([this, result = std::move(result)] () mutable {
         auto m = result.make_message();
         return _write_buf.write(std::move(*m)).then([this] {
-            return _write_buf.flush();
+            return maybe_flush();
         });
     });
 }
 
+future<> redis_server::connection::write_result(future<redis_server::result>&& result_f)
+{
+    return futurize_invoke([this, result_f = std::move(result_f)] () mutable {
+        try {
+            auto result = result_f.get0();
+            auto m = result.make_message();
+            return _write_buf.write(std::move(*m));
+        } catch (const redis_exception& e) {
+            return write_exception_message(e.what_message());
+        } catch (const std::exception& e) {
+            return write_exception_message(e.what());
+        } catch (...) {
+            return write_exception_message("Unknown exception");
+        }
+    }).then([this] {
+        return maybe_flush();
+    });
+}
+
 future<> redis_server::connection::process_request() {
     _parser.init();
     return _read_buf.consume(_parser).then([this] {
         if (_parser.eof()) {
             return make_ready_future<>();
         }
-        ++_server._stats._requests_serving;
-        _pending_requests_gate.enter();
-        utils::latency_counter lc;
-        lc.start();
-        auto leave = defer([this] () noexcept { _pending_requests_gate.leave(); });
-        return process_request_internal().then([this, leave = std::move(leave), lc = std::move(lc)] (auto&& result) mutable {
+        if (_parser.failed()) {
+            logging.error("request parse failed");
+            write_reply(redis_exception("unknown command ''"));
+            return make_ready_future<>();
+        }
+        // Bound the pipeline depth: once this many commands are in
+        // flight on this connection, drain the outstanding replies
+        // before dispatching more.
+        if (_requests_in_pipeline >= max_pipelined_requests) {
+            return std::exchange(_ready_to_respond, make_ready_future<>()).then([this] {
+                return process_parsed_request();
+            });
+        }
+        return process_parsed_request();
+    });
+}
+
+future<> redis_server::connection::process_parsed_request() {
+    ++_server._stats._requests_serving;
+    ++_requests_in_pipeline;
+    _pending_requests_gate.enter();
+    auto leave = defer([this] () noexcept { _pending_requests_gate.leave(); });
+    utils::latency_counter lc;
+    lc.start();
+    // Dispatch the command, but do not wait for its result here: chain
+    // the reply onto _ready_to_respond, which writes replies in dispatch
+    // order, and return to the read loop so that further commands already
+    // buffered by a pipelining client are parsed and dispatched while
+    // this one is still executing.
+    auto f = process_request_internal();
+    _ready_to_respond = _ready_to_respond.then([this, f = std::move(f), leave = std::move(leave), lc] () mutable {
+        return f.then_wrapped([this, leave = std::move(leave), lc] (future<result> result_f) mutable {
             --_server._stats._requests_serving;
-            try {
-                if (_parser.failed()) {
-                    logging.error("request parse failed");
-                    const auto e = redis_exception("unknown command ''");
-                    write_reply(std::move(e));
-                }else{
-                    write_reply(std::move(result));
-                }
+            --_requests_in_pipeline;
+            return write_result(std::move(result_f)).then([this, lc] () mutable {
                 ++_server._stats._requests_served;
                 _server._stats._requests.mark(lc.stop().latency());
                 _server._stats._estimated_requests_latency.add(lc.latency(), _server._stats._requests.hist.count);
-            } catch (...) {
-                logging.error("request processing failed: {}", std::current_exception());
-            }
+            });
         });
     });
+    return make_ready_future<>();
 }
 
 void redis_server::connection::handle_error(future<>&& f) {
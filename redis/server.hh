@@ -80,6 +80,12 @@ private:
         socket_address _server_addr;
         redis_protocol_parser _parser;
         redis::redis_options _options;
+        // Number of commands dispatched to the query processor whose
+        // replies were not written to the socket yet. Used to bound the
+        // pipeline depth and to coalesce output flushes within a
+        // pipelined burst.
+        unsigned _requests_in_pipeline = 0;
+        static constexpr unsigned max_pipelined_requests = 128;
 
         using execution_stage_type = inheriting_concrete_execution_stage<
                 future<redis_server::result>,
@@ -100,6 +106,10 @@ private:
         const ::timeout_config& timeout_config() { return _server.timeout_config(); }
         future<result> process_request_one(redis::request&& request, redis::redis_options&, service_permit permit);
         future<result> process_request_internal();
+        future<> process_parsed_request();
+        future<> write_result(future<result>&& result_f);
+        future<> write_exception_message(sstring message);
+        future<> maybe_flush();
     };
 
     virtual shared_ptr<generic_server::connection> make_connection(socket_address server_addr, connected_socket&& fd, socket_address addr) override;
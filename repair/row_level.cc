@@ -752,6 +752,13 @@ private:
     lw_shared_ptr<repair_writer> _repair_writer;
     // Contains rows read from disk
     std::list<repair_row> _row_buf;
+    // Rows read and hashed ahead of the next get_sync_boundary() by
+    // read_ahead_rows(), consumed by read_rows_from_disk() before the
+    // reader is touched again.
+    std::list<repair_row> _read_ahead_rows;
+    size_t _read_ahead_rows_size = 0;
+    // Resolves when the read-ahead in flight, if any, is done.
+    future<> _read_ahead_done = make_ready_future<>();
     // Contains rows we are working on to sync between peers
     std::list<repair_row> _working_row_buf;
     // Combines all the repair_hash in _working_row_buf
@@ -893,6 +900,7 @@ public:
         co_await utils::clear_gently(_peer_row_hash_sets);
         co_await utils::clear_gently(_working_row_buf);
         co_await utils::clear_gently(_row_buf);
+        co_await utils::clear_gently(_read_ahead_rows);
     }
 
     future<> stop() {
@@ -903,12 +911,18 @@ public:
         promise<> stopped;
         _stopped.emplace(stopped.get_future());
         auto gate_future = _gate.close();
+        // An unconsumed read-ahead failure is of no interest once the repair
+        // is being torn down; the gate keeps the read-ahead itself alive
+        // until it finishes.
+        auto read_ahead_future = std::exchange(_read_ahead_done, make_ready_future<>()).handle_exception([] (std::exception_ptr ep) {
+            rlogger.debug("repair_meta::stop: ignoring read-ahead failure: {}", ep);
+        });
         auto f1 = _sink_source_for_get_full_row_hashes.close();
         auto f2 = _sink_source_for_get_row_diff.close();
         auto f3 = _sink_source_for_put_row_diff.close();
         rlogger.debug("repair_meta::stop");
         // move to background.  waited on via _stopped->get_future.
-        when_all_succeed(std::move(gate_future), std::move(f1), std::move(f2), std::move(f3)).discard_result().finally([this] {
+        when_all_succeed(std::move(gate_future), std::move(read_ahead_future), std::move(f1), std::move(f2), std::move(f3)).discard_result().finally([this] {
             return _repair_writer->wait_for_writer_done().finally([this] {
                 return close().then([this] {
                     return clear_gently();
@@ -1084,7 +1098,7 @@ private:
     // This reads rows from where the reader left last time into _row_buf
     // _current_sync_boundary or _last_sync_boundary have no effect on the reader neither.
     future<std::tuple<std::list<repair_row>, size_t>>
-    read_rows_from_disk(size_t cur_size) {
+    do_read_rows_from_disk(size_t cur_size) {
         using value_type = std::tuple<std::list<repair_row>, size_t>;
         if (!_reader_permit) {
             bool all_shards = !_is_local_reader;
@@ -1118,6 +1132,50 @@ private:
         co_return ret;
     }
 
+    // Like do_read_rows_from_disk(), but consumes the rows fetched by a
+    // pending read-ahead first, topping up from the reader only if they
+    // don't fill the buffer. The only entry point to the reader besides
+    // read_ahead_rows(), so the two never run concurrently.
+    future<std::tuple<std::list<repair_row>, size_t>>
+    read_rows_from_disk(size_t cur_size) {
+        co_await std::exchange(_read_ahead_done, make_ready_future<>());
+        auto rows = std::exchange(_read_ahead_rows, std::list<repair_row>());
+        auto rows_size = std::exchange(_read_ahead_rows_size, size_t(0));
+        cur_size += rows_size;
+        if (cur_size < _max_row_buf_size) {
+            auto [more, more_size] = co_await do_read_rows_from_disk(cur_size);
+            rows.splice(rows.end(), more);
+            rows_size += more_size;
+        }
+        co_return std::tuple<std::list<repair_row>, size_t>(std::move(rows), rows_size);
+    }
+
+    // Starts reading and hashing the next batch of rows in the background,
+    // so that work interleaves with the hash and row exchange of the
+    // current round instead of leaving the reader idle while the rpcs are
+    // on the wire. Called by the repair master once a round's sync
+    // boundary is decided; the next read_rows_from_disk() picks up the
+    // result. cur_row_buf_size is the current size of _row_buf in bytes,
+    // which the read-ahead must not look up itself - the ongoing round
+    // mutates _row_buf.
+    void read_ahead_rows(size_t cur_row_buf_size) {
+        if (!_read_ahead_done.available() || _read_ahead_done.failed() || _gate.is_closed()) {
+            // A failed read-ahead is left for read_rows_from_disk() to
+            // report on the usual path.
+            return;
+        }
+        auto budget = cur_row_buf_size + _read_ahead_rows_size;
+        if (budget >= _max_row_buf_size) {
+            return;
+        }
+        _read_ahead_done = with_gate(_gate, [this, budget] {
+            return do_read_rows_from_disk(budget).then_unpack([this] (std::list<repair_row> rows, size_t rows_size) {
+                _read_ahead_rows.splice(_read_ahead_rows.end(), rows);
+                _read_ahead_rows_size += rows_size;
+            });
+        });
+    }
+
     future<> clear_row_buf() {
         return utils::clear_gently(_row_buf);
     }
@@ -1747,33 +1805,50 @@ public:
         });
     }
 
+    // Extract the rows of the _working_row_buf with hash within the given
+    // set_diff and serialize them to wire format. Once the returned future
+    // resolves, the serialized rows no longer reference the current round's
+    // state, so the actual transfer to the peer can overlap with the next
+    // round reusing (or clearing) the _working_row_buf.
+    future<std::optional<repair_rows_on_wire>> serialize_row_diff(repair_hash_set set_diff, needs_all_rows_t needs_all_rows, gms::inet_address remote_node) {
+        if (set_diff.empty() || remote_node == _myip) {
+            return make_ready_future<std::optional<repair_rows_on_wire>>(std::nullopt);
+        }
+        size_t sz = set_diff.size();
+        return get_row_diff(std::move(set_diff), needs_all_rows).then([this, remote_node, sz] (std::list<repair_row> row_diff) {
+            if (row_diff.size() != sz) {
+                rlogger.warn("Hash conflict detected, keyspace={}, table={}, range={}, row_diff.size={}, set_diff.size={}. It is recommended to compact the table and rerun repair for the range.",
+                        _schema->ks_name(), _schema->cf_name(), _range, row_diff.size(), sz);
+            }
+            return do_with(std::move(row_diff), [this, remote_node] (std::list<repair_row>& row_diff) {
+                return get_repair_rows_size(row_diff).then([this, remote_node, &row_diff] (size_t row_bytes) mutable {
+                    stats().tx_row_nr += row_diff.size();
+                    stats().tx_row_nr_peer[remote_node] += row_diff.size();
+                    stats().tx_row_bytes += row_bytes;
+                    stats().rpc_call_nr++;
+                    return to_repair_rows_on_wire(std::move(row_diff)).then([] (repair_rows_on_wire rows) {
+                        return make_ready_future<std::optional<repair_rows_on_wire>>(std::move(rows));
+                    });
+                });
+            });
+        });
+    }
+
+    // Ship rows serialized by serialize_row_diff() to the peer with the
+    // put_row_diff rpc verb.
+    future<> send_row_diff(repair_rows_on_wire rows, gms::inet_address remote_node) {
+        return _messaging.send_repair_put_row_diff(msg_addr(remote_node), _repair_meta_id, std::move(rows));
+    }
+
     // RPC API
     // Send rows in the _working_row_buf with hash within the given sef_diff
     future<> put_row_diff(repair_hash_set set_diff, needs_all_rows_t needs_all_rows, gms::inet_address remote_node) {
-        if (!set_diff.empty()) {
-            if (remote_node == _myip) {
+        return serialize_row_diff(std::move(set_diff), needs_all_rows, remote_node).then([this, remote_node] (std::optional<repair_rows_on_wire> rows) {
+            if (!rows) {
                 return make_ready_future<>();
             }
-            size_t sz = set_diff.size();
-            return get_row_diff(std::move(set_diff), needs_all_rows).then([this, remote_node, sz] (std::list<repair_row> row_diff) {
-                if (row_diff.size() != sz) {
-                    rlogger.warn("Hash conflict detected, keyspace={}, table={}, range={}, row_diff.size={}, set_diff.size={}. It is recommended to compact the table and rerun repair for the range.",
-                            _schema->ks_name(), _schema->cf_name(), _range, row_diff.size(), sz);
-                }
-                return do_with(std::move(row_diff), [this, remote_node] (std::list<repair_row>& row_diff) {
-                    return get_repair_rows_size(row_diff).then([this, remote_node, &row_diff] (size_t row_bytes) mutable {
-                        stats().tx_row_nr += row_diff.size();
-                        stats().tx_row_nr_peer[remote_node] += row_diff.size();
-                        stats().tx_row_bytes += row_bytes;
-                        stats().rpc_call_nr++;
-                        return to_repair_rows_on_wire(std::move(row_diff)).then([this, remote_node] (repair_rows_on_wire rows)  {
-                            return _messaging.send_repair_put_row_diff(msg_addr(remote_node), _repair_meta_id, std::move(rows));
-                        });
-                    });
-                });
-            });
-        }
-        return make_ready_future<>();
+            return send_row_diff(std::move(*rows), remote_node);
+        });
     }
 
 private:
@@ -1824,40 +1899,28 @@ private:
     }
 
 public:
+    // Ship rows serialized by serialize_row_diff() to the peer over the
+    // put_row_diff rpc stream.
+    future<> send_row_diff_with_rpc_stream(repair_rows_on_wire rows, gms::inet_address remote_node, unsigned node_idx) {
+        return _sink_source_for_put_row_diff.get_sink_source(remote_node, node_idx).then_unpack(
+                [this, rows = std::move(rows), remote_node, node_idx]
+                (rpc::sink<repair_row_on_wire_with_cmd>& sink, rpc::source<repair_stream_cmd>& source) mutable {
+            auto source_op = put_row_diff_source_op(remote_node, node_idx, source);
+            auto sink_op = put_row_diff_sink_op(std::move(rows), sink, remote_node);
+            return when_all_succeed(std::move(source_op), std::move(sink_op)).discard_result();
+        });
+    }
+
     future<> put_row_diff_with_rpc_stream(
             repair_hash_set set_diff,
             needs_all_rows_t needs_all_rows,
             gms::inet_address remote_node, unsigned node_idx) {
-        if (!set_diff.empty()) {
-            if (remote_node == _myip) {
+        return serialize_row_diff(std::move(set_diff), needs_all_rows, remote_node).then([this, remote_node, node_idx] (std::optional<repair_rows_on_wire> rows) {
+            if (!rows) {
                 return make_ready_future<>();
             }
-            size_t sz = set_diff.size();
-            return get_row_diff(std::move(set_diff), needs_all_rows).then([this, remote_node, node_idx, sz] (std::list<repair_row> row_diff) {
-                if (row_diff.size() != sz) {
-                    rlogger.warn("Hash conflict detected, keyspace={}, table={}, range={}, row_diff.size={}, set_diff.size={}. It is recommended to compact the table and rerun repair for the range.",
-                            _schema->ks_name(), _schema->cf_name(), _range, row_diff.size(), sz);
-                }
-                return do_with(std::move(row_diff), [this, remote_node, node_idx] (std::list<repair_row>& row_diff) {
-                    return get_repair_rows_size(row_diff).then([this, remote_node, node_idx, &row_diff] (size_t row_bytes) mutable {
-                        stats().tx_row_nr += row_diff.size();
-                        stats().tx_row_nr_peer[remote_node] += row_diff.size();
-                        stats().tx_row_bytes += row_bytes;
-                        stats().rpc_call_nr++;
-                        return to_repair_rows_on_wire(std::move(row_diff)).then([this, remote_node, node_idx] (repair_rows_on_wire rows)  {
-                            return  _sink_source_for_put_row_diff.get_sink_source(remote_node, node_idx).then_unpack(
-                                    [this, rows = std::move(rows), remote_node, node_idx]
-                                    (rpc::sink<repair_row_on_wire_with_cmd>& sink, rpc::source<repair_stream_cmd>& source) mutable {
-                                auto source_op = put_row_diff_source_op(remote_node, node_idx, source);
-                                auto sink_op = put_row_diff_sink_op(std::move(rows), sink, remote_node);
-                                return when_all_succeed(std::move(source_op), std::move(sink_op)).discard_result();
-                            });
-                        });
-                    });
-                });
-            });
-        }
-        return make_ready_future<>();
+            return send_row_diff_with_rpc_stream(std::move(*rows), remote_node, node_idx);
+        });
     }
 
     // RPC handler
@@ -2452,6 +2515,12 @@ class row_level_repair {
     // A flag indicates any error during the repair
     bool _failed = false;
 
+    // Transfer of the previous round's row diffs to the followers, kept
+    // in flight while the next sync boundary is negotiated so hashing of
+    // the next range overlaps with shipping the diffs of the previous
+    // one. Joined before the followers reuse their working row bufs.
+    future<> _pending_diff_transfer = make_ready_future<>();
+
     // Seed for the repair row hashing. If we ever had a hash conflict for a row
     // and we are not using stable hash, there is chance we will fix the row in
     // the next repair.
@@ -2503,6 +2572,7 @@ private:
         rlogger.debug("ROUND {}, _last_sync_boundary={}, _current_sync_boundary={}, _skipped_sync_boundary={}",
                 master.stats().round_nr, master.last_sync_boundary(), master.current_sync_boundary(), _skipped_sync_boundary);
         master.stats().round_nr++;
+        size_t local_row_buf_bytes = 0;
         parallel_for_each(master.all_nodes(), [&, this] (repair_node_state& ns) {
             const auto& node = ns.node;
             // By calling `get_sync_boundary`, the `_last_sync_boundary`
@@ -2513,6 +2583,10 @@ private:
                 ns.state = repair_state::get_sync_boundary_finished;
                 master.stats().row_from_disk_bytes[node] += res.new_rows_size;
                 master.stats().row_from_disk_nr[node] += res.new_rows_nr;
+                if (&ns == &master.all_nodes().front()) {
+                    // The first node is the local node
+                    local_row_buf_bytes = res.row_buf_size;
+                }
                 if (res.boundary && res.row_buf_size > 0) {
                     _sync_boundaries.push_back(*res.boundary);
                     _combined_hashes.push_back(res.row_buf_combined_csum);
@@ -2550,6 +2624,10 @@ private:
             // We are done with this range because all the nodes have no more data.
             return op_status::all_done;
         }
+        // The rest of the round exchanges hashes and rows with the peers
+        // and doesn't touch the reader, so read and hash the next batch of
+        // rows in the background while the rpcs are on the wire.
+        master.read_ahead_rows(local_row_buf_bytes);
         return op_status::next_step;
     }
 
@@ -2689,30 +2767,45 @@ private:
         _shard_task.check_in_abort_or_shutdown();
         repair_hash_set local_row_hash_sets = master.working_row_hashes().get0();
         auto sz = _all_live_peer_nodes.size();
-        std::vector<repair_hash_set> set_diffs(sz);
+        // Serialize the diffs off the _working_row_buf up front, so the
+        // transfer below no longer depends on this round's state and can
+        // stay in flight while the next sync boundary is negotiated and
+        // the next batch of rows is read from disk and hashed.
+        std::vector<std::optional<repair_rows_on_wire>> serialized_diffs(sz);
         for (size_t idx : boost::irange(size_t(0), sz)) {
-            set_diffs[idx] = get_set_diff(local_row_hash_sets, master.peer_row_hash_sets(idx));
-        }
-        parallel_for_each(boost::irange(size_t(0), sz), [&, this] (size_t idx) {
-            auto& ns = master.all_nodes()[idx + 1];
+            auto set_diff = get_set_diff(local_row_hash_sets, master.peer_row_hash_sets(idx));
             auto needs_all_rows = repair_meta::needs_all_rows_t(master.peer_row_hash_sets(idx).empty());
-            auto& set_diff = set_diffs[idx];
             rlogger.debug("Calling master.put_row_diff to node {}, set_diff={}, needs_all_rows={}", _all_live_peer_nodes[idx], set_diff.size(), needs_all_rows);
+            serialized_diffs[idx] = master.serialize_row_diff(std::move(set_diff), needs_all_rows, _all_live_peer_nodes[idx]).get0();
+        }
+        _pending_diff_transfer = parallel_for_each(boost::irange(size_t(0), sz),
+                [&master, this, diffs = std::move(serialized_diffs)] (size_t idx) mutable {
+            if (!diffs[idx]) {
+                return make_ready_future<>();
+            }
+            auto& ns = master.all_nodes()[idx + 1];
             if (master.use_rpc_stream()) {
                 ns.state = repair_state::put_row_diff_with_rpc_stream_started;
-                return master.put_row_diff_with_rpc_stream(std::move(set_diff), needs_all_rows, _all_live_peer_nodes[idx], idx).then([&ns] {
+                return master.send_row_diff_with_rpc_stream(std::move(*diffs[idx]), _all_live_peer_nodes[idx], idx).then([&ns] {
                     ns.state = repair_state::put_row_diff_with_rpc_stream_finished;
                 });
             } else {
-                ns.state = repair_state::put_row_diff_finished;
-                return master.put_row_diff(std::move(set_diff), needs_all_rows, _all_live_peer_nodes[idx]).then([&ns] {
+                ns.state = repair_state::put_row_diff_started;
+                return master.send_row_diff(std::move(*diffs[idx]), _all_live_peer_nodes[idx]).then([&ns] {
                     ns.state = repair_state::put_row_diff_finished;
                 });
             }
-        }).get();
+        });
         master.stats().round_nr_slow_path++;
     }
 
+    // Join the in-flight transfer of the previous round's row diffs.
+    // Must be called before any step that makes the followers touch their
+    // repair_writer out of order or tears the repair down.
+    void join_pending_diff_transfer() {
+        std::exchange(_pending_diff_transfer, make_ready_future<>()).get();
+    }
+
 private:
     // Update system.repair_history table
     future<> update_system_repair_table() {
@@ -2834,12 +2927,20 @@ public:
                 }).get();
 
                 while (true) {
+                    // Runs in parallel with the previous round's diff
+                    // transfer, if one is still in flight: negotiating the
+                    // sync boundary only reads rows from disk into _row_buf
+                    // and hashes them, which does not conflict with the
+                    // followers applying the already-serialized diffs.
                     auto status = negotiate_sync_boundary(master);
                     if (status == op_status::next_round) {
                         continue;
                     } else if (status == op_status::all_done) {
                         break;
                     }
+                    // The next step moves rows into the working row bufs on
+                    // all nodes, so the previous transfer must be done first.
+                    join_pending_diff_transfer();
                     status = get_missing_rows_from_follower_nodes(master);
                     if (status == op_status::next_round) {
                         continue;
@@ -2858,6 +2959,16 @@ public:
                 _failed = true;
             }
 
+            // The diff transfer of the last round may still be in flight;
+            // join it before tearing down the followers' repair_meta.
+            try {
+                join_pending_diff_transfer();
+            } catch (std::exception& e) {
+                rlogger.warn("repair[{}]: shard={}, keyspace={}, cf={}, range={}, got error in row level repair: {}",
+                        _shard_task.id.uuid(), this_shard_id(), _shard_task.get_keyspace(), _cf_name, _range, e);
+                _failed = true;
+            }
+
             parallel_for_each(nodes_to_stop, [&] (const gms::inet_address& node) {
                 master.set_repair_state(repair_state::row_level_stop_started, node);
                 return master.repair_row_level_stop(node, _shard_task.get_keyspace(), _cf_name, _range).then([node, &master] {
@@ -10,6 +10,7 @@
 #include "replica/database_fwd.hh"
 #include "utils/lister.hh"
 #include "replica/database.hh"
+#include "replica/query_result_cache.hh"
 #include <seastar/core/future-util.hh>
 #include "db/system_keyspace.hh"
 #include "db/system_distributed_keyspace.hh"
@@ -24,6 +25,7 @@
 #include <seastar/coroutine/as_future.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/metrics.hh>
+#include <seastar/core/sleep.hh>
 #include <boost/algorithm/string/erase.hpp>
 #include "sstables/sstables.hh"
 #include "sstables/sstables_manager.hh"
@@ -359,6 +361,8 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     , _system_sstables_manager(std::make_unique<sstables::sstables_manager>(*_nop_large_data_handler, _cfg, feat, _row_cache_tracker, dbcfg.available_memory, sst_dir_sem.local()))
     , _result_memory_limiter(dbcfg.available_memory / 10)
     , _data_listeners(std::make_unique<db::data_listeners>())
+    , _hot_partitions_tracker(std::make_unique<db::hot_partitions_tracker>(*this))
+    , _query_result_cache(std::make_unique<query_result_cache>())
     , _mnotifier(mn)
     , _feat(feat)
     , _shared_token_metadata(stm)
@@ -374,6 +378,30 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     setup_metrics();
 
     _row_cache_tracker.set_compaction_scheduling_group(dbcfg.memory_compaction_scheduling_group);
+    _row_cache_tracker.compressed_tier().set_capacity(size_t(_cfg.compressed_row_cache_size_in_mb()) << 20);
+    _row_cache_tracker.set_population_budget(size_t(_cfg.row_cache_population_budget_in_kb()) << 10);
+    _query_result_cache->set_capacity(size_t(_cfg.query_result_cache_size_in_mb()) << 20);
+    if (_cfg.adaptive_concurrent_reads()) {
+        // Retune the count limit of user reads between 10% and 100% of the
+        // static maximum, based on measured admission wait.
+        _read_concurrency_sem.enable_adaptive_admission(std::max(1ul, max_count_concurrent_reads / 10), 100ms);
+    }
+    if (_cfg.adaptive_reader_memory()) {
+        _reader_memory_broker.emplace();
+        _reader_memory_broker->tick_timer.set_callback([this] { reader_memory_broker_tick(); });
+        _reader_memory_broker->tick_timer.arm_periodic(std::chrono::seconds(1));
+    }
+    if (_cfg.sstable_background_compression()) {
+        // System tables stick to cheap compressors, so only user sstables
+        // benefit from compressing off the write path.
+        _user_sstables_manager->set_background_compression_group(dbcfg.background_compression_scheduling_group);
+    }
+    if (_cfg.sstable_background_decompression()) {
+        // Scheduling groups are scarce, and compression and decompression of
+        // sstable chunks are the same kind of background CPU work, so scan
+        // decompression shares the compression group.
+        _user_sstables_manager->set_background_decompression_group(dbcfg.background_compression_scheduling_group);
+    }
 
     setup_scylla_memory_diagnostics_producer();
     if (_dbcfg.sstables_format) {
@@ -381,6 +409,55 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     }
 }
 
+// Shifts memory budget between the row cache and user read permits.
+//
+// The reader semaphore's memory limit is an accounting limit: raising it
+// admits more (or larger) reads, whose buffers create real allocation
+// pressure under which the LSA row cache evicts, so no explicit cache
+// shrink is needed. The floor is the static budget
+// (max_memory_concurrent_reads()); budget above the floor is granted only
+// while reads queue on permit memory and the cache hit rate suggests the
+// cache is not earning its memory (e.g. a scan-heavy period churning
+// through cold data), and decays back as soon as either stops being true,
+// letting the cache grow back for point-read periods.
+void database::reader_memory_broker_tick() noexcept {
+    static constexpr double cache_hit_rate_low_watermark = 0.5;
+
+    auto& ctl = *_reader_memory_broker;
+    auto& sem = _read_concurrency_sem;
+
+    const auto& cs = _row_cache_tracker.get_stats();
+    const uint64_t total_hits = cs.partition_hits + cs.row_hits;
+    const uint64_t total_misses = cs.partition_misses + cs.row_misses;
+    const uint64_t hits = total_hits - std::exchange(ctl.last_cache_hits, total_hits);
+    const uint64_t misses = total_misses - std::exchange(ctl.last_cache_misses, total_misses);
+    const double hit_rate = hits + misses ? double(hits) / double(hits + misses) : 0.0;
+
+    const ssize_t floor = max_memory_concurrent_reads();
+    const ssize_t ceiling = floor * 4;
+    const auto res = sem.initial_resources();
+    ssize_t memory = res.memory;
+
+    // Memory is the binding resource when reads are queued and nearly all
+    // of the permit memory is consumed.
+    const bool memory_bound = sem.waiters() && sem.consumed_resources().memory >= memory - memory / 8;
+
+    if (memory_bound && hit_rate < cache_hit_rate_low_watermark) {
+        memory = std::min(ceiling, memory + floor / 4);
+    } else if (memory > floor) {
+        // Decay the excess multiplicatively so the cache reclaims its
+        // memory quickly once the pressure is gone or the cache proves
+        // useful again.
+        memory = std::max(floor, floor + (memory - floor) * 3 / 4);
+    }
+
+    if (memory != res.memory) {
+        dblog.debug("reader memory broker: adjusting user read memory limit {} -> {} (cache hit rate {:.2f}, {} waiters)",
+                res.memory, memory, hit_rate, sem.waiters());
+        sem.set_resources({res.count, memory});
+    }
+}
+
 const db::extensions& database::extensions() const {
     return get_config().extensions();
 }
@@ -403,6 +480,26 @@ void backlog_controller::adjust() {
 
     auto backlog = _current_backlog();
 
+    // Deadline awareness: estimate the backlog growth rate from the previous
+    // adjustment and, while the backlog is growing, respond to the backlog
+    // projected deadline_lookahead_intervals ahead. The projection only
+    // matters when the time left until the saturation point (the last control
+    // point; for flushes the dirty-memory hard limit, for compaction the
+    // maximum normalized backlog) is comparable to the lookahead window, in
+    // which case shares ramp up before the limit is hit instead of after.
+    auto now = timer<>::clock::now();
+    auto measured = backlog;
+    if (_last_adjust != timer<>::clock::time_point{}) {
+        auto dt = std::chrono::duration<float>(now - _last_adjust).count();
+        auto rate = dt > 0 ? (measured - _last_backlog) / dt : 0.0f;
+        if (rate > 0) {
+            auto lookahead = std::chrono::duration<float>(_interval * deadline_lookahead_intervals).count();
+            backlog = std::min(measured + rate * lookahead, _control_points.back().input);
+        }
+    }
+    _last_backlog = measured;
+    _last_adjust = now;
+
     if (backlog >= _control_points.back().input) {
         update_controller(_control_points.back().output);
         return;
@@ -511,6 +608,10 @@ database::setup_metrics() {
                        sm::description("Counts sstables that survived the clustering key filtering. "
                                        "High value indicates that bloom filter is not very efficient and still have to access a lot of sstables to get data.")),
 
+        sm::make_counter("flush_filter_sstables_pruned", _cf_stats.sstables_pruned_by_flush_filter,
+                       sm::description("Counts sstables dismissed from single-partition reads by one probe of the shared flush-run filter "
+                                       "instead of one bloom filter probe per sstable.")),
+
         sm::make_counter("dropped_view_updates", _cf_stats.dropped_view_updates,
                        sm::description("Counts the number of view updates that have been dropped due to cluster overload. ")),
 
@@ -530,6 +631,10 @@ database::setup_metrics() {
         sm::make_counter("total_writes_rate_limited", _stats->total_writes_rate_limited,
                        sm::description("Counts write operations which were rejected on the replica side because the per-partition limit was reached.")),
 
+        sm::make_counter("counter_updates_combined", _stats->counter_updates_combined,
+                       sm::description("Counts counter updates which were combined with a pending update of the same partition instead of "
+                                       "performing their own read-modify-write (see counter_write_combining_window_in_ms).")),
+
         sm::make_counter("total_reads", _read_concurrency_sem.get_stats().total_successful_reads,
                        sm::description("Counts the total number of successful user reads on this shard."),
                        {user_label_instance}),
@@ -560,9 +665,21 @@ database::setup_metrics() {
         sm::make_counter("querier_cache_misses", _querier_cache.get_stats().misses,
                        sm::description("Counts querier cache lookups that failed to find a cached querier")),
 
+        sm::make_counter("querier_cache_hits", _querier_cache.get_stats().hits,
+                       sm::description("Counts querier cache lookups that found a cached querier that could be reused")),
+
         sm::make_counter("querier_cache_drops", _querier_cache.get_stats().drops,
                        sm::description("Counts querier cache lookups that found a cached querier but had to drop it due to position mismatch")),
 
+        sm::make_counter("querier_cache_drops_schema_version_mismatch", _querier_cache.get_stats().drops_schema_version_mismatch,
+                       sm::description("The subset of querier cache drops caused by the page using a different schema version")),
+
+        sm::make_counter("querier_cache_drops_ring_pos_mismatch", _querier_cache.get_stats().drops_ring_pos_mismatch,
+                       sm::description("The subset of querier cache drops caused by the page not continuing from the cached querier's ring position")),
+
+        sm::make_counter("querier_cache_drops_clustering_pos_mismatch", _querier_cache.get_stats().drops_clustering_pos_mismatch,
+                       sm::description("The subset of querier cache drops caused by the page not continuing from the cached querier's clustering position")),
+
         sm::make_counter("querier_cache_time_based_evictions", _querier_cache.get_stats().time_based_evictions,
                        sm::description("Counts querier cache entries that timed out and were evicted.")),
 
@@ -573,6 +690,24 @@ database::setup_metrics() {
         sm::make_gauge("querier_cache_population", _querier_cache.get_stats().population,
                        sm::description("The number of entries currently in the querier cache.")),
 
+        sm::make_counter("query_result_cache_hits", _query_result_cache->get_stats().hits,
+                       sm::description("Counts single-partition data reads served directly from the query result cache.")),
+
+        sm::make_counter("query_result_cache_misses", _query_result_cache->get_stats().misses,
+                       sm::description("Counts query result cache lookups that did not find a cached page.")),
+
+        sm::make_counter("query_result_cache_insertions", _query_result_cache->get_stats().insertions,
+                       sm::description("Counts pages inserted into the query result cache.")),
+
+        sm::make_counter("query_result_cache_evictions", _query_result_cache->get_stats().evictions,
+                       sm::description("Counts query result cache pages evicted due to size pressure.")),
+
+        sm::make_gauge("query_result_cache_bytes_used", _query_result_cache->get_stats().used_bytes,
+                       sm::description("The number of bytes currently held by the query result cache.")),
+
+        sm::make_gauge("query_result_cache_population", _query_result_cache->get_stats().entries,
+                       sm::description("The number of entries currently in the query result cache.")),
+
         sm::make_counter("sstable_read_queue_overloads", _read_concurrency_sem.get_stats().total_reads_shed_due_to_overload,
                        sm::description("Counts the number of times the sstable read queue was overloaded. "
                                        "A non-zero value indicates that we have to drop read requests because they arrive faster than we can serve them.")),
@@ -596,6 +731,20 @@ database::setup_metrics() {
                        sm::description("The number of currently active reads that are temporarily paused."),
                        {user_label_instance}),
 
+        sm::make_counter("reads_admission_wait_micros", _read_concurrency_sem.get_stats().total_admission_wait_time_us,
+                       sm::description("The total time reads spent waiting for admission, in microseconds."),
+                       {user_label_instance}),
+
+        sm::make_gauge("reads_concurrency_limit", [this] { return _read_concurrency_sem.initial_resources().count; },
+                       sm::description("The current count limit of concurrent reads. Differs from the configured maximum "
+                                       "when adaptive admission control is enabled."),
+                       {user_label_instance}),
+
+        sm::make_gauge("reads_memory_limit", [this] { return _read_concurrency_sem.initial_resources().memory; },
+                       sm::description("The current memory limit of concurrent reads. Differs from the static budget "
+                                       "when the adaptive reader memory broker is enabled."),
+                       {user_label_instance}),
+
         sm::make_counter("paused_reads_permit_based_evictions", _read_concurrency_sem.get_stats().permit_based_evictions,
                        sm::description("The number of paused reads evicted to free up permits."
                                        " Permits are required for new reads to start, and the database will evict paused reads (if any)"
@@ -1250,10 +1399,13 @@ keyspace::make_column_family_config(const schema& s, const database& db) const {
     cfg.enable_metrics_reporting = db_config.enable_keyspace_column_family_metrics();
     cfg.reversed_reads_auto_bypass_cache = db_config.reversed_reads_auto_bypass_cache;
     cfg.enable_optimized_reversed_reads = db_config.enable_optimized_reversed_reads;
+    cfg.memtable_flush_streams = db_config.memtable_flush_streams;
+    cfg.write_dedup_window_size = db_config.write_dedup_window_size;
     cfg.tombstone_warn_threshold = db_config.tombstone_warn_threshold();
     cfg.view_update_concurrency_semaphore = _config.view_update_concurrency_semaphore;
     cfg.view_update_concurrency_semaphore_limit = _config.view_update_concurrency_semaphore_limit;
     cfg.data_listeners = &db.data_listeners();
+    cfg.result_cache = &db.get_query_result_cache();
     cfg.x_log2_compaction_groups = db_config.x_log2_compaction_groups();
 
     return cfg;
@@ -1650,6 +1802,38 @@ future<reader_permit> database::obtain_reader_permit(schema_ptr schema, const ch
     return obtain_reader_permit(find_column_family(std::move(schema)), op_name, timeout);
 }
 
+future<> database::warm_partition_cache(schema_ptr s, dht::decorated_key dk, uint64_t max_bytes, db::timeout_clock::time_point timeout) {
+    return with_scheduling_group(_dbcfg.streaming_scheduling_group, [this, s = std::move(s), dk = std::move(dk), max_bytes, timeout] () mutable {
+        return do_warm_partition_cache(std::move(s), std::move(dk), max_bytes, timeout);
+    });
+}
+
+future<> database::do_warm_partition_cache(schema_ptr s, dht::decorated_key dk, uint64_t max_bytes, db::timeout_clock::time_point timeout) {
+    auto& t = find_column_family(s);
+    auto permit = co_await obtain_reader_permit(t, "warm-partition-cache", timeout);
+    auto pr = dht::partition_range::make_singular(dk);
+    auto rd = t.make_reader_v2(std::move(s), std::move(permit), pr);
+    std::exception_ptr ex;
+    try {
+        // Draining the reader pulls the partition through the cache reader,
+        // populating the row cache as a side effect. The result is discarded.
+        uint64_t bytes = 0;
+        while (bytes < max_bytes) {
+            auto mfopt = co_await rd();
+            if (!mfopt) {
+                break;
+            }
+            bytes += mfopt->memory_usage();
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await rd.close();
+    if (ex) {
+        co_await coroutine::return_exception_ptr(std::move(ex));
+    }
+}
+
 std::ostream& operator<<(std::ostream& out, const column_family& cf) {
     fmt::print(out, "{{column_family: {}/{}}}", cf._schema->ks_name(), cf._schema->cf_name());
     return out;
@@ -1670,6 +1854,62 @@ future<mutation> database::do_apply_counter_update(column_family& cf, const froz
     auto m = fm.unfreeze(m_schema);
     m.upgrade(cf.schema());
 
+    auto window = std::chrono::milliseconds(_cfg.counter_write_combining_window_in_ms());
+    if (window.count() && is_pure_counter_update(m)) {
+        return combine_counter_update(cf, std::move(m), window, timeout, std::move(trace_state));
+    }
+    return do_apply_counter_update_one(cf, std::move(m), timeout, std::move(trace_state));
+}
+
+future<mutation> database::combine_counter_update(column_family& cf, mutation m, std::chrono::milliseconds window,
+                                                  db::timeout_clock::time_point timeout, tracing::trace_state_ptr trace_state) {
+    auto table_id = cf.schema()->id();
+    auto& batches = _pending_counter_updates.try_emplace(table_id,
+            counter_update_batches(16, counter_batch_dk_hash{}, counter_batch_dk_equal{cf.schema()})).first->second;
+
+    auto it = batches.find(m.decorated_key());
+    if (it != batches.end()) {
+        auto& b = *it->second;
+        if (b.update.schema()->version() != m.schema()->version()) {
+            // The schema changed within the window. Don't mix updates in
+            // different schema versions, apply this one on its own.
+            return do_apply_counter_update_one(cf, std::move(m), timeout, std::move(trace_state));
+        }
+        tracing::trace(trace_state, "Combining with a pending counter update of the same partition");
+        b.update.apply(std::move(m));
+        b.timeout = std::max(b.timeout, timeout);
+        ++_stats->counter_updates_combined;
+        return b.result.get_shared_future();
+    }
+
+    auto batch = make_lw_shared<counter_update_batch>(counter_update_batch{std::move(m), timeout, shared_promise<mutation>(), cf.write_in_progress()});
+    batches.emplace(batch->update.decorated_key(), batch);
+
+    // The first update of the window drives the batch: it waits out the
+    // window, runs the read-modify-write for everything accumulated in the
+    // meantime and publishes the resulting shard mutation to the followers.
+    // Replicating the combined mutation from each waiter is idempotent, as
+    // counter shards merge by logical clock.
+    return seastar::sleep(window).then([this, &cf, batch, table_id, trace_state = std::move(trace_state)] () mutable {
+        auto bit = _pending_counter_updates.find(table_id);
+        if (bit != _pending_counter_updates.end()) {
+            bit->second.erase(batch->update.decorated_key());
+        }
+        return do_apply_counter_update_one(cf, std::move(batch->update), batch->timeout, std::move(trace_state)).then_wrapped([batch] (future<mutation> f) {
+            if (f.failed()) {
+                auto ep = f.get_exception();
+                batch->result.set_exception(ep);
+                return make_exception_future<mutation>(std::move(ep));
+            }
+            auto m = f.get0();
+            batch->result.set_value(m);
+            return make_ready_future<mutation>(std::move(m));
+        });
+    });
+}
+
+future<mutation> database::do_apply_counter_update_one(column_family& cf, mutation m, db::timeout_clock::time_point timeout,
+                                                       tracing::trace_state_ptr trace_state) {
     // prepare partition slice
     query::column_id_vector static_columns;
     static_columns.reserve(m.partition().static_row().size());
@@ -1823,8 +2063,8 @@ static std::exception_ptr wrap_commitlog_add_error(schema_ptr s, const frozen_mu
 
 future<> database::apply_with_commitlog(column_family& cf, const mutation& m, db::timeout_clock::time_point timeout) {
     db::rp_handle h;
-    if (cf.commitlog() != nullptr && cf.durable_writes()) {
-        auto fm = freeze(m);
+    if (cf.commitlog() != nullptr && cf.durable_writes() && !m.schema()->commitlog_disabled()) {
+        auto fm = co_await freeze_gently(m);
         std::exception_ptr ex;
         try {
             commitlog_entry_writer cew(m.schema(), fm, db::commitlog::force_sync::no);
@@ -1931,6 +2171,13 @@ future<> database::do_apply(schema_ptr s, const frozen_mutation& m, tracing::tra
         }
     }
 
+    if (cf.should_suppress_duplicate_write(m)) [[unlikely]] {
+        // Exact duplicate of a recently applied mutation. Re-applying it
+        // would be a no-op, so skip the commitlog and memtable work.
+        update_writes_failed.cancel();
+        co_return;
+    }
+
     sync = sync || db::commitlog::force_sync(s->wait_for_sync_to_commitlog());
 
     // Signal to view building code that a write is in progress,
@@ -1954,7 +2201,7 @@ future<> database::do_apply(schema_ptr s, const frozen_mutation& m, tracing::tra
     // frames.
     db::rp_handle h;
     auto cl = cf.commitlog();
-    if (cl != nullptr && cf.durable_writes()) {
+    if (cl != nullptr && cf.durable_writes() && !s->commitlog_disabled()) {
         std::exception_ptr ex;
         try {
             commitlog_entry_writer cew(s, m, sync);
@@ -2213,6 +2460,9 @@ future<> database::stop() {
     if (!_shutdown) {
         co_await shutdown();
     }
+    if (_reader_memory_broker) {
+        _reader_memory_broker->tick_timer.cancel();
+    }
 
     // try to ensure that CL has done disk flushing
     if (_commitlog) {
@@ -2542,6 +2792,49 @@ future<std::vector<database::snapshot_details_result>> database::get_snapshot_de
     co_return details;
 }
 
+future<std::vector<database::snapshot_diff_file>> database::get_snapshot_diff(sstring from_tag, sstring to_tag) {
+    std::vector<snapshot_diff_file> diff;
+
+    for (auto& datadir : _cfg.data_file_directories()) {
+        co_await lister::scan_dir(fs::path(datadir), lister::dir_entry_types::of<directory_entry_type::directory>(), [&] (fs::path parent_dir, directory_entry de) -> future<> {
+            // KS directory
+            sstring ks_name = de.name;
+
+            co_return co_await lister::scan_dir(parent_dir / de.name, lister::dir_entry_types::of<directory_entry_type::directory>(), [&, ks_name = std::move(ks_name)] (fs::path parent_dir, directory_entry de) -> future<> {
+                // CF directory
+                auto snapshots_dir = parent_dir / de.name / sstables::snapshots_dir;
+                auto to_dir = snapshots_dir / std::string_view(to_tag);
+                // Also skips tables with no snapshots and non-keyspace
+                // directories (e.g. commitlog) under the data directory.
+                if (!co_await file_exists(to_dir.native())) {
+                    co_return;
+                }
+
+                std::unordered_set<sstring> base_files;
+                auto from_dir = snapshots_dir / std::string_view(from_tag);
+                if (co_await file_exists(from_dir.native())) {
+                    co_await lister::scan_dir(from_dir, lister::dir_entry_types::of<directory_entry_type::regular>(), [&base_files] (fs::path, directory_entry de) {
+                        base_files.insert(de.name);
+                        return make_ready_future<>();
+                    });
+                }
+
+                auto cf_name = extract_cf_name_and_uuid(de.name).first;
+                co_await lister::scan_dir(to_dir, lister::dir_entry_types::of<directory_entry_type::regular>(), [&] (fs::path snapshot_dir, directory_entry de) -> future<> {
+                    // Snapshot metadata is regenerated for every snapshot and is not part of the data diff.
+                    if (de.name == "manifest.json" || de.name == "schema.cql" || base_files.contains(de.name)) {
+                        co_return;
+                    }
+                    auto sd = co_await io_check(file_stat, (snapshot_dir / de.name).native(), follow_symlink::no);
+                    diff.push_back(snapshot_diff_file{ks_name, cf_name, de.name, int64_t(sd.size)});
+                });
+            });
+        });
+    }
+
+    co_return diff;
+}
+
 // For the filesystem operations, this code will assume that all keyspaces are visible in all shards
 // (as we have been doing for a lot of the other operations, like the snapshot itself).
 future<> database::clear_snapshot(sstring tag, std::vector<sstring> keyspace_names, const sstring& table_name) {
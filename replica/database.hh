@@ -20,7 +20,9 @@
 #include <chrono>
 #include <seastar/core/distributed.hh>
 #include <functional>
+#include <deque>
 #include <unordered_map>
+#include <unordered_set>
 #include <map>
 #include <set>
 #include <boost/functional/hash.hpp>
@@ -60,6 +62,7 @@
 #include "absl-flat_hash_map.hh"
 #include "utils/cross-shard-barrier.hh"
 #include "sstables/generation_type.hh"
+#include "utils/i_filter.hh"
 #include "db/rate_limiter.hh"
 #include "db/operation_type.hh"
 #include "utils/serialized_action.hh"
@@ -110,17 +113,22 @@ namespace gms {
 class gossiper;
 }
 
+namespace cql3 {
+class query_processor;
+}
+
 namespace db {
 class commitlog;
 class config;
 class extensions;
 class rp_handle;
 class data_listeners;
+class hot_partitions_tracker;
 class large_data_handler;
 class system_keyspace;
 class table_selector;
 
-future<> system_keyspace_make(db::system_keyspace& sys_ks, distributed<replica::database>& db, distributed<service::storage_service>& ss, sharded<gms::gossiper>& g, db::config& cfg, db::table_selector&);
+future<> system_keyspace_make(db::system_keyspace& sys_ks, distributed<replica::database>& db, distributed<service::storage_service>& ss, sharded<gms::gossiper>& g, db::config& cfg, db::table_selector&, sharded<cql3::query_processor>& qp);
 
 }
 
@@ -294,6 +302,10 @@ struct cf_stats {
     // how many sstables survived the clustering key checks
     int64_t surviving_sstables_after_clustering_filter = 0;
 
+    // sstables dismissed from single-partition reads by one probe of the
+    // shared flush-run filter instead of a bloom filter probe per sstable
+    int64_t sstables_pruned_by_flush_filter = 0;
+
     // How many view updates were dropped due to overload.
     int64_t dropped_view_updates = 0;
 
@@ -333,6 +345,8 @@ struct table_stats {
     int64_t memtable_partition_hits = 0;
     int64_t memtable_range_tombstone_reads = 0;
     int64_t memtable_row_tombstone_reads = 0;
+    /** Number of writes suppressed by the duplicate-write filter */
+    int64_t write_dedup_suppressed = 0;
     mutation_application_stats memtable_app_stats;
     utils::timed_rate_moving_average_summary_and_histogram reads{256};
     utils::timed_rate_moving_average_summary_and_histogram writes{256};
@@ -345,6 +359,8 @@ struct table_stats {
     utils::estimated_histogram estimated_coordinator_read;
 };
 
+class query_result_cache;
+
 class table : public enable_lw_shared_from_this<table> {
 public:
     struct config {
@@ -371,10 +387,13 @@ public:
         db::timeout_semaphore* view_update_concurrency_semaphore;
         size_t view_update_concurrency_semaphore_limit;
         db::data_listeners* data_listeners = nullptr;
+        query_result_cache* result_cache = nullptr;
         // Not really table-specific (it's a global configuration parameter), but stored here
         // for easy access from `table` member functions:
         utils::updateable_value<bool> reversed_reads_auto_bypass_cache{false};
         utils::updateable_value<bool> enable_optimized_reversed_reads{true};
+        utils::updateable_value<uint32_t> memtable_flush_streams{1};
+        utils::updateable_value<uint32_t> write_dedup_window_size{0};
         // Can be updated by a schema change:
         bool enable_optimized_twcs_queries{true};
         uint32_t tombstone_warn_threshold{0};
@@ -399,9 +418,19 @@ private:
 
     uint64_t _failed_counter_applies_to_memtable = 0;
 
+    // Hashes of recently applied mutations, in application order, with a
+    // set for lookup. Backs the optional duplicate-write filter, see
+    // should_suppress_duplicate_write().
+    std::deque<uint64_t> _recent_write_hashes;
+    std::unordered_set<uint64_t> _recent_write_hash_set;
+
     template<typename... Args>
     void do_apply(compaction_group& cg, db::rp_handle&&, Args&&... args);
 
+    // Drops the hot-key query result cache entries of a freshly written
+    // partition.
+    void invalidate_cached_query_results(partition_key_view pk);
+
     lw_shared_ptr<memtable_list> make_memory_only_memtable_list();
     lw_shared_ptr<memtable_list> make_memtable_list(compaction_group& cg);
 
@@ -425,6 +454,21 @@ private:
     mutable row_cache _cache; // Cache covers only sstables.
     std::optional<int64_t> _sstable_generation = {};
 
+    // Shared bloom filter covering the partition keys of the sstables recently
+    // written out by memtable flushes, together with the generations of the
+    // sstables it covers. A burst of flushes creates many small sstables which
+    // all have to be probed by every single-partition read until compaction
+    // catches up; one probe of this filter can dismiss all of them at once.
+    // The filter is fed on the flush path (see try_flush_memtable_to_sstable())
+    // and dropped once the last covered sstable is compacted away.
+    utils::filter_ptr _flush_run_filter;
+    std::unordered_set<sstables::generation_type> _flush_run_filter_generations;
+    uint64_t _flush_run_filter_keys = 0;
+    uint64_t _flush_run_filter_capacity = 0;
+    // Flushes currently recording their keys; the filter is not reset while
+    // any are in flight.
+    unsigned _flush_run_filter_writers = 0;
+
     db::replay_position _highest_rp;
     db::replay_position _flush_rp;
     db::replay_position _lowest_allowed_rp;
@@ -555,6 +599,12 @@ private:
     future<> try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtable> memt, sstable_write_permit&& permit);
     // Caller must keep m alive.
     future<> update_cache(compaction_group& cg, lw_shared_ptr<memtable> m, std::vector<sstables::shared_sstable> ssts);
+    // Flush-run filter maintenance, driven by the flush and compaction paths.
+    // See the comment at _flush_run_filter.
+    bool prepare_flush_run_filter(uint64_t estimated_partitions);
+    flat_mutation_reader_v2 record_in_flush_run_filter(flat_mutation_reader_v2 rd);
+    void cover_by_flush_run_filter(const std::vector<sstables::shared_sstable>& ssts);
+    void forget_in_flush_run_filter(const sstables::shared_sstable& sst);
     struct merge_comparator;
 
     // update the sstable generation, making sure that new new sstables don't overwrite this one.
@@ -730,6 +780,18 @@ public:
     // TODO: expose stats, whatever, instead of exposing active memtables themselves.
     std::vector<memtable*> active_memtables();
     api::timestamp_type min_memtable_timestamp() const;
+    // Estimated number of partitions in this table on this shard, from
+    // sstable statistics plus the current memtable contents. Counts
+    // partitions once per sstable/memtable they appear in and includes
+    // partitions that are deleted but not yet purged.
+    uint64_t estimated_partition_count() const;
+    // Cheap, probabilistic existence check for a partition key: consults
+    // the memtables and the sstable bloom filters only, so no disk reads
+    // are performed. A false result means the key is certainly absent on
+    // this shard; a true result means a regular read is needed to tell.
+    // The row cache does not need to be consulted - everything it holds is
+    // backed by an sstable whose bloom filter answers for it.
+    bool may_contain_key(const dht::decorated_key& dk) const;
     const row_cache& get_row_cache() const {
         return _cache;
     }
@@ -786,6 +848,13 @@ public:
     future<> apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_handle&& h, db::timeout_clock::time_point tmo);
     future<> apply(const mutation& m, db::rp_handle&& h, db::timeout_clock::time_point tmo);
 
+    // Returns true if m is a byte-for-byte duplicate of a recently applied
+    // mutation and the write should be dropped before it costs commitlog
+    // and memtable work. Enabled by write_dedup_window_size; only safe for
+    // idempotent writes with explicit timestamps, where re-applying the
+    // same mutation is a no-op anyway.
+    bool should_suppress_duplicate_write(const frozen_mutation& m);
+
     // Returns at most "cmd.limit" rows
     // The saved_querier parameter is an input-output parameter which contains
     // the saved querier from the previous page (if there was one) and after
@@ -940,6 +1009,15 @@ public:
         return _config.cf_stats;
     }
 
+    // Returns true iff the shared flush-run filter is engaged and proves that
+    // no sstable covered by it contains the given partition key. The key is
+    // hashed the same way as for the per-sstable bloom filters.
+    bool flush_run_filter_excludes(utils::hashed_key hk);
+
+    // Whether the given sstable's partition keys are covered by the shared
+    // flush-run filter, i.e. flush_run_filter_excludes() can speak for it.
+    bool flush_run_filter_covers(const sstables::sstable& sst) const;
+
     const config& get_config() const {
         return _config;
     }
@@ -1233,6 +1311,7 @@ struct database_config {
     seastar::scheduling_group statement_scheduling_group;
     seastar::scheduling_group streaming_scheduling_group;
     seastar::scheduling_group gossip_scheduling_group;
+    seastar::scheduling_group background_compression_scheduling_group;
     size_t available_memory;
     std::optional<sstables::sstable_version_types> sstables_format;
 };
@@ -1287,6 +1366,7 @@ private:
         uint64_t total_writes_failed = 0;
         uint64_t total_writes_timedout = 0;
         uint64_t total_writes_rate_limited = 0;
+        uint64_t counter_updates_combined = 0;
         uint64_t total_reads = 0;
         uint64_t total_reads_failed = 0;
         uint64_t total_reads_rate_limited = 0;
@@ -1323,6 +1403,16 @@ private:
 
     cache_tracker _row_cache_tracker;
 
+    // State of the broker shifting memory budget between the row cache and
+    // user read permits, engaged by the adaptive_reader_memory config option.
+    // See reader_memory_broker_tick().
+    struct reader_memory_broker_state {
+        timer<lowres_clock> tick_timer;
+        uint64_t last_cache_hits = 0;
+        uint64_t last_cache_misses = 0;
+    };
+    std::optional<reader_memory_broker_state> _reader_memory_broker;
+
     inheriting_concrete_execution_stage<
             future<>,
             database*,
@@ -1361,6 +1451,9 @@ private:
 
     friend db::data_listeners;
     std::unique_ptr<db::data_listeners> _data_listeners;
+    std::unique_ptr<db::hot_partitions_tracker> _hot_partitions_tracker;
+
+    std::unique_ptr<query_result_cache> _query_result_cache;
 
     service::migration_notifier& _mnotifier;
     gms::feature_service& _feat;
@@ -1405,16 +1498,50 @@ private:
 
     using system_keyspace = bool_class<struct system_keyspace_tag>;
     future<> create_in_memory_keyspace(const lw_shared_ptr<keyspace_metadata>& ksm, locator::effective_replication_map_factory& erm_factory, system_keyspace system);
-    friend future<> db::system_keyspace_make(db::system_keyspace& sys_ks, distributed<database>& db, distributed<service::storage_service>& ss, sharded<gms::gossiper>& g, db::config& cfg, db::table_selector&);
+    friend future<> db::system_keyspace_make(db::system_keyspace& sys_ks, distributed<database>& db, distributed<service::storage_service>& ss, sharded<gms::gossiper>& g, db::config& cfg, db::table_selector&, sharded<cql3::query_processor>& qp);
     void setup_metrics();
     void setup_scylla_memory_diagnostics_producer();
+    void reader_memory_broker_tick() noexcept;
 
     future<> do_apply(schema_ptr, const frozen_mutation&, tracing::trace_state_ptr tr_state, db::timeout_clock::time_point timeout, db::commitlog_force_sync sync, db::per_partition_rate_limit::info rate_limit_info);
+    future<> do_warm_partition_cache(schema_ptr, dht::decorated_key, uint64_t max_bytes, db::timeout_clock::time_point timeout);
     future<> do_apply_many(const std::vector<frozen_mutation>&, db::timeout_clock::time_point timeout);
     future<> apply_with_commitlog(column_family& cf, const mutation& m, db::timeout_clock::time_point timeout);
 
     future<mutation> do_apply_counter_update(column_family& cf, const frozen_mutation& fm, schema_ptr m_schema, db::timeout_clock::time_point timeout,
                                              tracing::trace_state_ptr trace_state);
+    // Runs the locked read-modify-write for a single counter update mutation,
+    // which must already be in cf's schema.
+    future<mutation> do_apply_counter_update_one(column_family& cf, mutation m, db::timeout_clock::time_point timeout,
+                                                 tracing::trace_state_ptr trace_state);
+
+    // Write-behind combining of counter updates, see
+    // counter_write_combining_window_in_ms. Updates to the same partition
+    // arriving within the window are merged (counter update deltas are
+    // summed by mutation::apply()) and applied with a single
+    // read-modify-write, whose result all of them share.
+    struct counter_update_batch {
+        mutation update;
+        db::timeout_clock::time_point timeout;
+        shared_promise<mutation> result;
+        utils::phased_barrier::operation op;
+    };
+    struct counter_batch_dk_hash {
+        size_t operator()(const dht::decorated_key& dk) const {
+            return std::hash<dht::decorated_key>()(dk);
+        }
+    };
+    struct counter_batch_dk_equal {
+        schema_ptr _schema;
+        bool operator()(const dht::decorated_key& a, const dht::decorated_key& b) const {
+            return a.equal(*_schema, b);
+        }
+    };
+    using counter_update_batches = std::unordered_map<dht::decorated_key, lw_shared_ptr<counter_update_batch>, counter_batch_dk_hash, counter_batch_dk_equal>;
+    std::unordered_map<table_id, counter_update_batches> _pending_counter_updates;
+
+    future<mutation> combine_counter_update(column_family& cf, mutation m, std::chrono::milliseconds window,
+                                            db::timeout_clock::time_point timeout, tracing::trace_state_ptr trace_state);
 
     template<typename Future>
     Future update_write_metrics(Future&& f);
@@ -1594,6 +1721,21 @@ public:
 
     future<std::vector<snapshot_details_result>> get_snapshot_details();
 
+    struct snapshot_diff_file {
+        sstring ks;
+        sstring cf;
+        sstring name;
+        int64_t size;
+        bool operator==(const snapshot_diff_file&) const = default;
+    };
+
+    // Lists the sstable files present in snapshot to_tag but absent from
+    // snapshot from_tag, across all tables. Since sstables are immutable and
+    // snapshots are hardlinks, a file with the same name has the same
+    // content, so this is the set a backup agent has to upload on top of an
+    // existing backup of from_tag.
+    future<std::vector<snapshot_diff_file>> get_snapshot_diff(sstring from_tag, sstring to_tag);
+
     friend std::ostream& operator<<(std::ostream& out, const database& db);
     const flat_hash_map<sstring, keyspace>& get_keyspaces() const {
         return _keyspaces;
@@ -1710,6 +1852,14 @@ public:
         return *_data_listeners;
     }
 
+    db::hot_partitions_tracker& hot_partitions_tracker() const {
+        return *_hot_partitions_tracker;
+    }
+
+    query_result_cache& get_query_result_cache() const {
+        return *_query_result_cache;
+    }
+
     // Get the maximum result size for an unlimited query, appropriate for the
     // query class, which is deduced from the current scheduling group.
     query::max_result_size get_unlimited_query_max_result_size() const;
@@ -1718,10 +1868,23 @@ public:
     // which is deduced from the current scheduling group.
     reader_concurrency_semaphore& get_reader_concurrency_semaphore();
 
+    // Number of streaming reads queued behind this shard's streaming reader
+    // concurrency semaphore. Used by streaming as a congestion signal when
+    // deciding how many transfers to run in parallel.
+    size_t streaming_read_waiters() const {
+        return _streaming_concurrency_sem.waiters();
+    }
+
     // Convenience method to obtain an admitted permit. See reader_concurrency_semaphore::obtain_permit().
     future<reader_permit> obtain_reader_permit(table& tbl, const char* const op_name, db::timeout_clock::time_point timeout);
     future<reader_permit> obtain_reader_permit(schema_ptr schema, const char* const op_name, db::timeout_clock::time_point timeout);
 
+    // Reads the given partition through the regular read path at streaming
+    // priority, to populate the row cache ahead of anticipated foreground
+    // reads, consuming at most max_bytes worth of fragments. Must be called
+    // on the shard owning the key.
+    future<> warm_partition_cache(schema_ptr s, dht::decorated_key dk, uint64_t max_bytes, db::timeout_clock::time_point timeout);
+
     bool is_internal_query() const;
 
     sharded<sstables::directory_semaphore>& get_sharded_sst_dir_semaphore() {
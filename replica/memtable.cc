@@ -197,24 +197,6 @@ future<> memtable::clear_gently() noexcept {
     });
 }
 
-partition_entry&
-memtable::find_or_create_partition_slow(partition_key_view key) {
-    assert(!reclaiming_enabled());
-
-    // FIXME: Perform lookup using std::pair<token, partition_key_view>
-    // to avoid unconditional copy of the partition key.
-    // We can't do it right now because std::map<> which holds
-    // partitions doesn't support heterogeneous lookup.
-    // We could switch to boost::intrusive_map<> similar to what we have for row keys.
-    auto& outer = current_allocator();
-    return with_allocator(standard_allocator(), [&, this] () -> partition_entry& {
-        auto dk = dht::decorate_key(*_schema, key);
-        return with_allocator(outer, [&dk, this] () -> partition_entry& {
-            return find_or_create_partition(dk);
-        });
-    });
-}
-
 partition_entry&
 memtable::find_or_create_partition(const dht::decorated_key& key) {
     assert(!reclaiming_enabled());
@@ -239,6 +221,43 @@ memtable::find_or_create_partition(const dht::decorated_key& key) {
     return i->partition();
 }
 
+bool
+memtable::apply_direct(const dht::decorated_key& key, const frozen_mutation& m, const schema_ptr& m_schema) {
+    assert(!reclaiming_enabled());
+
+    if (_schema->version() != m_schema->version()) {
+        return false; // Upgrading needs a separately built partition.
+    }
+    partitions_type::bound_hint hint;
+    auto i = partitions.lower_bound(key, dht::ring_position_comparator(*_schema), hint);
+    if (i != partitions.end() && hint.match) {
+        return false; // Merging into existing content goes through the generic path.
+    }
+    auto entry = partitions.emplace_before(i,
+            key.token().raw(), hint,
+            _schema, dht::decorated_key(key), mutation_partition(_schema));
+    ++nr_partitions;
+    ++_table_stats.memtable_partition_insertions;
+    if (!hint.emplace_keeps_iterators()) {
+        current_allocator().invalidate_references();
+    }
+    try {
+        mutation_partition& mp = entry->partition().version()->partition();
+        partition_builder pb(*_schema, mp);
+        m.partition().accept(*_schema, pb);
+        _stats_collector.update(*_schema, mp);
+        _table_stats.memtable_app_stats.row_writes += mp.row_count();
+        return true;
+    } catch (...) {
+        // Remove the partially built entry so that a failed write doesn't
+        // leave a torn partition behind; the generic path makes the same
+        // guarantee by building the partition on the side.
+        entry.erase(dht::raw_token_less_comparator{});
+        --nr_partitions;
+        throw;
+    }
+}
+
 boost::iterator_range<memtable::partitions_type::const_iterator>
 memtable::slice(const dht::partition_range& range) const {
     if (query::is_single_partition(range)) {
@@ -620,9 +639,9 @@ class flush_reader final : public flat_mutation_reader_v2::impl, private iterato
     flat_mutation_reader_v2_opt _partition_reader;
     flush_memory_accounter _flushed_memory;
 public:
-    flush_reader(schema_ptr s, reader_permit permit, lw_shared_ptr<memtable> m)
+    flush_reader(schema_ptr s, reader_permit permit, lw_shared_ptr<memtable> m, const dht::partition_range& range)
         : impl(s, std::move(permit))
-        , iterator_reader(std::move(s), m, query::full_partition_range)
+        , iterator_reader(std::move(s), m, range)
         , _flushed_memory(*m)
     {}
     flush_reader(const flush_reader&) = delete;
@@ -744,13 +763,13 @@ memtable::make_flat_reader_opt(schema_ptr s,
 }
 
 flat_mutation_reader_v2
-memtable::make_flush_reader(schema_ptr s, reader_permit permit, const io_priority_class& pc) {
+memtable::make_flush_reader(schema_ptr s, reader_permit permit, const io_priority_class& pc, const dht::partition_range& range) {
     if (!_merged_into_cache) {
-        return make_flat_mutation_reader_v2<flush_reader>(std::move(s), std::move(permit), shared_from_this());
+        return make_flat_mutation_reader_v2<flush_reader>(std::move(s), std::move(permit), shared_from_this(), range);
     } else {
         auto& full_slice = s->full_slice();
         return make_flat_mutation_reader_v2<scanning_reader>(std::move(s), shared_from_this(), std::move(permit),
-                      query::full_partition_range, full_slice, pc, mutation_reader::forwarding::no);
+                      range, full_slice, pc, mutation_reader::forwarding::no);
     }
 }
 
@@ -790,9 +809,20 @@ memtable::apply(const mutation& m, db::rp_handle&& h) {
 
 void
 memtable::apply(const frozen_mutation& m, const schema_ptr& m_schema, db::rp_handle&& h) {
-    with_allocator(allocator(), [this, &m, &m_schema] {
+    // Decorate the key up front, with the standard allocator, rather than
+    // switching allocators back and forth inside the allocating section
+    // on every write.
+    auto dk = m.decorated_key(*m_schema);
+    with_allocator(allocator(), [this, &m, &m_schema, &dk] {
         _allocating_section(*this, [&, this] {
-            auto& p = find_or_create_partition_slow(m.key());
+            // Common no-conflict case: the partition is not in this memtable
+            // yet, so the mutation view can be deserialized straight into the
+            // fresh entry, skipping the intermediate mutation_partition and
+            // its merge into the tree.
+            if (apply_direct(dk, m, m_schema)) {
+                return;
+            }
+            auto& p = find_or_create_partition(dk);
             mutation_partition mp(m_schema);
             partition_builder pb(*m_schema, mp);
             m.partition().accept(*m_schema, pb);
@@ -803,6 +833,45 @@ memtable::apply(const frozen_mutation& m, const schema_ptr& m_schema, db::rp_han
     update(std::move(h));
 }
 
+void
+memtable::apply(const std::vector<frozen_mutation_and_schema>& muts, db::rp_handle&& h) {
+    // Decorate the keys and sort the batch in ring order up front, with the
+    // standard allocator, so the walk over the partition tree below touches
+    // adjacent nodes and each lookup starts from a warm path.
+    struct decorated_mutation {
+        dht::decorated_key dk;
+        const frozen_mutation_and_schema* m;
+    };
+    std::vector<decorated_mutation> sorted;
+    sorted.reserve(muts.size());
+    for (const auto& m : muts) {
+        sorted.push_back({m.fm.decorated_key(*m.s), &m});
+    }
+    std::sort(sorted.begin(), sorted.end(), [less = dht::decorated_key::less_comparator(_schema)] (const decorated_mutation& a, const decorated_mutation& b) {
+        return less(a.dk, b.dk);
+    });
+    with_allocator(allocator(), [&, this] {
+        _allocating_section(*this, [&, this] {
+            // We don't keep an iterator hint across insertions; emplacing
+            // into the tree may invalidate references, so each mutation does
+            // its own lookup, which the sorted order keeps cheap.
+            for (const auto& dm : sorted) {
+                const schema_ptr& m_schema = dm.m->s;
+                if (apply_direct(dm.dk, dm.m->fm, m_schema)) {
+                    continue;
+                }
+                auto& p = find_or_create_partition(dm.dk);
+                mutation_partition mp(m_schema);
+                partition_builder pb(*m_schema, mp);
+                dm.m->fm.partition().accept(*m_schema, pb);
+                _stats_collector.update(*m_schema, mp);
+                p.apply(region(), cleaner(), *_schema, std::move(mp), *m_schema, _table_stats.memtable_app_stats);
+            }
+        });
+    });
+    update(std::move(h));
+}
+
 logalloc::occupancy_stats memtable::occupancy() const noexcept {
     return logalloc::region::occupancy();
 }
@@ -26,6 +26,7 @@
 #include "readers/mutation_source.hh"
 
 class frozen_mutation;
+struct frozen_mutation_and_schema;
 class row_cache;
 
 namespace bi = boost::intrusive;
@@ -167,7 +168,13 @@ private:
 private:
     boost::iterator_range<partitions_type::const_iterator> slice(const dht::partition_range& r) const;
     partition_entry& find_or_create_partition(const dht::decorated_key& key);
-    partition_entry& find_or_create_partition_slow(partition_key_view key);
+    // Direct-apply path for a frozen mutation: when the partition is not yet
+    // present in this memtable and the schemas match, the mutation view is
+    // deserialized straight into a freshly created entry, skipping the
+    // intermediate mutation_partition and its merge into the partition tree.
+    // Returns false when the generic path must be taken instead. Must be
+    // called under the allocating section, like find_or_create_partition().
+    bool apply_direct(const dht::decorated_key& key, const frozen_mutation& m, const schema_ptr& m_schema);
     void upgrade_entry(memtable_entry&);
     void add_flushed_memory(uint64_t);
     void remove_flushed_memory(uint64_t);
@@ -190,6 +197,11 @@ public:
     void apply(const mutation& m, db::rp_handle&& = {});
     // The mutation is upgraded to current schema.
     void apply(const frozen_mutation& m, const schema_ptr& m_schema, db::rp_handle&& = {});
+    // Applies a batch of mutations to this memtable in a single pass,
+    // sorted in ring order, amortizing region entry and dirty memory
+    // accounting across the batch. Each mutation is upgraded to current
+    // schema.
+    void apply(const std::vector<frozen_mutation_and_schema>& muts, db::rp_handle&& = {});
     void evict_entry(memtable_entry& e, mutation_cleaner& cleaner) noexcept;
 
     static memtable& from_region(logalloc::region& r) noexcept {
@@ -266,7 +278,9 @@ public:
         return make_flat_reader(s, std::move(permit), range, full_slice);
     }
 
-    flat_mutation_reader_v2 make_flush_reader(schema_ptr, reader_permit permit, const io_priority_class& pc);
+    // The range must remain alive as long as the reader is used.
+    flat_mutation_reader_v2 make_flush_reader(schema_ptr, reader_permit permit, const io_priority_class& pc,
+                                              const dht::partition_range& range = query::full_partition_range);
 
     mutation_source as_data_source();
 
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include "replica/query_result_cache.hh"
+
+#include "schema.hh"
+#include "idl/keys.dist.hh"
+#include "idl/uuid.dist.hh"
+#include "idl/range.dist.hh"
+#include "idl/read_command.dist.hh"
+#include "serializer_impl.hh"
+#include "serialization_visitors.hh"
+#include "idl/keys.dist.impl.hh"
+#include "idl/uuid.dist.impl.hh"
+#include "idl/range.dist.impl.hh"
+#include "idl/read_command.dist.impl.hh"
+
+namespace replica {
+
+static void write_uuid(bytes_ostream& out, const utils::UUID& uuid) {
+    ser::serialize(out, uuid.get_most_significant_bits());
+    ser::serialize(out, uuid.get_least_significant_bits());
+}
+
+static bytes linearize_to_bytes(bytes_ostream& out) {
+    auto v = out.linearize();
+    return bytes(v.begin(), v.end());
+}
+
+static bytes make_pk_index_blob(const table_id& id, partition_key_view pk) {
+    bytes_ostream out;
+    write_uuid(out, id.uuid());
+    out.write(to_bytes(pk.representation()));
+    return linearize_to_bytes(out);
+}
+
+query_result_cache::key::key(const schema& s, const query::read_command& cmd, partition_key_view pk) {
+    bytes_ostream out;
+    write_uuid(out, s.id().uuid());
+    write_uuid(out, s.version().uuid());
+    ser::serialize(out, cmd.get_row_limit());
+    ser::serialize(out, cmd.partition_limit);
+    ser::serialize(out, cmd.tombstone_limit);
+    if (cmd.max_result_size) {
+        ser::serialize(out, cmd.max_result_size->soft_limit);
+        ser::serialize(out, cmd.max_result_size->hard_limit);
+        ser::serialize(out, cmd.max_result_size->get_page_size());
+    } else {
+        ser::serialize(out, uint64_t(0));
+    }
+    ser::serialize(out, cmd.slice);
+    out.write(to_bytes(pk.representation()));
+    _blob = linearize_to_bytes(out);
+    _pk_index_blob = make_pk_index_blob(s.id(), pk);
+}
+
+void query_result_cache::set_capacity(size_t capacity) {
+    _capacity = capacity;
+    evict_to_fit(0);
+}
+
+void query_result_cache::remove(lru_type::iterator it) {
+    auto pk_range = _pk_index.equal_range(it->pk_index_blob);
+    for (auto i = pk_range.first; i != pk_range.second; ++i) {
+        if (i->second == it) {
+            _pk_index.erase(i);
+            break;
+        }
+    }
+    _entries.erase(it->blob);
+    _stats.used_bytes -= it->size;
+    --_stats.entries;
+    _lru.erase(it);
+}
+
+void query_result_cache::evict_to_fit(size_t size) {
+    while (!_lru.empty() && _stats.used_bytes + size > _capacity) {
+        auto victim = std::prev(_lru.end());
+        ++_stats.evictions;
+        remove(victim);
+    }
+}
+
+static bool wants_data(query::result_options opts) {
+    return opts.request != query::result_request::only_digest;
+}
+
+static bool wants_digest(query::result_options opts) {
+    return opts.request != query::result_request::only_result;
+}
+
+lw_shared_ptr<query::result> query_result_cache::lookup(const key& k, query::result_options opts) {
+    auto i = _entries.find(k._blob);
+    if (i == _entries.end()) {
+        ++_stats.misses;
+        return nullptr;
+    }
+    auto it = i->second;
+    if (lowres_clock::now() - it->inserted_at > max_entry_age) {
+        ++_stats.removals;
+        remove(it);
+        ++_stats.misses;
+        return nullptr;
+    }
+    if ((wants_data(opts) && !it->has_data)
+            || (wants_digest(opts) && (!it->digest || it->digest_algo != opts.digest_algo))) {
+        // The entry doesn't carry what this read asks for. Treat it as a
+        // miss; the insertion on the miss path replaces it with a superset.
+        ++_stats.misses;
+        return nullptr;
+    }
+    _lru.splice(_lru.begin(), _lru, it); // move to MRU
+    ++_stats.hits;
+    // Digest-only reads get an empty body, like a freshly built digest page.
+    auto buf = wants_data(opts) ? bytes_ostream(it->buf) : bytes_ostream();
+    return make_lw_shared<query::result>(std::move(buf), it->digest, it->last_modified,
+            it->short_read, it->row_count_low_bits, it->partition_count, it->row_count_high_bits,
+            it->last_position);
+}
+
+void query_result_cache::insert(uint64_t phase, key&& k, const query::result& result, query::result_options opts) {
+    if (phase != _phase) {
+        // The underlying sources changed while the page was being built;
+        // caching it could serve a pre-write page after the write.
+        return;
+    }
+    auto size = k._blob.size() + k._pk_index_blob.size() + result.buf().size() + entry_overhead;
+    if (size > std::min(max_entry_size, _capacity)) {
+        return;
+    }
+    if (auto i = _entries.find(k._blob); i != _entries.end()) {
+        // A concurrent read of the same key already populated the entry.
+        // Replace it only if this page carries more than it does.
+        const auto& e = *i->second;
+        const bool adds_data = wants_data(opts) && !e.has_data;
+        const bool adds_digest = wants_digest(opts) && (!e.digest || e.digest_algo != opts.digest_algo);
+        if (!adds_data && !adds_digest) {
+            return;
+        }
+        ++_stats.removals;
+        remove(i->second);
+    }
+    evict_to_fit(size);
+    _lru.emplace_front(entry{
+        .blob = std::move(k._blob),
+        .pk_index_blob = std::move(k._pk_index_blob),
+        .buf = bytes_ostream(result.buf()),
+        .has_data = wants_data(opts),
+        .digest = result.digest(),
+        .digest_algo = opts.digest_algo,
+        .last_modified = result.last_modified(),
+        .short_read = result.is_short_read(),
+        .row_count_low_bits = result.row_count_low_bits(),
+        .row_count_high_bits = result.row_count_high_bits(),
+        .partition_count = result.partition_count(),
+        .last_position = result.last_position(),
+        .inserted_at = lowres_clock::now(),
+        .size = size,
+    });
+    auto it = _lru.begin();
+    _entries.emplace(it->blob, it);
+    _pk_index.emplace(it->pk_index_blob, it);
+    _stats.used_bytes += size;
+    ++_stats.entries;
+    ++_stats.insertions;
+}
+
+void query_result_cache::invalidate(const table_id& id, partition_key_view pk) {
+    ++_phase;
+    if (_entries.empty()) {
+        return;
+    }
+    auto pk_range = _pk_index.equal_range(make_pk_index_blob(id, pk));
+    while (pk_range.first != pk_range.second) {
+        auto cur = pk_range.first++;
+        auto it = cur->second;
+        _entries.erase(it->blob);
+        _stats.used_bytes -= it->size;
+        --_stats.entries;
+        ++_stats.removals;
+        _lru.erase(it);
+        _pk_index.erase(cur);
+    }
+}
+
+void query_result_cache::invalidate(const table_id& id) {
+    ++_phase;
+    if (_entries.empty()) {
+        return;
+    }
+    bytes_ostream out;
+    write_uuid(out, id.uuid());
+    auto prefix = linearize_to_bytes(out);
+    for (auto it = _lru.begin(); it != _lru.end();) {
+        auto cur = it++;
+        if (cur->pk_index_blob.size() >= prefix.size()
+                && bytes_view(cur->pk_index_blob.data(), prefix.size()) == bytes_view(prefix)) {
+            ++_stats.removals;
+            remove(cur);
+        }
+    }
+}
+
+void query_result_cache::clear() {
+    ++_phase;
+    _stats.removals += _stats.entries;
+    _stats.used_bytes = 0;
+    _stats.entries = 0;
+    _pk_index.clear();
+    _entries.clear();
+    _lru.clear();
+}
+
+} // namespace replica
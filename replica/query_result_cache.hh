@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <list>
+#include <unordered_map>
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include "bytes_ostream.hh"
+#include "keys.hh"
+#include "query-result.hh"
+#include "schema_fwd.hh"
+#include "seastarx.hh"
+
+namespace replica {
+
+/// A per-shard cache of serialized query::result pages for single-partition
+/// data reads, sitting in front of table::query().
+///
+/// Point reads of tiny hot partitions (e.g. an auth-token lookup table
+/// hammered with identical reads) pay for the full read path on every
+/// request: querier construction, row cache snapshot machinery and the
+/// mutation fragment pipeline, only to rebuild the same serialized page
+/// each time. This cache remembers the built page and serves repeats of
+/// the exact same read directly.
+///
+/// An entry is keyed by an opaque byte blob covering everything that
+/// affects the page content except the query timestamp: table id, schema
+/// version, row/partition/tombstone limits, the serialized partition
+/// slice and the partition key. Blobs are compared byte-for-byte, so
+/// there are no collision concerns.
+///
+/// The requested result kind (data, digest or both) is deliberately not
+/// part of the key: data and digest reads of the same page share one
+/// entry, so on a quorum read the work done for a data request can serve
+/// an immediately following digest request for the same page (and vice
+/// versa, for entries which carry both), which is what coordinator
+/// retries produce. An entry records what it holds, and a lookup whose
+/// request it cannot satisfy is a miss; the subsequent insertion then
+/// replaces the entry with one carrying the superset.
+///
+/// Consistency:
+///  - every write applied to a table invalidates the entries for the
+///    written partition key (see table::do_apply());
+///  - out-of-band additions of sstables (streaming, repair, CDC needs
+///    none) and truncation invalidate the whole table;
+///  - a read captures phase() before touching the underlying sources and
+///    passes it to insert(), which drops the page if any invalidation
+///    happened in between - mirroring the mispopulation guard of
+///    row_cache;
+///  - since the query timestamp is deliberately not part of the key,
+///    entries are also expired after a fixed short age so that TTLed
+///    cells and tombstone expiry are never served arbitrarily late.
+///
+/// The cache is owned by replica::database and shared by all tables on
+/// the shard; it lives on the standard allocator and is sized by the
+/// query_result_cache_size_in_mb config option (0 disables it).
+class query_result_cache {
+public:
+    struct stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        uint64_t removals = 0;
+        uint64_t used_bytes = 0;
+        uint64_t entries = 0;
+    };
+
+    // Lookup key. The blob is built once per read and reused for the miss-path
+    // insertion.
+    class key {
+        bytes _blob;
+        bytes _pk_index_blob; // table id + partition key, for write invalidation
+        friend class query_result_cache;
+    public:
+        key(const schema& s, const query::read_command& cmd, partition_key_view pk);
+    };
+
+private:
+    struct entry {
+        bytes blob;
+        bytes pk_index_blob;
+        bytes_ostream buf;
+        bool has_data;
+        std::optional<query::result_digest> digest;
+        query::digest_algorithm digest_algo;
+        api::timestamp_type last_modified;
+        query::short_read short_read;
+        std::optional<uint32_t> row_count_low_bits;
+        std::optional<uint32_t> row_count_high_bits;
+        std::optional<uint32_t> partition_count;
+        std::optional<full_position> last_position;
+        lowres_clock::time_point inserted_at;
+        size_t size;
+    };
+
+    // Rough per-entry bookkeeping overhead, for accounting against capacity.
+    static constexpr size_t entry_overhead = 256;
+    // Pages larger than this are not worth caching - the read path cost they
+    // amortize is dominated by the page size anyway.
+    static constexpr size_t max_entry_size = 128 * 1024;
+    // Maximum age of a served page. Bounds how late TTLed cells and expiring
+    // tombstones can be observed, since the query timestamp is not part of
+    // the key.
+    static constexpr std::chrono::milliseconds max_entry_age{1000};
+
+    using lru_type = std::list<entry>; // front is MRU
+    lru_type _lru;
+    std::unordered_map<bytes, lru_type::iterator> _entries;
+    std::unordered_multimap<bytes, lru_type::iterator> _pk_index;
+    size_t _capacity = 0;
+    uint64_t _phase = 0;
+    stats _stats;
+
+private:
+    void remove(lru_type::iterator it);
+    void evict_to_fit(size_t size);
+
+public:
+    void set_capacity(size_t capacity);
+
+    bool enabled() const {
+        return _capacity != 0;
+    }
+
+    // Invalidation counter. Capture before the underlying read starts and
+    // pass to insert(); a page built across any invalidation is dropped.
+    uint64_t phase() const {
+        return _phase;
+    }
+
+    // Returns the cached page for the key, or null on miss. An entry which
+    // cannot satisfy the requested result kind (e.g. a digest-only entry
+    // for a data read) is a miss.
+    lw_shared_ptr<query::result> lookup(const key& k, query::result_options opts);
+
+    // Caches a built page unless an invalidation happened since phase was
+    // captured or the page is too large. An existing entry for the key is
+    // replaced if the new page carries more (data and/or a digest) than it.
+    void insert(uint64_t phase, key&& k, const query::result& result, query::result_options opts);
+
+    // Called on every write to the table; drops the entries of the written
+    // partition.
+    void invalidate(const table_id& id, partition_key_view pk);
+
+    // Called when data appears in a table without going through apply()
+    // (streaming, repair, truncation); drops all the entries of the table.
+    void invalidate(const table_id& id);
+
+    void clear();
+
+    const stats& get_stats() const {
+        return _stats;
+    }
+};
+
+} // namespace replica
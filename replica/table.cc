@@ -16,6 +16,7 @@
 #include <seastar/util/defer.hh>
 
 #include "replica/database.hh"
+#include "replica/query_result_cache.hh"
 #include "replica/data_dictionary_impl.hh"
 #include "replica/compaction_group.hh"
 #include "sstables/sstables.hh"
@@ -39,6 +40,7 @@
 #include <boost/range/adaptor/map.hpp>
 #include "utils/error_injection.hh"
 #include "utils/histogram_metrics_helper.hh"
+#include "xx_hasher.hh"
 #include "utils/fb_utilities.hh"
 #include "mutation_source_metadata.hh"
 #include "gms/gossiper.hh"
@@ -50,6 +52,7 @@
 #include <boost/range/algorithm.hpp>
 #include "utils/error_injection.hh"
 #include "readers/reversing_v2.hh"
+#include "readers/filtering.hh"
 #include "readers/from_mutations_v2.hh"
 #include "readers/empty_v2.hh"
 #include "readers/multi_range.hh"
@@ -211,8 +214,6 @@ table::make_reader_v2(schema_ptr s,
     }
     auto& slice = unreversed_slice ? *unreversed_slice : query_slice;
 
-    std::vector<flat_mutation_reader_v2> readers;
-
     // We're assuming that cache and memtables are both read atomically
     // for single-key queries, so we don't need to special case memtable
     // undergoing a move to cache. At any given point in time between
@@ -233,20 +234,54 @@ table::make_reader_v2(schema_ptr s,
     // https://github.com/scylladb/scylla/issues/309
     // https://github.com/scylladb/scylla/issues/185
 
-    add_memtables_to_reader_list(readers, s, permit, range, slice, pc, trace_state, fwd, fwd_mr, [&] (size_t memtable_count) {
-        readers.reserve(memtable_count + 1);
-    });
-
     const auto bypass_cache = slice.options.contains(query::partition_slice::option::bypass_cache);
-    if (cache_enabled() && !bypass_cache && !(reversed && _config.reversed_reads_auto_bypass_cache())) {
-        if (auto reader_opt = _cache.make_reader_opt(s, permit, range, slice, pc, std::move(trace_state), fwd, fwd_mr)) {
+    const auto use_cache = cache_enabled() && !bypass_cache && !(reversed && _config.reversed_reads_auto_bypass_cache());
+
+    auto make_cache_or_sstable_reader = [&] (tracing::trace_state_ptr trace_state) -> flat_mutation_reader_v2_opt {
+        if (use_cache) {
+            return _cache.make_reader_opt(s, permit, range, slice, pc, std::move(trace_state), fwd, fwd_mr);
+        }
+        return make_sstable_reader(s, permit, _sstables, range, slice, pc, std::move(trace_state), fwd, fwd_mr);
+    };
+
+    flat_mutation_reader_v2_opt rd_opt;
+
+    if (range.is_singular() && range.start()->value().has_key()) {
+        // Point query fast path: such a query spans a single compaction group
+        // and, outside of flushes, a single memtable, so combine the memtable
+        // reader with the cache (or single-key sstable) reader directly
+        // instead of going through a heap-allocated reader vector.
+        auto& cg = compaction_group_for_token(range.start()->value().token());
+        if (cg.memtable_count() == 1) {
+            auto mt_rd_opt = (*cg.memtables()->begin())->make_flat_reader_opt(s, permit, range, slice, pc, trace_state, fwd, fwd_mr);
+            auto other_rd_opt = make_cache_or_sstable_reader(std::move(trace_state));
+            if (mt_rd_opt && other_rd_opt) {
+                rd_opt = flat_mutation_reader_v2_opt(make_combined_reader(s, permit, std::move(*mt_rd_opt), std::move(*other_rd_opt), fwd, fwd_mr));
+            } else if (mt_rd_opt) {
+                rd_opt = std::move(mt_rd_opt);
+            } else if (other_rd_opt) {
+                rd_opt = std::move(other_rd_opt);
+            } else {
+                rd_opt = flat_mutation_reader_v2_opt(make_empty_flat_reader_v2(s, permit));
+            }
+        }
+    }
+
+    if (!rd_opt) {
+        std::vector<flat_mutation_reader_v2> readers;
+
+        add_memtables_to_reader_list(readers, s, permit, range, slice, pc, trace_state, fwd, fwd_mr, [&] (size_t memtable_count) {
+            readers.reserve(memtable_count + 1);
+        });
+
+        if (auto reader_opt = make_cache_or_sstable_reader(std::move(trace_state))) {
             readers.emplace_back(std::move(*reader_opt));
         }
-    } else {
-        readers.emplace_back(make_sstable_reader(s, permit, _sstables, range, slice, pc, std::move(trace_state), fwd, fwd_mr));
+
+        rd_opt = flat_mutation_reader_v2_opt(make_combined_reader(s, permit, std::move(readers), fwd, fwd_mr));
     }
 
-    auto rd = make_combined_reader(s, permit, std::move(readers), fwd, fwd_mr);
+    auto rd = std::move(*rd_opt);
 
     if (_config.data_listeners && !_config.data_listeners->empty()) {
         rd = _config.data_listeners->on_read(s, range, slice, std::move(rd));
@@ -273,6 +308,10 @@ sstables::shared_sstable table::make_streaming_staging_sstable() {
     return make_streaming_sstable_for_write(sstables::staging_dir);
 }
 
+// Streams the live combined memtable+sstable view, so callers must not
+// flush the table first: for short-TTL workloads a decommission would
+// otherwise write out memtables only for the data to be discarded soon
+// after it lands on the target.
 flat_mutation_reader_v2
 table::make_streaming_reader(schema_ptr s, reader_permit permit,
                            const dht::partition_range_vector& ranges) const {
@@ -328,6 +367,38 @@ std::vector<memtable*> table::active_memtables() {
     }));
 }
 
+uint64_t table::estimated_partition_count() const {
+    // An estimate only: partitions present in multiple sstables, or both in a
+    // memtable and on disk, are counted once per appearance, and deleted
+    // partitions keep being counted until their tombstones are purged.
+    uint64_t count = 0;
+    for (auto sstables = get_sstables(); auto& sst : *sstables) {
+        count += sst->get_stats_metadata().estimated_partition_size.count();
+    }
+    for (const compaction_group_ptr& cg : compaction_groups()) {
+        for (auto&& mt : *cg->memtables()) {
+            count += mt->partition_count();
+        }
+    }
+    return count;
+}
+
+bool table::may_contain_key(const dht::decorated_key& dk) const {
+    auto singular = dht::partition_range::make_singular(dk);
+    auto& cg = compaction_group_for_token(dk.token());
+    for (auto&& mt : *cg.memtables()) {
+        if (!mt->slice(singular).empty()) {
+            return true;
+        }
+    }
+    for (auto sstables = get_sstables(); auto& sst : *sstables) {
+        if (sst->filter_has_key(*_schema, dk)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 api::timestamp_type compaction_group::min_memtable_timestamp() const {
     if (_memtables->empty()) {
         return api::max_timestamp;
@@ -569,6 +640,11 @@ table::do_add_sstable_and_update_cache(sstables::shared_sstable sst, sstables::o
             add_maintenance_sstable(cg, sst);
         }
     }), dht::partition_range::make({sst->get_first_decorated_key(), true}, {sst->get_last_decorated_key(), true}));
+    // The new sstable made data visible without going through apply();
+    // drop all the cached query results of the table.
+    if (_config.result_cache) {
+        _config.result_cache->invalidate(_schema->id());
+    }
 }
 
 future<>
@@ -823,6 +899,93 @@ table::seal_active_memtable(compaction_group& cg, flush_permit&& flush_permit) n
     // FIXME: provide back-pressure to upper layers
 }
 
+// Size the shared flush-run filter for a whole backlog of flushes, so that an
+// ingest spike doesn't saturate it before compaction starts catching up.
+static constexpr uint64_t flush_run_filter_flushes = 32;
+static constexpr uint64_t flush_run_filter_min_keys = 4096;
+
+bool table::prepare_flush_run_filter(uint64_t estimated_partitions) {
+    const auto fp_chance = _schema->bloom_filter_fp_chance();
+    if (fp_chance >= 1.0) {
+        // Bloom filters are disabled for this table.
+        return false;
+    }
+    if (!_flush_run_filter) {
+        _flush_run_filter_capacity = std::max(estimated_partitions * flush_run_filter_flushes, flush_run_filter_min_keys);
+        _flush_run_filter = utils::i_filter::get_filter(_flush_run_filter_capacity, fp_chance, utils::filter_format::m_format);
+    }
+    // A flush that would overflow the filter is simply not covered by it, and
+    // its sstables keep paying the individual probes on the read path.
+    return _flush_run_filter_keys + estimated_partitions <= _flush_run_filter_capacity;
+}
+
+flat_mutation_reader_v2 table::record_in_flush_run_filter(flat_mutation_reader_v2 rd) {
+    return make_filtering_reader(std::move(rd), [this, s = _schema] (const dht::decorated_key& dk) {
+        // Nothing is ever dropped from the flush stream; the "filter" only
+        // observes the keys going into the new sstable.
+        auto k = sstables::key::from_partition_key(*s, dk.key());
+        _flush_run_filter->add(static_cast<bytes_view>(k));
+        ++_flush_run_filter_keys;
+        return true;
+    });
+}
+
+void table::cover_by_flush_run_filter(const std::vector<sstables::shared_sstable>& ssts) {
+    for (const auto& sst : ssts) {
+        _flush_run_filter_generations.insert(sst->generation());
+    }
+}
+
+void table::forget_in_flush_run_filter(const sstables::shared_sstable& sst) {
+    if (!_flush_run_filter) {
+        return;
+    }
+    _flush_run_filter_generations.erase(sst->generation());
+    if (_flush_run_filter_generations.empty() && !_flush_run_filter_writers) {
+        // The last covered sstable is gone and no flush is recording into the
+        // filter; the next flush burst starts over with a fresh filter sized
+        // for its own partition estimate.
+        _flush_run_filter = nullptr;
+        _flush_run_filter_keys = 0;
+    }
+}
+
+bool table::flush_run_filter_excludes(utils::hashed_key hk) {
+    return _flush_run_filter && !_flush_run_filter_generations.empty() && !_flush_run_filter->is_present(hk);
+}
+
+bool table::flush_run_filter_covers(const sstables::sstable& sst) const {
+    return _flush_run_filter_generations.contains(sst.generation());
+}
+
+// Each flush stream should get enough partitions to produce an sstable
+// worth the per-sstable overhead; flushes smaller than this per stream are
+// not split further.
+static constexpr uint64_t min_partitions_per_flush_stream = 1024;
+
+// Splits the ring into n contiguous token ranges of equal token span. The
+// partitioner spreads partitions uniformly over the token space, so the
+// sub-ranges carry roughly equal shares of the memtable.
+static dht::partition_range_vector equal_token_span_ranges(unsigned n) {
+    dht::partition_range_vector ranges;
+    ranges.reserve(n);
+    const uint64_t step = std::numeric_limits<uint64_t>::max() / n;
+    std::optional<dht::token> prev;
+    auto lower_bound = [&prev] () -> std::optional<dht::token_range::bound> {
+        if (prev) {
+            return dht::token_range::bound(*prev, false);
+        }
+        return std::nullopt;
+    };
+    for (unsigned i = 1; i < n; ++i) {
+        auto t = dht::token::from_int64(int64_t(uint64_t(std::numeric_limits<int64_t>::min()) + step * i));
+        ranges.push_back(dht::to_partition_range(dht::token_range(lower_bound(), dht::token_range::bound(t, true))));
+        prev = t;
+    }
+    ranges.push_back(dht::to_partition_range(dht::token_range(lower_bound(), std::nullopt)));
+    return ranges;
+}
+
 future<>
 table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtable> old, sstable_write_permit&& permit) {
     auto try_flush = [this, old = std::move(old), permit = make_lw_shared(std::move(permit)), &cg] () mutable -> future<> {
@@ -844,16 +1007,35 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
         metadata.max_timestamp = old->get_max_timestamp();
         auto estimated_partitions = _compaction_strategy.adjust_partition_estimate(metadata, old->partition_count());
 
+        // A flush may optionally be partitioned by token into several
+        // concurrent output streams, each writing its own sstable over a
+        // disjoint token sub-range. The outputs share one run identifier, so
+        // they count as a single run for compaction purposes. Interposing
+        // strategies consume the whole stream themselves and keep the
+        // single-stream path.
+        unsigned flush_streams = 1;
+        if (auto configured = _config.memtable_flush_streams(); configured > 1 && !_compaction_strategy.use_interposer_consumer()) {
+            flush_streams = std::min<uint64_t>(configured, std::max<uint64_t>(old->partition_count() / min_partitions_per_flush_stream, 1));
+        }
+        auto stream_partition_estimate = std::max<uint64_t>(estimated_partitions / flush_streams, 1);
+        std::optional<sstables::run_id> flush_run;
+        if (flush_streams > 1) {
+            flush_run = sstables::run_id::create_random_id();
+        }
+
         if (!_async_gate.is_closed()) {
             co_await _compaction_manager.maybe_wait_for_sstable_count_reduction(cg.as_table_state());
         }
 
-        auto consumer = _compaction_strategy.make_interposer_consumer(metadata, [this, old, permit, &newtabs, metadata, estimated_partitions, &cg] (flat_mutation_reader_v2 reader) mutable -> future<> {
+        auto consumer = _compaction_strategy.make_interposer_consumer(metadata, [this, old, permit, &newtabs, metadata, stream_partition_estimate, flush_run, &cg] (flat_mutation_reader_v2 reader) mutable -> future<> {
           std::exception_ptr ex;
           try {
             auto&& priority = service::get_local_memtable_flush_priority();
             sstables::sstable_writer_config cfg = get_sstables_manager().configure_writer("memtable");
             cfg.backup = incremental_backups_enabled();
+            if (flush_run) {
+                cfg.run_identifier = *flush_run;
+            }
 
             auto newtab = make_sstable();
             newtabs.push_back(newtab);
@@ -862,7 +1044,7 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
             auto monitor = database_sstable_write_monitor(permit, newtab, cg,
                 old->get_max_timestamp());
 
-            co_return co_await write_memtable_to_sstable(std::move(reader), *old, newtab, estimated_partitions, monitor, cfg, priority);
+            co_return co_await write_memtable_to_sstable(std::move(reader), *old, newtab, stream_partition_estimate, monitor, cfg, priority);
           } catch (...) {
             ex = std::current_exception();
           }
@@ -870,15 +1052,47 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
           co_await coroutine::return_exception_ptr(std::move(ex));
         });
 
-        auto f = consumer(old->make_flush_reader(
-            old->schema(),
-            compaction_concurrency_semaphore().make_tracking_only_permit(old->schema().get(), "try_flush_memtable_to_sstable()", db::no_timeout),
-            service::get_local_memtable_flush_priority()));
+        const bool track_in_flush_filter = prepare_flush_run_filter(estimated_partitions);
+        if (track_in_flush_filter) {
+            ++_flush_run_filter_writers;
+        }
+        auto untrack_flush_filter = defer([this, track_in_flush_filter] () noexcept {
+            if (track_in_flush_filter) {
+                --_flush_run_filter_writers;
+            }
+        });
+        auto make_one_flush_reader = [this, &old, track_in_flush_filter] (const dht::partition_range& pr) {
+            auto rd = old->make_flush_reader(
+                old->schema(),
+                compaction_concurrency_semaphore().make_tracking_only_permit(old->schema().get(), "try_flush_memtable_to_sstable()", db::no_timeout),
+                service::get_local_memtable_flush_priority(),
+                pr);
+            // Record the flushed keys in the shared flush-run filter, so that
+            // one probe of it can later dismiss this flush's output together
+            // with its siblings on the single-partition read path.
+            if (track_in_flush_filter) {
+                rd = record_in_flush_run_filter(std::move(rd));
+            }
+            return rd;
+        };
+
+        // The flush readers keep pointers into this vector; it must stay
+        // alive until the flush completes.
+        dht::partition_range_vector flush_ranges;
+        future<> f = make_ready_future<>();
+        if (flush_streams == 1) {
+            f = consumer(make_one_flush_reader(query::full_partition_range));
+        } else {
+            flush_ranges = equal_token_span_ranges(flush_streams);
+            f = parallel_for_each(flush_ranges, [&consumer, &make_one_flush_reader] (const dht::partition_range& pr) {
+                return consumer(make_one_flush_reader(pr));
+            });
+        }
 
         // Switch back to default scheduling group for post-flush actions, to avoid them being staved by the memtable flush
         // controller. Cache update does not affect the input of the memtable cpu controller, so it can be subject to
         // priority inversion.
-        auto post_flush = [this, old = std::move(old), &newtabs, f = std::move(f), &cg] () mutable -> future<> {
+        auto post_flush = [this, old = std::move(old), &newtabs, f = std::move(f), track_in_flush_filter, &cg] () mutable -> future<> {
             try {
                 co_await std::move(f);
                 co_await coroutine::parallel_for_each(newtabs, [] (auto& newtab) -> future<> {
@@ -889,6 +1103,13 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
                 co_await with_scheduling_group(_config.memtable_to_cache_scheduling_group, [this, old, &newtabs, &cg] {
                     return update_cache(cg, old, newtabs);
                 });
+                if (track_in_flush_filter) {
+                    // Cover the new sstables only once the flush can no longer
+                    // fail and be retried; a failed attempt leaves its keys in
+                    // the filter (harmless false positives), but must not leave
+                    // generations behind that would never be compacted away.
+                    cover_by_flush_run_filter(newtabs);
+                }
                 cg.memtables()->erase(old);
                 tlogger.debug("Memtable for {}.{} replaced, into {} sstables", old->schema()->ks_name(), old->schema()->cf_name(), newtabs.size());
                 co_return;
@@ -948,6 +1169,7 @@ void table::set_metrics() {
                 ms::make_counter("memtable_rows_compacted_with_tombstones", _stats.memtable_app_stats.rows_compacted_with_tombstones, ms::description("Number of rows scanned during write of a tombstone for the purpose of compaction in memtables"))(cf)(ks).set_skip_when_empty(),
                 ms::make_counter("memtable_range_tombstone_reads", _stats.memtable_range_tombstone_reads, ms::description("Number of range tombstones read from memtables"))(cf)(ks).set_skip_when_empty(),
                 ms::make_counter("memtable_row_tombstone_reads", _stats.memtable_row_tombstone_reads, ms::description("Number of row tombstones read from memtables"))(cf)(ks),
+                ms::make_counter("write_dedup_suppressed", _stats.write_dedup_suppressed, ms::description("Number of writes suppressed by the duplicate-write filter"))(cf)(ks).set_skip_when_empty(),
                 ms::make_gauge("pending_tasks", ms::description("Estimated number of tasks pending for this column family"), _stats.pending_flushes)(cf)(ks),
                 ms::make_gauge("live_disk_space", ms::description("Live disk space used"), _stats.live_disk_space_used)(cf)(ks),
                 ms::make_gauge("total_disk_space", ms::description("Total disk space used"), _stats.total_disk_space_used)(cf)(ks),
@@ -1134,6 +1356,9 @@ compaction_group::update_main_sstable_list_on_compaction_completion(sstables::co
             _cg.set_main_sstables(std::move(_new_sstables));
             _t.refresh_compound_sstable_set();
             _cg.backlog_tracker_adjust_charges(_desc.old_sstables, _desc.new_sstables);
+            for (auto& sst : _desc.old_sstables) {
+                _t.forget_in_flush_run_filter(sst);
+            }
         }
         static std::unique_ptr<row_cache::external_updater_impl> make(compaction_group& cg, table::sstable_list_builder::permit_t permit, sstables::compaction_completion_desc& d) {
             return std::make_unique<sstable_list_updater>(cg, std::move(permit), d);
@@ -1458,7 +1683,16 @@ snapshot_source
 table::sstables_as_snapshot_source() {
     return snapshot_source([this] () {
         auto sst_set = _sstables;
-        return mutation_source([this, sst_set] (schema_ptr s,
+        // If no sstable in this snapshot contains tombstones or expiring
+        // cells, the compacting reader has nothing to drop or purge and its
+        // per-fragment processing is pure overhead, so skip it. Append-only
+        // workloads never pay the compaction tax on the read path this way.
+        // The decision is sound because the snapshot is immutable; a new
+        // snapshot is created whenever the sstable set changes.
+        const bool need_compacting = std::ranges::any_of(*sst_set->all(), [] (const sstables::shared_sstable& sst) {
+            return sst->may_have_tombstones();
+        });
+        return mutation_source([this, sst_set, need_compacting] (schema_ptr s,
                 reader_permit permit,
                 const dht::partition_range& r,
                 const query::partition_slice& slice,
@@ -1467,6 +1701,9 @@ table::sstables_as_snapshot_source() {
                 streamed_mutation::forwarding fwd,
                 mutation_reader::forwarding fwd_mr) {
             auto reader = make_sstable_reader(std::move(s), std::move(permit), sst_set, r, slice, pc, std::move(trace_state), fwd, fwd_mr);
+            if (!need_compacting) {
+                return reader;
+            }
             return make_compacting_reader(
                 std::move(reader),
                 gc_clock::now(),
@@ -1734,6 +1971,10 @@ future<> table::clear() {
     co_await parallel_foreach_compaction_group(std::mem_fn(&compaction_group::clear_memtables));
 
     co_await _cache.invalidate(row_cache::external_updater([] { /* There is no underlying mutation source */ }));
+
+    if (_config.result_cache) {
+        _config.result_cache->invalidate(_schema->id());
+    }
 }
 
 // NOTE: does not need to be futurized, but might eventually, depending on
@@ -1789,7 +2030,13 @@ future<db::replay_position> table::discard_sstables(db_clock::time_point truncat
         refresh_compound_sstable_set();
         tlogger.debug("cleaning out row cache");
     }));
+    if (_config.result_cache) {
+        _config.result_cache->invalidate(_schema->id());
+    }
     rebuild_statistics();
+    for (const auto& r : p->remove) {
+        forget_in_flush_run_filter(r.sst);
+    }
     co_await coroutine::parallel_for_each(p->remove, [this, p] (pruner::removed_sstable& r) {
         if (r.enable_backlog_tracker) {
             remove_sstable_from_backlog_tracker(r.cg.get_backlog_tracker(), r.sst);
@@ -2153,6 +2400,7 @@ void table::do_apply(compaction_group& cg, db::rp_handle&& h, Args&&... args) {
 future<> table::apply(const mutation& m, db::rp_handle&& h, db::timeout_clock::time_point timeout) {
     return dirty_memory_region_group().run_when_memory_available([this, &m, h = std::move(h)] () mutable {
         do_apply(compaction_group_for_token(m.token()), std::move(h), m);
+        invalidate_cached_query_results(m.key());
     }, timeout);
 }
 
@@ -2165,11 +2413,50 @@ future<> table::apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_hand
 
     return dirty_memory_region_group().run_when_memory_available([this, &m, m_schema = std::move(m_schema), h = std::move(h)]() mutable {
         do_apply(compaction_group_for_key(m.key(), m_schema), std::move(h), m, m_schema);
+        invalidate_cached_query_results(m.key());
     }, timeout);
 }
 
 template void table::do_apply(compaction_group& cg, db::rp_handle&&, const frozen_mutation&, const schema_ptr&);
 
+bool table::should_suppress_duplicate_write(const frozen_mutation& m) {
+    auto window = _config.write_dedup_window_size();
+    if (!window) {
+        if (!_recent_write_hashes.empty()) {
+            _recent_write_hashes.clear();
+            _recent_write_hash_set.clear();
+        }
+        return false;
+    }
+    // Counter updates are not idempotent, so they are never suppressed.
+    // Their serialized form carries fresh shard clocks anyway, so retries
+    // would not hash equal in the first place.
+    if (_schema->is_counter()) {
+        return false;
+    }
+    xx_hasher hasher;
+    for (bytes_view frag : m.representation().fragments()) {
+        hasher.update(reinterpret_cast<const char*>(frag.data()), frag.size());
+    }
+    auto hash = hasher.finalize_uint64();
+    if (!_recent_write_hash_set.insert(hash).second) {
+        ++_stats.write_dedup_suppressed;
+        return true;
+    }
+    _recent_write_hashes.push_back(hash);
+    while (_recent_write_hashes.size() > window) {
+        _recent_write_hash_set.erase(_recent_write_hashes.front());
+        _recent_write_hashes.pop_front();
+    }
+    return false;
+}
+
+void table::invalidate_cached_query_results(partition_key_view pk) {
+    if (_config.result_cache && _config.result_cache->enabled()) {
+        _config.result_cache->invalidate(_schema->id(), pk);
+    }
+}
+
 future<>
 write_memtable_to_sstable(flat_mutation_reader_v2 reader,
                           memtable& mt, sstables::shared_sstable sst,
@@ -2262,6 +2549,25 @@ table::query(schema_ptr s,
         _async_gate.leave();
     });
 
+    // Repeated identical point reads of hot partitions can be served from
+    // the query result cache, skipping the querier and the whole mutation
+    // fragment pipeline. Only plain single-partition reads without paging
+    // state are eligible; data and digest reads of the same page share an
+    // entry, so the quorum-read pattern of a data request closely followed
+    // by digest requests for the same page hits too.
+    query_result_cache* result_cache = _config.result_cache;
+    std::optional<query_result_cache::key> result_cache_key;
+    uint64_t result_cache_phase = 0;
+    if (result_cache && result_cache->enabled() && !saved_querier
+            && partition_ranges.size() == 1 && query::is_single_partition(partition_ranges.front())) {
+        const auto& pk = *partition_ranges.front().start()->value().key();
+        result_cache_key.emplace(*s, cmd, pk);
+        if (auto cached = result_cache->lookup(*result_cache_key, opts)) {
+            co_return cached;
+        }
+        result_cache_phase = result_cache->phase();
+    }
+
     const auto short_read_allowed = query::short_read(cmd.slice.options.contains<query::partition_slice::option::allow_short_read>());
     auto accounter = co_await (opts.request == query::result_request::only_digest
              ? memory_limiter.new_digest_read(permit.max_result_size(), short_read_allowed)
@@ -2312,7 +2618,11 @@ table::query(schema_ptr s,
         *saved_querier = std::move(querier_opt);
     }
 
-    co_return make_lw_shared<query::result>(qs.builder.build(std::move(last_pos)));
+    auto result = make_lw_shared<query::result>(qs.builder.build(std::move(last_pos)));
+    if (result_cache_key) {
+        result_cache->insert(result_cache_phase, std::move(*result_cache_key), *result, opts);
+    }
+    co_return result;
 }
 
 future<reconcilable_result>
@@ -24,6 +24,9 @@
 #include "readers/nonforwardable.hh"
 #include "cache_flat_mutation_reader.hh"
 #include "clustering_key_filter.hh"
+#include "frozen_mutation.hh"
+#include "mutation_rebuilder.hh"
+#include "readers/from_mutations_v2.hh"
 
 namespace cache {
 
@@ -66,6 +69,10 @@ cache_tracker::cache_tracker(mutation_application_stats& app_stats, register_met
         setup_metrics();
     }
 
+    // Cache entries are expensive to repopulate (they cost a disk read), so
+    // under memory pressure give up memory only after other regions have.
+    _region.set_reclaim_priority(logalloc::reclaim_priority::last);
+
     _region.make_evictable([this] {
         return with_allocator(_region.allocator(), [this] () noexcept {
             if (!_garbage.empty()) {
@@ -114,6 +121,7 @@ cache_tracker::setup_metrics() {
         sm::make_counter("partition_evictions", sm::description("total number of evicted partitions"), _stats.partition_evictions),
         sm::make_counter("partition_removals", sm::description("total number of invalidated partitions"), _stats.partition_removals),
         sm::make_counter("mispopulations", sm::description("number of entries not inserted by reads"), _stats.mispopulations),
+        sm::make_counter("population_budget_cutoffs", sm::description("number of times a read stopped populating the cache because it exhausted its population budget"), _stats.population_budget_cutoffs),
         sm::make_gauge("partitions", sm::description("total number of cached partitions"), _stats.partitions),
         sm::make_gauge("rows", sm::description("total number of cached rows"), _stats.rows),
         sm::make_counter("reads", sm::description("number of started reads"), _stats.reads),
@@ -133,6 +141,18 @@ cache_tracker::setup_metrics() {
             sm::description("total amount of range tombstones processed during read")),
         sm::make_counter("row_tombstone_reads", _stats.row_tombstone_reads,
             sm::description("total amount of row tombstones processed during read")),
+        sm::make_counter("compressed_tier_hits", sm::description("number of single-partition misses served from the compressed tier"),
+            [this] { return _compressed_tier.get_stats().hits; }),
+        sm::make_counter("compressed_tier_misses", sm::description("number of single-partition misses not found in the compressed tier"),
+            [this] { return _compressed_tier.get_stats().misses; }),
+        sm::make_counter("compressed_tier_insertions", sm::description("total number of partitions added to the compressed tier"),
+            [this] { return _compressed_tier.get_stats().insertions; }),
+        sm::make_counter("compressed_tier_evictions", sm::description("total number of partitions evicted from the compressed tier"),
+            [this] { return _compressed_tier.get_stats().evictions; }),
+        sm::make_gauge("compressed_tier_bytes_used", sm::description("current bytes used by the compressed tier"),
+            [this] { return _compressed_tier.get_stats().used_bytes; }),
+        sm::make_gauge("compressed_tier_partitions", sm::description("total number of partitions in the compressed tier"),
+            [this] { return _compressed_tier.get_stats().entries; }),
     });
 }
 
@@ -153,9 +173,17 @@ void cache_tracker::clear() {
     _stats.partition_removals += partitions_before;
     _stats.row_removals += rows_before;
     allocator().invalidate_references();
+    _compressed_tier.clear();
 }
 
 void cache_tracker::touch(rows_entry& e) {
+    // Row entries are deliberately never promoted to the protected LRU
+    // section. Eviction must remove rows from older MVCC versions before
+    // rows from newer ones (see docs/dev/row_cache.md), which holds as long
+    // as ordering within the probationary section reflects the order of the
+    // last touch/insertion. A protected entry could outlive a newer-version
+    // copy of the same row inserted later, breaking that invariant.
+    //
     // last dummy may not be linked if evicted
     if (e.is_linked()) {
         _lru.remove(e);
@@ -215,6 +243,10 @@ void cache_tracker::on_mispopulate() noexcept {
     ++_stats.mispopulations;
 }
 
+void cache_tracker::on_population_budget_cutoff() noexcept {
+    ++_stats.population_budget_cutoffs;
+}
+
 void cache_tracker::on_miss_already_populated() noexcept {
     ++_stats.concurrent_misses_same_key;
 }
@@ -358,11 +390,63 @@ class single_partition_populating_reader final : public flat_mutation_reader_v2:
     row_cache& _cache;
     std::unique_ptr<read_context> _read_context;
     flat_mutation_reader_v2_opt _reader;
+    // When engaged, fragments served by this read are accumulated so that
+    // the complete partition can be stored in the compressed tier once the
+    // read finishes.
+    std::optional<mutation_rebuilder_v2> _snapshot_builder;
+    size_t _snapshot_size = 0;
+    row_cache::phase_type _snapshot_phase;
+
+    // Partitions larger than this are not kept compressed; they are less
+    // likely to fit the tier's budget and more expensive to re-freeze.
+    static constexpr size_t max_compressed_tier_partition_size = 128 * 1024;
 private:
+    // True iff reading with this slice streams every fragment of the
+    // partition, so the result can be cached as a complete partition.
+    static bool slice_covers_whole_partition(const query::partition_slice& slice) {
+        return !slice.get_specific_ranges()
+            && slice.default_row_ranges().size() == 1
+            && slice.default_row_ranges().front().is_full();
+    }
     future<> create_reader() {
-        auto src_and_phase = _cache.snapshot_of(_read_context->range().start()->value());
-        auto phase = src_and_phase.phase;
-        _read_context->enter_partition(_read_context->range().start()->value().as_decorated_key(), src_and_phase.snapshot, phase);
+        auto& pos = _read_context->range().start()->value();
+        auto& tier = _cache._tracker.compressed_tier();
+        row_cache::phase_type phase;
+        mutation_source_opt promoted;
+        if (tier.enabled() && !_read_context->is_reversed()) {
+            if (auto m = tier.take(_cache.schema()->id(), pos.as_decorated_key())) {
+                // Serve and populate from the compressed copy instead of the
+                // underlying source. The tier is purged whenever the
+                // underlying source changes, so the copy reflects the
+                // current snapshot.
+                promoted = mutation_source([m = std::move(*m)] (schema_ptr s,
+                        reader_permit permit,
+                        const dht::partition_range&,
+                        const query::partition_slice& slice,
+                        const io_priority_class&,
+                        tracing::trace_state_ptr,
+                        streamed_mutation::forwarding fwd,
+                        mutation_reader::forwarding) {
+                    mutation m2 = m;
+                    if (m2.schema() != s) {
+                        m2.upgrade(s);
+                    }
+                    return make_flat_mutation_reader_from_mutations_v2(std::move(s), std::move(permit), std::move(m2), slice, fwd);
+                });
+            }
+        }
+        if (promoted) {
+            phase = _cache.phase_of(pos);
+            _read_context->enter_partition(pos.as_decorated_key(), *promoted, phase);
+        } else {
+            auto src_and_phase = _cache.snapshot_of(pos);
+            phase = src_and_phase.phase;
+            _read_context->enter_partition(pos.as_decorated_key(), src_and_phase.snapshot, phase);
+            if (tier.enabled() && !_read_context->is_reversed() && slice_covers_whole_partition(_read_context->slice())) {
+                _snapshot_builder.emplace(_read_context->schema());
+                _snapshot_phase = phase;
+            }
+        }
         return _read_context->create_underlying().then([this, phase] {
           return _read_context->underlying().underlying()().then([this, phase] (auto&& mfopt) {
             if (!mfopt) {
@@ -381,12 +465,43 @@ private:
                 });
             } else {
                 _cache._tracker.on_mispopulate();
+                _snapshot_builder.reset();
                 _reader = read_directly_from_underlying(*_read_context);
                 this->push_mutation_fragment(std::move(*mfopt));
             }
           });
         });
     }
+    void capture_new_fragments(size_t from) {
+        if (!_snapshot_builder) {
+            return;
+        }
+        const auto& buf = buffer();
+        for (auto i = from; i < buf.size(); ++i) {
+            const mutation_fragment_v2& mf = buf[i];
+            _snapshot_size += mf.memory_usage();
+            if (_snapshot_size > max_compressed_tier_partition_size) {
+                _snapshot_builder.reset();
+                return;
+            }
+            _snapshot_builder->consume(mutation_fragment_v2(*_schema, _permit, mf));
+        }
+    }
+    void store_in_compressed_tier() {
+        if (!_snapshot_builder) {
+            return;
+        }
+        auto m = _snapshot_builder->consume_end_of_stream();
+        _snapshot_builder.reset();
+        if (!m) {
+            return;
+        }
+        if (_cache.phase_of(_read_context->range().start()->value()) != _snapshot_phase) {
+            _cache._tracker.on_mispopulate();
+            return;
+        }
+        _cache._tracker.compressed_tier().insert(m->schema(), m->decorated_key(), freeze(*m));
+    }
 public:
     single_partition_populating_reader(row_cache& cache,
             std::unique_ptr<read_context> context)
@@ -405,9 +520,12 @@ public:
             });
         }
         return do_until([this] { return is_end_of_stream() || is_buffer_full(); }, [this] {
-            return fill_buffer_from(*_reader).then([this] (bool reader_finished) {
+            auto size_before = buffer().size();
+            return fill_buffer_from(*_reader).then([this, size_before] (bool reader_finished) {
+                capture_new_fragments(size_before);
                 if (reader_finished) {
                     _end_of_stream = true;
+                    store_in_compressed_tier();
                 }
             });
         });
@@ -416,12 +534,14 @@ public:
         if (_reader) {
             clear_buffer();
             _end_of_stream = true;
+            _snapshot_builder.reset();
         }
         return make_ready_future<>();
     }
     virtual future<> fast_forward_to(const dht::partition_range&) override {
         clear_buffer();
         _end_of_stream = true;
+        _snapshot_builder.reset();
         return make_ready_future<>();
     }
     virtual future<> fast_forward_to(position_range pr) override {
@@ -775,6 +895,7 @@ row_cache::make_reader_opt(schema_ptr s,
 }
 
 row_cache::~row_cache() {
+    _tracker.compressed_tier().invalidate(_schema->id());
     with_allocator(_tracker.allocator(), [this] {
         _partitions.clear_and_dispose([this] (cache_entry* p) mutable noexcept {
             if (!p->is_dummy_entry()) {
@@ -1016,6 +1137,9 @@ future<> row_cache::do_update(external_updater eu, replica::memtable& m, Updater
 }
 
 future<> row_cache::update(external_updater eu, replica::memtable& m) {
+    // The underlying snapshot is about to change; compressed copies of
+    // partitions modified by this memtable would no longer be complete.
+    _tracker.compressed_tier().invalidate(_schema->id());
     return do_update(std::move(eu), m, [this] (logalloc::allocating_section& alloc,
             row_cache::partitions_type::iterator cache_i, replica::memtable_entry& mem_e, partition_presence_checker& is_present,
             real_dirty_memory_accounter& acc, const partitions_type::bound_hint& hint) mutable {
@@ -1049,6 +1173,7 @@ future<> row_cache::update(external_updater eu, replica::memtable& m) {
 }
 
 future<> row_cache::update_invalidating(external_updater eu, replica::memtable& m) {
+    _tracker.compressed_tier().invalidate(_schema->id());
     return do_update(std::move(eu), m, [this] (logalloc::allocating_section& alloc,
         row_cache::partitions_type::iterator cache_i, replica::memtable_entry& mem_e, partition_presence_checker& is_present,
         real_dirty_memory_accounter& acc, const partitions_type::bound_hint&)
@@ -1084,6 +1209,38 @@ void row_cache::touch(const dht::decorated_key& dk) {
  });
 }
 
+std::vector<bool> row_cache::probe(const std::vector<dht::decorated_key>& keys) {
+    auto cmp = dht::ring_position_comparator(*_schema);
+    std::vector<bool> present(keys.size(), false);
+    _read_section(_tracker.region(), [&] {
+        // Keys close in ring order usually sit in the same or a neighbouring
+        // leaf, so try a short forward walk from the previous position before
+        // paying for a full root-to-leaf descent.
+        constexpr int max_forward_steps = 8;
+        auto end = partitions_end();
+        partitions_type::iterator i;
+        bool have_pos = false;
+        for (size_t k = 0; k < keys.size(); ++k) {
+            const auto& key = keys[k];
+            if (have_pos) {
+                int steps = 0;
+                while (i != end && cmp(i->position(), key) < 0 && steps++ < max_forward_steps) {
+                    ++i;
+                }
+                if (i != end && cmp(i->position(), key) < 0) {
+                    have_pos = false;
+                }
+            }
+            if (!have_pos) {
+                i = _partitions.lower_bound(key, cmp);
+                have_pos = true;
+            }
+            present[k] = i != end && i->key().equal(*_schema, key);
+        }
+    });
+    return present;
+}
+
 void row_cache::unlink_from_lru(const dht::decorated_key& dk) {
     _read_section(_tracker.region(), [&] {
         auto i = _partitions.find(dk, dht::ring_position_comparator(*_schema));
@@ -1123,6 +1280,9 @@ future<> row_cache::invalidate(external_updater eu, const dht::partition_range&
 }
 
 future<> row_cache::invalidate(external_updater eu, dht::partition_range_vector&& ranges) {
+    for (auto&& range : ranges) {
+        _tracker.compressed_tier().invalidate(_schema->id(), range);
+    }
     return do_update(std::move(eu), [this, ranges = std::move(ranges)] {
         return seastar::async([this, ranges = std::move(ranges)] {
             auto on_failure = defer([this] () noexcept {
@@ -1179,6 +1339,21 @@ void row_cache::evict() {
     while (_tracker.region().evict_some() == memory::reclaiming_result::reclaimed_something) {}
 }
 
+std::vector<dht::decorated_key> row_cache::cached_partition_keys(size_t max) {
+    std::vector<dht::decorated_key> keys;
+    _read_section(_tracker.region(), [&] {
+        // No deferring points, so the iteration is not disturbed by eviction
+        // or updates. Keep max reasonably small, this is linear work.
+        for (auto it = _partitions.begin(); it != partitions_end() && keys.size() < max; ++it) {
+            if (!it->is_dummy_entry()) {
+                // The copy also moves the key out of the LSA region.
+                keys.emplace_back(it->key());
+            }
+        }
+    });
+    return keys;
+}
+
 row_cache::row_cache(schema_ptr s, snapshot_source src, cache_tracker& tracker, is_continuous cont)
     : _tracker(tracker)
     , _schema(std::move(s))
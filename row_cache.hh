@@ -421,6 +421,17 @@ public:
     // Moves given partition to the front of LRU if present in cache.
     void touch(const dht::decorated_key&);
 
+    // Probes the cache for all of `keys` in one pass. `keys` must be sorted
+    // in ring order. Bit i of the result is set when keys[i] has an entry in
+    // the cache; rows of that partition may still be incomplete, so a set bit
+    // promises a cheap read start, not that sstables won't be touched at all.
+    //
+    // The whole batch runs under a single read section, and consecutive keys
+    // landing close in the ring are located by walking forward from the
+    // previous position instead of a fresh tree descent. No iterators are
+    // returned - they wouldn't survive the first eviction or deferring point.
+    std::vector<bool> probe(const std::vector<dht::decorated_key>& keys);
+
     // Detaches current contents of given partition from LRU, so
     // that they are not evicted by memory reclaimer.
     void unlink_from_lru(const dht::decorated_key&);
@@ -449,6 +460,12 @@ public:
     // If it did, use invalidate() instead.
     void evict();
 
+    // Returns the keys of up to `max` cached partitions, in ring order.
+    // The result is a snapshot and can go stale as soon as the cache is
+    // updated or entries are evicted. Used for saving the cache's warm
+    // state, so that the partitions can be re-read after a restart.
+    std::vector<dht::decorated_key> cached_partition_keys(size_t max);
+
     const cache_tracker& get_cache_tracker() const {
         return _tracker;
     }
@@ -32,6 +32,7 @@
 #include "cdc/cdc_extension.hh"
 #include "tombstone_gc_extension.hh"
 #include "db/paxos_grace_seconds_extension.hh"
+#include "db/disable_commitlog_extension.hh"
 #include "utils/rjson.hh"
 #include "tombstone_gc_options.hh"
 #include "db/per_partition_rate_limit_extension.hh"
@@ -1316,6 +1317,12 @@ schema_ptr schema_builder::build() {
             dynamic_pointer_cast<db::paxos_grace_seconds_extension>(it->second)->get_paxos_grace_seconds();
     }
 
+    // cache the `disable_commitlog` flag for fast access on the write path.
+    if (auto it = new_raw._extensions.find(db::disable_commitlog_extension::NAME); it != new_raw._extensions.end()) {
+        new_raw._commitlog_disabled =
+            dynamic_pointer_cast<db::disable_commitlog_extension>(it->second)->is_disabled();
+    }
+
     // cache the `per_partition_rate_limit` parameters for fast access through the schema object.
     if (auto it = new_raw._extensions.find(db::per_partition_rate_limit_extension::NAME); it != new_raw._extensions.end()) {
         new_raw._per_partition_rate_limit_options =
@@ -602,6 +602,7 @@ private:
         cf_type _type = cf_type::standard;
         int32_t _gc_grace_seconds = DEFAULT_GC_GRACE_SECONDS;
         std::optional<int32_t> _paxos_grace_seconds;
+        bool _commitlog_disabled = false;
         double _dc_local_read_repair_chance = 0.0;
         double _read_repair_chance = 0.0;
         double _crc_check_chance = 1;
@@ -747,6 +748,12 @@ public:
 
     gc_clock::duration paxos_grace_seconds() const;
 
+    // True iff the `disable_commitlog` extension asks for mutations of this
+    // table to be applied to memtables only.
+    bool commitlog_disabled() const {
+        return _raw._commitlog_disabled;
+    }
+
     double dc_local_read_repair_chance() const {
         return _raw._dc_local_read_repair_chance;
     }
@@ -244,6 +244,8 @@ future<> service::client_state::maybe_update_per_service_level_params() {
         auto& role_manager = _auth_service->underlying_role_manager();
         auto role_set = co_await role_manager.query_granted(_user->name.value(), auth::recursive_role_query::yes);
         auto slo_opt = co_await _sl_controller->find_service_level(role_set);
+        auto sl_name = co_await _sl_controller->find_effective_service_level_name(role_set);
+        _service_level_name = sl_name.value_or(qos::service_level_controller::default_service_level_name);
         if (!slo_opt) {
             co_return;
         }
@@ -126,6 +126,12 @@ private:
 
     workload_type _workload_type = workload_type::unspecified;
 
+    // The name of the service level in effect for this session, for
+    // attributing the CPU time its statements consume. Empty until the
+    // session logs in and matches a service level; the controller treats
+    // an empty name as the default service level.
+    sstring _service_level_name;
+
 public:
     struct internal_tag {};
     struct external_tag {};
@@ -185,6 +191,15 @@ public:
         return *_sl_controller;
     }
 
+    // May return nullptr - internal client states have no controller.
+    qos::service_level_controller* get_service_level_controller_ptr() const {
+        return _sl_controller;
+    }
+
+    const sstring& get_service_level_name() const {
+        return _service_level_name;
+    }
+
     client_state(internal_tag) : client_state(internal_tag{}, infinite_timeout_config)
     {}
 
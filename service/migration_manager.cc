@@ -1095,6 +1095,16 @@ future<schema_ptr> migration_manager::get_schema_for_write(table_schema_version
         return make_exception_future<schema_ptr>(abort_requested_exception());
     }
 
+    // Fast path: every remote read and write resolves its schema version
+    // here, and in steady state that version is already loaded and synced.
+    // Answer straight from the registry in that case, skipping the loader
+    // and syncer std::function allocations of the slow path below.
+    if (auto s = local_schema_registry().get_or_null(v); s && s->is_synced()) {
+        if (!s->is_view() || s->view_info()->base_info()) {
+            return make_ready_future<schema_ptr>(std::move(s));
+        }
+    }
+
     return get_schema_definition(v, dst, ms, _storage_proxy).then([this, dst] (schema_ptr s) {
         return maybe_sync(s, dst).then([s] {
             return s;
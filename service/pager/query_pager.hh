@@ -75,6 +75,9 @@ protected:
     paging_state::replicas_per_token_range _last_replicas;
     std::optional<db::read_repair_decision> _query_read_repair_decision;
     uint64_t _rows_fetched_for_last_partition = 0;
+    // Running estimate of the serialized size of one row of this query,
+    // fed by the pages already served. 0 until the first page completes.
+    uint64_t _avg_row_size = 0;
     stats _stats;
 public:
     query_pager(service::storage_proxy& p, schema_ptr s, shared_ptr<const cql3::selection::selection> selection,
@@ -142,6 +145,31 @@ protected:
     future<result<service::storage_proxy_coordinator_query_result>>
     do_fetch_page(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout);
 
+    // Trims cmd and ranges past the current pager position (_last_pkey/_last_pos)
+    // and applies the page's row limits, exactly as do_fetch_page() does before
+    // issuing the read. Not idempotent for a given position, so lookahead must
+    // run it on copies.
+    void prepare_next_page_command(query::read_command& cmd, dht::partition_range_vector& ranges, uint32_t page_size);
+
+    // Consumes the page stashed by maybe_prefetch_next_page() for this query,
+    // if there is one and it matches the position we are resuming from.
+    std::optional<service::storage_proxy_coordinator_query_result> take_prefetched_page(uint32_t page_size);
+
+    // If the query_page_prefetch option is enabled and this query is not
+    // exhausted, speculatively reads the next page in the background and
+    // stashes the raw result for the fetch_page() which serves it. The
+    // speculative read reuses the replica-side cached querier, so by the time
+    // the client asks for the page it is a pure memory hit. Call after
+    // handle_result() has advanced the pager position.
+    void maybe_prefetch_next_page(uint32_t page_size);
+
+    // Caps the client's requested row count so that the page is expected to
+    // stay within the query_page_size_in_bytes budget, based on the average
+    // row size observed on the pages served so far. The first page of a query
+    // has no estimate yet and keeps the requested size; it is still bounded
+    // by max_result_size short reads.
+    uint32_t effective_page_size(uint32_t page_size) const;
+
     template<typename Visitor>
     requires query::ResultVisitor<Visitor>
     void handle_result(Visitor&& visitor,
@@ -152,7 +180,7 @@ protected:
         return std::min(_max, static_cast<uint64_t>(page_size));
     }
 
-    virtual void maybe_adjust_per_partition_limit(uint32_t page_size) const { }
+    virtual void maybe_adjust_per_partition_limit(query::partition_slice& slice, uint32_t page_size) const { }
 };
 
 }
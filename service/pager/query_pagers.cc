@@ -8,12 +8,17 @@
  * SPDX-License-Identifier: (AGPL-3.0-or-later and Apache-2.0)
  */
 
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/with_scheduling_group.hh>
+
 #include "query_pagers.hh"
 #include "query_pager.hh"
 #include "cql3/selection/selection.hh"
 #include "cql3/query_options.hh"
 #include "cql3/restrictions/statement_restrictions.hh"
 #include "log.hh"
+#include "replica/database.hh"
+#include "db/config.hh"
 #include "service/storage_proxy.hh"
 #include "to_string.hh"
 #include "utils/result_combinators.hh"
@@ -59,16 +64,45 @@ query_pager::query_pager(service::storage_proxy& p, schema_ptr s,
                 , _ranges(std::move(ranges))
 {}
 
+// A page read speculatively after its predecessor was served, waiting for the
+// client to ask for it. Entries are consumed (or invalidated) by the first
+// fetch_page() resuming the same query on this shard, and expire so that an
+// abandoned paging session does not pin result memory for long.
+struct prefetched_page {
+    service::storage_proxy::coordinator_query_result result;
+    // The pager position the speculative read resumed from; the result may
+    // only be served to a fetch_page() resuming from the very same position.
+    partition_key start_pkey;
+    position_in_partition start_pos;
+    uint32_t page_size;
+    db::consistency_level cl;
+    lowres_clock::time_point expires_at;
+};
+
+static constexpr size_t max_prefetched_pages = 16;
+static constexpr auto prefetched_page_ttl = std::chrono::seconds(30);
+
+static thread_local std::unordered_map<query_id, prefetched_page> prefetched_pages;
+
+static void expire_prefetched_pages() {
+    const auto now = lowres_clock::now();
+    std::erase_if(prefetched_pages, [now] (const auto& e) {
+        return now > e.second.expires_at;
+    });
+}
+
+uint32_t query_pager::effective_page_size(uint32_t page_size) const {
+    const uint64_t target = _proxy->local_db().get_config().query_page_size_in_bytes();
+    if (!target || !_avg_row_size) {
+        return page_size;
+    }
+    const uint64_t rows_within_target = std::max<uint64_t>(target / _avg_row_size, 1);
+    return static_cast<uint32_t>(std::min<uint64_t>(page_size, rows_within_target));
+}
+
 future<result<service::storage_proxy::coordinator_query_result>> query_pager::do_fetch_page(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout) {
     auto state = _options.get_paging_state();
 
-    // Most callers should set this but we want to make sure, as results
-    // won't be paged without it.
-    _cmd->slice.options.set<query::partition_slice::option::allow_short_read>();
-    // Override this, to make sure we use the value appropriate for paging
-    // (with allow_short_read set).
-    _cmd->max_result_size = _proxy->get_max_result_size(_cmd->slice);
-
     if (!_last_pkey && state) {
         _max = state->get_remaining();
         _last_pkey = state->get_partition_key();
@@ -87,11 +121,34 @@ future<result<service::storage_proxy::coordinator_query_result>> query_pager::do
 
     qlogger.trace("fetch_page query id {}", _cmd->query_uuid);
 
+    prepare_next_page_command(*_cmd, _ranges, page_size);
+
+    if (auto prefetched = take_prefetched_page(page_size)) {
+        return make_ready_future<result<service::storage_proxy::coordinator_query_result>>(std::move(*prefetched));
+    }
+
+    auto ranges = _ranges;
+    auto command = ::make_lw_shared<query::read_command>(*_cmd);
+    return _proxy->query_result(_schema,
+            std::move(command),
+            std::move(ranges),
+            _options.get_consistency(),
+            {timeout, _state.get_permit(), _state.get_client_state(), _state.get_trace_state(), std::move(_last_replicas), _query_read_repair_decision});
+}
+
+void query_pager::prepare_next_page_command(query::read_command& cmd, dht::partition_range_vector& ranges, uint32_t page_size) {
+    // Most callers should set this but we want to make sure, as results
+    // won't be paged without it.
+    cmd.slice.options.set<query::partition_slice::option::allow_short_read>();
+    // Override this, to make sure we use the value appropriate for paging
+    // (with allow_short_read set).
+    cmd.max_result_size = _proxy->get_max_result_size(cmd.slice);
+
     if (_last_pkey) {
         auto dpk = dht::decorate_key(*_schema, *_last_pkey);
         dht::ring_position lo(dpk);
 
-        auto reversed = _cmd->slice.options.contains<query::partition_slice::option::reversed>();
+        auto reversed = cmd.slice.options.contains<query::partition_slice::option::reversed>();
 
         qlogger.trace("PKey={}, Pos={}, reversed={}", dpk, _last_pos, reversed);
 
@@ -146,10 +203,10 @@ future<result<service::storage_proxy::coordinator_query_result>> query_pager::do
 
         // If we have no clustering keys, it should mean we only have one row
         // per PK. Thus we can just bypass the last one.
-        modify_ranges(_ranges, lo, has_ck, dht::ring_position_comparator(*_schema));
+        modify_ranges(ranges, lo, has_ck, dht::ring_position_comparator(*_schema));
 
         if (has_ck) {
-            query::clustering_row_ranges row_ranges = _cmd->slice.default_row_ranges();
+            query::clustering_row_ranges row_ranges = cmd.slice.default_row_ranges();
             position_in_partition next_pos = _last_pos;
             if (_last_pos.has_key()) {
                 next_pos = reversed ? position_in_partition::before_key(_last_pos)
@@ -157,33 +214,91 @@ future<result<service::storage_proxy::coordinator_query_result>> query_pager::do
             }
             query::trim_clustering_row_ranges_to(*_schema, row_ranges, next_pos, reversed);
 
-            _cmd->slice.set_range(*_schema, *_last_pkey, row_ranges);
+            cmd.slice.set_range(*_schema, *_last_pkey, row_ranges);
         }
     }
 
     auto max_rows = max_rows_to_fetch(page_size);
 
     // We always need PK so we can determine where to start next.
-    _cmd->slice.options.set<query::partition_slice::option::send_partition_key>();
+    cmd.slice.options.set<query::partition_slice::option::send_partition_key>();
     // don't add empty bytes (cks) unless we have to
     if (_has_clustering_keys) {
-        _cmd->slice.options.set<
+        cmd.slice.options.set<
                 query::partition_slice::option::send_clustering_key>();
     }
-    _cmd->set_row_limit(max_rows);
-    maybe_adjust_per_partition_limit(page_size);
+    cmd.set_row_limit(max_rows);
+    maybe_adjust_per_partition_limit(cmd.slice, page_size);
 
     qlogger.debug("Fetching {}, page size={}, max_rows={}",
-            _cmd->cf_id, page_size, max_rows
+            cmd.cf_id, page_size, max_rows
             );
+}
+
+std::optional<service::storage_proxy::coordinator_query_result> query_pager::take_prefetched_page(uint32_t page_size) {
+    if (!_last_pkey) {
+        return std::nullopt;
+    }
+    auto it = prefetched_pages.find(*_query_uuid);
+    if (it == prefetched_pages.end()) {
+        return std::nullopt;
+    }
+    // Consume-once: whether we can serve it or not, the entry is spent.
+    auto entry = std::move(it->second);
+    prefetched_pages.erase(it);
+    if (lowres_clock::now() > entry.expires_at
+            || entry.page_size != page_size
+            || entry.cl != _options.get_consistency()
+            || !entry.start_pkey.equal(*_schema, *_last_pkey)
+            || !position_in_partition::equal_compare(*_schema)(entry.start_pos, _last_pos)) {
+        qlogger.trace("Dropping unusable prefetched page for {}", *_query_uuid);
+        return std::nullopt;
+    }
+    qlogger.trace("Serving prefetched page for {}", *_query_uuid);
+    return std::move(entry.result);
+}
 
+void query_pager::maybe_prefetch_next_page(uint32_t page_size) {
+    if (_exhausted || !_query_uuid || !_last_pkey) {
+        return;
+    }
+    if (!_proxy->local_db().get_config().query_page_prefetch()) {
+        return;
+    }
+    expire_prefetched_pages();
+    if (prefetched_pages.size() >= max_prefetched_pages || prefetched_pages.contains(*_query_uuid)) {
+        return;
+    }
+    // Prepare the next page's command exactly as the fetch_page() resuming
+    // from the state we just handed out will, but on copies -- the trimming
+    // is not idempotent and this pager may still serve further fetch_page()
+    // calls of its own.
+    auto cmd = ::make_lw_shared<query::read_command>(*_cmd);
     auto ranges = _ranges;
-    auto command = ::make_lw_shared<query::read_command>(*_cmd);
-    return _proxy->query_result(_schema,
-            std::move(command),
-            std::move(ranges),
-            _options.get_consistency(),
-            {timeout, _state.get_permit(), _state.get_client_state(), _state.get_trace_state(), std::move(_last_replicas), _query_read_repair_decision});
+    prepare_next_page_command(*cmd, ranges, page_size);
+
+    // The request which triggered the lookahead is done, so the speculative
+    // read runs on its own (fresh) timeout and permit, and under the
+    // streaming scheduling group so that it cannot crowd out foreground
+    // statements.
+    const auto timeout = db::timeout_clock::now() + std::chrono::milliseconds(_proxy->local_db().get_config().read_request_timeout_in_ms());
+    qlogger.trace("Prefetching next page for {}", *_query_uuid);
+    (void)with_scheduling_group(_proxy->local_db().get_streaming_scheduling_group(),
+            [proxy = _proxy, schema = _schema, cmd = std::move(cmd), ranges = std::move(ranges),
+                    cl = _options.get_consistency(), timeout, replicas = _last_replicas,
+                    read_repair_decision = _query_read_repair_decision] () mutable {
+        return proxy->query_result(std::move(schema), std::move(cmd), std::move(ranges), cl,
+                {timeout, empty_service_permit(), client_state::for_internal_calls(), tracing::trace_state_ptr(), std::move(replicas), read_repair_decision});
+    }).then([uuid = *_query_uuid, start_pkey = *_last_pkey, start_pos = _last_pos, page_size,
+            cl = _options.get_consistency()] (result<service::storage_proxy::coordinator_query_result> qr) mutable {
+        if (!qr || prefetched_pages.size() >= max_prefetched_pages) {
+            return;
+        }
+        prefetched_pages.emplace(uuid, prefetched_page{std::move(qr).value(), std::move(start_pkey), std::move(start_pos),
+                page_size, cl, lowres_clock::now() + prefetched_page_ttl});
+    }).handle_exception([uuid = *_query_uuid] (std::exception_ptr ep) {
+        qlogger.trace("Prefetch of next page for {} failed: {}", uuid, ep);
+    });
 }
 
 future<> query_pager::fetch_page(cql3::selection::result_set_builder& builder, uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout) {
@@ -192,12 +307,14 @@ future<> query_pager::fetch_page(cql3::selection::result_set_builder& builder, u
 }
 
 future<result<>> query_pager::fetch_page_result(cql3::selection::result_set_builder& builder, uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout) {
+    page_size = effective_page_size(page_size);
     return do_fetch_page(page_size, now, timeout).then(utils::result_wrap([this, &builder, page_size, now] (service::storage_proxy::coordinator_query_result qr) {
         _last_replicas = std::move(qr.last_replicas);
         _query_read_repair_decision = qr.read_repair_decision;
         return builder.with_thread_if_needed([this, &builder, page_size, now, qr = std::move(qr)] () mutable -> result<> {
             handle_result(cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection),
                           std::move(qr.query_result), page_size, now);
+            maybe_prefetch_next_page(page_size);
             return bo::success();
         });
     }));
@@ -229,10 +346,12 @@ future<cql3::result_generator> query_pager::fetch_page_generator(uint32_t page_s
 }
 
 future<result<cql3::result_generator>> query_pager::fetch_page_generator_result(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout, cql3::cql_stats& stats) {
+    page_size = effective_page_size(page_size);
     return do_fetch_page(page_size, now, timeout).then(utils::result_wrap([this, page_size, now, &stats] (service::storage_proxy::coordinator_query_result qr) -> future<result<cql3::result_generator>> {
         _last_replicas = std::move(qr.last_replicas);
         _query_read_repair_decision = qr.read_repair_decision;
         handle_result(noop_visitor(), qr.query_result, page_size, now);
+        maybe_prefetch_next_page(page_size);
         return make_ready_future<result<cql3::result_generator>>(cql3::result_generator(_schema, std::move(qr.query_result), _cmd, _selection, stats));
     }));
 }
@@ -252,6 +371,7 @@ public:
     virtual ~filtering_query_pager() {}
 
     virtual future<result<>> fetch_page_result(cql3::selection::result_set_builder& builder, uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout) override {
+        page_size = effective_page_size(page_size);
         return do_fetch_page(page_size, now, timeout).then(utils::result_wrap([this, &builder, page_size, now] (service::storage_proxy::coordinator_query_result qr) {
             _last_replicas = std::move(qr.last_replicas);
             _query_read_repair_decision = qr.read_repair_decision;
@@ -261,6 +381,7 @@ public:
                 handle_result(cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection,
                             cql3::selection::result_set_builder::restrictions_filter(_filtering_restrictions, _options, _max, _schema, _per_partition_limit, _last_pkey, _rows_fetched_for_last_partition)),
                             std::move(query_result), page_size, now);
+                maybe_prefetch_next_page(page_size);
                 return bo::success();
             });
         }));
@@ -271,8 +392,8 @@ protected:
         return static_cast<uint64_t>(page_size);
     }
 
-    virtual void maybe_adjust_per_partition_limit(uint32_t page_size) const override {
-        _cmd->slice.set_partition_row_limit(page_size);
+    virtual void maybe_adjust_per_partition_limit(query::partition_slice& slice, uint32_t page_size) const override {
+        slice.set_partition_row_limit(page_size);
     }
 };
 
@@ -301,6 +422,7 @@ public:
     virtual ~ghost_row_deleting_query_pager() {}
 
     virtual future<result<>> fetch_page_result(cql3::selection::result_set_builder& builder, uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout) override {
+        page_size = effective_page_size(page_size);
         return do_fetch_page(page_size, now, timeout).then(utils::result_wrap([this, &builder, page_size, now] (service::storage_proxy::coordinator_query_result qr) {
             _last_replicas = std::move(qr.last_replicas);
             _query_read_repair_decision = qr.read_repair_decision;
@@ -374,6 +496,7 @@ void query_pager::handle_result(
 
     _last_pos = position_in_partition::for_partition_start();
     uint64_t row_count;
+    uint64_t fetched_rows;
     if constexpr(!std::is_same_v<std::decay_t<Visitor>, noop_visitor>) {
         query_result_visitor<Visitor> v(std::forward<Visitor>(visitor));
         view.consume(_cmd->slice, v);
@@ -383,6 +506,7 @@ void query_pager::handle_result(
         }
 
         row_count = v.total_rows - v.dropped_rows;
+        fetched_rows = v.total_rows;
         _max = _max - row_count;
         _exhausted = (v.total_rows < page_size && !results->is_short_read() && v.dropped_rows == 0) || _max == 0;
         // If per partition limit is defined, we need to accumulate rows fetched for last partition key if the key matches
@@ -405,6 +529,7 @@ void query_pager::handle_result(
         }
     } else {
         row_count = results->row_count() ? *results->row_count() : std::get<1>(view.count_partitions_and_rows());
+        fetched_rows = row_count;
         _max = _max - row_count;
         _exhausted = (row_count < page_size && !results->is_short_read()) || _max == 0;
 
@@ -418,6 +543,16 @@ void query_pager::handle_result(
         }
     }
 
+    if (fetched_rows) {
+        // Re-estimate the average row size from what this page actually
+        // cost; effective_page_size() uses it to cap the next page. Smooth
+        // over the previous estimate so one outlier page does not swing the
+        // page size wildly. Sizes are of rows as fetched, before filtering
+        // drops any - that is what the next read will pay for.
+        const uint64_t page_avg = results->buf().size() / fetched_rows;
+        _avg_row_size = _avg_row_size ? (_avg_row_size + page_avg) / 2 : page_avg;
+    }
+
     qlogger.debug("Fetched {} rows, max_remain={} {}", row_count, _max, _exhausted ? "(exh)" : "");
 
     if (_last_pkey) {
@@ -16,6 +16,7 @@
 #include "replica/database.hh"
 
 #include "utils/error_injection.hh"
+#include "utils/hash.hh"
 
 #include "db/schema_tables.hh"
 #include "service/migration_manager.hh"
@@ -37,6 +38,71 @@ void paxos_state::key_lock_map::release_semaphore_for_key(const dht::token& key)
     }
 }
 
+// See the comment about the paxos state cache in paxos_state.hh.
+struct cached_paxos_state {
+    paxos_state state;
+    gc_clock::time_point expires_at;
+};
+
+using paxos_state_cache_key = std::pair<table_id, bytes>;
+
+static constexpr size_t max_cached_paxos_states = 1000;
+// Columns of the paxos table are written with a TTL, and the cache must not
+// keep serving them long after a read from the table would have dropped them
+// as expired, so entries get a short lifetime of their own.
+static constexpr gc_clock::duration paxos_state_cache_entry_ttl = std::chrono::seconds(10);
+
+static thread_local std::unordered_map<paxos_state_cache_key, cached_paxos_state, utils::tuple_hash> paxos_state_cache;
+
+static paxos_state_cache_key make_paxos_state_cache_key(const schema& s, partition_key_view key) {
+    return paxos_state_cache_key(s.id(), to_bytes(key.representation()));
+}
+
+std::optional<paxos_state> paxos_state::get_cached_state(const schema& s, partition_key_view key, gc_clock::time_point now) {
+    auto it = paxos_state_cache.find(make_paxos_state_cache_key(s, key));
+    if (it == paxos_state_cache.end()) {
+        return std::nullopt;
+    }
+    if (now >= it->second.expires_at) {
+        paxos_state_cache.erase(it);
+        return std::nullopt;
+    }
+    return it->second.state;
+}
+
+void paxos_state::set_cached_state(const schema& s, partition_key_view key, paxos_state state) {
+    auto ttl = std::min(paxos_state_cache_entry_ttl, s.paxos_grace_seconds() / 2);
+    auto cache_key = make_paxos_state_cache_key(s, key);
+    // Erase the old entry first so that if the insertion throws we are left
+    // with no entry rather than a stale one.
+    paxos_state_cache.erase(cache_key);
+    auto it = paxos_state_cache.emplace(std::move(cache_key),
+            cached_paxos_state{std::move(state), gc_clock::now() + ttl}).first;
+    if (paxos_state_cache.size() > max_cached_paxos_states) {
+        // Evict an arbitrary entry, but not the one just inserted. Whatever
+        // is dropped can be read back from the paxos table.
+        auto victim = paxos_state_cache.begin();
+        if (victim == it) {
+            ++victim;
+        }
+        paxos_state_cache.erase(victim);
+    }
+}
+
+void paxos_state::forget_cached_state(const schema& s, partition_key_view key) {
+    paxos_state_cache.erase(make_paxos_state_cache_key(s, key));
+}
+
+future<paxos_state> paxos_state::load_state(partition_key_view key, schema_ptr schema, gc_clock::time_point now, clock_type::time_point timeout) {
+    if (auto cached = get_cached_state(*schema, key, now)) {
+        return make_ready_future<paxos_state>(std::move(*cached));
+    }
+    return db::system_keyspace::load_paxos_state(key, schema, now, timeout).then([schema, key] (paxos_state state) {
+        set_cached_state(*schema, key, state);
+        return state;
+    });
+}
+
 future<paxos_state::guard> paxos_state::get_cas_lock(const dht::token& key, clock_type::time_point timeout) {
     guard m(_coordinator_lock, key, timeout);
     co_await m.lock();
@@ -58,7 +124,7 @@ future<prepare_response> paxos_state::prepare(storage_proxy& sp, tracing::trace_
             // tombstone that hides any re-submit). See CASSANDRA-12043 for details.
             auto now_in_sec = utils::UUID_gen::unix_timestamp_in_sec(ballot);
 
-            auto f = db::system_keyspace::load_paxos_state(key, schema, gc_clock::time_point(now_in_sec), timeout);
+            auto f = load_state(key, schema, gc_clock::time_point(now_in_sec), timeout);
             return f.then([&sp, &cmd, token = std::move(token), &key, ballot, tr_state, schema, only_digest, da, timeout] (paxos_state state) {
                 // If received ballot is newer that the one we already accepted it has to be accepted as well,
                 // but we will return the previously accepted proposal so that the new coordinator will use it instead of
@@ -78,17 +144,24 @@ future<prepare_response> paxos_state::prepare(storage_proxy& sp, tracing::trace_
                                     prv, tr_state, timeout);
                         });
                     });
-                    return when_all(std::move(f1), std::move(f2)).then([state = std::move(state), only_digest] (auto t) {
+                    return when_all(std::move(f1), std::move(f2)).then([&key, ballot, schema, state = std::move(state), only_digest] (auto t) {
                         if (utils::get_local_injector().enter("paxos_error_after_save_promise")) {
+                            forget_cached_state(*schema, key);
                             return make_exception_future<prepare_response>(utils::injected_error("injected_error_after_save_promise"));
                         }
                         auto&& f1 = std::get<0>(t);
                         auto&& f2 = std::get<1>(t);
                         if (f1.failed()) {
                             f2.ignore_ready_future();
-                            // Failed to save promise. Nothing we can do but throw.
+                            // Failed to save promise. The write may still have taken effect,
+                            // so drop any cached state for the key. Nothing else we can do
+                            // but throw.
+                            forget_cached_state(*schema, key);
                             return make_exception_future<prepare_response>(f1.get_exception());
                         }
+                        // The promise is durable now; mirror it in the cache for the accept
+                        // phase and for subsequent rounds.
+                        set_cached_state(*schema, key, paxos_state(ballot, state._accepted_proposal, state._most_recent_commit));
                         std::optional<std::variant<foreign_ptr<lw_shared_ptr<query::result>>, query::result_digest>> data_or_digest;
                         if (!f2.failed()) {
                             auto&& [result, hit_rate] = f2.get0();
@@ -130,7 +203,7 @@ future<bool> paxos_state::accept(storage_proxy& sp, tracing::trace_state_ptr tr_
         lc.start();
         return with_locked_key(token, timeout, [&proposal, schema, tr_state, timeout] () mutable {
             auto now_in_sec = utils::UUID_gen::unix_timestamp_in_sec(proposal.ballot);
-            auto f = db::system_keyspace::load_paxos_state(proposal.update.key(), schema, gc_clock::time_point(now_in_sec), timeout);
+            auto f = load_state(proposal.update.key(), schema, gc_clock::time_point(now_in_sec), timeout);
             return f.then([&proposal, tr_state, schema, timeout] (paxos_state state) {
                 // Accept the proposal if we promised to accept it or the proposal is newer than the one we promised.
                 // Otherwise the proposal was cutoff by another Paxos proposer and has to be rejected.
@@ -142,10 +215,21 @@ future<bool> paxos_state::accept(storage_proxy& sp, tracing::trace_state_ptr tr_
                         return make_exception_future<bool>(utils::injected_error("injected_error_before_save_proposal"));
                     }
 
-                    return db::system_keyspace::save_paxos_proposal(*schema, proposal, timeout).then([] {
+                    return db::system_keyspace::save_paxos_proposal(*schema, proposal, timeout).then_wrapped(
+                            [&proposal, schema, commit = std::move(state._most_recent_commit)] (future<> f) mutable {
+                        if (f.failed()) {
+                            // The write may still have taken effect, so drop any cached
+                            // state for the key.
+                            forget_cached_state(*schema, proposal.update.key());
+                            return make_exception_future<bool>(f.get_exception());
+                        }
                         if (utils::get_local_injector().enter("paxos_error_after_save_proposal")) {
+                            forget_cached_state(*schema, proposal.update.key());
                             return make_exception_future<bool>(utils::injected_error("injected_error_after_save_proposal"));
                         }
+                        // save_paxos_proposal() moves the promise forward to the proposal's
+                        // ballot as well, so the cached state does the same.
+                        set_cached_state(*schema, proposal.update.key(), paxos_state(proposal.ballot, proposal, std::move(commit)));
                         return make_ready_future<bool>(true);
                     });
                 } else {
@@ -219,6 +303,10 @@ future<> paxos_state::learn(storage_proxy& sp, schema_ptr schema, proposal decis
             return utils::get_local_injector().inject("paxos_timeout_after_save_decision", timeout, [&decision, schema, timeout] {
                 return db::system_keyspace::save_paxos_decision(*schema, decision, timeout);
             });
+        }).finally([&decision, schema] {
+            // Since we don't hold the per-key lock here we can't update the cached
+            // state; drop it instead and let the next round reload the row.
+            forget_cached_state(*schema, decision.update.key());
         });
     }).finally([&sp, schema, lc] () mutable {
         auto& stats = sp.get_db().local().find_column_family(schema).get_stats();
@@ -230,7 +318,11 @@ future<> paxos_state::prune(schema_ptr schema, const partition_key& key, utils::
         tracing::trace_state_ptr tr_state) {
     logger.debug("Delete paxos state for ballot {}", ballot);
     tracing::trace(tr_state, "Delete paxos state for ballot {}", ballot);
-    return db::system_keyspace::delete_paxos_decision(*schema, key, ballot, timeout);
+    return db::system_keyspace::delete_paxos_decision(*schema, key, ballot, timeout).finally([schema, &key] {
+        // Like learn(), prune() updates the row without the per-key lock, so
+        // it invalidates the cached state rather than updating it.
+        forget_cached_state(*schema, key);
+    });
 }
 
 } // end of namespace "service::paxos"
@@ -11,6 +11,7 @@
 #include "log.hh"
 #include "digest_algorithm.hh"
 #include "db/timeout_clock.hh"
+#include "gc_clock.hh"
 #include <unordered_map>
 #include "utils/UUID_gen.hh"
 #include "service/paxos/prepare_response.hh"
@@ -63,6 +64,28 @@ private:
     // eachother.
     static thread_local key_lock_map _coordinator_lock;
 
+    // Reading the paxos table row is a large part of the cost of an LWT round:
+    // both the prepare and the accept phase load it. Keep a small per-shard
+    // cache of recently used rows so that a round of an actively updated key
+    // reads the table at most once, or not at all.
+    //
+    // Entries are inserted and refreshed only under the per-key lock, right
+    // after the corresponding system.paxos write completes, so they mirror the
+    // persisted state exactly. learn() and prune() write the row without
+    // taking the lock, so they invalidate the entry instead of updating it.
+    // The map itself lives in paxos_state.cc.
+
+    // Returns a copy of the cached state for the key, or std::nullopt on a
+    // miss. Must be called under the per-key lock.
+    static std::optional<paxos_state> get_cached_state(const schema& s, partition_key_view key, gc_clock::time_point now);
+    // Remembers the given state for the key. Must be called under the per-key
+    // lock, after the state has been persisted.
+    static void set_cached_state(const schema& s, partition_key_view key, paxos_state state);
+    static void forget_cached_state(const schema& s, partition_key_view key);
+    // Loads the paxos state of the key from the cache, falling back to
+    // reading the paxos table on a miss. Must be called under the per-key
+    // lock.
+    static future<paxos_state> load_state(partition_key_view key, schema_ptr schema, gc_clock::time_point now, clock_type::time_point timeout);
 
     // protects acess to system.paxos
     template<typename Func>
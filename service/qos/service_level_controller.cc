@@ -7,6 +7,7 @@
  */
 
 #include <algorithm>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include "service_level_controller.hh"
@@ -217,6 +218,97 @@ future<std::optional<service_level_options>> service_level_controller::find_serv
     });
 }
 
+future<std::optional<sstring>> service_level_controller::find_effective_service_level_name(auth::role_set roles) {
+    auto& role_manager = _auth_service.local().underlying_role_manager();
+
+    return ::map_reduce(roles.begin(), roles.end(), [&role_manager, this] (const sstring& role) {
+        return role_manager.get_attribute(role, "service_level").then_wrapped([this] (future<std::optional<sstring>> sl_name_fut) -> std::optional<sstring> {
+            try {
+                std::optional<sstring> sl_name = sl_name_fut.get0();
+                if (!sl_name || !_service_levels_db.contains(*sl_name)) {
+                    return std::nullopt;
+                }
+                return sl_name;
+            } catch (...) { // as in find_service_level, a failure to read the
+                            // attribute is treated as the attribute not existing.
+                return std::nullopt;
+            }
+        });
+    }, std::optional<sstring>{}, [] (std::optional<sstring> first, std::optional<sstring> second) -> std::optional<sstring> {
+        if (!second) {
+            return first;
+        } else if (!first) {
+            return second;
+        } else {
+            return *first < *second ? first : second;
+        }
+    });
+}
+
+service_level_controller::cpu_account& service_level_controller::get_cpu_account(const sstring& service_level_name) {
+    auto [it, inserted] = _cpu_accounts.try_emplace(service_level_name);
+    cpu_account& account = it->second;
+    if (inserted) {
+        account.last_refill = steady_clock_type::now();
+        namespace sm = seastar::metrics;
+        sm::label service_level_label("service_level");
+        account.metrics.add_group("service_level_controller", {
+            sm::make_counter("cpu_time_consumed_ms", [&account] { return int64_t(account.consumed_ns / 1000000); },
+                    sm::description("Total statement execution time charged to this service level."),
+                    {service_level_label(it->first)}),
+            sm::make_counter("cpu_admission_delays", [&account] { return int64_t(account.admission_delays); },
+                    sm::description("Statements of this service level delayed at admission because the level overdrew its CPU budget."),
+                    {service_level_label(it->first)}),
+        });
+    }
+    return account;
+}
+
+void service_level_controller::refill_cpu_account(cpu_account& account, uint32_t budget_ms_per_second) {
+    auto now = steady_clock_type::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - account.last_refill);
+    account.last_refill = now;
+    // budget_ms_per_second milliseconds of execution time are earned per
+    // second of wall-clock time; allow bursting up to one second worth.
+    auto burst = std::chrono::nanoseconds(std::chrono::milliseconds(budget_ms_per_second));
+    if (!account.primed) {
+        account.balance = burst;
+        account.primed = true;
+        return;
+    }
+    account.balance += elapsed * budget_ms_per_second / 1000;
+    if (account.balance > burst) {
+        account.balance = burst;
+    }
+}
+
+future<> service_level_controller::wait_for_cpu_budget(const sstring& service_level_name) {
+    uint32_t budget = _cpu_budget_ms_per_second();
+    if (!budget) {
+        return make_ready_future<>();
+    }
+    auto& account = get_cpu_account(service_level_name.empty() ? default_service_level_name : service_level_name);
+    refill_cpu_account(account, budget);
+    if (account.balance >= std::chrono::nanoseconds::zero()) {
+        return make_ready_future<>();
+    }
+    ++account.admission_delays;
+    // Sleep for as long as it takes the deficit to be earned back at the
+    // configured refill rate. The balance is left negative, so concurrent
+    // arrivals of the same level queue up behind this one instead of all
+    // being admitted the moment the balance turns positive.
+    auto deficit = -account.balance;
+    return seastar::sleep(deficit * 1000 / budget);
+}
+
+void service_level_controller::account_cpu_time(const sstring& service_level_name, std::chrono::nanoseconds busy) {
+    auto& account = get_cpu_account(service_level_name.empty() ? default_service_level_name : service_level_name);
+    account.consumed_ns += busy.count();
+    if (_cpu_budget_ms_per_second()) {
+        account.balance -= busy;
+    }
+}
+
 future<>  service_level_controller::notify_service_level_added(sstring name, service_level sl_data) {
     return seastar::async( [this, name, sl_data] {
         _subscribers.thread_for_each([name, sl_data] (qos_configuration_change_subscriber* subscriber) {
@@ -16,9 +16,13 @@
 #include <seastar/core/distributed.hh>
 #include <seastar/core/abort_source.hh>
 #include "auth/service.hh"
+#include <chrono>
 #include <map>
 #include <unordered_set>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/timer.hh>
 #include "qos_common.hh"
+#include "utils/updateable_value.hh"
 #include "service/endpoint_lifecycle_subscriber.hh"
 #include "qos_configuration_change_subscriber.hh"
 
@@ -73,9 +77,31 @@ private:
 
     std::unique_ptr<global_controller_data> _global_controller_db;
 
+    // Per-shard CPU-time accounting for one service level. Without a
+    // scheduling group per service level the scheduler cannot isolate
+    // tenants, so we meter the execution time of every statement and delay
+    // admission of statements from levels that overdrew their budget. The
+    // balance is a token bucket replenished at the configured rate; it goes
+    // negative when a level overdraws and new statements wait until the
+    // deficit is earned back.
+    struct cpu_account {
+        std::chrono::nanoseconds balance{0};
+        // The budget is not known until the first refill, so the bucket is
+        // filled to the burst capacity the first time it is replenished.
+        bool primed = false;
+        steady_clock_type::time_point last_refill;
+        uint64_t consumed_ns = 0;
+        uint64_t admission_delays = 0;
+        seastar::metrics::metric_groups metrics;
+    };
+
     static constexpr shard_id global_controller = 0;
 
     std::map<sstring, service_level> _service_levels_db;
+    // std::map for node stability - the metric callbacks capture references
+    // to the mapped cpu_account objects.
+    std::map<sstring, cpu_account> _cpu_accounts;
+    utils::updateable_value<uint32_t> _cpu_budget_ms_per_second;
     std::unordered_map<sstring, sstring> _role_to_service_level;
     service_level _default_service_level;
     service_level_distributed_data_accessor_ptr _sl_data_accessor;
@@ -157,6 +183,38 @@ public:
      */
     future<std::optional<service_level_options>> find_service_level(auth::role_set roles);
 
+    /**
+     * Returns the name of the service level in effect for a user having the
+     * given collection of roles. When several service levels apply, the
+     * lexicographically first name is returned so that the attribution of a
+     * session to a level is stable across calls.
+     * @param roles - the collection of roles to consider
+     * @return the name of the effective service level, or a disengaged
+     *         optional if none of the roles has a service level attached
+     */
+    future<std::optional<sstring>> find_effective_service_level_name(auth::role_set roles);
+
+    /**
+     * Sets the per-shard CPU-time budget every service level may consume per
+     * second of wall-clock time. 0 disables metering-based admission control.
+     */
+    void set_cpu_budget(utils::updateable_value<uint32_t> budget_ms_per_second) {
+        _cpu_budget_ms_per_second = std::move(budget_ms_per_second);
+    }
+
+    /**
+     * Delays the calling statement while the given service level's CPU budget
+     * is overdrawn. Resolves immediately when enforcement is disabled or the
+     * level has budget left. An empty name stands for the default level.
+     */
+    future<> wait_for_cpu_budget(const sstring& service_level_name);
+
+    /**
+     * Charges `busy` - the measured execution time of a statement - to the
+     * given service level's budget.
+     */
+    void account_cpu_time(const sstring& service_level_name, std::chrono::nanoseconds busy);
+
     /**
      * Gets the service level data by name.
      * @param service_level_name - the name of the requested service level
@@ -172,6 +230,19 @@ public:
     }
 
 private:
+    /**
+     * Returns the accounting state for the given service level, creating it
+     * (and registering its metrics) on first use.
+     */
+    cpu_account& get_cpu_account(const sstring& service_level_name);
+
+    /**
+     * Replenishes the given account's token bucket for the wall-clock time
+     * elapsed since it was last refilled, capping the balance at one second
+     * worth of budget.
+     */
+    void refill_cpu_account(cpu_account& account, uint32_t budget_ms_per_second);
+
     /**
      *  Adds a service level configuration if it doesn't exists, and updates
      *  an the existing one if it does exist.
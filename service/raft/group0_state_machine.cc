@@ -33,6 +33,7 @@
 #include "partition_slice_builder.hh"
 #include "timestamp.hh"
 #include "utils/overloaded_functor.hh"
+#include <iterator>
 #include <optional>
 
 namespace service {
@@ -57,6 +58,47 @@ static mutation convert_history_mutation(canonical_mutation m, const data_dictio
 
 future<> group0_state_machine::apply(std::vector<raft::command_cref> command) {
     slogger.trace("apply() is called with {} commands", command.size());
+
+    auto read_apply_mutex_holder = co_await get_units(_client._read_apply_mutex, 1);
+
+    // During catch-up raft hands us long runs of committed entries at once,
+    // and with a large schema it is the per-command schema merge that
+    // dominates replay time. Consecutive schema changes whose state IDs
+    // chain (each command's prev_state_id is the previous command's
+    // new_state_id) are therefore coalesced: their schema mutations go
+    // through a single merge and their history appends are written as one
+    // mutation. Skipping the intermediate schema versions is safe - it is
+    // the same situation as transfer_snapshot pulling the latest state of
+    // the remote tables rather than the state at the snapshot descriptor.
+    struct pending_batch {
+        gms::inet_address creator_addr;
+        std::vector<canonical_mutation> schema_mutations;
+        std::optional<mutation> history_append;
+        std::optional<utils::UUID> last_state_id;
+    };
+    std::optional<pending_batch> batch;
+
+    auto flush_batch = [&] () -> future<> {
+        if (!batch) {
+            co_return;
+        }
+        auto b = std::exchange(batch, std::nullopt);
+        // We assume that each batched `cmd.change` was constructed using group0 state which was observed *after* its
+        // `cmd.prev_state_id` was obtained. It is now important that we apply the changes *before* we append the
+        // group0 state IDs to the history table.
+        //
+        // If we crash before appending the state IDs, when we reapply the commands after restart, the changes will be
+        // applied because the state IDs were not yet appended so the prev_state_id checks will pass.
+
+        // TODO: reapplication of a command after a crash may require contacting a quorum (we need to learn that the command
+        // is committed from a leader). But we may want to ensure that group 0 state is consistent after restart even without
+        // access to quorum, which means we cannot allow partially applied commands. We need to ensure that either the entire
+        // change is applied and the state ID is updated or none of this happens.
+        // E.g. use a write-ahead-entry which contains all this information and make sure it's replayed during restarts.
+        co_await _mm.merge_schema_from(netw::messaging_service::msg_addr(b->creator_addr), std::move(b->schema_mutations));
+        co_await _sp.mutate_locally({std::move(*b->history_append)}, nullptr);
+    };
+
     for (auto&& c : command) {
         auto is = ser::as_input_stream(c);
         auto cmd = ser::deserialize(is, boost::type<group0_command>{});
@@ -65,49 +107,57 @@ future<> group0_state_machine::apply(std::vector<raft::command_cref> command) {
                 cmd.prev_state_id, cmd.new_state_id, cmd.creator_addr, cmd.creator_id);
         slogger.trace("cmd.history_append: {}", cmd.history_append);
 
-        auto read_apply_mutex_holder = co_await get_units(_client._read_apply_mutex, 1);
-
         if (cmd.prev_state_id) {
-            auto last_group0_state_id = co_await db::system_keyspace::get_last_group0_state_id();
-            if (*cmd.prev_state_id != last_group0_state_id) {
-                // This command used obsolete state. Make it a no-op.
-                // BTW. on restart, all commands after last snapshot descriptor become no-ops even when they originally weren't no-ops.
-                // This is because we don't restart from snapshot descriptor, but using current state of the tables so the last state ID
-                // is the one given by the last command.
-                // Similar thing may happen when we pull group0 state in transfer_snapshot - we pull the latest state of remote tables,
-                // not state at the snapshot descriptor.
-                slogger.trace("cmd.prev_state_id ({}) different than last group 0 state ID in history table ({})",
-                        cmd.prev_state_id, last_group0_state_id);
-                continue;
+            // A command chained to the pending batch doesn't need to consult
+            // the history table: the batch ends with exactly the state it
+            // expects.
+            if (!batch || *cmd.prev_state_id != batch->last_state_id) {
+                co_await flush_batch();
+                auto last_group0_state_id = co_await db::system_keyspace::get_last_group0_state_id();
+                if (*cmd.prev_state_id != last_group0_state_id) {
+                    // This command used obsolete state. Make it a no-op.
+                    // BTW. on restart, all commands after last snapshot descriptor become no-ops even when they originally weren't no-ops.
+                    // This is because we don't restart from snapshot descriptor, but using current state of the tables so the last state ID
+                    // is the one given by the last command.
+                    // Similar thing may happen when we pull group0 state in transfer_snapshot - we pull the latest state of remote tables,
+                    // not state at the snapshot descriptor.
+                    slogger.trace("cmd.prev_state_id ({}) different than last group 0 state ID in history table ({})",
+                            cmd.prev_state_id, last_group0_state_id);
+                    continue;
+                }
             }
         } else {
             slogger.trace("unconditional modification, cmd.new_state_id: {}", cmd.new_state_id);
         }
 
-        // We assume that `cmd.change` was constructed using group0 state which was observed *after* `cmd.prev_state_id` was obtained.
-        // It is now important that we apply the change *before* we append the group0 state ID to the history table.
-        //
-        // If we crash before appending the state ID, when we reapply the command after restart, the change will be applied because
-        // the state ID was not yet appended so the above check will pass.
-
-        // TODO: reapplication of a command after a crash may require contacting a quorum (we need to learn that the command
-        // is committed from a leader). But we may want to ensure that group 0 state is consistent after restart even without
-        // access to quorum, which means we cannot allow partially applied commands. We need to ensure that either the entire
-        // change is applied and the state ID is updated or none of this happens.
-        // E.g. use a write-ahead-entry which contains all this information and make sure it's replayed during restarts.
-
         co_await std::visit(make_visitor(
         [&] (schema_change& chng) -> future<> {
-            return _mm.merge_schema_from(netw::messaging_service::msg_addr(std::move(cmd.creator_addr)), std::move(chng.mutations));
+            auto history_mut = convert_history_mutation(std::move(cmd.history_append), _sp.data_dictionary());
+            if (!batch) {
+                batch.emplace(pending_batch{cmd.creator_addr, {}, std::nullopt, std::nullopt});
+            }
+            batch->creator_addr = cmd.creator_addr;
+            std::move(chng.mutations.begin(), chng.mutations.end(), std::back_inserter(batch->schema_mutations));
+            if (batch->history_append) {
+                // All history appends target the same partition of the
+                // history table, so the batch folds them into one mutation.
+                batch->history_append->apply(std::move(history_mut));
+            } else {
+                batch->history_append = std::move(history_mut);
+            }
+            batch->last_state_id = cmd.new_state_id;
+            return make_ready_future<>();
         },
         [&] (broadcast_table_query& query) -> future<> {
+            co_await flush_batch();
             auto result = co_await service::broadcast_tables::execute_broadcast_table_query(_sp, query.query, cmd.new_state_id);
             _client.set_query_result(cmd.new_state_id, std::move(result));
+            co_await _sp.mutate_locally({convert_history_mutation(std::move(cmd.history_append), _sp.data_dictionary())}, nullptr);
         }
         ), cmd.change);
-
-        co_await _sp.mutate_locally({convert_history_mutation(std::move(cmd.history_append), _sp.data_dictionary())}, nullptr);
     }
+
+    co_await flush_batch();
 }
 
 future<raft::snapshot_id> group0_state_machine::take_snapshot() {
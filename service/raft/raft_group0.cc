@@ -194,7 +194,7 @@ raft_server_for_group raft_group0::create_server_for_group0(raft::group_id gid,
     auto rpc = std::make_unique<group0_rpc>(_raft_gr.direct_fd(), *state_machine, _ms.local(), _raft_gr.address_map(), gid, my_id);
     // Keep a reference to a specific RPC class.
     auto& rpc_ref = *rpc;
-    auto storage = std::make_unique<raft_sys_table_storage>(_qp, gid, my_id);
+    auto storage = std::make_unique<raft_sys_table_storage>(_qp, gid, my_id, _raft_gr.log_sync_window());
     auto& persistence_ref = *storage;
     auto* cl = _qp.proxy().get_db().local().commitlog();
     auto config = raft::server::configuration {
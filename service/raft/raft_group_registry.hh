@@ -89,6 +89,13 @@ private:
     // Group 0 id, valid only on shard 0 after boot/upgrade is over
     std::optional<raft::group_id> _group0_id;
 
+    // Group commit window for Raft log appends, applied to the persistence
+    // module of servers created after it is set. `store_log_entries` calls
+    // arriving within the window are coalesced into a single batch write.
+    // Zero (the default) disables coalescing. Configured with the
+    // raft_group_commit_window_in_ms option.
+    std::chrono::microseconds _log_sync_window{0};
+
     // My Raft ID. Shared between different Raft groups.
     // Once set, must not be changed.
     //
@@ -136,6 +143,11 @@ public:
     raft_address_map& address_map() { return _address_map; }
     direct_failure_detector::failure_detector& direct_fd() { return _direct_fd; }
 
+    // Group commit window for Raft log appends. Takes effect for servers
+    // created after the call.
+    std::chrono::microseconds log_sync_window() const { return _log_sync_window; }
+    void set_log_sync_window(std::chrono::microseconds window) { _log_sync_window = window; }
+
     // Is the RAFT local feature enabled?
     // Note: do not confuse with the SUPPORTS_RAFT cluster feature.
     bool is_enabled() const { return _is_enabled; }
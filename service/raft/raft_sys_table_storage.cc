@@ -23,17 +23,20 @@
 #include "gms/inet_address_serializer.hh"
 
 #include <seastar/core/loop.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
 namespace service {
 
-raft_sys_table_storage::raft_sys_table_storage(cql3::query_processor& qp, raft::group_id gid, raft::server_id server_id)
+raft_sys_table_storage::raft_sys_table_storage(cql3::query_processor& qp, raft::group_id gid, raft::server_id server_id,
+        std::chrono::microseconds log_sync_window)
     : _group_id(std::move(gid))
     , _server_id(std::move(server_id))
     , _qp(qp)
     , _dummy_query_state(service::client_state::for_internal_calls(), empty_service_permit())
     , _pending_op_fut(make_ready_future<>())
+    , _log_sync_window(log_sync_window)
 {
     static const auto store_cql = format("INSERT INTO system.{} (group_id, term, \"index\", data) VALUES (?, ?, ?, ?)",
         db::system_keyspace::RAFT);
@@ -264,9 +267,46 @@ future<> raft_sys_table_storage::do_store_log_entries(const std::vector<raft::lo
 }
 
 future<> raft_sys_table_storage::store_log_entries(const std::vector<raft::log_entry_ptr>& entries) {
-    return execute_with_linearization_point([this, &entries] {
-        return do_store_log_entries(entries);
+    if (_log_sync_window == std::chrono::microseconds::zero()) {
+        return execute_with_linearization_point([this, &entries] {
+            return do_store_log_entries(entries);
+        });
+    }
+    // Group commit: entries from all calls arriving within the sync window
+    // are persisted by a single batch write, so they share one commitlog
+    // sync instead of paying for one each.
+    _pending_entries.insert(_pending_entries.end(), entries.begin(), entries.end());
+    if (_pending_flush) {
+        // A flush is already scheduled; the entries above joined its batch.
+        return _pending_flush->get_shared_future();
+    }
+    auto flush = make_lw_shared<shared_promise<>>();
+    _pending_flush = flush;
+    // The flush is queued behind the linearization point like any other
+    // write, and the wait for the sync window happens inside it, so writes
+    // issued after the window opened (e.g. truncate_log()) cannot overtake
+    // the batch.
+    (void)execute_with_linearization_point([this, flush] () -> future<> {
+        co_await seastar::sleep(_log_sync_window);
+        auto batch = std::exchange(_pending_entries, {});
+        // Calls arriving from here on start accumulating the next batch.
+        _pending_flush = nullptr;
+        try {
+            co_await do_store_log_entries(batch);
+            flush->set_value();
+        } catch (...) {
+            flush->set_exception(std::current_exception());
+            throw; // fail the linearization point as well
+        }
+    }).handle_exception([flush] (std::exception_ptr ep) {
+        // Either the flush itself failed - then the waiters have already
+        // been signalled above - or an earlier linearized operation failed
+        // and the flush never ran; fail the waiters with that error.
+        if (!flush->available()) {
+            flush->set_exception(std::move(ep));
+        }
     });
+    return flush->get_shared_future();
 }
 
 future<> raft_sys_table_storage::truncate_log(raft::index_t idx) {
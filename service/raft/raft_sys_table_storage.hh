@@ -9,11 +9,13 @@
 
 #include "raft/raft.hh"
 
+#include <chrono>
 #include <vector>
 #include <functional>
 
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/shared_future.hh>
 
 #include "service/query_state.hh"
 #include "seastarx.hh"
@@ -50,9 +52,19 @@ class raft_sys_table_storage : public raft::persistence {
     // All RPC entry points that involve writing to system.raft are guarded with
     // this helper.
     future<> _pending_op_fut;
+    // Group commit window for `store_log_entries`. When non-zero, entries
+    // from calls arriving within the window are coalesced into a single
+    // batch write, paying one commitlog sync for the whole group.
+    std::chrono::microseconds _log_sync_window;
+    // Entries accumulated for the next flush.
+    std::vector<raft::log_entry_ptr> _pending_entries;
+    // Resolved when `_pending_entries` is persisted. Engaged iff a flush
+    // is already scheduled, in which case new entries join its batch.
+    lw_shared_ptr<shared_promise<>> _pending_flush;
 
 public:
-    explicit raft_sys_table_storage(cql3::query_processor& qp, raft::group_id gid, raft::server_id server_id);
+    explicit raft_sys_table_storage(cql3::query_processor& qp, raft::group_id gid, raft::server_id server_id,
+            std::chrono::microseconds log_sync_window = std::chrono::microseconds(0));
 
     future<> store_term_and_vote(raft::term_t term, raft::server_id vote) override;
     future<std::pair<raft::term_t, raft::server_id>> load_term_and_vote() override;
@@ -10,6 +10,7 @@
 
 #include <random>
 #include <seastar/core/sleep.hh>
+#include <seastar/core/timer-set.hh>
 #include <seastar/util/defer.hh>
 #include "partition_range_compat.hh"
 #include "db/consistency_level.hh"
@@ -195,7 +196,11 @@ public:
     }
 
     bool is_alive(const gms::inet_address& ep) const {
-        return _gossiper.is_alive(ep);
+        // Replica selection runs this for every request, so consult the
+        // gossiper's immutable liveness snapshot instead of is_alive(),
+        // which walks the endpoint state map.
+        return ep == utils::fb_utilities::get_broadcast_address()
+                || _gossiper.get_live_members_snapshot()->contains(ep);
     }
 
     future<> send_mutation(
@@ -1193,7 +1198,11 @@ protected:
     size_t _total_endpoints = 0;
     storage_proxy::write_stats& _stats;
     lw_shared_ptr<cdc::operation_result_tracker> _cdc_operation_result_tracker;
-    timer<storage_proxy::clock_type> _expire_timer;
+    // Deadline and linkage for the proxy's shared timeout wheel
+    // (storage_proxy::write_handler_timeouts); see expire_at().
+    storage_proxy::clock_type::time_point _timeout;
+    bi::list_member_hook<> _timeout_link;
+    bool _timeout_registered = false;
     service_permit _permit; // holds admission permit until operation completes
     db::per_partition_rate_limit::info _rate_limit_info;
 
@@ -1216,7 +1225,7 @@ public:
             : _id(p->get_next_response_id()), _proxy(std::move(p))
             , _effective_replication_map_ptr(std::move(erm))
             , _trace_state(trace_state), _cl(cl), _type(type), _mutation_holder(std::move(mh)), _targets(std::move(targets)),
-              _dead_endpoints(std::move(dead_endpoints)), _stats(stats), _expire_timer([this] { timeout_cb(); }), _permit(std::move(permit)),
+              _dead_endpoints(std::move(dead_endpoints)), _stats(stats), _permit(std::move(permit)),
               _rate_limit_info(rate_limit_info) {
         // original comment from cassandra:
         // during bootstrap, include pending endpoints in the count
@@ -1341,15 +1350,16 @@ public:
             timeout_cb();
         }
     }
-    void expire_at(storage_proxy::clock_type::time_point timeout) {
-        _expire_timer.arm(timeout);
-    }
-    void on_released() {
-        _expire_timer.cancel();
-        if (_targets.size() == 0) {
-            _mutation_holder->release_mutation();
-        }
+    // Aliases and accessor required by seastar::timer_set, which backs the
+    // proxy's shared timeout wheel.
+    using time_point = storage_proxy::clock_type::time_point;
+    using duration = storage_proxy::clock_type::duration;
+    time_point get_timeout() const noexcept {
+        return _timeout;
     }
+    // Defined after storage_proxy::write_handler_timeouts, which they use.
+    void expire_at(storage_proxy::clock_type::time_point timeout);
+    void on_released();
     void timeout_cb() {
         if (_cl_achieved || _cl == db::consistency_level::ANY) {
             // we are here because either cl was achieved, but targets left in the handler are not
@@ -1385,7 +1395,7 @@ public:
         constexpr auto delay_limit_us = 1000000;
         auto adjust = [] (float x) { return x * x * x; };
         auto budget = std::max(storage_proxy::clock_type::duration(0),
-            _expire_timer.get_timeout() - storage_proxy::clock_type::now());
+            get_timeout() - storage_proxy::clock_type::now());
         std::chrono::microseconds ret(uint32_t(adjust(backlog.relative_size()) * delay_limit_us));
         // "budget" has millisecond resolution and can potentially be long
         // in the future so converting it to microseconds may overflow.
@@ -1457,8 +1467,72 @@ public:
         return _stats;
     }
     friend storage_proxy;
+    friend class storage_proxy::write_handler_timeouts;
 };
 
+// A shared per-shard timer wheel for write response handler expiry.
+//
+// Every in-flight write used to arm its own reactor timer, and since writes
+// normally complete long before their deadline, nearly every one of those
+// arms was followed by a cancellation, all going through the reactor's
+// timer bookkeeping. Handler deadlines only need lowres granularity, so
+// instead the handlers link themselves into this proxy-owned
+// seastar::timer_set - the same hierarchical wheel the reactor's timers use
+// - and a single reactor timer, re-armed only when the nearest deadline
+// moves, drives batch expiry. Cancellation is a plain intrusive-list unlink
+// that never touches the reactor; a timer firing with nothing left to
+// expire is cheap.
+class storage_proxy::write_handler_timeouts {
+    seastar::timer_set<abstract_write_response_handler, &abstract_write_response_handler::_timeout_link> _timeouts;
+    timer<storage_proxy::clock_type> _timer;
+public:
+    write_handler_timeouts() {
+        _timer.set_callback([this] { expire(); });
+    }
+    void add(abstract_write_response_handler& h) {
+        if (_timeouts.insert(h)) {
+            _timer.rearm(_timeouts.get_next_timeout());
+        }
+    }
+    void remove(abstract_write_response_handler& h) {
+        // Leave _timer armed even if h's deadline was the nearest: most
+        // writes complete well before their deadline, and rearming on every
+        // completion would reintroduce the reactor timer traffic this wheel
+        // exists to avoid.
+        _timeouts.remove(h);
+    }
+private:
+    void expire() {
+        auto expired = _timeouts.expire(storage_proxy::clock_type::now());
+        while (!expired.empty()) {
+            auto& h = expired.front();
+            expired.pop_front();
+            h._timeout_registered = false;
+            // Removes (and typically destroys) the handler.
+            h.timeout_cb();
+        }
+        if (!_timeouts.empty()) {
+            _timer.rearm(_timeouts.get_next_timeout());
+        }
+    }
+};
+
+void abstract_write_response_handler::expire_at(storage_proxy::clock_type::time_point timeout) {
+    _timeout = timeout;
+    _proxy->_write_handler_timeouts->add(*this);
+    _timeout_registered = true;
+}
+
+void abstract_write_response_handler::on_released() {
+    if (_timeout_registered) {
+        _proxy->_write_handler_timeouts->remove(*this);
+        _timeout_registered = false;
+    }
+    if (_targets.size() == 0) {
+        _mutation_holder->release_mutation();
+    }
+}
+
 class datacenter_write_response_handler : public abstract_write_response_handler {
     bool waited_for(gms::inet_address from) override {
         const auto& topo = _effective_replication_map_ptr->get_topology();
@@ -2296,6 +2370,25 @@ db::view::update_backlog storage_proxy::get_backlog_of(gms::inet_address ep) con
     return it->second.backlog;
 }
 
+void storage_proxy::record_replica_read_latency(gms::inet_address replica, utils::estimated_histogram::duration latency) {
+    _replica_read_latencies[replica].histogram.add(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+}
+
+std::optional<std::chrono::milliseconds> storage_proxy::get_replica_read_latency_percentile(gms::inet_address replica, double percentile) {
+    auto it = _replica_read_latencies.find(replica);
+    if (it == _replica_read_latencies.end() || !it->second.histogram.count()) {
+        return std::nullopt;
+    }
+    auto& tracker = it->second;
+    if (tracker.cached_percentile != percentile || lowres_clock::now() - tracker.percentile_cache_timestamp > std::chrono::seconds(1)) {
+        tracker.percentile_cache_timestamp = lowres_clock::now();
+        tracker.cached_percentile = percentile;
+        tracker.percentile_cache_value = std::chrono::milliseconds(std::max(tracker.histogram.percentile(percentile) / 1000, int64_t(1)));
+        tracker.histogram *= 0.9; // decay values a little to give new data points more weight
+    }
+    return tracker.percentile_cache_value;
+}
+
 future<result<>> storage_proxy::response_wait(storage_proxy::response_id_type id, clock_type::time_point timeout) {
     auto& handler = _response_handlers.find(id)->second;
     handler->expire_at(timeout);
@@ -2406,6 +2499,10 @@ void storage_proxy_stats::write_stats::register_stats() {
                     sm::description("number of CQL write requests which arrived to a non-replica and had to be forwarded to a replica"),
                     {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
 
+            sm::make_total_operations("coalesced_writes", coalesced_writes,
+                    sm::description("number of write requests which were merged into another in-flight write to the same partition (see write_coalescing_window_in_us)"),
+                    {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
             sm::make_total_operations("reads_coordinator_outside_replica_set", reads_coordinator_outside_replica_set,
                     sm::description("number of CQL read requests which arrived to a non-replica and had to be forwarded to a replica"),
                     {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
@@ -2722,7 +2819,8 @@ storage_proxy::storage_proxy(distributed<replica::database>& db, gms::gossiper&
     , _background_write_throttle_threahsold(cfg.available_memory / 10)
     , _mutate_stage{"storage_proxy_mutate", &storage_proxy::do_mutate}
     , _max_view_update_backlog(max_view_update_backlog)
-    , _view_update_handlers_list(std::make_unique<view_update_handlers_list>()) {
+    , _view_update_handlers_list(std::make_unique<view_update_handlers_list>())
+    , _write_handler_timeouts(std::make_unique<write_handler_timeouts>()) {
     namespace sm = seastar::metrics;
     _metrics.add_group(storage_proxy_stats::COORDINATOR_STATS_CATEGORY, {
         sm::make_queue_length("current_throttled_writes", [this] { return _throttled_writes.size(); },
@@ -3275,7 +3373,72 @@ future<> storage_proxy::mutate(std::vector<mutation> mutations, db::consistency_
             .then(utils::result_into_future<result<>>);
 }
 
+std::optional<future<storage_proxy::result<>>>
+storage_proxy::maybe_coalesce_write(std::vector<mutation>& mutations, db::consistency_level cl, clock_type::time_point timeout,
+        tracing::trace_state_ptr& tr_state, service_permit& permit, db::allow_per_partition_rate_limit allow_limit, bool raw_counters) {
+    auto window = std::chrono::microseconds(_db.local().get_config().write_coalescing_window_in_us());
+    if (!window.count() || mutations.size() != 1) {
+        return std::nullopt;
+    }
+    auto& m = mutations[0];
+    if (raw_counters || m.schema()->is_counter()) {
+        return std::nullopt;
+    }
+    if (_cdc && _cdc->needs_cdc_augmentation(mutations)) {
+        // Merging would collapse the individual writes into a single CDC log
+        // entry, changing what the change stream observes.
+        return std::nullopt;
+    }
+
+    auto key = coalesced_write_key(m.schema()->id(), m.token(), cl, bool(allow_limit));
+    if (auto it = _coalesced_writes.find(key); it != _coalesced_writes.end()) {
+        auto& group = *it->second;
+        if (group.mutations[0].schema() != m.schema()) {
+            // Schema changed between the leader's arrival and ours; don't mix versions.
+            return std::nullopt;
+        }
+        tracing::trace(tr_state, "Merging write with an in-flight write to the same partition");
+        group.mutations[0].apply(std::move(m));
+        get_stats().coalesced_writes++;
+        group.waiters.emplace_back();
+        // The leader fulfills our promise with the outcome of the merged
+        // write. Hold our own permit until then, as the leader's write only
+        // accounts for its own.
+        return group.waiters.back().get_future().finally([permit = std::move(permit)] {});
+    }
+
+    auto group = make_lw_shared<coalesced_write>();
+    group->mutations = std::move(mutations);
+    _coalesced_writes.emplace(key, group);
+    return seastar::sleep(window).then([this, p = shared_from_this(), key = std::move(key), group, cl, timeout,
+            tr_state = std::move(tr_state), permit = std::move(permit), allow_limit] () mutable {
+        _coalesced_writes.erase(key);
+        return _mutate_stage(this, std::move(group->mutations), cl, timeout, std::move(tr_state), std::move(permit), false, allow_limit, nullptr)
+                .then_wrapped([group] (future<result<>> f) {
+            if (f.failed()) {
+                auto ex = f.get_exception();
+                for (auto& w : group->waiters) {
+                    w.set_exception(ex);
+                }
+                return make_exception_future<result<>>(std::move(ex));
+            }
+            auto res = f.get0();
+            for (auto& w : group->waiters) {
+                if (res) {
+                    w.set_value(bo::success());
+                } else {
+                    w.set_value(bo::failure(res.error().clone()));
+                }
+            }
+            return make_ready_future<result<>>(std::move(res));
+        });
+    });
+}
+
 future<result<>> storage_proxy::mutate_result(std::vector<mutation> mutations, db::consistency_level cl, clock_type::time_point timeout, tracing::trace_state_ptr tr_state, service_permit permit, db::allow_per_partition_rate_limit allow_limit, bool raw_counters) {
+    if (auto coalesced = maybe_coalesce_write(mutations, cl, timeout, tr_state, permit, allow_limit, raw_counters)) {
+        return std::move(*coalesced);
+    }
     if (_cdc && _cdc->needs_cdc_augmentation(mutations)) {
         return _cdc->augment_mutation_call(timeout, std::move(mutations), tr_state, cl).then([this, cl, timeout, tr_state, permit = std::move(permit), raw_counters, cdc = _cdc->shared_from_this(), allow_limit](std::tuple<std::vector<mutation>, lw_shared_ptr<cdc::operation_result_tracker>>&& t) mutable {
             auto mutations = std::move(std::get<0>(t));
@@ -3368,7 +3531,29 @@ storage_proxy::mutate_atomically(std::vector<mutation> mutations, db::consistenc
             .then(utils::result_into_future<result<>>);
 }
 
-static inet_address_vector_replica_set endpoint_filter(const gms::gossiper& g, const sstring& local_rack, const std::unordered_map<sstring, std::unordered_set<gms::inet_address>>& endpoints) {
+// The set of nodes replicating any of the batch's target partitions.
+// Placing the batchlog entry on such a node means its replica write of the
+// replayed batch is a local apply instead of another full mutation
+// round-trip, so they make better batchlog replicas whenever the rack
+// constraints leave us a choice.
+static std::unordered_set<gms::inet_address> batch_target_replicas(replica::database& db, const std::vector<mutation>& mutations) {
+    std::unordered_set<gms::inet_address> targets;
+    for (const auto& m : mutations) {
+        try {
+            auto erm = db.find_keyspace(m.schema()->ks_name()).get_effective_replication_map();
+            for (const auto& ep : erm->get_natural_endpoints(m.token())) {
+                targets.insert(ep);
+            }
+        } catch (const data_dictionary::no_such_keyspace&) {
+            // The batch write itself will fail later; nothing to prefer.
+        }
+    }
+    return targets;
+}
+
+static inet_address_vector_replica_set endpoint_filter(const gms::gossiper& g, const sstring& local_rack,
+        const std::unordered_map<sstring, std::unordered_set<gms::inet_address>>& endpoints,
+        const std::unordered_set<gms::inet_address>& preferred) {
     // special case for single-node data centers
     if (endpoints.size() == 1 && endpoints.begin()->second.size() == 1) {
         return boost::copy_range<inet_address_vector_replica_set>(endpoints.begin()->second);
@@ -3403,11 +3588,12 @@ static inet_address_vector_replica_set endpoint_filter(const gms::gossiper& g, c
 
     if (validated.bucket_count() == 1) {
         // we have only 1 `other` rack
-        auto res = validated | boost::adaptors::map_values;
+        auto res = boost::copy_range<std::vector<gms::inet_address>>(validated | boost::adaptors::map_values);
         if (validated.size() > 2) {
-            return boost::copy_range<return_type>(
-                    boost::copy_range<std::vector<gms::inet_address>>(res)
-                            | boost::adaptors::sliced(0, 2));
+            std::stable_partition(res.begin(), res.end(), [&preferred] (const gms::inet_address& ep) {
+                return preferred.contains(ep);
+            });
+            return boost::copy_range<return_type>(res | boost::adaptors::sliced(0, 2));
         }
         return boost::copy_range<return_type>(res);
     }
@@ -3425,10 +3611,15 @@ static inet_address_vector_replica_set endpoint_filter(const gms::gossiper& g, c
 
     inet_address_vector_replica_set result;
 
-    // grab a random member of up to two racks
+    // grab a random member of up to two racks, preferring endpoints which
+    // also replicate the batch's target partitions
     for (auto& rack : racks) {
         auto cpy = boost::copy_range<std::vector<gms::inet_address>>(validated.equal_range(rack) | boost::adaptors::map_values);
-        std::uniform_int_distribution<size_t> rdist(0, cpy.size() - 1);
+        auto preferred_end = std::stable_partition(cpy.begin(), cpy.end(), [&preferred] (const gms::inet_address& ep) {
+            return preferred.contains(ep);
+        });
+        auto candidates = preferred_end != cpy.begin() ? size_t(preferred_end - cpy.begin()) : cpy.size();
+        std::uniform_int_distribution<size_t> rdist(0, candidates - 1);
         result.emplace_back(cpy[rdist(rnd_engine)]);
     }
 
@@ -3474,7 +3665,8 @@ storage_proxy::mutate_atomically_result(std::vector<mutation> mutations, db::con
                             auto& local_endpoints = topology.get_datacenter_racks().at(local_dc);
                             auto local_rack = topology.get_rack();
                             auto& gossiper = _p._remote->gossiper();
-                            auto chosen_endpoints = endpoint_filter(gossiper, local_rack, local_endpoints);
+                            auto chosen_endpoints = endpoint_filter(gossiper, local_rack, local_endpoints,
+                                    batch_target_replicas(_p._db.local(), _mutations));
 
                             if (chosen_endpoints.empty()) {
                                 if (_cl == db::consistency_level::ANY) {
@@ -3741,11 +3933,17 @@ void storage_proxy::send_to_live_endpoints(storage_proxy::response_id_type respo
     auto& global_stats = handler._proxy->_global_stats;
     auto& topology = handler_ptr->_effective_replication_map_ptr->get_topology();
     auto local_dc = topology.get_datacenter();
+    auto my_address = utils::fb_utilities::get_broadcast_address();
+    // When enabled, local-datacenter replicas are grouped like remote
+    // datacenters: the mutation is serialized and sent once, to a single
+    // replica, which forwards it to the rest of the group. The forwarded
+    // replicas still respond to this coordinator directly.
+    const bool forward_local = local_db().get_config().mutation_forwarding_in_local_dc();
 
     for(auto dest: handler.get_targets()) {
         sstring dc = topology.get_datacenter(dest);
         // read repair writes do not go through coordinator since mutations are per destination
-        if (handler.read_repair_write() || dc == local_dc) {
+        if (handler.read_repair_write() || (dc == local_dc && (!forward_local || dest == my_address))) {
             local.emplace_back("", inet_address_vector_replica_set({dest}));
         } else {
             dc_groups[dc].push_back(dest);
@@ -3753,7 +3951,6 @@ void storage_proxy::send_to_live_endpoints(storage_proxy::response_id_type respo
     }
 
     auto all = boost::range::join(local, dc_groups);
-    auto my_address = utils::fb_utilities::get_broadcast_address();
 
     // lambda for applying mutation locally
     auto lmutate = [handler_ptr, response_id, this, my_address, timeout] () mutable {
@@ -4705,7 +4902,9 @@ protected:
                     resolver->add_data(ep, std::get<0>(std::move(v)));
                     ++_proxy->get_stats().data_read_completed.get_ep_stat(get_topology(), ep);
                     _used_targets.push_back(ep);
-                    register_request_latency(latency_clock::now() - start);
+                    const auto latency = latency_clock::now() - start;
+                    _proxy->record_replica_read_latency(ep, latency);
+                    register_request_latency(latency);
                     return;
                   } else {
                     ex = f.get_exception();
@@ -4732,7 +4931,9 @@ protected:
                     resolver->add_digest(ep, std::get<0>(v), std::get<1>(v), std::get<3>(std::move(v)));
                     ++_proxy->get_stats().digest_read_completed.get_ep_stat(get_topology(), ep);
                     _used_targets.push_back(ep);
-                    register_request_latency(latency_clock::now() - start);
+                    const auto latency = latency_clock::now() - start;
+                    _proxy->record_replica_read_latency(ep, latency);
+                    register_request_latency(latency);
                     return;
                   } else {
                     ex = f.get_exception();
@@ -4768,8 +4969,33 @@ protected:
         data_resolver_ptr data_resolver = ::make_shared<data_read_resolver>(_schema, cl, _targets.size(), timeout);
         auto exec = shared_from_this();
 
+        // While merging, the coordinator holds every replica's full mutation
+        // response at once, so the peak memory is one page budget per target.
+        // Scale the per-replica budget down by the target count to keep the
+        // peak near a single page's worth regardless of replication factor;
+        // when replicas cut a divergent partition short because of the
+        // smaller budget, the short-read retry logic below completes it over
+        // further rounds. The scaled command is only used for the requests -
+        // resolve() and the retry bookkeeping keep the original limits, so
+        // retries do not compound the scaling.
+        auto data_cmd = cmd;
+        const auto n_targets = _targets.size();
+        if (cmd->max_result_size && n_targets > 1) {
+            data_cmd = make_lw_shared<query::read_command>(*cmd);
+            const auto& mrs = *cmd->max_result_size;
+            auto scaled = [n_targets] (uint64_t limit) {
+                return std::max<uint64_t>(limit / n_targets, 1);
+            };
+            if (mrs.get_page_size() == mrs.hard_limit) {
+                // No separate page size; the scaled hard limit is the page cutoff.
+                data_cmd->max_result_size.emplace(scaled(mrs.soft_limit), scaled(mrs.hard_limit));
+            } else {
+                data_cmd->max_result_size.emplace(scaled(mrs.soft_limit), scaled(mrs.hard_limit), scaled(mrs.get_page_size()));
+            }
+        }
+
         // Waited on indirectly.
-        make_mutation_data_requests(cmd, data_resolver, _targets.begin(), _targets.end(), timeout);
+        make_mutation_data_requests(data_cmd, data_resolver, _targets.begin(), _targets.end(), timeout);
 
         // Waited on indirectly.
         (void)data_resolver->done().then_wrapped([this, exec_ = std::move(exec), data_resolver_ = std::move(data_resolver), cmd_ = std::move(cmd), cl_ = cl, timeout_ = timeout] (future<result<>> f) mutable -> future<> {
@@ -5024,9 +5250,24 @@ public:
             }
         });
         auto& sr = _schema->speculative_retry();
-        auto t = (sr.get_type() == speculative_retry::type::PERCENTILE) ?
-            std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_proxy->get_db().local().get_config().read_request_timeout_in_ms()/2)) :
-            std::chrono::milliseconds(unsigned(sr.get_value()));
+        std::chrono::milliseconds t;
+        if (sr.get_type() == speculative_retry::type::PERCENTILE) {
+            // Hedge when the slowest initially-contacted replica is past its
+            // own latency percentile, not the table-wide one: replicas of the
+            // same table can have very different distributions (e.g. a
+            // cross-DC replica), and hedging a naturally-slow replica on the
+            // aggregate percentile sends a steady stream of pointless
+            // speculative reads. Replicas with no samples yet fall back to
+            // the table-wide percentile.
+            const auto table_wide = _cf->get_coordinator_read_latency_percentile(sr.get_value());
+            auto slowest = std::chrono::milliseconds(0);
+            for (auto i = _targets.begin(); i != _targets.end() - 1; ++i) {
+                slowest = std::max(slowest, _proxy->get_replica_read_latency_percentile(*i, sr.get_value()).value_or(table_wide));
+            }
+            t = std::min(slowest, std::chrono::milliseconds(_proxy->get_db().local().get_config().read_request_timeout_in_ms()/2));
+        } else {
+            t = std::chrono::milliseconds(unsigned(sr.get_value()));
+        }
         _speculate_timer.arm(t);
 
         // if CL + RR result in covering all replicas, getReadExecutor forces AlwaysSpeculating.  So we know
@@ -5249,6 +5490,78 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
     bool is_read_non_local = false;
 
     const auto& tm = erm->get_token_metadata();
+
+    // A request whose every partition would be read by a sole local
+    // never-speculating executor has nothing to reconcile, repair or
+    // speculate on, so the per-partition executor machinery is pure
+    // overhead. If additionally the ranges come in ring order - which
+    // keeps the partition order of the result identical to the
+    // executor-based path, as paging requires - serve the whole request
+    // as one local multi-range query instead. The replicas of all
+    // partitions are then read with one reader permit and one sstable
+    // set snapshot per shard rather than admitting every partition
+    // separately, which is severalfold cheaper for large IN lists.
+    if (partition_ranges.size() > 1 && repair_decision == db::read_repair_decision::NONE
+            && db::block_for(*erm, cl) == 1
+            && !(cmd->allow_limit && _db.local().can_apply_per_partition_rate_limit(*schema, db::operation_type::read))) {
+        const auto my_address = utils::fb_utilities::get_broadcast_address();
+        const auto retry_type = schema->speculative_retry().get_type();
+        auto& gossiper = _remote->gossiper();
+        auto& cf = _db.local().find_column_family(schema);
+        auto* pcf = _db.local().get_config().cache_hit_rate_read_balancing() ? &cf : nullptr;
+        dht::ring_position_comparator cmp(*schema);
+        bool local_only = true;
+        for (size_t i = 0; i < partition_ranges.size(); ++i) {
+            const auto& pr = partition_ranges[i];
+            if (!pr.is_singular() || (i && cmp(partition_ranges[i - 1].start()->value(), pr.start()->value()) >= 0)) {
+                local_only = false;
+                break;
+            }
+            auto it = query_options.preferred_replicas.find(dht::token_range::make_singular(pr.start()->value().token()));
+            const auto preferred = it == query_options.preferred_replicas.end()
+                ? inet_address_vector_replica_set{} : replica_ids_to_endpoints(tm, it->second);
+            auto all_replicas = get_live_sorted_endpoints(*erm, pr.start()->value().token());
+            // Mirrors the target selection of get_read_executor(). Only a
+            // read which it would hand to a sole-local-target
+            // never_speculating_read_executor may skip the executor path
+            // without changing behavior.
+            auto targets = db::filter_for_query(cl, *erm, all_replicas, preferred, repair_decision, gossiper, nullptr, pcf);
+            if (targets.size() != 1 || targets[0] != my_address
+                    || (retry_type != speculative_retry::type::NONE && all_replicas.size() != 1)) {
+                local_only = false;
+                break;
+            }
+        }
+        if (local_only) {
+            replicas_per_token_range used_replicas;
+            const auto local_replica_ids = endpoints_to_replica_ids(tm, inet_address_vector_replica_set{my_address});
+            for (const auto& pr : partition_ranges) {
+                used_replicas.emplace(dht::token_range::make_singular(pr.start()->value().token()), local_replica_ids);
+            }
+            if (_features.range_scan_data_variant) {
+                cmd->slice.options.set<query::partition_slice::option::range_scan_data_variant>();
+            }
+            query::result_options opts;
+            opts.digest_algo = query::digest_algorithm::none;
+            opts.request = query::result_request::only_result;
+            auto timeout = query_options.timeout(*this);
+            // Keep sp alive and the read queue-length metrics meaningful.
+            auto p = shared_from_this();
+            get_stats().reads++;
+            get_stats().foreground_reads++;
+            auto f = co_await coroutine::as_future(
+                    query_nonsingular_data_locally(schema, cmd, std::move(partition_ranges), opts, query_options.trace_state, timeout));
+            get_stats().reads--;
+            get_stats().foreground_reads--;
+            if (f.failed()) {
+                auto ex = f.get_exception();
+                handle_read_error(ex, false);
+                co_return coroutine::exception(std::move(ex));
+            }
+            co_return coordinator_query_result(std::move(std::get<0>(f.get())), std::move(used_replicas), repair_decision);
+        }
+    }
+
     for (auto&& pr: partition_ranges) {
         if (!pr.is_singular()) {
             co_await coroutine::return_exception(std::runtime_error("mixed singular and non singular range are not supported"));
@@ -5560,6 +5873,26 @@ storage_proxy::query_partition_key_range_concurrent(storage_proxy::clock_type::t
     }));
 }
 
+// Estimates the number of result rows a single vnode range contributes to a
+// range scan, so that the initial fan-out can cover as many ranges as it
+// takes to fill the page, instead of always starting with one range and
+// doubling as each batch comes back empty. Only the replica-local partition
+// count estimate is available here; it is scaled to the whole ring and
+// divided between the vnode ranges. Partitions are used as a stand-in for
+// rows (there is no clustering-row estimate), which errs towards more
+// parallelism; the extra speculative ranges are bounded by the caller.
+static int estimate_result_rows_per_range(const replica::column_family& cf, const locator::effective_replication_map& erm) {
+    const auto& tm = erm.get_token_metadata();
+    const auto total_ranges = tm.sorted_tokens().size();
+    const auto node_count = tm.count_normal_token_owners();
+    if (!total_ranges || !node_count) {
+        return 0;
+    }
+    const uint64_t local_node_estimate = cf.estimated_partition_count() * smp::count;
+    const uint64_t ring_estimate = local_node_estimate * node_count / std::max<size_t>(erm.get_replication_factor(), 1);
+    return int(std::min<uint64_t>(ring_estimate / total_ranges, std::numeric_limits<int>::max()));
+}
+
 future<result<storage_proxy::coordinator_query_result>>
 storage_proxy::query_partition_key_range(lw_shared_ptr<query::read_command> cmd,
         dht::partition_range_vector partition_ranges,
@@ -5575,8 +5908,14 @@ storage_proxy::query_partition_key_range(lw_shared_ptr<query::read_command> cmd,
 
     query_ranges_to_vnodes_generator ranges_to_vnodes(erm->get_token_metadata_ptr(), schema, std::move(partition_ranges), merge_tokens);
 
-    int result_rows_per_range = 0;
-    int concurrency_factor = 1;
+    // Fan out to as many vnode ranges as the page is expected to need, capped
+    // so that a mis-estimate cannot flood the replicas; pages needing even
+    // more ranges still ramp up by the concurrency_factor doubling below.
+    constexpr int max_initial_concurrency_factor = 32;
+    int result_rows_per_range = estimate_result_rows_per_range(_db.local().find_column_family(schema), *erm);
+    int concurrency_factor = result_rows_per_range > 0
+            ? std::max(1, int(std::min<uint64_t>(cmd->get_row_limit() / result_rows_per_range, max_initial_concurrency_factor)))
+            : 1;
 
     std::vector<foreign_ptr<lw_shared_ptr<query::result>>> results;
 
@@ -12,6 +12,7 @@
 
 #include <variant>
 #include "replica/database_fwd.hh"
+#include "schema_fwd.hh"
 #include "message/messaging_service_fwd.hh"
 #include <seastar/core/distributed.hh>
 #include <seastar/core/execution_stage.hh>
@@ -28,6 +29,8 @@
 #include "cdc/stats.hh"
 #include "locator/abstract_replication_strategy.hh"
 #include "db/hints/host_filter.hh"
+#include "utils/estimated_histogram.hh"
+#include "utils/hash.hh"
 #include "utils/small_vector.hh"
 #include "service/endpoint_lifecycle_subscriber.hh"
 #include <seastar/core/circular_buffer.hh>
@@ -272,10 +275,44 @@ private:
     db::view::node_update_backlog& _max_view_update_backlog;
     std::unordered_map<gms::inet_address, view_update_backlog_timestamped> _view_update_backlogs;
 
+    // An in-flight write which is held back for the coalescing window so that
+    // later writes to the same partition can be merged into it and share its
+    // replication round. Only populated while write_coalescing_window_in_us
+    // is positive. The first writer (the leader) owns the group: it performs
+    // the merged write when the window closes and fans the outcome out to the
+    // writes which joined in the meantime.
+    struct coalesced_write {
+        std::vector<mutation> mutations; // a single, progressively merged, mutation
+        std::vector<promise<result<>>> waiters;
+    };
+    // Writes can only be merged if they target the same partition of the same
+    // table and are parametrized identically.
+    using coalesced_write_key = std::tuple<table_id, dht::token, db::consistency_level, bool>;
+    std::unordered_map<coalesced_write_key, lw_shared_ptr<coalesced_write>, utils::tuple_hash> _coalesced_writes;
+
+    // Decaying per-replica read latency histogram, fed by the read executors
+    // with the latency of every completed data/digest request. Drives
+    // percentile-based speculative retry at replica granularity, so that a
+    // replica with a latency distribution very different from the table-wide
+    // one (e.g. a remote-DC replica) gets its own hedging deadline.
+    struct replica_read_latency_tracker {
+        utils::estimated_histogram histogram;
+        lowres_clock::time_point percentile_cache_timestamp;
+        double cached_percentile = 0;
+        std::chrono::milliseconds percentile_cache_value{0};
+    };
+    std::unordered_map<gms::inet_address, replica_read_latency_tracker> _replica_read_latencies;
+
     //NOTICE(sarna): This opaque pointer is here just to avoid moving write handler class definitions from .cc to .hh. It's slow path.
     class view_update_handlers_list;
     std::unique_ptr<view_update_handlers_list> _view_update_handlers_list;
 
+    // Shared timer wheel for write response handler expiry, replacing a
+    // reactor timer per in-flight write. Opaque for the same reason as
+    // above; defined in storage_proxy.cc.
+    class write_handler_timeouts;
+    std::unique_ptr<write_handler_timeouts> _write_handler_timeouts;
+
     /* This is a pointer to the shard-local part of the sharded cdc_service:
      * storage_proxy needs access to cdc_service to augument mutations.
      *
@@ -424,6 +461,12 @@ private:
 
     db::view::update_backlog get_backlog_of(gms::inet_address) const;
 
+    void record_replica_read_latency(gms::inet_address replica, utils::estimated_histogram::duration latency);
+
+    // Returns disengaged when no read latency has been recorded for the
+    // replica yet.
+    std::optional<std::chrono::milliseconds> get_replica_read_latency_percentile(gms::inet_address replica, double percentile);
+
     template<typename Range>
     future<> mutate_counters(Range&& mutations, db::consistency_level cl, tracing::trace_state_ptr tr_state, service_permit permit, clock_type::time_point timeout);
 
@@ -532,6 +575,18 @@ public:
     */
     future<result<>> mutate_result(std::vector<mutation> mutations, db::consistency_level cl, clock_type::time_point timeout, tracing::trace_state_ptr tr_state, service_permit permit, db::allow_per_partition_rate_limit allow_limit, bool raw_counters = false);
 
+private:
+    // Implements the write_coalescing_window_in_us option: if the write is
+    // eligible and a write to the same partition is already held back, merge
+    // into it and return a future sharing its outcome; if it is eligible but
+    // there is no such write, become the leader of a new group and return a
+    // future performing the merged write once the window closes. Returns
+    // nullopt (and leaves the arguments untouched) if the write must take the
+    // regular path.
+    std::optional<future<result<>>> maybe_coalesce_write(std::vector<mutation>& mutations, db::consistency_level cl, clock_type::time_point timeout,
+            tracing::trace_state_ptr& tr_state, service_permit& permit, db::allow_per_partition_rate_limit allow_limit, bool raw_counters);
+public:
+
     paxos_participants
     get_paxos_participants(const sstring& ks_name, const locator::effective_replication_map& erm, const dht::token& token, db::consistency_level consistency_for_paxos);
 
@@ -97,6 +97,7 @@ struct write_stats {
     // forwarded by a coordinator to a replica
     uint64_t reads_coordinator_outside_replica_set = 0;
     uint64_t background_writes = 0; // client no longer waits for the write
+    uint64_t coalesced_writes = 0; // writes merged into another in-flight write to the same partition
     uint64_t throttled_writes = 0; // total number of writes ever delayed due to throttling
     uint64_t throttled_base_writes = 0; // current number of base writes delayed due to view update backlog
     uint64_t background_writes_failed = 0;
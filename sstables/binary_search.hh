@@ -46,11 +46,19 @@ int binary_search(const dht::i_partitioner& partitioner, const T& entries, const
         // creation by keeping only a key view, and then manually carrying out
         // both parts of the comparison ourselves.
         mid = low + ((high - low) >> 1);
-        key_view mid_key = entries[mid].get_key();
-        auto mid_token = partitioner.get_token(mid_key);
+        const auto& mid_entry = entries[mid];
+        dht::token mid_token;
+        if constexpr (requires { mid_entry.token; }) {
+            // Summary entries carry their decorated token in memory, so use
+            // it directly rather than re-hashing the sampled key - for long
+            // partition keys the per-probe hashing dominates summary lookups.
+            mid_token = mid_entry.token;
+        } else {
+            mid_token = partitioner.get_token(mid_entry.get_key());
+        }
 
         if (token == mid_token) {
-            result = sk.tri_compare(mid_key);
+            result = sk.tri_compare(mid_entry.get_key());
         } else {
             result = token < mid_token ? std::strong_ordering::less : std::strong_ordering::greater;
         }
@@ -8,16 +8,25 @@
 
 #include <stdexcept>
 #include <cstdlib>
+#include <list>
+#include <unordered_map>
 
 #include <boost/range/algorithm/find_if.hpp>
 #include <seastar/core/align.hh>
 #include <seastar/core/bitops.hh>
 #include <seastar/core/byteorder.hh>
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/fstream.hh>
+#include <seastar/core/queue.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/core/with_scheduling_group.hh>
+#include <seastar/coroutine/exception.hh>
 
 #include "../compress.hh"
 #include "compress.hh"
 #include "exceptions.hh"
+#include "stats.hh"
 #include "unimplemented.hh"
 #include "segmented_compress_params.hh"
 #include "utils/class_registrator.hh"
@@ -289,6 +298,139 @@ size_t local_compression::compress_max_size(size_t input_len) const {
     return _compressor ? _compressor->compress_max_size(input_len) : 0;
 }
 
+// Shard-local LRU cache of verified compressed data file chunks, keyed by
+// the owning sstable's never-reused cache identity and the chunk's position
+// in the compressed file. A hit spares the disk read and the checksum
+// verification of the chunk (done when it was inserted), but the chunk is
+// decompressed again on every read - the cache is a middle tier between the
+// row cache, which holds uncompressed rows, and disk, useful when the
+// compressed working set fits in memory while the uncompressed one does not.
+// It is sized independently of the LSA-managed caches, via the
+// sstable_compressed_chunk_cache_size_in_mb config option, and is disabled
+// (zero capacity) by default.
+class compressed_chunk_cache {
+public:
+    struct key {
+        uint64_t owner;
+        uint64_t chunk_start;
+        bool operator==(const key&) const noexcept = default;
+    };
+private:
+    struct key_hash {
+        size_t operator()(const key& k) const noexcept {
+            return std::hash<uint64_t>()(k.owner ^ (k.chunk_start * 0x9e3779b97f4a7c15ull));
+        }
+    };
+    struct entry;
+    using lru_list = std::list<entry>;
+    using entry_map = std::unordered_map<key, lru_list::iterator, key_hash>;
+    using owner_index = std::unordered_multimap<uint64_t, lru_list::iterator>;
+    struct entry {
+        key k;
+        temporary_buffer<char> buf;
+        owner_index::iterator owner_it;
+    };
+
+    lru_list _lru; // front is the most recently used entry
+    entry_map _entries;
+    owner_index _owners;
+    size_t _capacity = 0;
+    size_t _size = 0;
+
+    void evict(lru_list::iterator it) {
+        _size -= it->buf.size();
+        _owners.erase(it->owner_it);
+        _entries.erase(it->k);
+        _lru.erase(it);
+    }
+
+    void evict_to_fit(size_t bytes) {
+        while (_size + bytes > _capacity && !_lru.empty()) {
+            evict(std::prev(_lru.end()));
+        }
+    }
+public:
+    bool enabled() const noexcept {
+        return _capacity != 0;
+    }
+
+    // Returns the cached chunk, refreshing its LRU position, or nullptr.
+    // The returned buffer must be share()d before the next insertion.
+    const temporary_buffer<char>* find(const key& k) {
+        auto i = _entries.find(k);
+        if (i == _entries.end()) {
+            return nullptr;
+        }
+        _lru.splice(_lru.begin(), _lru, i->second);
+        return &i->second->buf;
+    }
+
+    void insert(const key& k, temporary_buffer<char> buf) {
+        if (buf.size() > _capacity || _entries.contains(k)) {
+            return;
+        }
+        evict_to_fit(buf.size());
+        _size += buf.size();
+        _lru.push_front(entry{k, std::move(buf), _owners.end()});
+        auto it = _lru.begin();
+        it->owner_it = _owners.emplace(k.owner, it);
+        _entries.emplace(k, it);
+    }
+
+    // Drops the entries cached on this shard under the given identity.
+    void retire_owner(uint64_t owner) {
+        auto range = _owners.equal_range(owner);
+        for (auto i = range.first; i != range.second; i = _owners.erase(i)) {
+            auto it = i->second;
+            _size -= it->buf.size();
+            _entries.erase(it->k);
+            _lru.erase(it);
+        }
+    }
+
+    void set_capacity(size_t capacity) {
+        _capacity = capacity;
+        evict_to_fit(0);
+    }
+
+    static compressed_chunk_cache& shard_cache() {
+        static thread_local compressed_chunk_cache cache;
+        return cache;
+    }
+
+    static uint64_t next_owner_id() noexcept {
+        // Tagging the id with the shard which allocated it makes ids unique
+        // across shards without coordination: compression objects may be
+        // constructed on one shard and read from on others.
+        static thread_local uint64_t counter = 0;
+        return (uint64_t(this_shard_id()) << 48) | ++counter;
+    }
+};
+
+chunk_cache_owner_id::chunk_cache_owner_id() noexcept
+    : _id(compressed_chunk_cache::next_owner_id())
+{}
+
+chunk_cache_owner_id& chunk_cache_owner_id::operator=(chunk_cache_owner_id&& other) noexcept {
+    if (this != &other) {
+        if (_id) {
+            compressed_chunk_cache::shard_cache().retire_owner(_id);
+        }
+        _id = std::exchange(other._id, 0);
+    }
+    return *this;
+}
+
+chunk_cache_owner_id::~chunk_cache_owner_id() {
+    if (_id) {
+        compressed_chunk_cache::shard_cache().retire_owner(_id);
+    }
+}
+
+void set_compressed_chunk_cache_capacity(size_t capacity_bytes) {
+    compressed_chunk_cache::shard_cache().set_capacity(capacity_bytes);
+}
+
 void compression::set_compressor(compressor_ptr c) {
     if (c) {
         unqualified_name uqn(compressor::namespace_prefix, c->name());
@@ -340,13 +482,50 @@ class compressed_file_data_source_impl : public data_source_impl {
     sstables::compression::segmented_offsets::accessor _offsets;
     sstables::local_compression _compression;
     reader_permit _permit;
+    sstables::sstables_stats _stats;
     uint64_t _underlying_pos;
     uint64_t _pos;
     uint64_t _beg_pos;
     uint64_t _end_pos;
+    // Engaged for multi-chunk zstd reads when the caller supplied a
+    // background decompression group; see data_stream().
+    std::optional<seastar::scheduling_group> _decompression_sg;
+
+    // Decompresses a chunk (compressed payload plus checksum trailer, as
+    // stored on disk) and advances the stream positions past it.
+    temporary_buffer<char> uncompress_chunk(const sstables::compression::chunk_and_offset& addr, temporary_buffer<char> buf) {
+        // We know that the uncompressed data will take exactly
+        // chunk_length bytes (or less, if reading the last chunk).
+        temporary_buffer<char> out(
+                _compression_metadata->uncompressed_chunk_length());
+        // The compressed data is the whole chunk, minus the last 4
+        // bytes (which contain the checksum).
+        auto len = _compression.uncompress(buf.get(), addr.chunk_len - 4, out.get_write(), out.size());
+
+        out.trim(len);
+        out.trim_front(addr.offset);
+        _pos += out.size();
+        _underlying_pos += addr.chunk_len;
+
+        return make_tracked_temporary_buffer(std::move(out), _permit);
+    }
+
+    // Decompresses a chunk in _decompression_sg when engaged, inline
+    // otherwise. The stream positions are only advanced once the
+    // decompression actually ran, so the single consumer awaiting the
+    // returned future always observes them in sync.
+    future<temporary_buffer<char>> uncompress_chunk_maybe_in_group(const sstables::compression::chunk_and_offset& addr, temporary_buffer<char> buf) {
+        if (_decompression_sg && *_decompression_sg != current_scheduling_group()) {
+            return with_scheduling_group(*_decompression_sg, [this, addr, buf = std::move(buf)] () mutable {
+                return uncompress_chunk(addr, std::move(buf));
+            });
+        }
+        return make_ready_future<temporary_buffer<char>>(uncompress_chunk(addr, std::move(buf)));
+    }
 public:
     compressed_file_data_source_impl(file f, sstables::compression* cm,
-                uint64_t pos, size_t len, file_input_stream_options options, reader_permit permit)
+                uint64_t pos, size_t len, file_input_stream_options options, reader_permit permit,
+                std::optional<seastar::scheduling_group> decompression_sg)
             : _compression_metadata(cm)
             , _offsets(_compression_metadata->offsets.get_accessor())
             , _compression(*cm)
@@ -377,6 +556,14 @@ public:
                 std::move(options));
         _underlying_pos = start.chunk_start;
         _pos = _beg_pos;
+        if (decompression_sg && _end_pos - _beg_pos >= 4 * _compression_metadata->uncompressed_chunk_length()
+                && _compression.compressor()->name() == compressor::namespace_prefix + "ZstdCompressor") {
+            // Point reads (single-chunk ranges) stay inline: the group
+            // switch per chunk is noise for a scan but pure added latency
+            // for them. Only zstd is expensive enough to be worth isolating;
+            // the cheap compressors decompress faster than they'd reschedule.
+            _decompression_sg = decompression_sg;
+        }
     }
     virtual future<temporary_buffer<char>> get() override {
         if (_pos >= _end_pos) {
@@ -388,6 +575,20 @@ public:
         if (_pos != _beg_pos && addr.offset != 0) {
             throw std::runtime_error("compressed reader out of sync");
         }
+        auto& cache = sstables::compressed_chunk_cache::shard_cache();
+        if (cache.enabled()) {
+            auto cache_key = sstables::compressed_chunk_cache::key{_compression_metadata->chunk_cache_id(), addr.chunk_start};
+            if (auto* cached = cache.find(cache_key)) {
+                _stats.on_compressed_chunk_cache_hit();
+                // The cached chunk had its checksum verified when it was
+                // inserted. Skip past it in the underlying stream so that
+                // subsequent reads stay in sync.
+                return _input_stream->skip(addr.chunk_len).then([this, addr, buf = cached->share()] () mutable {
+                    return uncompress_chunk_maybe_in_group(addr, std::move(buf));
+                });
+            }
+            _stats.on_compressed_chunk_cache_miss();
+        }
         return _input_stream->read_exactly(addr.chunk_len).
             then([this, addr](temporary_buffer<char> buf) {
                 // The last 4 bytes of the chunk are the adler32/crc32 checksum
@@ -401,21 +602,12 @@ public:
                     throw sstables::malformed_sstable_exception(format("compressed chunk of size {} at file offset {} failed checksum, expected={}, actual={}", addr.chunk_len, _underlying_pos, expected_checksum, actual_checksum));
                 }
 
-                // We know that the uncompressed data will take exactly
-                // chunk_length bytes (or less, if reading the last chunk).
-                temporary_buffer<char> out(
-                        _compression_metadata->uncompressed_chunk_length());
-                // The compressed data is the whole chunk, minus the last 4
-                // bytes (which contain the checksum verified above).
-
-                auto len = _compression.uncompress(buf.get(), compressed_len, out.get_write(), out.size());
-
-                out.trim(len);
-                out.trim_front(addr.offset);
-                _pos += out.size();
-                _underlying_pos += addr.chunk_len;
+                auto& cache = sstables::compressed_chunk_cache::shard_cache();
+                if (cache.enabled()) {
+                    cache.insert({_compression_metadata->chunk_cache_id(), addr.chunk_start}, buf.share());
+                }
 
-                return make_tracked_temporary_buffer(std::move(out), _permit);
+                return uncompress_chunk_maybe_in_group(addr, std::move(buf));
         });
     }
 
@@ -447,9 +639,10 @@ requires ChecksumUtils<ChecksumType>
 class compressed_file_data_source : public data_source {
 public:
     compressed_file_data_source(file f, sstables::compression* cm,
-            uint64_t offset, size_t len, file_input_stream_options options, reader_permit permit)
+            uint64_t offset, size_t len, file_input_stream_options options, reader_permit permit,
+            std::optional<seastar::scheduling_group> decompression_sg)
         : data_source(std::make_unique<compressed_file_data_source_impl<ChecksumType>>(
-                std::move(f), cm, offset, len, std::move(options), std::move(permit)))
+                std::move(f), cm, offset, len, std::move(options), std::move(permit), decompression_sg))
         {}
 };
 
@@ -457,10 +650,11 @@ template <typename ChecksumType>
 requires ChecksumUtils<ChecksumType>
 inline input_stream<char> make_compressed_file_input_stream(
         file f, sstables::compression *cm, uint64_t offset, size_t len,
-        file_input_stream_options options, reader_permit permit)
+        file_input_stream_options options, reader_permit permit,
+        std::optional<seastar::scheduling_group> decompression_sg)
 {
     return input_stream<char>(compressed_file_data_source<ChecksumType>(
-            std::move(f), cm, offset, len, std::move(options), std::move(permit)));
+            std::move(f), cm, offset, len, std::move(options), std::move(permit), decompression_sg));
 }
 
 // For SSTables 2.x (formats 'ka' and 'la'), the full checksum is a combination of checksums of compressed chunks.
@@ -570,17 +764,88 @@ inline output_stream<char> make_compressed_file_output_stream(output_stream<char
     return output_stream<char>(compressed_file_data_sink<ChecksumType, mode>(std::move(out), cm, p));
 }
 
+// Bounded queue of uncompressed chunks between the producer of the stream
+// and a background fiber which feeds them to the downstream compressed
+// stream, where the compressor runs. See make_pipelined_compression_output_stream().
+class pipelined_compression_data_sink_impl : public data_sink_impl {
+    // Compressing a chunk with an expensive compressor takes longer than
+    // producing one, so a deep queue would only add memory pressure; a few
+    // chunks are enough to absorb production bursts.
+    static constexpr size_t queue_depth = 4;
+
+    output_stream<char> _out;
+    size_t _buffer_size;
+    // Disengaged element signals end of stream.
+    seastar::queue<std::optional<temporary_buffer<char>>> _queue;
+    future<> _consumer_done;
+public:
+    pipelined_compression_data_sink_impl(output_stream<char> out, size_t buffer_size, seastar::scheduling_group sg)
+        : _out(std::move(out))
+        , _buffer_size(buffer_size)
+        , _queue(queue_depth)
+        , _consumer_done(with_scheduling_group(sg, [this] { return consume(); }))
+    {}
+
+    virtual future<> put(net::packet data) override { abort(); }
+    virtual future<> put(temporary_buffer<char> buf) override {
+        return _queue.push_eventually(std::make_optional(std::move(buf)));
+    }
+    virtual future<> close() override {
+        return _queue.push_eventually(std::nullopt).then_wrapped([this] (future<> f) {
+            // If the consumer failed it aborted the queue; the push failure
+            // carries the same error as _consumer_done, which we return.
+            f.ignore_ready_future();
+            return std::move(_consumer_done);
+        });
+    }
+
+    virtual size_t buffer_size() const noexcept override {
+        return _buffer_size;
+    }
+private:
+    future<> consume() {
+        std::exception_ptr ex;
+        try {
+            while (auto buf = co_await _queue.pop_eventually()) {
+                co_await _out.write(buf->get(), buf->size());
+            }
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        try {
+            co_await _out.close();
+        } catch (...) {
+            if (!ex) {
+                ex = std::current_exception();
+            }
+        }
+        if (ex) {
+            // Fail pending and future put()s, so the producer stops early.
+            _queue.abort(ex);
+            co_await coroutine::return_exception_ptr(std::move(ex));
+        }
+    }
+};
+
+output_stream<char> sstables::make_pipelined_compression_output_stream(output_stream<char> out,
+        size_t buffer_size, seastar::scheduling_group sg) {
+    return output_stream<char>(data_sink(std::make_unique<pipelined_compression_data_sink_impl>(
+            std::move(out), buffer_size, sg)));
+}
+
 input_stream<char> sstables::make_compressed_file_k_l_format_input_stream(file f,
         sstables::compression* cm, uint64_t offset, size_t len,
-        class file_input_stream_options options, reader_permit permit)
+        class file_input_stream_options options, reader_permit permit,
+        std::optional<seastar::scheduling_group> decompression_sg)
 {
-    return make_compressed_file_input_stream<adler32_utils>(std::move(f), cm, offset, len, std::move(options), std::move(permit));
+    return make_compressed_file_input_stream<adler32_utils>(std::move(f), cm, offset, len, std::move(options), std::move(permit), decompression_sg);
 }
 
 input_stream<char> sstables::make_compressed_file_m_format_input_stream(file f,
         sstables::compression *cm, uint64_t offset, size_t len,
-        class file_input_stream_options options, reader_permit permit) {
-    return make_compressed_file_input_stream<crc32_utils>(std::move(f), cm, offset, len, std::move(options), std::move(permit));
+        class file_input_stream_options options, reader_permit permit,
+        std::optional<seastar::scheduling_group> decompression_sg) {
+    return make_compressed_file_input_stream<crc32_utils>(std::move(f), cm, offset, len, std::move(options), std::move(permit), decompression_sg);
 }
 
 output_stream<char> sstables::make_compressed_file_m_format_output_stream(output_stream<char> out,
@@ -29,16 +29,20 @@
 // "crc_check_chance" (defaulting to 1.0) which determines the probability
 // of us verifying the checksum of each chunk we read.
 //
-// This implementation does not cache the compressed disk blocks (which
-// are read using O_DIRECT), nor uncompressed data. We intend to cache high-
-// level Cassandra rows, not disk blocks.
+// This implementation can optionally keep the verified compressed disk
+// blocks (which are read using O_DIRECT) in a shard-local cache - see the
+// compressed chunk cache in compress.cc. Uncompressed data is never cached
+// at this level; high-level Cassandra rows are cached by the row cache.
 
 #include <vector>
 #include <cstdint>
 #include <iterator>
+#include <optional>
+#include <utility>
 
 #include <seastar/core/file.hh>
 #include <seastar/core/seastar.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/fstream.hh>
 
@@ -57,6 +61,24 @@ namespace sstables {
 
 struct compression;
 
+// RAII handle on a never-reused identity under which an sstable's verified
+// compressed data chunks live in the compressed chunk cache (compress.cc).
+// Destroying the handle retires the identity and drops the chunks cached
+// under it on this shard; entries left behind on other shards simply age
+// out of the LRU, since the identity is never handed out again.
+class chunk_cache_owner_id {
+    uint64_t _id;
+public:
+    chunk_cache_owner_id() noexcept;
+    chunk_cache_owner_id(chunk_cache_owner_id&& other) noexcept : _id(std::exchange(other._id, 0)) {}
+    chunk_cache_owner_id& operator=(chunk_cache_owner_id&& other) noexcept;
+    ~chunk_cache_owner_id();
+
+    uint64_t value() const noexcept {
+        return _id;
+    }
+};
+
 struct compression {
     // To reduce the memory footpring of compression-info, n offsets are grouped
     // together into segments, where each segment stores a base absolute offset
@@ -303,7 +325,12 @@ private:
     // Variables *not* found in the "Compression Info" file (added by update()):
     uint64_t _compressed_file_length = 0;
     uint32_t _full_checksum = 0;
+    // Identity under which this sstable's compressed chunks are cached.
+    chunk_cache_owner_id _chunk_cache_id;
 public:
+    uint64_t chunk_cache_id() const noexcept {
+        return _chunk_cache_id.value();
+    }
     // Set the compressor algorithm, please check the definition of enum compressor.
     void set_compressor(compressor_ptr c);
     // After changing _compression, update() must be called to update
@@ -366,22 +393,49 @@ public:
 // for API query only. Free function just to distinguish it from an accessor in compression
 compressor_ptr get_sstable_compressor(const compression&);
 
+// Sets the capacity, in bytes, of this shard's cache of verified compressed
+// data chunks. Zero (the initial value) disables the cache. Called at startup
+// by the sstables_manager, from the sstable_compressed_chunk_cache_size_in_mb
+// config option.
+void set_compressed_chunk_cache_capacity(size_t capacity_bytes);
+
 // Note: compression_metadata is passed by reference; The caller is
 // responsible for keeping the compression_metadata alive as long as there
 // are open streams on it. This should happen naturally on a higher level -
 // as long as we have *sstables* work in progress, we need to keep the whole
 // sstable alive, and the compression metadata is only a part of it.
+// When `decompression_sg` is engaged, reads which span several chunks (i.e.
+// sequential scans, not point reads) of a zstd-compressed file decompress
+// each chunk in that scheduling group instead of the reading fiber's group,
+// so the CPU cost of decompressing cold data is accounted to (and throttled
+// by the shares of) the background group rather than competing with
+// latency-sensitive work in the reader's group.
 input_stream<char> make_compressed_file_k_l_format_input_stream(file f,
                 sstables::compression* cm, uint64_t offset, size_t len,
-                class file_input_stream_options options, reader_permit permit);
+                class file_input_stream_options options, reader_permit permit,
+                std::optional<seastar::scheduling_group> decompression_sg = {});
 
 input_stream<char> make_compressed_file_m_format_input_stream(file f,
                 sstables::compression* cm, uint64_t offset, size_t len,
-                class file_input_stream_options options, reader_permit permit);
+                class file_input_stream_options options, reader_permit permit,
+                std::optional<seastar::scheduling_group> decompression_sg = {});
 
 output_stream<char> make_compressed_file_m_format_output_stream(output_stream<char> out,
                 sstables::compression* cm,
                 const compression_parameters& cp);
 
+// Decouples the producer of a compressed stream from the compression work.
+// Chunks written to the returned stream are placed in a bounded queue and
+// a background fiber, running in `sg`, pops them and writes them to `out`
+// (a stream made with make_compressed_file_*_output_stream()), which is
+// where the compressor actually runs. The producer only stalls on a full
+// queue, so expensive compressors (e.g. high zstd levels) don't inflate
+// the latency of the write path feeding the stream. `buffer_size` should
+// be the compression chunk length, so that every chunk crosses the queue
+// as a single buffer.
+output_stream<char> make_pipelined_compression_output_stream(output_stream<char> out,
+                size_t buffer_size,
+                seastar::scheduling_group sg);
+
 }
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include "encrypted_file_impl.hh"
+
+#include <algorithm>
+#include <numeric>
+
+#include <seastar/core/print.hh>
+#include <seastar/core/with_file.hh>
+
+#include <cryptopp/aes.h>
+#include <cryptopp/modes.h>
+
+namespace sstables {
+
+using aes_ctr_cipher = CryptoPP::CTR_Mode<CryptoPP::AES>::Encryption;
+
+static const CryptoPP::byte* as_cryptopp_bytes(const bytes& b) {
+    return reinterpret_cast<const CryptoPP::byte*>(b.data());
+}
+
+encrypted_file_impl::encrypted_file_impl(file f, bytes key, bytes iv)
+        : file_impl(*get_file_impl(f)), _file(std::move(f)), _key(std::move(key)), _iv(std::move(iv)) {
+    if (!aes_ctr_cipher::IsValidKeyLength(_key.size())) {
+        throw std::invalid_argument(format("encrypted_file_impl: invalid AES key length: {}", _key.size()));
+    }
+    if (_iv.size() != CryptoPP::AES::BLOCKSIZE) {
+        throw std::invalid_argument(format("encrypted_file_impl: invalid IV length: {} (expected {})", _iv.size(), CryptoPP::AES::BLOCKSIZE));
+    }
+}
+
+void encrypted_file_impl::transform_in_place(uint64_t pos, uint8_t* buffer, size_t len) {
+    // The cipher object is cheap relative to the I/O it accompanies, and a
+    // per-call instance keeps this safe under concurrent reads and writes.
+    aes_ctr_cipher cipher(as_cryptopp_bytes(_key), _key.size(), as_cryptopp_bytes(_iv));
+    cipher.Seek(pos);
+    cipher.ProcessData(buffer, buffer, len);
+}
+
+future<size_t>
+encrypted_file_impl::write_dma(uint64_t pos, const void* buffer, size_t len, const io_priority_class& pc) {
+    // The caller's buffer must not be modified, so encrypt into a bounce
+    // buffer, which also has to satisfy the DMA alignment requirements.
+    auto wbuf = temporary_buffer<uint8_t>::aligned(_memory_dma_alignment, len);
+    std::copy_n(static_cast<const uint8_t*>(buffer), len, wbuf.get_write());
+    transform_in_place(pos, wbuf.get_write(), len);
+
+    auto p = wbuf.get();
+    return get_file_impl(_file)->write_dma(pos, p, len, pc).finally([wbuf = std::move(wbuf)] {});
+}
+
+future<size_t>
+encrypted_file_impl::write_dma(uint64_t pos, std::vector<iovec> iov, const io_priority_class& pc) {
+    // Gather the fragments into a single encrypted bounce buffer. The extra
+    // copy is unfortunate but this path is not taken by the sstable writers.
+    auto len = std::accumulate(iov.begin(), iov.end(), size_t(0), [] (size_t acc, const iovec& v) { return acc + v.iov_len; });
+    auto wbuf = temporary_buffer<uint8_t>::aligned(_memory_dma_alignment, len);
+    auto out = wbuf.get_write();
+    for (const auto& v : iov) {
+        out = std::copy_n(static_cast<const uint8_t*>(v.iov_base), v.iov_len, out);
+    }
+    transform_in_place(pos, wbuf.get_write(), len);
+
+    auto p = wbuf.get();
+    return get_file_impl(_file)->write_dma(pos, p, len, pc).finally([wbuf = std::move(wbuf)] {});
+}
+
+future<size_t>
+encrypted_file_impl::read_dma(uint64_t pos, void* buffer, size_t len, const io_priority_class& pc) {
+    return get_file_impl(_file)->read_dma(pos, buffer, len, pc).then([this, pos, buffer] (size_t ret) {
+        transform_in_place(pos, static_cast<uint8_t*>(buffer), ret);
+        return ret;
+    });
+}
+
+future<size_t>
+encrypted_file_impl::read_dma(uint64_t pos, std::vector<iovec> iov, const io_priority_class& pc) {
+    return get_file_impl(_file)->read_dma(pos, iov, pc).then([this, pos, iov = std::move(iov)] (size_t ret) {
+        auto off = pos;
+        auto left = ret;
+        for (const auto& v : iov) {
+            auto n = std::min(left, v.iov_len);
+            transform_in_place(off, static_cast<uint8_t*>(v.iov_base), n);
+            off += n;
+            left -= n;
+            if (!left) {
+                break;
+            }
+        }
+        return ret;
+    });
+}
+
+future<temporary_buffer<uint8_t>>
+encrypted_file_impl::dma_read_bulk(uint64_t offset, size_t range_size, const io_priority_class& pc) {
+    return get_file_impl(_file)->dma_read_bulk(offset, range_size, pc).then([this, offset] (temporary_buffer<uint8_t> buf) {
+        transform_in_place(offset, buf.get_write(), buf.size());
+        return buf;
+    });
+}
+
+file make_encrypted_file(file f, bytes key, bytes iv) {
+    return file(::make_shared<encrypted_file_impl>(std::move(f), std::move(key), std::move(iv)));
+}
+
+future<file>
+open_encrypted_file_dma(std::string_view name, open_flags flags, file_open_options options, bytes key, bytes iv) noexcept {
+    static_assert(std::is_nothrow_move_constructible_v<file_open_options>);
+    return with_file_close_on_failure(open_file_dma(name, flags, std::move(options)), [key = std::move(key), iv = std::move(iv)] (file f) mutable {
+        return make_ready_future<file>(make_encrypted_file(std::move(f), std::move(key), std::move(iv)));
+    });
+}
+
+}
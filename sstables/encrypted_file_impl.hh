@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+#include "bytes.hh"
+
+namespace sstables {
+
+/// Transparent, length-preserving encryption layer over a file.
+///
+/// Data is encrypted with AES in CTR mode, with the keystream position tied
+/// to the file offset, so any aligned range of the file can be read or
+/// written independently of the rest - which is exactly what the sstable
+/// readers and writers do. CTR adds no padding and no per-block headers, so
+/// file sizes, component offsets and promoted index positions are unchanged
+/// and the layer can wrap any sstable component without the readers noticing.
+///
+/// CTR turns keystream reuse into plaintext exposure, so each file must be
+/// wrapped with its own (key, IV) pair - e.g. a per-sstable key derived from
+/// a table master key. Key management is the caller's responsibility; this
+/// layer only does the bulk transformation (which Crypto++ implements with
+/// AES-NI where available).
+class encrypted_file_impl : public file_impl {
+public:
+    // \c key must be a valid AES key (16, 24 or 32 bytes), \c iv must be
+    // 16 bytes. Throws std::invalid_argument otherwise.
+    encrypted_file_impl(file f, bytes key, bytes iv);
+
+    virtual future<size_t> write_dma(uint64_t pos, const void* buffer, size_t len, const io_priority_class& pc) override;
+
+    virtual future<size_t> write_dma(uint64_t pos, std::vector<iovec> iov, const io_priority_class& pc) override;
+
+    virtual future<size_t> read_dma(uint64_t pos, void* buffer, size_t len, const io_priority_class& pc) override;
+
+    virtual future<size_t> read_dma(uint64_t pos, std::vector<iovec> iov, const io_priority_class& pc) override;
+
+    virtual future<temporary_buffer<uint8_t>> dma_read_bulk(uint64_t offset, size_t range_size, const io_priority_class& pc) override;
+
+    virtual future<> flush(void) override {
+        return get_file_impl(_file)->flush();
+    }
+
+    virtual future<struct stat> stat(void) override {
+        return get_file_impl(_file)->stat();
+    }
+
+    virtual future<> truncate(uint64_t length) override {
+        return get_file_impl(_file)->truncate(length);
+    }
+
+    virtual future<> discard(uint64_t offset, uint64_t length) override {
+        return get_file_impl(_file)->discard(offset, length);
+    }
+
+    virtual future<> allocate(uint64_t position, uint64_t length) override {
+        return get_file_impl(_file)->allocate(position, length);
+    }
+
+    virtual future<uint64_t> size(void) override {
+        return get_file_impl(_file)->size();
+    }
+
+    virtual future<> close() override {
+        return get_file_impl(_file)->close();
+    }
+
+    // Returns a handle for the plain underlying file: the encryption state
+    // cannot cross the shard boundary, so the receiving shard has to wrap
+    // the file obtained from the handle with make_encrypted_file() again.
+    virtual std::unique_ptr<seastar::file_handle_impl> dup() override {
+        return get_file_impl(_file)->dup();
+    }
+
+    virtual subscription<directory_entry> list_directory(std::function<future<> (directory_entry de)> next) override {
+        return get_file_impl(_file)->list_directory(next);
+    }
+
+private:
+    // Encrypts/decrypts (CTR is symmetric) \c len bytes located at file
+    // offset \c pos, in place.
+    void transform_in_place(uint64_t pos, uint8_t* buffer, size_t len);
+
+    file _file;
+    bytes _key;
+    bytes _iv;
+};
+
+file make_encrypted_file(file f, bytes key, bytes iv);
+
+future<file>
+open_encrypted_file_dma(std::string_view name, open_flags flags, file_open_options options, bytes key, bytes iv) noexcept;
+
+}
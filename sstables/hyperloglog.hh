@@ -89,6 +89,20 @@ static inline size_t write_unsigned_var_int(unsigned int value, uint8_t* to) {
     return size;
 }
 
+static inline unsigned int read_unsigned_var_int(const uint8_t*& from, const uint8_t* end) {
+    unsigned int value = 0;
+    unsigned shift = 0;
+    while (from != end && shift < 32) {
+        uint8_t b = *from++;
+        value |= static_cast<unsigned int>(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            return value;
+        }
+        shift += 7;
+    }
+    throw std::runtime_error("malformed varint in cardinality metadata");
+}
+
 /** @class HyperLogLog
  *  @brief Implement of 'HyperLogLog' estimate cardinality algorithm
  */
@@ -128,11 +142,46 @@ public:
         alphaMM_ = alpha * m_ * m_;
     }
 
+    /**
+     * Creates a HyperLogLog from the serialized form produced by get_bytes(),
+     * i.e. the cardinality data stored in the compaction metadata. Only the
+     * NORMAL (dense) representation is supported; sstables written by
+     * Cassandra may use the SPARSE format, in which case this throws and the
+     * caller is expected to fall back to a cruder estimate.
+     *
+     * @exception std::runtime_error the buffer is malformed or uses an
+     *            unsupported version or encoding.
+     */
     static HyperLogLog from_bytes(temporary_buffer<uint8_t> bytes) {
-        // FIXME: implement class that creates a HyperLogLog from an array of bytes.
-        // This will useful if we need to work with the cardinality data from the
-        // compaction metadata.
-        abort();
+        static constexpr int version = 2;
+        const uint8_t* from = bytes.get();
+        const uint8_t* end = from + bytes.size();
+
+        if (size_t(end - from) < sizeof(int32_t)) {
+            throw std::runtime_error("truncated cardinality metadata");
+        }
+        auto v = read_be<int32_t>(reinterpret_cast<const char*>(from));
+        from += sizeof(int32_t);
+        if (v != -version) {
+            throw std::runtime_error("unsupported cardinality metadata version");
+        }
+        auto b = read_unsigned_var_int(from, end);
+        auto sp = read_unsigned_var_int(from, end);
+        auto type = read_unsigned_var_int(from, end);
+        if (sp != 0 || type != 0) {
+            // FIXME: add support to SPARSE format.
+            throw std::runtime_error("unsupported cardinality metadata encoding");
+        }
+        auto register_count = read_unsigned_var_int(from, end);
+        if (b < 4 || b > 16) {
+            throw std::runtime_error("cardinality metadata register width out of range");
+        }
+        HyperLogLog hll(b);
+        if (register_count != hll.m_ || size_t(end - from) < register_count) {
+            throw std::runtime_error("malformed cardinality metadata register set");
+        }
+        std::copy_n(from, register_count, hll.M_.begin());
+        return hll;
     }
 
     /**
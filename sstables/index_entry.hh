@@ -262,8 +262,9 @@ public:
         return {};
     }
 
-    index_entry(managed_bytes&& key, uint64_t position, managed_ref<promoted_index>&& index)
+    index_entry(managed_bytes&& key, dht::token token, uint64_t position, managed_ref<promoted_index>&& index)
         : _key(std::move(key))
+        , _token(token)
         , _position(position)
         , _index(std::move(index))
     {}
@@ -288,6 +289,10 @@ public:
 class partition_index_page {
 public:
     lsa::chunked_managed_vector<managed_ref<index_entry>> _entries;
+    // Tokens of the entries above, in a fixed-stride table parallel to _entries.
+    // Point lookups binary-search this table, so probes touch contiguous memory
+    // instead of dereferencing individual entries scattered around LSA.
+    lsa::chunked_managed_vector<dht::token> _tokens;
 public:
     partition_index_page() = default;
     partition_index_page(partition_index_page&&) noexcept = default;
@@ -297,7 +302,7 @@ public:
     size_t size() const { return _entries.size(); }
 
     size_t external_memory_usage() const {
-        size_t size = _entries.external_memory_usage();
+        size_t size = _entries.external_memory_usage() + _tokens.external_memory_usage();
         for (auto&& e : _entries) {
             size += sizeof(index_entry) + e->external_memory_usage();
         }
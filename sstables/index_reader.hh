@@ -64,10 +64,13 @@ public:
     ~index_consumer() {
         with_allocator(_region.allocator(), [&] {
             indexes._entries.clear_and_release();
+            indexes._tokens.clear_and_release();
         });
     }
 
     void consume_entry(parsed_partition_index_entry&& e) {
+        auto token = _s->get_partitioner().get_token(
+                key_view(bytes_view(reinterpret_cast<const bytes::value_type*>(e.key.get()), e.key.size())));
         _alloc_section(_region, [&] {
             with_allocator(_region.allocator(), [&] {
                 managed_ref<promoted_index> pi;
@@ -79,7 +82,8 @@ public:
                             e.promoted_index->num_blocks);
                 }
                 auto key = managed_bytes(reinterpret_cast<const blob_storage::char_type*>(e.key.get()), e.key.size());
-                indexes._entries.emplace_back(make_managed<index_entry>(std::move(key), e.data_file_offset, std::move(pi)));
+                indexes._entries.emplace_back(make_managed<index_entry>(std::move(key), token, e.data_file_offset, std::move(pi)));
+                indexes._tokens.push_back(token);
             });
         });
     }
@@ -89,6 +93,7 @@ public:
         _alloc_section(_region, [&] {
             with_allocator(_region.allocator(), [&] {
                 indexes._entries.reserve(size);
+                indexes._tokens.reserve(size);
             });
         });
     }
@@ -335,7 +340,8 @@ std::unique_ptr<clustered_index_cursor> promoted_index::make_cursor(shared_sstab
         return std::make_unique<mc::bsearch_clustered_cursor>(*sst->get_schema(),
             _promoted_index_start, _promoted_index_size,
             promoted_index_cache_metrics, permit,
-            *ck_values_fixed_lengths, cached_file_ptr, options.io_priority_class, _num_blocks, trace_state);
+            *ck_values_fixed_lengths, cached_file_ptr, options.io_priority_class, _num_blocks, trace_state,
+            caching ? sst->_promoted_index_stash : nullptr);
     }
 
     auto file = make_tracked_index_file(*sst, permit, std::move(trace_state), caching);
@@ -672,20 +678,29 @@ private:
 
         return advance_to_page(bound, summary_idx).then([this, &bound, pos, summary_idx] {
             sstlog.trace("index {}: old page index = {}", fmt::ptr(this), bound.current_index_idx);
-            auto i = _alloc_section(_region, [&] {
+            auto idx = _alloc_section(_region, [&] {
+                // Binary-search the fixed-stride token table first. Its probes
+                // touch contiguous memory; only entries whose token collides
+                // with the sought position are dereferenced for a full key
+                // comparison.
+                auto& tokens = bound.current_list->_tokens;
+                auto t = std::lower_bound(tokens.begin() + bound.current_index_idx, tokens.end(), pos.token());
+                uint64_t i = std::distance(tokens.begin(), t);
                 auto& entries = bound.current_list->_entries;
-                return std::lower_bound(std::begin(entries) + bound.current_index_idx, std::end(entries), pos,
-                    index_comparator(*_sstable->_schema));
+                index_comparator cmp(*_sstable->_schema);
+                while (i < tokens.size() && !(pos.token() < tokens[i]) && cmp(entries[i], pos)) {
+                    ++i;
+                }
+                return i;
             });
-            // i is valid until next allocation point
             auto& entries = bound.current_list->_entries;
-            if (i == std::end(entries)) {
+            if (idx == entries.size()) {
                 sstlog.trace("index {}: not found", fmt::ptr(this));
                 return advance_to_page(bound, summary_idx + 1);
             }
-            bound.current_index_idx = std::distance(std::begin(entries), i);
+            bound.current_index_idx = idx;
             bound.current_pi_idx = 0;
-            bound.data_file_position = (*i)->position();
+            bound.data_file_position = entries[idx]->position();
             bound.element = indexable_element::partition;
             bound.end_open_marker.reset();
             sstlog.trace("index {}: new page index = {}, pos={}", fmt::ptr(this), bound.current_index_idx, bound.data_file_position);
@@ -14,11 +14,15 @@
 #include "parsers.hh"
 #include "schema.hh"
 #include "utils/cached_file.hh"
+#include "utils/chunked_vector.hh"
 
 #include <seastar/core/byteorder.hh>
 #include <seastar/core/on_internal_error.hh>
 
+#include <list>
 #include <optional>
+#include <set>
+#include <unordered_map>
 
 namespace sstables {
 
@@ -139,6 +143,8 @@ public:
             return lhs < rhs.index;
         }
     };
+
+    using block_set_type = std::set<promoted_index_block, block_comparator>;
 private:
     // Cache of the parsed promoted index blocks.
     //
@@ -152,7 +158,6 @@ private:
     // savings in CPU time from less over-reads more than compensate
     // for it.
     //
-    using block_set_type = std::set<promoted_index_block, block_comparator>;
     block_set_type _blocks;
 public:
     const schema& _s;
@@ -345,9 +350,133 @@ public:
         erase_range(_blocks.begin(), _blocks.lower_bound(block->index));
     }
 
+    // Moves the parsed blocks out, ordered by block index, so that they can
+    // outlive this instance (see promoted_index_stash). The blocks remain
+    // accounted as cached in the metrics; whoever drops them afterwards is
+    // responsible for updating the metrics.
+    utils::chunked_vector<promoted_index_block> detach_blocks() {
+        utils::chunked_vector<promoted_index_block> blocks;
+        blocks.reserve(_blocks.size());
+        while (!_blocks.empty()) {
+            auto node = _blocks.extract(_blocks.begin());
+            blocks.emplace_back(std::move(node.value()));
+        }
+        return blocks;
+    }
+
+    // Re-adopts blocks previously returned by detach_blocks() of a cursor
+    // over the same promoted index. Must be called before any block was
+    // populated. blocks must be ordered by block index.
+    void adopt_blocks(utils::chunked_vector<promoted_index_block>&& blocks) {
+        for (auto&& b : blocks) {
+            _blocks.emplace_hint(_blocks.end(), std::move(b));
+        }
+    }
+
     cached_file& file() { return _cached_file; }
 };
 
+/// Shard-local stash of parsed promoted index blocks of idle partitions,
+/// keyed by the start offset of the promoted index within the index file.
+///
+/// cached_promoted_index parses blocks lazily while bisecting, and, being
+/// designed for a single user, its parsed set used to die with the cursor.
+/// As a result, every slice read of the same wide partition parsed the same
+/// blocks again, paying several index page reads per read when the index
+/// pages had been evicted. Cursors donate their parsed sets here on
+/// destruction and adopt them back on creation, so repeated slice reads of
+/// a hot, wide partition bisect over already-materialized blocks.
+///
+/// Only sets not owned by any live cursor are stashed, which preserves the
+/// single-user discipline of cached_promoted_index. The stash is bounded;
+/// least recently stashed sets are dropped first.
+class promoted_index_stash {
+public:
+    using promoted_index_block = cached_promoted_index::promoted_index_block;
+    using block_vector = utils::chunked_vector<promoted_index_block>;
+    // Big enough for the parsed blocks of a few hot wide partitions;
+    // bisection materializes O(log(blocks)) blocks per read.
+    static constexpr size_t default_max_bytes = 128 * 1024;
+private:
+    struct entry {
+        uint64_t key;
+        block_vector blocks;
+        size_t bytes;
+    };
+    std::list<entry> _lru; // front is the most recently stashed
+    std::unordered_map<uint64_t, std::list<entry>::iterator> _entries;
+    size_t _bytes = 0;
+    size_t _max_bytes;
+    cached_promoted_index::metrics& _metrics;
+private:
+    void drop(std::list<entry>::iterator i) {
+        for (const promoted_index_block& b : i->blocks) {
+            --_metrics.block_count;
+            ++_metrics.evictions;
+            _metrics.used_bytes -= b.memory_usage();
+        }
+        _bytes -= i->bytes;
+        _entries.erase(i->key);
+        _lru.erase(i);
+    }
+public:
+    explicit promoted_index_stash(cached_promoted_index::metrics& m, size_t max_bytes = default_max_bytes)
+        : _max_bytes(max_bytes)
+        , _metrics(m)
+    { }
+
+    ~promoted_index_stash() {
+        while (!_lru.empty()) {
+            drop(_lru.begin());
+        }
+    }
+
+    promoted_index_stash(const promoted_index_stash&) = delete;
+    promoted_index_stash& operator=(const promoted_index_stash&) = delete;
+
+    // Removes and returns the stashed blocks for the given key, if any.
+    // The returned blocks remain accounted as cached in the metrics.
+    std::optional<block_vector> take(uint64_t key) {
+        auto i = _entries.find(key);
+        if (i == _entries.end()) {
+            return std::nullopt;
+        }
+        auto blocks = std::move(i->second->blocks);
+        _bytes -= i->second->bytes;
+        _lru.erase(i->second);
+        _entries.erase(i);
+        return blocks;
+    }
+
+    // Stashes the given blocks under the given key, evicting least recently
+    // stashed sets when over budget. Replaces any set previously stashed
+    // under the same key.
+    void put(uint64_t key, block_vector blocks) {
+        size_t bytes = 0;
+        for (const promoted_index_block& b : blocks) {
+            bytes += b.memory_usage();
+        }
+        if (auto i = _entries.find(key); i != _entries.end()) {
+            drop(i->second);
+        }
+        if (bytes > _max_bytes) {
+            // Would never fit; don't evict everything else for its sake.
+            for (const promoted_index_block& b : blocks) {
+                --_metrics.block_count;
+                ++_metrics.evictions;
+                _metrics.used_bytes -= b.memory_usage();
+            }
+            return;
+        }
+        _lru.push_front(entry{key, std::move(blocks), bytes});
+        _entries.emplace(key, _lru.begin());
+        _bytes += bytes;
+        while (_bytes > _max_bytes) {
+            drop(std::prev(_lru.end()));
+        }
+    }
+};
+
 /// Cursor implementation which does binary search over index entries.
 ///
 /// Memory consumption: O(log(N))
@@ -379,6 +508,11 @@ class bsearch_clustered_cursor : public clustered_index_cursor {
     std::optional<position_in_partition> _current_pos;
 
     tracing::trace_state_ptr _trace_state;
+
+    // When engaged, parsed blocks are adopted from and donated back to the
+    // stash, surviving across cursors over the same partition.
+    seastar::shared_ptr<promoted_index_stash> _stash;
+    uint64_t _stash_key;
 private:
     // Advances the cursor to the nearest block whose start position is > pos.
     //
@@ -444,7 +578,8 @@ public:
             seastar::shared_ptr<cached_file> f,
             io_priority_class pc,
             pi_index_type blocks_count,
-            tracing::trace_state_ptr trace_state)
+            tracing::trace_state_ptr trace_state,
+            seastar::shared_ptr<promoted_index_stash> stash = nullptr)
         : _s(s)
         , _blocks_count(blocks_count)
         , _cached_file(std::move(f))
@@ -458,7 +593,21 @@ public:
             pc,
             blocks_count)
         , _trace_state(std::move(trace_state))
-    { }
+        , _stash(std::move(stash))
+        , _stash_key(promoted_index_start)
+    {
+        if (_stash) {
+            if (auto blocks = _stash->take(_stash_key)) {
+                _promoted_index.adopt_blocks(std::move(*blocks));
+            }
+        }
+    }
+
+    ~bsearch_clustered_cursor() {
+        if (_stash) {
+            _stash->put(_stash_key, _promoted_index.detach_blocks());
+        }
+    }
 
     future<std::optional<skip_info>> advance_to(position_in_partition_view pos) override {
         position_in_partition::less_compare less(_s);
@@ -680,6 +680,14 @@ private:
         return dt;
     }
 
+    // Liveness info of the row being written, against which write_cell()
+    // compares each cell: cells sharing the row's timestamp and/or TTL are
+    // emitted with just the use_row_timestamp/use_row_ttl flags and no
+    // per-cell liveness payload, so rows whose cells were all written by one
+    // INSERT cost a single liveness read on the read path. Rows without a
+    // marker (e.g. built by UPDATEs) leave the fields unset - the format has
+    // no row-level liveness to refer to in that case - and their cells carry
+    // individual delta-encoded timestamps.
     struct row_time_properties {
         std::optional<api::timestamp_type> timestamp;
         std::optional<gc_clock::duration> ttl;
@@ -794,7 +802,11 @@ public:
         _sst._shards = { shard };
 
         _cfg.monitor->on_write_started(_data_writer->offset_tracker());
-        _sst._components->filter = utils::i_filter::get_filter(estimated_partitions, _schema.bloom_filter_fp_chance(), utils::filter_format::m_format);
+        auto fp_chance = _schema.bloom_filter_fp_chance();
+        if (_sst.manager().config().bloom_filter_level_aware_sizing()) {
+            fp_chance = utils::bloom_calculations::fp_chance_for_level(fp_chance, cfg.sstable_level.value_or(0));
+        }
+        _sst._components->filter = utils::i_filter::get_filter(estimated_partitions, fp_chance, utils::filter_format::m_format);
         _pi_write_m.promoted_index_block_size = cfg.promoted_index_block_size;
         _pi_write_m.promoted_index_auto_scale_threshold = cfg.promoted_index_auto_scale_threshold;
         _index_sampling_state.summary_byte_cost = _cfg.summary_byte_cost;
@@ -884,11 +896,22 @@ void writer::init_file_writers() {
         _data_writer = std::make_unique<crc32_checksummed_file_writer>(std::move(out), options.buffer_size, _sst.filename(component_type::Data));
     } else {
         auto out = make_file_output_stream(std::move(_sst._data_file), options).get0();
-        _data_writer = std::make_unique<file_writer>(
-            make_compressed_file_m_format_output_stream(
+        auto cp = _schema.get_compressor_params();
+        if (_cfg.compression_chunk_length) {
+            cp.set_chunk_length(*_cfg.compression_chunk_length);
+        }
+        auto compressed = make_compressed_file_m_format_output_stream(
                 std::move(out),
                 &_sst._components->compression,
-                _schema.get_compressor_params()), _sst.filename(component_type::Data));
+                cp);
+        if (_cfg.background_compression_group && cp.get_compressor()->name() == compressor::namespace_prefix + "ZstdCompressor") {
+            // zstd is expensive enough for inline compression to dominate
+            // the latency of the path feeding the writer; cheap compressors
+            // are not worth the extra buffering of the pipeline.
+            compressed = make_pipelined_compression_output_stream(
+                    std::move(compressed), cp.chunk_length(), *_cfg.background_compression_group);
+        }
+        _data_writer = std::make_unique<file_writer>(std::move(compressed), _sst.filename(component_type::Data));
     }
     auto w = file_writer::make(std::move(_sst._index_file), std::move(options), _sst.filename(component_type::Index));
     _index_writer = std::make_unique<file_writer>(w.get0());
@@ -113,6 +113,8 @@ public:
         {
             if (_ref->is_linked()) {
                 _ref->_parent->_lru.remove(*_ref);
+                // Reuse of an idle page; have the re-add promote it.
+                lru::mark_hot(*_ref);
             }
         }
         ~entry_ptr() { *this = nullptr; }
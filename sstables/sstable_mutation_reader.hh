@@ -118,8 +118,15 @@ inline std::unique_ptr<DataConsumeRowsContext> data_consume_rows(const schema& s
     // This potentially enables read-ahead beyond end, until last_end, which
     // can be beneficial if the user wants to fast_forward_to() on the
     // returned context, and may make small skips.
+    // Range scans are sequential and move a lot of data; size the readahead
+    // window and the buffers per scheduling group so neither analytics scans
+    // nor compaction ever block on disk while sharing it with the other, and
+    // so compaction consumes each of its many inputs in long sequential
+    // bursts rather than interleaving buffer-sized reads of all of them.
+    auto read_ahead = sst->manager().range_scan_read_ahead(consumer.io_priority());
+    auto buffer_size = sst->manager().range_scan_buffer_size(consumer.io_priority());
     auto input = sst->data_stream(toread.start, last_end - toread.start, consumer.io_priority(),
-            consumer.permit(), consumer.trace_state(), sst->_partition_range_history);
+            consumer.permit(), consumer.trace_state(), sst->_partition_range_history, sstable::raw_stream::no, read_ahead, buffer_size);
     return std::make_unique<DataConsumeRowsContext>(s, std::move(sst), consumer, std::move(input), toread.start, toread.end - toread.start);
 }
 
@@ -152,8 +159,19 @@ inline reversed_context<DataConsumeRowsContext> data_consume_reversed_partition(
 
 template <typename DataConsumeRowsContext>
 inline std::unique_ptr<DataConsumeRowsContext> data_consume_single_partition(const schema& s, shared_sstable sst, typename DataConsumeRowsContext::consumer& consumer, sstable::disk_read_range toread) {
+    // Most single-partition reads span a couple of buffers and the default
+    // window is plenty. A slice of a very wide partition is a long
+    // sequential read though, and a deeper window keeps several reads in
+    // flight at once, so it scales with the disk's queue depth instead of
+    // being bound by per-request latency. The stream's dynamic adjustments
+    // shrink the window back if the consumer turns out to skip over most
+    // of the range via the promoted index.
+    auto read_ahead = sstable::default_read_ahead;
+    if (toread.end - toread.start > read_ahead * sst->sstable_buffer_size) {
+        read_ahead = std::max(read_ahead, sst->manager().range_scan_read_ahead(consumer.io_priority()));
+    }
     auto input = sst->data_stream(toread.start, toread.end - toread.start, consumer.io_priority(),
-            consumer.permit(), consumer.trace_state(), sst->_single_partition_history);
+            consumer.permit(), consumer.trace_state(), sst->_single_partition_history, sstable::raw_stream::no, read_ahead);
     return std::make_unique<DataConsumeRowsContext>(s, std::move(sst), consumer, std::move(input), toread.start, toread.end - toread.start);
 }
 
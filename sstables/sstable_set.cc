@@ -773,9 +773,31 @@ make_pk_filter(const dht::ring_position& pos, const schema& schema) {
 
 // Filter out sstables for reader using bloom filter
 static std::vector<shared_sstable>
-filter_sstable_for_reader_by_pk(std::vector<shared_sstable>&& sstables, const schema& schema, const dht::ring_position& pos) {
-    auto filter = [_filter = make_pk_filter(pos, schema)] (const shared_sstable& sst) { return !_filter(*sst); };
-    sstables.erase(boost::remove_if(sstables, filter), sstables.end());
+filter_sstable_for_reader_by_pk(std::vector<shared_sstable>&& sstables, replica::column_family& cf, const schema& schema, const dht::ring_position& pos) {
+    auto cmp = dht::ring_position_comparator(schema);
+    sstables.erase(boost::remove_if(sstables, [&] (const shared_sstable& sst) {
+        return cmp(pos, sst->get_first_decorated_key()) < 0 || cmp(pos, sst->get_last_decorated_key()) > 0;
+    }), sstables.end());
+    auto hk = utils::make_hashed_key(static_cast<bytes_view>(key::from_partition_key(schema, *pos.key())));
+    // One probe of the table's shared flush-run filter speaks for every
+    // flush-produced sstable it covers, so a burst of memtable flushes
+    // doesn't cost a point read one filter probe per small sstable.
+    if (cf.flush_run_filter_excludes(hk)) {
+        auto covered = boost::remove_if(sstables, [&] (const shared_sstable& sst) {
+            return cf.flush_run_filter_covers(*sst);
+        });
+        cf.cf_stats()->sstables_pruned_by_flush_filter += std::distance(covered, sstables.end());
+        sstables.erase(covered, sstables.end());
+    }
+    // Prefetch every remaining filter's probe words before testing, so that
+    // probing the key against many sstables overlaps the cache misses
+    // instead of taking them one filter at a time.
+    for (const shared_sstable& sst : sstables) {
+        sst->filter_prefetch(hk);
+    }
+    sstables.erase(boost::remove_if(sstables, [&] (const shared_sstable& sst) {
+        return !sst->filter_has_key(hk);
+    }), sstables.end());
     return std::move(sstables);
 }
 
@@ -832,7 +854,7 @@ sstable_set_impl::create_single_key_sstable_reader(
         mutation_reader::forwarding fwd_mr) const
 {
     const auto& pos = pr.start()->value();
-    auto selected_sstables = filter_sstable_for_reader_by_pk(select(pr), *schema, pos);
+    auto selected_sstables = filter_sstable_for_reader_by_pk(select(pr), *cf, *schema, pos);
     auto num_sstables = selected_sstables.size();
     if (!num_sstables) {
         return make_empty_flat_reader_v2(schema, permit);
@@ -841,6 +863,7 @@ sstable_set_impl::create_single_key_sstable_reader(
         filter_sstable_for_reader_by_ck(std::move(selected_sstables), *cf, schema, slice)
         | boost::adaptors::transformed([&] (const shared_sstable& sstable) {
             tracing::trace(trace_state, "Reading key {} from sstable {}", pos, seastar::value_of([&sstable] { return sstable->get_filename(); }));
+            sstable->bump_read_hotness();
             return sstable->make_reader(schema, permit, pr, slice, pc, trace_state, fwd);
         })
     );
@@ -1136,6 +1159,30 @@ sstable_set::create_single_key_sstable_reader(
             std::move(permit), sstable_histogram, pr, slice, pc, std::move(trace_state), fwd, fwd_mr);
 }
 
+// The clustering ranges to prune whole sstables by in a range scan, or
+// nullopt when pruning doesn't apply. When the query restricts the
+// clustering key, an sstable whose [min, max] clustering bounds don't
+// intersect the queried ranges contributes nothing and its reader doesn't
+// have to be created at all. This matters most for time-series tables under
+// TWCS, where a scan restricted to recent timestamps overlaps a single time
+// window while the set holds dozens: each pruned sstable costs an in-memory
+// bounds check instead of a reader with its index lookups. Pruning is
+// disabled when the slice selects static columns, since an sstable may hold
+// a partition's static row without any clustered rows in the queried ranges;
+// may_contain_rows() itself is conservative about partition tombstones and
+// about sstables too old to carry trustworthy min/max metadata.
+static std::optional<query::clustering_row_ranges> clustering_pruning_ranges(const schema& s, const query::partition_slice& slice) {
+    if (!s.clustering_key_size() || slice.static_columns.size()) {
+        return std::nullopt;
+    }
+    auto ranges = slice.get_all_ranges();
+    if (ranges.size() == 1 && ranges[0].is_full()) {
+        // The common unrestricted scan; nothing can be pruned.
+        return std::nullopt;
+    }
+    return ranges;
+}
+
 flat_mutation_reader_v2
 sstable_set::make_range_sstable_reader(
         schema_ptr s,
@@ -1148,8 +1195,12 @@ sstable_set::make_range_sstable_reader(
         mutation_reader::forwarding fwd_mr,
         read_monitor_generator& monitor_generator) const
 {
-    auto reader_factory_fn = [s, permit, &slice, &pc, trace_state, fwd, fwd_mr, &monitor_generator]
+    auto reader_factory_fn = [s, permit, &slice, &pc, trace_state, fwd, fwd_mr, &monitor_generator,
+            pruning_ranges = clustering_pruning_ranges(*s, slice)]
             (shared_sstable& sst, const dht::partition_range& pr) mutable {
+        if (pruning_ranges && !sst->may_contain_rows(*pruning_ranges)) {
+            return make_empty_flat_reader_v2(s, permit);
+        }
         return sst->make_reader(s, permit, pr, slice, pc, trace_state, fwd, fwd_mr, monitor_generator(sst));
     };
     return make_combined_reader(s, std::move(permit), std::make_unique<incremental_reader_selector>(s,
@@ -1173,9 +1224,13 @@ sstable_set::make_local_shard_sstable_reader(
         mutation_reader::forwarding fwd_mr,
         read_monitor_generator& monitor_generator) const
 {
-    auto reader_factory_fn = [s, permit, &slice, &pc, trace_state, fwd, fwd_mr, &monitor_generator]
+    auto reader_factory_fn = [s, permit, &slice, &pc, trace_state, fwd, fwd_mr, &monitor_generator,
+            pruning_ranges = clustering_pruning_ranges(*s, slice)]
             (shared_sstable& sst, const dht::partition_range& pr) mutable {
         assert(!sst->is_shared());
+        if (pruning_ranges && !sst->may_contain_rows(*pruning_ranges)) {
+            return make_empty_flat_reader_v2(s, permit);
+        }
         return sst->make_reader(s, permit, pr, slice, pc, trace_state, fwd, fwd_mr, monitor_generator(sst));
     };
     if (auto sstables = _impl->all(); sstables->size() == 1) [[unlikely]] {
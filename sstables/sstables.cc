@@ -7,6 +7,7 @@
  */
 
 #include "log.hh"
+#include <cmath>
 #include <vector>
 #include <typeinfo>
 #include <limits>
@@ -538,8 +539,30 @@ future<> parse(const schema& schema, sstable_version_types v, random_access_read
 
     s.entries.reserve(s.header.size);
 
+    // Keys are hashed a batch at a time rather than one by one, which lets
+    // the partitioner pipeline the hashing of independent keys.
+    constexpr size_t keys_per_batch = 1024;
+    std::vector<bytes_view> keys;
+    std::vector<uint64_t> entry_positions;
+    std::vector<dht::token> tokens;
+    keys.reserve(keys_per_batch);
+    entry_positions.reserve(keys_per_batch);
+    tokens.reserve(keys_per_batch);
+
+    auto flush_entries = [&] {
+        tokens.clear();
+        schema.get_partitioner().get_tokens(keys, tokens);
+        for (size_t i = 0; i != keys.size(); ++i) {
+            s.add_summary_data(tokens[i].data());
+            s.entries.push_back({ tokens[i], keys[i], entry_positions[i] });
+        }
+        keys.clear();
+        entry_positions.clear();
+    };
+
     int idx = 0;
-    while (s.entries.size() != s.header.size) {
+    size_t nr_parsed = 0;
+    while (nr_parsed != s.header.size) {
         auto pos = s.positions[idx++];
         auto next = s.positions[idx];
 
@@ -552,11 +575,16 @@ future<> parse(const schema& schema, sstable_version_types v, random_access_read
         buf.trim_front(keysize);
 
         // position is little-endian encoded
-        auto position = seastar::read_le<uint64_t>(buf.get());
-        auto token = schema.get_partitioner().get_token(key_view(key_data));
-        s.add_summary_data(token.data());
-        s.entries.push_back({ token, key_data, position });
+        entry_positions.push_back(seastar::read_le<uint64_t>(buf.get()));
+        keys.push_back(key_data);
+        ++nr_parsed;
+
+        if (keys.size() == keys_per_batch) {
+            flush_entries();
+            co_await coroutine::maybe_yield();
+        }
     }
+    flush_entries();
     // Delete last element which isn't part of the on-disk format.
     s.positions.pop_back();
 }
@@ -1316,6 +1344,13 @@ double sstable::estimate_droppable_tombstone_ratio(gc_clock::time_point gc_befor
     return 0.0f;
 }
 
+bool sstable::may_have_tombstones() const {
+    // The writers record every tombstone (partition, range, row and cell)
+    // and every expiring cell in this histogram, so an empty one proves
+    // there is nothing the compaction machinery could drop or purge.
+    return get_stats_metadata().estimated_tombstone_drop_time.bin.size() > 0;
+}
+
 future<> sstable::read_statistics(const io_priority_class& pc) {
     return read_simple<component_type::Statistics>(_components->statistics, pc);
 }
@@ -1351,10 +1386,14 @@ future<> sstable::read_summary(const io_priority_class& pc) noexcept {
         if (has_component(component_type::Summary)) {
             return read_simple<component_type::Summary>(_components->summary, pc).handle_exception([this, &pc] (auto ep) {
                 sstlog.warn("Couldn't read summary file {}: {}. Recreating it.", this->filename(component_type::Summary), ep);
-                return this->generate_summary(pc);
+                return this->generate_summary(pc).then([this, &pc] {
+                    return this->maybe_persist_summary(pc);
+                });
             });
         } else {
-            return generate_summary(pc);
+            return generate_summary(pc).then([this, &pc] {
+                return maybe_persist_summary(pc);
+            });
         }
     });
 }
@@ -1392,6 +1431,7 @@ future<> sstable::open_data(sstable_open_config cfg) noexcept {
     }
     _open_mode.emplace(open_flags::ro);
     _stats.on_open_for_reading();
+    _manager.account_filter_memory(this);
 }
 
 future<> sstable::update_info_for_opened_data(sstable_open_config cfg) {
@@ -1412,6 +1452,9 @@ future<> sstable::update_info_for_opened_data(sstable_open_config cfg) {
                                                             _manager.get_cache_tracker().region(),
                                                             _index_file_size);
     _index_file = make_cached_seastar_file(*_cached_index_file);
+    if (get_version() >= sstable_version_types::mc) {
+        _promoted_index_stash = seastar::make_shared<mc::promoted_index_stash>(promoted_index_cache_metrics);
+    }
 
     if (this->has_component(component_type::Filter)) {
         auto size = co_await io_check([&] {
@@ -1425,8 +1468,10 @@ future<> sstable::update_info_for_opened_data(sstable_open_config cfg) {
     _run_identifier = _components->scylla_metadata->get_optional_run_identifier().value_or(run_id::create_random_id());
 
     // Get disk usage for this sstable (includes all components).
+    // Stat the components in parallel; on a cold boot these small
+    // serialized I/Os dominate the per-sstable open latency.
     _bytes_on_disk = 0;
-    for (component_type c : _recognized_components) {
+    co_await coroutine::parallel_for_each(_recognized_components, coroutine::lambda([&] (component_type c) -> future<> {
         uint64_t bytes = co_await this->sstable_write_io_check(coroutine::lambda([&] () -> future<uint64_t> {
             future<seastar::stat_data> f = co_await coroutine::as_future(file_stat(this->filename(c)));
             if (f.failed()) [[unlikely]] {
@@ -1443,7 +1488,7 @@ future<> sstable::update_info_for_opened_data(sstable_open_config cfg) {
             co_return f.get0().allocated_size;
         }));
         _bytes_on_disk += bytes;
-    }
+    }));
     if (cfg.load_first_and_last_position_metadata) {
         co_await load_first_and_last_position_in_partition();
     }
@@ -1465,6 +1510,28 @@ future<> sstable::drop_caches() {
     });
 }
 
+future<size_t> sstable::warm_up_index_cache(const io_priority_class& pc, size_t max_bytes) {
+    if (!_cached_index_file) {
+        co_return 0;
+    }
+    auto to_read = std::min<uint64_t>(max_bytes, _cached_index_file->size());
+    uint64_t offset = 0;
+    while (offset < to_read) {
+        // Reading populates the page cache as a side effect; the buffers
+        // themselves are discarded. The size hint only applies to a stream's
+        // first read, so open a fresh stream per chunk to keep the misses
+        // full-sized; pages already brought in by the previous chunk's
+        // readahead are hits and cost nothing.
+        auto stream = _cached_index_file->read(offset, pc, std::nullopt, {}, default_sstable_buffer_size);
+        auto buf = co_await stream.next();
+        if (buf.empty()) {
+            break;
+        }
+        offset += buf.size();
+    }
+    co_return offset;
+}
+
 future<> sstable::read_filter(const io_priority_class& pc) {
     if (!has_component(component_type::Filter)) {
         _components->filter = std::make_unique<utils::filter::always_present_filter>();
@@ -1495,6 +1562,22 @@ void sstable::write_filter(const io_priority_class& pc) {
     write_simple<component_type::Filter>(filter_ref, pc);
 }
 
+uint64_t sstable::reclaim_filter() noexcept {
+    if (!_components->filter) {
+        return 0;
+    }
+    auto mem = _components->filter->memory_size();
+    if (!mem) {
+        return 0;
+    }
+    try {
+        _components->filter = std::make_unique<utils::filter::always_present_filter>();
+    } catch (...) {
+        return 0;
+    }
+    return mem;
+}
+
 // This interface is only used during tests, snapshot loading and early initialization.
 // No need to set tunable priorities for it.
 future<> sstable::load(const io_priority_class& pc, sstable_open_config cfg) noexcept {
@@ -1525,7 +1608,9 @@ future<> sstable::load(sstables::foreign_sstable_open_info info) noexcept {
         validate_min_max_metadata();
         validate_max_local_deletion_time();
         validate_partitioner();
-        return update_info_for_opened_data();
+        return update_info_for_opened_data().then([this] {
+            _manager.account_filter_memory(this);
+        });
     });
 }
 
@@ -1893,6 +1978,30 @@ future<> sstable::generate_summary(const io_priority_class& pc) {
     }
 }
 
+future<> sstable::maybe_persist_summary(const io_priority_class& pc) noexcept {
+    try {
+        auto summary_path = filename(component_type::Summary);
+        // Don't overwrite an existing (corrupt) Summary; leave it in place
+        // for inspection. Its replacement lives on in memory.
+        if (co_await sstable_write_io_check(file_exists, summary_path)) {
+            co_return;
+        }
+        co_await seastar::async([this, &pc] {
+            write_summary(pc);
+        });
+        sstlog.info("Persisted recreated summary file {}", summary_path);
+    } catch (const std::system_error& ex) {
+        if (ex.code().value() == EEXIST) {
+            // Another shard loading the same sstable beat us to it.
+            sstlog.debug("Summary file {} already persisted by another shard", filename(component_type::Summary));
+        } else {
+            sstlog.warn("Failed to persist recreated summary file {}: {}", filename(component_type::Summary), std::current_exception());
+        }
+    } catch (...) {
+        sstlog.warn("Failed to persist recreated summary file {}: {}", filename(component_type::Summary), std::current_exception());
+    }
+}
+
 bool sstable::is_shared() const {
     if (_shards.empty()) {
         on_internal_error(sstlog, format("Shards weren't computed for SSTable: {}", get_filename()));
@@ -2256,6 +2365,25 @@ future<> sstable::delayed_commit_changes::commit() {
     });
 }
 
+// Half-life of the read-hotness counter. Short enough to follow workload
+// shifts within the hour, long enough to not forget a hot sstable between
+// two compaction rounds.
+static constexpr auto read_hotness_half_life = std::chrono::minutes(10);
+
+static double read_hotness_decay_factor(lowres_clock::duration elapsed) noexcept {
+    return std::exp2(-std::chrono::duration<double>(elapsed).count() / std::chrono::duration<double>(read_hotness_half_life).count());
+}
+
+void sstable::bump_read_hotness() noexcept {
+    auto now = lowres_clock::now();
+    _read_hotness = _read_hotness * read_hotness_decay_factor(now - _read_hotness_decayed_at) + 1.0;
+    _read_hotness_decayed_at = now;
+}
+
+double sstable::read_hotness() const noexcept {
+    return _read_hotness * read_hotness_decay_factor(lowres_clock::now() - _read_hotness_decayed_at);
+}
+
 flat_mutation_reader_v2
 sstable::make_reader(
         schema_ptr schema,
@@ -2405,11 +2533,12 @@ component_type sstable::component_from_sstring(version_types v, sstring &s) {
 }
 
 input_stream<char> sstable::data_stream(uint64_t pos, size_t len, const io_priority_class& pc,
-        reader_permit permit, tracing::trace_state_ptr trace_state, lw_shared_ptr<file_input_stream_history> history, raw_stream raw) {
+        reader_permit permit, tracing::trace_state_ptr trace_state, lw_shared_ptr<file_input_stream_history> history, raw_stream raw,
+        unsigned read_ahead, size_t buffer_size) {
     file_input_stream_options options;
-    options.buffer_size = sstable_buffer_size;
+    options.buffer_size = buffer_size ? buffer_size : sstable_buffer_size;
     options.io_priority_class = pc;
-    options.read_ahead = 4;
+    options.read_ahead = read_ahead;
     options.dynamic_adjustments = std::move(history);
 
     file f = make_tracked_file(_data_file, permit);
@@ -2419,12 +2548,13 @@ input_stream<char> sstable::data_stream(uint64_t pos, size_t len, const io_prior
 
     input_stream<char> stream;
     if (_components->compression && raw == raw_stream::no) {
+        auto decompression_sg = _manager.background_decompression_group();
         if (_version >= sstable_version_types::mc) {
              return make_compressed_file_m_format_input_stream(f, &_components->compression,
-                pos, len, std::move(options), permit);
+                pos, len, std::move(options), permit, decompression_sg);
         } else {
             return make_compressed_file_k_l_format_input_stream(f, &_components->compression,
-                pos, len, std::move(options), permit);
+                pos, len, std::move(options), permit, decompression_sg);
         }
     }
 
@@ -3135,6 +3265,11 @@ future<> init_metrics() {
         sm::make_counter("row_reads", [] { return sstables_stats::get_shard_stats().row_reads; },
             sm::description("Number of rows read")),
 
+        sm::make_counter("compressed_chunk_cache_hits", [] { return sstables_stats::get_shard_stats().compressed_chunk_cache_hits; },
+            sm::description("Number of compressed data chunk reads served from the compressed chunk cache")),
+        sm::make_counter("compressed_chunk_cache_misses", [] { return sstables_stats::get_shard_stats().compressed_chunk_cache_misses; },
+            sm::description("Number of compressed data chunk reads which had to go to disk")),
+
         sm::make_counter("capped_local_deletion_time", [] { return sstables_stats::get_shard_stats().capped_local_deletion_time; },
             sm::description("Was local deletion time capped at maximum allowed value in Statistics")),
         sm::make_counter("capped_tombstone_deletion_time", [] { return sstables_stats::get_shard_stats().capped_tombstone_deletion_time; },
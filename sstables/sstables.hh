@@ -16,7 +16,9 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/core/enum.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <unordered_set>
 #include <unordered_map>
 #include <variant>
@@ -55,6 +57,7 @@ extern thread_local utils::updateable_value<bool> global_cache_index_pages;
 
 namespace mc {
 class writer;
+class promoted_index_stash;
 }
 
 namespace mx {
@@ -108,6 +111,16 @@ struct sstable_writer_config {
     run_id run_identifier = run_id::create_random_id();
     size_t summary_byte_cost;
     sstring origin;
+    // When engaged, chunks of the data file of tables with an expensive
+    // compressor (zstd) are compressed by a background fiber running in
+    // this scheduling group, behind a bounded queue, instead of inline in
+    // the writer. See make_pipelined_compression_output_stream().
+    std::optional<seastar::scheduling_group> background_compression_group;
+    // When engaged, the data file is compressed with this chunk length
+    // (in bytes) instead of the one from the table's compression
+    // parameters. Lets compaction write rarely-read sstables with larger
+    // chunks for a better compression ratio.
+    std::optional<uint32_t> compression_chunk_length;
 
 private:
     explicit sstable_writer_config() {}
@@ -225,6 +238,13 @@ public:
         return _generation;
     }
 
+    // Read-hotness tracking: an exponentially decaying count of point reads
+    // served by this sstable, bumped on the single-key read path. Compaction
+    // uses it to prefer compacting the sstables which currently cause the
+    // most read fan-out.
+    void bump_read_hotness() noexcept;
+    double read_hotness() const noexcept;
+
     // Returns a mutation_reader for given range of partitions.
     //
     // Precondition: if the slice is reversed, the schema must be reversed as well.
@@ -528,10 +548,17 @@ private:
     std::set<generation_type> _compaction_ancestors;
     file _index_file;
     seastar::shared_ptr<cached_file> _cached_index_file;
+    // Keeps parsed promoted index blocks of recently read wide partitions
+    // alive across index cursors, see mc::promoted_index_stash.
+    seastar::shared_ptr<mc::promoted_index_stash> _promoted_index_stash;
     file _data_file;
     uint64_t _data_file_size;
     uint64_t _index_file_size;
     uint64_t _filter_file_size = 0;
+    // Whether this sstable's bloom filter memory is currently accounted for
+    // (and reclaimable) by the manager, see
+    // sstables_manager::account_filter_memory().
+    bool _filter_memory_accounted = false;
     uint64_t _bytes_on_disk = 0;
     db_clock::time_point _data_file_write_time;
     position_range _min_max_position_range = position_range::all_clustered_rows();
@@ -576,6 +603,11 @@ private:
     sstables_stats _stats;
     manager_link_type _manager_link;
 
+    // See bump_read_hotness()/read_hotness(). The stored value is the count
+    // as of _read_hotness_decayed_at; readers apply the decay lazily.
+    mutable double _read_hotness = 0;
+    mutable seastar::lowres_clock::time_point _read_hotness_decayed_at;
+
     // The _large_data_stats map stores e.g. largest partitions, rows, cells sizes,
     // and max number of rows in a partition.
     //
@@ -622,6 +654,14 @@ private:
 
     void write_filter(const io_priority_class& pc);
 
+    // Frees the in-memory bloom filter, replacing it with one that reports
+    // every key as possibly present. Reads stay correct; probes for keys
+    // this sstable doesn't hold fall through to its index instead of being
+    // filtered out. Returns the number of bytes freed. Called by the
+    // manager when the filters of a shard's sstables outgrow their memory
+    // budget, see sstables_manager::maybe_reclaim_filter_memory().
+    uint64_t reclaim_filter() noexcept;
+
     future<> read_summary(const io_priority_class& pc) noexcept;
 
     void write_summary(const io_priority_class& pc) {
@@ -632,6 +672,12 @@ private:
     // happen if old tools are being used.
     future<> generate_summary(const io_priority_class& pc);
 
+    // Writes a summary recreated by generate_summary() back to disk, so the
+    // next load of this sstable doesn't repeat the full Index.db pass.
+    // Best effort: a failed write is logged and otherwise ignored, as the
+    // in-memory summary is intact either way.
+    future<> maybe_persist_summary(const io_priority_class& pc) noexcept;
+
     future<> read_statistics(const io_priority_class& pc);
     void write_statistics(const io_priority_class& pc);
     // Rewrite statistics component by creating a temporary Statistics and
@@ -681,8 +727,15 @@ public:
     // When created with `raw_stream::yes`, the sstable data file will be
     // streamed as-is, without decompressing (if compressed).
     using raw_stream = bool_class<class raw_stream_tag>;
+    // default_read_ahead suits random access; sequential scans should pass
+    // the window sized by sstables_manager::range_scan_read_ahead().
+    static constexpr unsigned default_read_ahead = 4;
+    // A zero buffer_size means the sstable's default (sstable_buffer_size).
+    // Sequential scans may pass a larger size to read the file in longer
+    // sequential bursts, see sstables_manager::range_scan_buffer_size().
     input_stream<char> data_stream(uint64_t pos, size_t len, const io_priority_class& pc,
-            reader_permit permit, tracing::trace_state_ptr trace_state, lw_shared_ptr<file_input_stream_history> history, raw_stream raw = raw_stream::no);
+            reader_permit permit, tracing::trace_state_ptr trace_state, lw_shared_ptr<file_input_stream_history> history, raw_stream raw = raw_stream::no,
+            unsigned read_ahead = default_read_ahead, size_t buffer_size = 0);
 
     // Read exactly the specific byte range from the data file (after
     // uncompression, if the file is compressed). This can be used to read
@@ -777,6 +830,14 @@ public:
         return _components->filter->is_present(key);
     }
 
+    // Starts pulling the filter words probed by the given key into cache.
+    // Callers probing one key against many sstables should prefetch all the
+    // filters first and only then call filter_has_key(), so the misses
+    // overlap across sstables.
+    void filter_prefetch(utils::hashed_key key) const {
+        _components->filter->prefetch(key);
+    }
+
     bool filter_has_key(const schema& s, partition_key_view key) const {
         return filter_has_key(key::from_partition_key(s, key));
     }
@@ -871,6 +932,11 @@ public:
     // for cells expired before gc_before and regular tombstones older than gc_before.
     double estimate_droppable_tombstone_ratio(gc_clock::time_point gc_before) const;
 
+    // Whether the sstable may contain tombstones of any kind, or expiring
+    // cells (which become tombstones once they expire). A false return is
+    // authoritative: the sstable holds only live, non-expiring data.
+    bool may_have_tombstones() const;
+
     // get sstable open info from a loaded sstable, which can be used to quickly open a sstable
     // at another shard.
     future<foreign_sstable_open_info> get_open_info() &;
@@ -904,6 +970,12 @@ public:
     // Drops all evictable in-memory caches of on-disk content.
     future<> drop_caches();
 
+    // Reads the front of the index file into the index page cache, up to
+    // max_bytes, so that the first reads against this sstable don't pull
+    // the pages in one cache miss at a time. Used by the post-startup
+    // warm-up. Returns the number of bytes brought in.
+    future<size_t> warm_up_index_cache(const io_priority_class& pc, size_t max_bytes);
+
     // Allow the test cases from sstable_test.cc to test private methods. We use
     // a placeholder to avoid cluttering this class too much. The sstable_test class
     // will then re-export as public every method it needs.
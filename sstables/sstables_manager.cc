@@ -6,13 +6,19 @@
  * SPDX-License-Identifier: AGPL-3.0-or-later
  */
 
+#include <algorithm>
+
+#include <seastar/core/coroutine.hh>
+
 #include "log.hh"
 #include "sstables/sstables_manager.hh"
+#include "sstables/compress.hh"
 #include "sstables/partition_index_cache.hh"
 #include "sstables/sstables.hh"
 #include "db/config.hh"
 #include "gms/feature.hh"
 #include "gms/feature_service.hh"
+#include "service/priority_manager.hh"
 
 namespace sstables {
 
@@ -27,7 +33,9 @@ sstables_manager::sstables_manager(
         "sstable_metadata_concurrency_sem",
         std::numeric_limits<size_t>::max())
     , _dir_semaphore(dir_sem)
+    , _available_memory(available_memory)
 {
+    set_compressed_chunk_cache_capacity(size_t(_db_config.sstable_compressed_chunk_cache_size_in_mb()) * 1024 * 1024);
 }
 
 sstables_manager::~sstables_manager() {
@@ -63,19 +71,108 @@ sstable_writer_config sstables_manager::configure_writer(sstring origin) const {
             ? mutation_fragment_stream_validation_level::clustering_key
             : mutation_fragment_stream_validation_level::token;
     cfg.summary_byte_cost = summary_byte_cost(_db_config.sstable_summary_ratio());
+    cfg.background_compression_group = _background_compression_group;
 
     cfg.origin = std::move(origin);
 
     return cfg;
 }
 
+void sstables_manager::mark_cold(shared_sstable sst) {
+    // Eviction proceeds in the background. The sstable reference held by the
+    // continuation keeps the sstable alive, which in turn keeps close() from
+    // completing before the eviction is done.
+    (void)sst->drop_caches().handle_exception([sst] (std::exception_ptr ep) {
+        smlogger.warn("Failed to evict caches of cold sstable {}: {}", sst->get_filename(), ep);
+    });
+}
+
+future<> sstables_manager::warm_up_index_caches() {
+    // The budget bounds both the warm-up work and the share of the cache it
+    // may fill before real reads take over and decide what is actually hot.
+    const size_t budget = _available_memory / 20;
+    // Snapshot the active sstables; the list changes under us once we yield.
+    std::vector<shared_sstable> ssts;
+    for (auto& sst : _active) {
+        ssts.push_back(sst.shared_from_this());
+    }
+    // Newest data first: with no read-hotness statistics surviving a restart,
+    // recency is the best available proxy for what the first reads will touch.
+    std::sort(ssts.begin(), ssts.end(), [] (const shared_sstable& a, const shared_sstable& b) {
+        return a->get_stats_metadata().max_timestamp > b->get_stats_metadata().max_timestamp;
+    });
+    const auto& pc = service::get_local_streaming_priority();
+    size_t warmed_bytes = 0;
+    size_t warmed_sstables = 0;
+    for (auto& sst : ssts) {
+        if (_closing || warmed_bytes >= budget) {
+            break;
+        }
+        try {
+            warmed_bytes += co_await sst->warm_up_index_cache(pc, budget - warmed_bytes);
+            ++warmed_sstables;
+        } catch (...) {
+            smlogger.warn("Failed to warm up the index cache of {}: {}", sst->get_filename(), std::current_exception());
+        }
+    }
+    smlogger.info("Index cache warm-up done: {} bytes across {} sstables", warmed_bytes, warmed_sstables);
+}
+
 void sstables_manager::add(sstable* sst) {
     _active.push_back(*sst);
 }
 
+void sstables_manager::account_filter_memory(sstable* sst) {
+    if (sst->_filter_memory_accounted) {
+        return;
+    }
+    const size_t mem = sst->filter_memory_size();
+    if (!mem) {
+        return;
+    }
+    _reclaimable_filters.emplace(mem, sst);
+    _total_filter_memory += mem;
+    sst->_filter_memory_accounted = true;
+    maybe_reclaim_filter_memory();
+}
+
+void sstables_manager::unaccount_filter_memory(sstable* sst) noexcept {
+    if (!sst->_filter_memory_accounted) {
+        return;
+    }
+    sst->_filter_memory_accounted = false;
+    // The filter's memory size doesn't change while it is accounted, so it
+    // still keys the sstable's entry.
+    auto [begin, end] = _reclaimable_filters.equal_range(sst->filter_memory_size());
+    for (auto it = begin; it != end; ++it) {
+        if (it->second == sst) {
+            _total_filter_memory -= it->first;
+            _reclaimable_filters.erase(it);
+            return;
+        }
+    }
+}
+
+void sstables_manager::maybe_reclaim_filter_memory() {
+    const size_t budget = _available_memory * std::clamp(_db_config.components_memory_reclaim_threshold(), 0.0, 1.0);
+    while (_total_filter_memory > budget && !_reclaimable_filters.empty()) {
+        // Largest filter first: frees the most memory while degrading the
+        // fewest sstables.
+        auto it = std::prev(_reclaimable_filters.end());
+        sstable* victim = it->second;
+        _total_filter_memory -= it->first;
+        _reclaimable_filters.erase(it);
+        victim->_filter_memory_accounted = false;
+        auto freed = victim->reclaim_filter();
+        smlogger.debug("Reclaimed {} bytes of bloom filter memory from {}; {} bytes of filters remain in memory",
+                freed, victim->get_filename(), _total_filter_memory);
+    }
+}
+
 void sstables_manager::deactivate(sstable* sst) {
     // At this point, sst has a reference count of zero, since we got here from
     // lw_shared_ptr_deleter<sstables::sstable>::dispose().
+    unaccount_filter_memory(sst);
     _active.erase(_active.iterator_to(*sst));
     _undergoing_close.push_back(*sst);
     // guard against sstable::close_files() calling shared_from_this() and immediately destroying
@@ -109,4 +206,18 @@ sstable_directory::components_lister sstables_manager::get_components_lister(std
     return sstable_directory::components_lister(std::move(dir));
 }
 
+unsigned sstables_manager::range_scan_read_ahead(const io_priority_class& pc) const {
+    if (pc.id() == service::get_local_compaction_priority().id()) {
+        return _db_config.sstable_compaction_read_ahead();
+    }
+    return _db_config.sstable_range_scan_read_ahead();
+}
+
+size_t sstables_manager::range_scan_buffer_size(const io_priority_class& pc) const {
+    if (pc.id() == service::get_local_compaction_priority().id()) {
+        return size_t(_db_config.sstable_compaction_read_buffer_size_in_kb()) << 10;
+    }
+    return default_sstable_buffer_size;
+}
+
 }   // namespace sstables
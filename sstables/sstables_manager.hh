@@ -25,6 +25,7 @@
 #include "reader_concurrency_semaphore.hh"
 
 #include <boost/intrusive/list.hpp>
+#include <map>
 
 namespace db {
 
@@ -71,6 +72,21 @@ private:
 
     reader_concurrency_semaphore _sstable_metadata_concurrency_sem;
     directory_semaphore& _dir_semaphore;
+    size_t _available_memory;
+    // When engaged, writers configured by this manager compress zstd data
+    // files in this scheduling group instead of inline. Set by the database
+    // when the sstable_background_compression config option is enabled.
+    std::optional<seastar::scheduling_group> _background_compression_group;
+    // When engaged, multi-chunk reads of zstd data files decompress their
+    // chunks in this scheduling group instead of the reading fiber's group.
+    // Set by the database when the sstable_background_decompression config
+    // option is enabled.
+    std::optional<seastar::scheduling_group> _background_decompression_group;
+    // Total memory occupied by the in-memory bloom filters of the active
+    // sstables, and the sstables whose filter is still reclaimable, keyed by
+    // that filter's memory size. See maybe_reclaim_filter_memory().
+    size_t _total_filter_memory = 0;
+    std::multimap<size_t, sstable*> _reclaimable_filters;
 public:
     explicit sstables_manager(db::large_data_handler& large_data_handler, const db::config& dbcfg, gms::feature_service& feat, cache_tracker&, size_t available_memory, directory_semaphore& dir_sem);
     virtual ~sstables_manager();
@@ -91,6 +107,40 @@ public:
     const db::config& config() const { return _db_config; }
     cache_tracker& get_cache_tracker() { return _cache_tracker; }
 
+    // Readahead window, in buffers, for sequential data file scans issued
+    // with the given I/O priority. Compaction scans and query/streaming
+    // scans are sized independently, see sstable_compaction_read_ahead and
+    // sstable_range_scan_read_ahead.
+    unsigned range_scan_read_ahead(const io_priority_class& pc) const;
+
+    // Buffer size for sequential data file scans issued with the given I/O
+    // priority. Compaction reads its inputs with larger buffers so each
+    // input is consumed in long sequential bursts instead of interleaving
+    // buffer-sized reads of all inputs, see
+    // sstable_compaction_read_buffer_size_in_kb.
+    size_t range_scan_buffer_size(const io_priority_class& pc) const;
+
+    // Offload compression of zstd data files written by sstable writers
+    // configured by this manager to the given scheduling group.
+    void set_background_compression_group(seastar::scheduling_group sg) noexcept { _background_compression_group = sg; }
+
+    // Isolate zstd decompression of sequential scans of sstables managed by
+    // this manager into the given scheduling group.
+    void set_background_decompression_group(seastar::scheduling_group sg) noexcept { _background_decompression_group = sg; }
+    std::optional<seastar::scheduling_group> background_decompression_group() const noexcept { return _background_decompression_group; }
+
+    // Cold-tier hint: gently evict the in-memory index caches of an sstable
+    // which the caller does not expect to be read again soon. Reads remain
+    // correct and simply repopulate the caches on demand.
+    void mark_cold(shared_sstable sst);
+
+    // Re-populates the index page caches of the active sstables, newest
+    // data first, under a small memory budget. Run after startup so that
+    // the first reads against each sstable don't stall on a cold index
+    // cache ("cold sstable" effect). Gated by the sstable_index_cache_warmup
+    // config option.
+    future<> warm_up_index_caches();
+
     void set_format(sstable_version_types format) noexcept { _format = format; }
     sstables::sstable::version_types get_highest_supported_format() const noexcept { return _format; }
 
@@ -110,6 +160,18 @@ public:
     directory_semaphore& dir_semaphore() noexcept { return _dir_semaphore; }
 private:
     void add(sstable* sst);
+    // Called by an sstable once its bloom filter has been loaded into
+    // memory, making it eligible for reclaim.
+    void account_filter_memory(sstable* sst);
+    // Forgets an sstable's filter memory when the sstable goes away. No-op
+    // if the filter was already reclaimed or was never accounted.
+    void unaccount_filter_memory(sstable* sst) noexcept;
+    // Reclaims bloom filters, largest first, until their total memory fits
+    // in the components_memory_reclaim_threshold share of the shard's
+    // memory. Reclaimed filters stay reclaimed for the lifetime of their
+    // sstable; compaction replaces sstables over time, so the freshly
+    // written, most-read sstables regain filters at the expense of old ones.
+    void maybe_reclaim_filter_memory();
     // Transition the sstable to the "inactive" state. It has no
     // visible references at this point, and only waits for its
     // files to be deleted (if necessary) and closed.
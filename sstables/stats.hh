@@ -36,6 +36,8 @@ class sstables_stats {
         uint64_t closed_for_writing = 0;
         uint64_t deleted = 0;
         uint64_t promoted_index_auto_scale_events = 0;
+        uint64_t compressed_chunk_cache_hits = 0;
+        uint64_t compressed_chunk_cache_misses = 0;
     } _shard_stats;
 
     stats& _stats = _shard_stats;
@@ -130,6 +132,14 @@ public:
     inline void on_promoted_index_auto_scale() noexcept {
         ++_stats.promoted_index_auto_scale_events;
     }
+
+    inline void on_compressed_chunk_cache_hit() noexcept {
+        ++_stats.compressed_chunk_cache_hits;
+    }
+
+    inline void on_compressed_chunk_cache_miss() noexcept {
+        ++_stats.compressed_chunk_cache_misses;
+    }
 };
 
 }
@@ -142,6 +142,37 @@ class checksummed_file_data_sink_impl : public data_sink_impl {
     data_sink _out;
     struct checksum& _c;
     uint32_t& _full_checksum;
+    // Checksum and fill of the chunk being accumulated, so that checksum
+    // chunks may span the buffers of a vectored put.
+    uint32_t _chunk_checksum = ChecksumType::init_checksum();
+    size_t _chunk_bytes = 0;
+private:
+    // Folds the buffer into the per-chunk and full-file checksums. With a
+    // fast (clmul-based) combine the buffer is checksummed exactly once and
+    // folded into both, otherwise it is fed to each incrementally.
+    void feed(const temporary_buffer<char>& buf) {
+        const char* p = buf.begin();
+        size_t size = buf.size();
+        while (size > 0) {
+            size_t n = std::min(size, size_t(_c.chunk_size) - _chunk_bytes);
+            if constexpr (ChecksumType::prefer_combine()) {
+                uint32_t piece = ChecksumType::checksum(p, n);
+                _chunk_checksum = ChecksumType::checksum_combine(_chunk_checksum, piece, n);
+                _full_checksum = ChecksumType::checksum_combine(_full_checksum, piece, n);
+            } else {
+                _chunk_checksum = ChecksumType::checksum(_chunk_checksum, p, n);
+                _full_checksum = ChecksumType::checksum(_full_checksum, p, n);
+            }
+            _chunk_bytes += n;
+            p += n;
+            size -= n;
+            if (_chunk_bytes == _c.chunk_size) {
+                _c.checksums.push_back(_chunk_checksum);
+                _chunk_checksum = ChecksumType::init_checksum();
+                _chunk_bytes = 0;
+            }
+        }
+    }
 public:
     checksummed_file_data_sink_impl(data_sink out, struct checksum& c, uint32_t& full_file_checksum)
             : _out(std::move(out))
@@ -156,20 +187,27 @@ public:
     virtual future<> put(temporary_buffer<char> buf) override {
         // bufs will usually be a multiple of chunk size, but this won't be the case for
         // the last buffer being flushed.
+        feed(buf);
+        return _out.put(std::move(buf));
+    }
 
-        for (size_t offset = 0; offset < buf.size(); offset += _c.chunk_size) {
-            size_t size = std::min(size_t(_c.chunk_size), buf.size() - offset);
-            uint32_t per_chunk_checksum = ChecksumType::init_checksum();
-
-            per_chunk_checksum = ChecksumType::checksum(per_chunk_checksum, buf.begin() + offset, size);
-            _full_checksum = checksum_combine_or_feed<ChecksumType>(_full_checksum, per_chunk_checksum, buf.begin() + offset, size);
-            _c.checksums.push_back(per_chunk_checksum);
+    // Checksums all the fragments in one pass and forwards the whole span
+    // downstream, so vectored writers keep their single submission to disk
+    // instead of degrading to one put per fragment.
+    virtual future<> put(std::vector<temporary_buffer<char>> data) override {
+        for (const auto& buf : data) {
+            feed(buf);
         }
-        return _out.put(std::move(buf));
+        return _out.put(std::move(data));
     }
 
     virtual future<> close() override {
         // Nothing to do, because close at the file_stream level will call flush on us.
+        if (_chunk_bytes) {
+            _c.checksums.push_back(_chunk_checksum);
+            _chunk_checksum = ChecksumType::init_checksum();
+            _chunk_bytes = 0;
+        }
         return _out.close();
     }
 
@@ -7,11 +7,15 @@
  */
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <seastar/rpc/rpc.hh>
 #include "sstables_loader.hh"
 #include "replica/distributed_loader.hh"
 #include "replica/database.hh"
+#include "sstables/checksum_utils.hh"
+#include "sstables/open_info.hh"
 #include "sstables/sstables.hh"
 #include "gms/inet_address.hh"
 #include "streaming/stream_mutation_fragments_cmd.hh"
@@ -269,3 +273,52 @@ future<> sstables_loader::load_new_sstables(sstring ks_name, sstring cf_name,
     _loading_new_sstables = false;
     co_return;
 }
+
+future<> sstables_loader::upload_component(sstring ks_name, sstring cf_name, sstring component_name,
+        input_stream<char>& in, std::optional<uint32_t> expected_crc32) {
+    // Parsing the name validates it: anything which is not a well-formed
+    // sstable component file name, including names trying to escape the
+    // upload directory, is rejected here.
+    sstables::entry_descriptor::make_descriptor(sstables::upload_dir, component_name);
+
+    auto& table = _db.local().find_column_family(ks_name, cf_name);
+    auto upload = std::filesystem::path(table.dir()) / sstables::upload_dir;
+    // The directory scan of the load path only considers regular files, so
+    // uploads staged in a subdirectory are invisible to a concurrent load.
+    auto staging = upload / ".upload-staging";
+    co_await recursive_touch_directory(staging.native());
+    auto staged_path = (staging / component_name.c_str()).native();
+
+    auto f = co_await open_file_dma(staged_path, open_flags::wo | open_flags::create | open_flags::truncate);
+    auto out = co_await make_file_output_stream(std::move(f));
+    uint32_t crc = crc32_utils::init_checksum();
+    uint64_t bytes = 0;
+    std::exception_ptr ex;
+    try {
+        while (true) {
+            auto buf = co_await in.read();
+            if (buf.empty()) {
+                break;
+            }
+            crc = crc32_utils::checksum(crc, buf.get(), buf.size());
+            bytes += buf.size();
+            co_await out.write(buf.get(), buf.size());
+        }
+        co_await out.flush();
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await out.close();
+    if (!ex && expected_crc32 && crc != *expected_crc32) {
+        ex = std::make_exception_ptr(std::runtime_error(format(
+                "Checksum mismatch for uploaded component {} of {}.{}: expected {}, got {}",
+                component_name, ks_name, cf_name, *expected_crc32, crc)));
+    }
+    if (ex) {
+        co_await remove_file(staged_path);
+        std::rethrow_exception(ex);
+    }
+    co_await rename_file(staged_path, (upload / component_name.c_str()).native());
+    co_await sync_directory(upload.native());
+    llog.info("Uploaded component {} of {}.{}: {} bytes, crc32={}", component_name, ks_name, cf_name, bytes, crc);
+}
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <optional>
+
+#include <seastar/core/iostream.hh>
 #include <seastar/core/sharded.hh>
 #include "schema_fwd.hh"
 #include "sstables/shared_sstable.hh"
@@ -74,4 +77,20 @@ public:
      */
     future<> load_new_sstables(sstring ks_name, sstring cf_name,
             bool load_and_stream, bool primary_replica_only);
+
+    /**
+     * Receive one sstable component pushed by a client over the network and
+     * place it in the upload directory of the given table, where a
+     * subsequent load_new_sstables() call picks it up.
+     *
+     * The component is written under a hidden staging directory and only
+     * renamed into the upload directory once it is fully on disk and its
+     * checksum, when one is supplied, has been verified, so a concurrent
+     * load never observes a partial file. Clients must upload the TOC
+     * component of an sstable last, mirroring the rule for files copied
+     * into the upload directory by hand, since the loader only considers
+     * sstables whose TOC is present.
+     */
+    future<> upload_component(sstring ks_name, sstring cf_name, sstring component_name,
+            input_stream<char>& in, std::optional<uint32_t> expected_crc32);
 };
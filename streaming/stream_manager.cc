@@ -18,6 +18,7 @@
 #include <seastar/core/metrics.hh>
 #include <seastar/core/coroutine.hh>
 #include "db/config.hh"
+#include "replica/database.hh"
 
 namespace streaming {
 
@@ -37,6 +38,7 @@ stream_manager::stream_manager(db::config& cfg,
         , _mm(mm)
         , _gossiper(gossiper)
         , _io_throughput_mbs(cfg.stream_io_throughput_mb_per_sec)
+        , _max_concurrent_transfers(cfg.stream_max_concurrent_transfers)
 {
     namespace sm = seastar::metrics;
 
@@ -105,6 +107,12 @@ future<> stream_manager::update_io_throughput(uint32_t value_mbs) {
     });
 }
 
+future<uint64_t> stream_manager::streaming_read_waiters() const {
+    return _db.map_reduce0([] (replica::database& db) {
+        return uint64_t(db.streaming_read_waiters());
+    }, uint64_t(0), std::plus<uint64_t>());
+}
+
 void stream_manager::register_sending(shared_ptr<stream_result_future> result) {
 #if 0
     result.addEventListener(notifier);
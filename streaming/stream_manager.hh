@@ -102,6 +102,7 @@ private:
     utils::updateable_value<uint32_t> _io_throughput_mbs;
     serialized_action _io_throughput_updater = serialized_action([this] { return update_io_throughput(_io_throughput_mbs()); });
     std::optional<utils::observer<uint32_t>> _io_throughput_option_observer;
+    utils::updateable_value<uint32_t> _max_concurrent_transfers;
 
 public:
     stream_manager(db::config& cfg, sharded<replica::database>& db,
@@ -129,6 +130,14 @@ public:
     replica::database& db() noexcept { return _db.local(); }
     netw::messaging_service& ms() noexcept { return _ms.local(); }
 
+    // Cap on the number of transfer tasks a session executes in parallel.
+    uint32_t max_concurrent_transfers() const { return _max_concurrent_transfers(); }
+
+    // Total number of streaming reads queued behind the per-shard streaming
+    // reader concurrency semaphores. Sessions use this as the congestion
+    // signal when adjusting their transfer parallelism.
+    future<uint64_t> streaming_read_waiters() const;
+
     const std::unordered_map<plan_id, shared_ptr<stream_result_future>>& get_initiated_streams() const {
         return _initiated_streams;
     }
@@ -17,6 +17,7 @@
 #include "dht/i_partitioner.hh"
 #include "utils/fb_utilities.hh"
 #include "streaming/stream_plan.hh"
+#include <seastar/core/gate.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include "streaming/stream_state.hh"
@@ -314,7 +315,9 @@ future<prepare_message> stream_session::prepare(std::vector<stream_request> requ
     set_state(stream_session_state::PREPARING);
     auto& db = manager().db();
     for (auto& request : requests) {
-        // always flush on stream request
+        // No need to flush the requested tables: the sender reads the live
+        // combined memtable+sstable view (table::make_streaming_reader()),
+        // so unflushed data is streamed directly from the memtables.
         sslog.debug("[Stream #{}] prepare stream_request={}", plan_id, request);
         auto ks = request.keyspace;
         // Make sure cf requested by peer node exists
@@ -438,15 +441,72 @@ void stream_session::prepare_receiving(stream_summary& summary) {
     }
 }
 
+// Grows or shrinks the window of concurrently executing transfer tasks,
+// called whenever a transfer completes. The signal is the number of streaming
+// reads queued behind the per-shard reader concurrency semaphores: a transfer
+// finishing with nothing queued means there is headroom and the window grows
+// by one (up to the configured maximum); queued reads mean the disks cannot
+// keep up with the current window, so it is halved. In-flight transfers are
+// never interrupted - shrinking only delays launching new ones.
+future<> stream_session::adjust_transfer_window() {
+    return manager().streaming_read_waiters().then([this] (uint64_t waiters) {
+        auto max = std::max<size_t>(1, manager().max_concurrent_transfers());
+        if (waiters) {
+            auto target = std::max<size_t>(1, _transfer_window / 2);
+            if (target < _transfer_window) {
+                sslog.debug("[Stream #{}] Reducing transfer parallelism {} -> {}: {} streaming reads waiting",
+                        plan_id(), _transfer_window, target, waiters);
+                _transfer_sem.consume(_transfer_window - target);
+                _transfer_window = target;
+            }
+        } else if (_transfer_window < max) {
+            ++_transfer_window;
+            _transfer_sem.signal();
+            sslog.debug("[Stream #{}] Raising transfer parallelism to {}", plan_id(), _transfer_window);
+        }
+        // The configured maximum may have been lowered while streaming.
+        while (_transfer_window > max) {
+            _transfer_sem.consume(1);
+            --_transfer_window;
+        }
+    });
+}
+
 void stream_session::start_streaming_files() {
     sslog.debug("[Stream #{}] {}: {} transfers to send", plan_id(), __func__, _transfers.size());
     if (!_transfers.empty()) {
         set_state(stream_session_state::STREAMING);
     }
     //FIXME: discarded future.
-    (void)do_for_each(_transfers.begin(), _transfers.end(), [this] (auto& item) {
-        sslog.debug("[Stream #{}] Start to send cf_id={}", this->plan_id(), item.first);
-        return item.second.execute();
+    (void)do_with(gate(), std::exception_ptr(), [this] (gate& g, std::exception_ptr& error) {
+        return do_for_each(_transfers.begin(), _transfers.end(), [this, &g, &error] (auto& item) {
+            return get_units(_transfer_sem, 1).then([this, &g, &error, &item] (semaphore_units<> units) {
+                if (error) {
+                    // A transfer already failed; don't start new ones, just
+                    // drain the loop so the gate can close.
+                    return;
+                }
+                sslog.debug("[Stream #{}] Start to send cf_id={}", this->plan_id(), item.first);
+                // Runs in the background, bounded by _transfer_sem; the
+                // gate close below waits for all of them.
+                (void)with_gate(g, [this, &error, &item, units = std::move(units)] () mutable {
+                    return item.second.execute().then([this] {
+                        return this->adjust_transfer_window();
+                    }).handle_exception([&error] (std::exception_ptr ep) {
+                        if (!error) {
+                            error = std::move(ep);
+                        }
+                    }).finally([units = std::move(units)] {});
+                });
+            });
+        }).finally([&g] {
+            return g.close();
+        }).then([&error] {
+            if (error) {
+                return make_exception_future<>(std::move(error));
+            }
+            return make_ready_future<>();
+        });
     }).then([this] {
         this->transfer_task_completed_all();
     }).handle_exception([this] (auto ep) {
@@ -24,6 +24,7 @@
 #include "streaming/session_info.hh"
 #include "query-request.hh"
 #include "dht/i_partitioner.hh"
+#include <seastar/core/semaphore.hh>
 #include <map>
 #include <vector>
 #include <memory>
@@ -140,6 +141,11 @@ private:
     std::map<table_id, stream_transfer_task> _transfers;
     // data receivers, filled after receiving prepare message
     std::map<table_id, stream_receive_task> _receivers;
+    // Transfer tasks run up to _transfer_window at a time. The window starts
+    // at one and is adjusted AIMD-style by adjust_transfer_window() as
+    // transfers complete; _transfer_sem tracks the free slots in it.
+    size_t _transfer_window = 1;
+    semaphore _transfer_sem{1};
     //private final StreamingMetrics metrics;
     /* can be null when session is created in remote */
     //private final StreamConnectionFactory factory;
@@ -318,6 +324,7 @@ private:
     bool maybe_completed();
     void prepare_receiving(stream_summary& summary);
     void start_streaming_files();
+    future<> adjust_transfer_window();
     future<> receiving_failed(table_id cf_id);
 };
 
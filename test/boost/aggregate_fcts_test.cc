@@ -228,6 +228,37 @@ SEASTAR_TEST_CASE(test_aggregate_count) {
     });
 }
 
+// Aggregate selectors feed count/sum in batches (see
+// aggregate_function_selector); use enough rows to cross batch boundaries
+// and a null here and there to check the batched loops.
+SEASTAR_TEST_CASE(test_aggregates_over_many_rows) {
+    return do_with_cql_env_thread([&] (auto& e) {
+        e.execute_cql("CREATE TABLE test(a int primary key, b bigint, c double)").get();
+
+        constexpr int64_t nr_rows = 1000;
+        int64_t sum_b = 0;
+        double sum_c = 0;
+        int64_t count_b = 0;
+        for (int64_t i = 0; i < nr_rows; ++i) {
+            if (i % 7 == 0) {
+                // b stays null
+                e.execute_cql(format("INSERT INTO test(a, c) VALUES ({}, {})", i, i)).get();
+            } else {
+                e.execute_cql(format("INSERT INTO test(a, b, c) VALUES ({}, {}, {})", i, i, i)).get();
+                sum_b += i;
+                ++count_b;
+            }
+            sum_c += double(i);
+        }
+
+        auto msg = e.execute_cql("SELECT count(*), count(b), sum(b), sum(c) FROM test").get0();
+        assert_that(msg).is_rows().with_size(1).with_row({{long_type->decompose(nr_rows)},
+                                                          {long_type->decompose(count_b)},
+                                                          {long_type->decompose(sum_b)},
+                                                          {double_type->decompose(sum_c)}});
+    });
+}
+
 SEASTAR_TEST_CASE(test_reverse_type_aggregation) {
     return do_with_cql_env_thread([&] (auto& e) {
         e.execute_cql("CREATE TABLE test(p int, c timestamp, v int, primary key (p, c)) with clustering order by (c desc)").get();
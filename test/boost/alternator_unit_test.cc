@@ -86,3 +86,43 @@ BOOST_AUTO_TEST_CASE(test_allocator_fail_gracefully) {
     rapidjson::internal::Stack stack(&allocator, 0);
     BOOST_REQUIRE_THROW(stack.Push<char>(too_large_alloc_size), rjson::error);
 }
+
+// A minimal SAX handler for exercising rjson::parse_sax(), the entry point
+// used by the streaming PutItem decoder: events must be delivered without
+// building a DOM, a handler returning false must abort the parse, and
+// invalid JSON must throw rjson::error.
+struct counting_sax_handler {
+    int strings = 0;
+    int keys = 0;
+    int objects = 0;
+    bool fail_on_bool = false;
+    bool Null() { return true; }
+    bool Bool(bool) { return !fail_on_bool; }
+    bool Int(int) { return true; }
+    bool Uint(unsigned) { return true; }
+    bool Int64(int64_t) { return true; }
+    bool Uint64(uint64_t) { return true; }
+    bool Double(double) { return true; }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return true; }
+    bool String(const char*, rapidjson::SizeType, bool) { ++strings; return true; }
+    bool StartObject() { ++objects; return true; }
+    bool Key(const char*, rapidjson::SizeType, bool) { ++keys; return true; }
+    bool EndObject(rapidjson::SizeType) { return true; }
+    bool StartArray() { return true; }
+    bool EndArray(rapidjson::SizeType) { return true; }
+};
+
+BOOST_AUTO_TEST_CASE(test_parse_sax) {
+    counting_sax_handler handler;
+    BOOST_REQUIRE(rjson::parse_sax(R"({"TableName": "tbl", "Item": {"p": {"S": "v"}}})", handler));
+    BOOST_REQUIRE_EQUAL(handler.strings, 2);
+    BOOST_REQUIRE_EQUAL(handler.keys, 4);
+    BOOST_REQUIRE_EQUAL(handler.objects, 3);
+
+    counting_sax_handler aborting;
+    aborting.fail_on_bool = true;
+    BOOST_REQUIRE(!rjson::parse_sax(R"({"BOOL": true})", aborting));
+
+    counting_sax_handler unused;
+    BOOST_REQUIRE_THROW(rjson::parse_sax("{]", unused), rjson::error);
+}
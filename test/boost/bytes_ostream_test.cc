@@ -150,6 +150,23 @@ BOOST_AUTO_TEST_CASE(test_writing_large_blobs) {
     BOOST_REQUIRE(std::all_of(buf_view.begin(), buf_view.end(), [] (auto&& c) { return c == 7; }));
 }
 
+BOOST_AUTO_TEST_CASE(test_reserve_keeps_writes_in_one_fragment) {
+    int count = 16*1024;
+
+    bytes_ostream buf;
+    buf.reserve(count * sizeof(int));
+    append_sequence(buf, count);
+
+    BOOST_REQUIRE(buf.is_linearized());
+    assert_sequence(buf, count);
+
+    // reserve() after a write must not disturb already written data.
+    bytes_ostream buf2;
+    append_sequence(buf2, count);
+    buf2.reserve(1024*1024);
+    assert_sequence(buf2, count);
+}
+
 BOOST_AUTO_TEST_CASE(test_fragment_iteration) {
     int count = 64*1024;
 
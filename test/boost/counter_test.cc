@@ -390,6 +390,47 @@ SEASTAR_TEST_CASE(test_counter_update_mutations) {
     });
 }
 
+SEASTAR_TEST_CASE(test_is_pure_counter_update) {
+    return seastar::async([] {
+        auto s = get_schema();
+
+        auto pk = partition_key::from_single_value(*s, int32_type->decompose(0));
+        auto ck = clustering_key::from_single_value(*s, int32_type->decompose(0));
+        auto& col = *s->get_column_definition(utf8_type->decompose(sstring("c1")));
+        auto& scol = *s->get_column_definition(utf8_type->decompose(sstring("s1")));
+
+        mutation m1(s, pk);
+        m1.set_clustered_cell(ck, col, atomic_cell::make_live_counter_update(api::new_timestamp(), 5));
+        m1.set_static_cell(scol, atomic_cell::make_live_counter_update(api::new_timestamp(), 4));
+        BOOST_REQUIRE(is_pure_counter_update(m1));
+
+        // Pure updates combine by delta addition, and stay pure.
+        auto m11 = m1;
+        m11.apply(m1);
+        BOOST_REQUIRE(is_pure_counter_update(m11));
+        BOOST_REQUIRE_EQUAL(get_counter_cell(m11).counter_update_value(), 10);
+
+        mutation m2(s, pk);
+        m2.set_clustered_cell(ck, col, atomic_cell::make_dead(api::new_timestamp(), gc_clock::now()));
+        BOOST_REQUIRE(!is_pure_counter_update(m2));
+
+        mutation m3(s, pk);
+        m3.set_clustered_cell(ck, col, atomic_cell::make_live_counter_update(api::new_timestamp(), 1));
+        m3.partition().apply(tombstone(api::new_timestamp(), gc_clock::now()));
+        BOOST_REQUIRE(!is_pure_counter_update(m3));
+
+        mutation m4(s, pk);
+        m4.set_clustered_cell(ck, col, atomic_cell::make_live_counter_update(api::new_timestamp(), 1));
+        m4.partition().clustered_row(*s, ck).apply(row_tombstone(tombstone(api::new_timestamp(), gc_clock::now())));
+        BOOST_REQUIRE(!is_pure_counter_update(m4));
+
+        mutation m5(s, pk);
+        m5.set_clustered_cell(ck, col, atomic_cell::make_live_counter_update(api::new_timestamp(), 1));
+        m5.partition().apply_row_tombstone(*s, ck, tombstone(api::new_timestamp(), gc_clock::now()));
+        BOOST_REQUIRE(!is_pure_counter_update(m5));
+    });
+}
+
 SEASTAR_TEST_CASE(test_transfer_updates_to_shards) {
     return seastar::async([] {
         auto s = get_schema();
@@ -5218,6 +5218,79 @@ SEASTAR_TEST_CASE(timeuuid_fcts_prepared_re_evaluation) {
     });
 }
 
+SEASTAR_TEST_CASE(test_sub_blob_fct) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (id int PRIMARY KEY, b blob)");
+        cquery_nofail(e, "INSERT INTO t (id, b) VALUES (1, 0x0001020304050607)");
+        cquery_nofail(e, "INSERT INTO t (id, b) VALUES (2, null)");
+
+        auto msg = cquery_nofail(e, "SELECT subblob(b, 0, 4) FROM t WHERE id = 1");
+        assert_that(msg).is_rows().with_rows({
+            {bytes_type->decompose(data_value(bytes{0x00, 0x01, 0x02, 0x03}))}
+        });
+        msg = cquery_nofail(e, "SELECT subblob(b, 6, 4) FROM t WHERE id = 1");
+        // The requested range is clamped to the value size.
+        assert_that(msg).is_rows().with_rows({
+            {bytes_type->decompose(data_value(bytes{0x06, 0x07}))}
+        });
+        msg = cquery_nofail(e, "SELECT subblob(b, 100, 4) FROM t WHERE id = 1");
+        assert_that(msg).is_rows().with_rows({
+            {bytes_type->decompose(data_value(bytes{}))}
+        });
+        msg = cquery_nofail(e, "SELECT subblob(b, 0, 4) FROM t WHERE id = 2");
+        assert_that(msg).is_rows().with_rows({
+            {std::nullopt}
+        });
+        BOOST_REQUIRE_THROW(e.execute_cql("SELECT subblob(b, -1, 4) FROM t WHERE id = 1").get(),
+                exceptions::invalid_request_exception);
+        BOOST_REQUIRE_THROW(e.execute_cql("SELECT subblob(b, 0, -4) FROM t WHERE id = 1").get(),
+                exceptions::invalid_request_exception);
+    });
+}
+
+// Unprepared statements are cached in the prepared statement cache after the
+// first execution, so paged queries don't re-parse the statement text for
+// every page.
+SEASTAR_TEST_CASE(test_unprepared_statement_caching) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (pk int PRIMARY KEY, v int)");
+        cquery_nofail(e, "INSERT INTO t (pk, v) VALUES (1, 2)");
+
+        const auto query = sstring("SELECT v FROM t WHERE pk = 1");
+        const auto key = cql3::query_processor::compute_id(query, "ks");
+        BOOST_REQUIRE(!e.local_qp().get_prepared(key));
+
+        auto msg = cquery_nofail(e, query);
+        assert_that(msg).is_rows().with_rows({{int32_type->decompose(2)}});
+
+        // The direct execution populated the prepared statement cache under
+        // the same key PREPARE would use...
+        BOOST_REQUIRE(bool(e.local_qp().get_prepared(key)));
+
+        // ...and repeated execution (the cached path) yields the same result.
+        msg = cquery_nofail(e, query);
+        assert_that(msg).is_rows().with_rows({{int32_type->decompose(2)}});
+    });
+}
+
+SEASTAR_TEST_CASE(test_write_coalescing_window) {
+    auto db_config = make_shared<db::config>();
+    db_config->write_coalescing_window_in_us(500);
+
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (pk int, ck int, v int, PRIMARY KEY (pk, ck))");
+        // Concurrent writes to the same partition land within the coalescing
+        // window and get merged into a single apply. All of them must be
+        // acknowledged individually and none may be lost.
+        auto cks = boost::irange(0, 16);
+        parallel_for_each(cks.begin(), cks.end(), [&e] (int ck) {
+            return e.execute_cql(format("INSERT INTO t (pk, ck, v) VALUES (1, {}, {})", ck, ck)).discard_result();
+        }).get();
+        auto msg = cquery_nofail(e, "SELECT count(*) FROM t WHERE pk = 1");
+        assert_that(msg).is_rows().with_rows({{long_type->decompose(int64_t(16))}});
+    }, cql_test_config(db_config));
+}
+
 static future<> with_parallelized_aggregation_enabled_thread(std::function<void(cql_test_env&)>&& func) {
     auto db_cfg_ptr = make_shared<db::config>();
     auto& db_cfg = *db_cfg_ptr;
@@ -182,6 +182,24 @@ SEASTAR_TEST_CASE(test_truncate_without_snapshot_during_writes) {
     }, cfg);
 }
 
+SEASTAR_TEST_CASE(test_write_dedup_window) {
+    auto cfg = make_shared<db::config>();
+    cfg->write_dedup_window_size.set(8);
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("create table ks.dedup (k int, v int, primary key (k));").get();
+        e.execute_cql("insert into ks.dedup (k, v) values (1, 1) using timestamp 1000;").get();
+        // An exact retry is suppressed before it reaches the memtable...
+        e.execute_cql("insert into ks.dedup (k, v) values (1, 1) using timestamp 1000;").get();
+        // ...while a write differing only in timestamp is applied normally.
+        e.execute_cql("insert into ks.dedup (k, v) values (1, 2) using timestamp 1001;").get();
+        auto suppressed = e.db().map_reduce0([] (replica::database& db) {
+            return db.find_column_family("ks", "dedup").get_stats().write_dedup_suppressed;
+        }, int64_t(0), std::plus<int64_t>()).get0();
+        BOOST_REQUIRE_EQUAL(suppressed, 1);
+        e.require_column_has_value("dedup", {1}, {}, "v", 2).get();
+    }, cfg);
+}
+
 SEASTAR_TEST_CASE(test_querying_with_limits) {
     return do_with_cql_env_and_compaction_groups([](cql_test_env& e) {
             // FIXME: restore indent.
@@ -544,6 +562,51 @@ SEASTAR_TEST_CASE(snapshot_works) {
     });
 }
 
+SEASTAR_TEST_CASE(snapshot_diff_works) {
+    return do_with_some_data({"cf"}, [] (cql_test_env& e) {
+        take_snapshot(e, "ks", "cf", "base").get();
+
+        // Add more data, flushed into new sstables that only the second
+        // snapshot will contain.
+        e.execute_cql("insert into cf (p1, c1, c2, r1) values ('key2', 7, 7, 7);").get();
+        auto& cf = e.local_db().find_column_family("ks", "cf");
+        e.db().invoke_on_all([] (replica::database& db) {
+            return db.find_column_family("ks", "cf").flush();
+        }).get();
+
+        take_snapshot(e, "ks", "cf", "next").get();
+
+        std::set<sstring> expected;
+        lister::scan_dir(fs::path(cf.dir()) / sstables::snapshots_dir / "next", lister::dir_entry_types::of<directory_entry_type::regular>(), [&expected] (fs::path parent_dir, directory_entry de) {
+            expected.insert(de.name);
+            return make_ready_future<>();
+        }).get();
+        lister::scan_dir(fs::path(cf.dir()) / sstables::snapshots_dir / "base", lister::dir_entry_types::of<directory_entry_type::regular>(), [&expected] (fs::path parent_dir, directory_entry de) {
+            expected.erase(de.name);
+            return make_ready_future<>();
+        }).get();
+        // Snapshot metadata is never part of the diff.
+        expected.erase("manifest.json");
+        expected.erase("schema.cql");
+        BOOST_REQUIRE_GT(expected.size(), 0);
+
+        auto diff = e.local_db().get_snapshot_diff("base", "next").get0();
+        for (auto& f : diff) {
+            BOOST_REQUIRE_EQUAL(f.ks, "ks");
+            BOOST_REQUIRE_EQUAL(f.cf, "cf");
+            BOOST_REQUIRE_GT(f.size, 0);
+            BOOST_REQUIRE(expected.contains(f.name));
+            expected.erase(f.name);
+        }
+        BOOST_REQUIRE_EQUAL(expected.size(), 0);
+
+        // Diffing against a tag that does not exist returns everything.
+        auto full = e.local_db().get_snapshot_diff("no_such_tag", "next").get0();
+        BOOST_REQUIRE_GT(full.size(), diff.size());
+        return make_ready_future<>();
+    });
+}
+
 SEASTAR_TEST_CASE(snapshot_skip_flush_works) {
     return do_with_some_data({"cf"}, [] (cql_test_env& e) {
         take_snapshot(e, true /* skip_flush */).get();
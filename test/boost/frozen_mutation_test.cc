@@ -66,6 +66,16 @@ SEASTAR_TEST_CASE(test_writing_and_reading_gently) {
     });
 }
 
+SEASTAR_TEST_CASE(test_freeze_gently_produces_same_representation_as_freeze) {
+    return seastar::async([] {
+        for_each_mutation([] (const mutation& m) {
+            auto frozen = freeze(m);
+            auto frozen_gently = freeze_gently(m).get0();
+            BOOST_REQUIRE(frozen.representation() == frozen_gently.representation());
+        });
+    });
+}
+
 SEASTAR_TEST_CASE(test_application_of_partition_view_has_the_same_effect_as_applying_regular_mutation) {
     return seastar::async([] {
         mutation_application_stats app_stats;
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#define BOOST_TEST_MODULE core
+
+#include <boost/test/unit_test.hpp>
+#include "sstables/hyperloglog.hh"
+#include "utils/murmur_hash.hh"
+
+static uint64_t hash_of(uint64_t i) {
+    auto b = bytes(reinterpret_cast<const int8_t*>(&i), sizeof(i));
+    return utils::murmur_hash::hash2_64(b, 0);
+}
+
+static hll::HyperLogLog make_hll(uint64_t first, uint64_t count) {
+    hll::HyperLogLog hll;
+    for (uint64_t i = first; i < first + count; ++i) {
+        hll.offer_hashed(hash_of(i));
+    }
+    return hll;
+}
+
+BOOST_AUTO_TEST_CASE(test_serialization_roundtrip) {
+    auto hll = make_hll(0, 10000);
+    auto restored = hll::HyperLogLog::from_bytes(hll.get_bytes());
+    BOOST_REQUIRE_EQUAL(hll.estimate(), restored.estimate());
+
+    // Merging a deserialized copy into the original must not change the estimate.
+    auto merged = make_hll(0, 10000);
+    merged.merge(restored);
+    BOOST_REQUIRE_EQUAL(hll.estimate(), merged.estimate());
+}
+
+BOOST_AUTO_TEST_CASE(test_merge_of_overlapping_sets) {
+    // Two sets sharing half their elements: the merged estimate must be close
+    // to the size of the union, not to the sum of the individual sizes.
+    auto hll1 = make_hll(0, 10000);
+    auto hll2 = make_hll(5000, 10000);
+    hll1.merge(hll2);
+    auto estimate = hll1.estimate();
+    // The default register width is coarse, so allow a wide error margin. The
+    // point is telling 15k (union) apart from 20k (sum).
+    BOOST_REQUIRE_GT(estimate, 15000 * 0.5);
+    BOOST_REQUIRE_LT(estimate, 15000 * 1.5);
+}
+
+BOOST_AUTO_TEST_CASE(test_from_bytes_rejects_malformed_input) {
+    BOOST_REQUIRE_THROW(hll::HyperLogLog::from_bytes(temporary_buffer<uint8_t>()), std::runtime_error);
+
+    auto bytes = make_hll(0, 100).get_bytes();
+    bytes.trim(bytes.size() - 1); // truncated register set
+    BOOST_REQUIRE_THROW(hll::HyperLogLog::from_bytes(std::move(bytes)), std::runtime_error);
+}
@@ -442,6 +442,30 @@ SEASTAR_TEST_CASE(test_loading_cache_loading_reloading_unprivileged) {
     });
 }
 
+SEASTAR_TEST_CASE(test_loading_cache_reload_ahead_of_expiry) {
+    return seastar::async([] {
+        using namespace std::chrono;
+        load_count = 0;
+        // Refresh is longer than expiry: an actively read entry must still be
+        // reloaded ahead of its expiry instead of being dropped and then
+        // synchronously reloaded by the next get_ptr().
+        utils::loading_cache<int, sstring, 1, utils::loading_cache_reload_enabled::yes> loading_cache({num_loaders, 100ms, 1h}, testlog, loader);
+        auto stop_cache_reload = seastar::defer([&loading_cache] { loading_cache.stop().get(); });
+        prepare().get();
+        loading_cache.get_ptr(0).discard_result().get();
+        // Keep the entry actively read across several expiry periods.
+        auto deadline = steady_clock::now() + 300ms;
+        while (steady_clock::now() < deadline) {
+            BOOST_REQUIRE(loading_cache.find(0) != nullptr);
+            sleep(10ms).get();
+        }
+        BOOST_REQUIRE(load_count >= 2);
+        // Once nobody reads the entry anymore it expires as usual.
+        sleep(100ms).get();
+        REQUIRE_EVENTUALLY_EQUAL(loading_cache.size(), 0);
+    });
+}
+
 SEASTAR_TEST_CASE(test_loading_cache_max_size_eviction) {
     return seastar::async([] {
         using namespace std::chrono;
@@ -520,6 +520,59 @@ SEASTAR_TEST_CASE(test_zone_reclaiming_preserves_free_size) {
     });
 }
 
+SEASTAR_TEST_CASE(test_reclaim_priority_order) {
+    return seastar::async([] {
+        region r_normal;
+        region r_last;
+        r_last.set_reclaim_priority(reclaim_priority::last);
+
+        std::vector<managed_bytes> objs_normal;
+        std::vector<managed_bytes> objs_last;
+
+        auto fill = [] (region& r, std::vector<managed_bytes>& objs) {
+            with_allocator(r.allocator(), [&] {
+                while (r.occupancy().total_space() < 4 * segment_size) {
+                    objs.push_back(managed_bytes(managed_bytes::initialized_later(), 1024));
+                }
+            });
+        };
+        fill(r_normal, objs_normal);
+        fill(r_last, objs_last);
+
+        size_t evictions_from_last = 0;
+        r_normal.make_evictable([&] {
+            return with_allocator(r_normal.allocator(), [&] {
+                if (objs_normal.empty()) {
+                    return memory::reclaiming_result::reclaimed_nothing;
+                }
+                objs_normal.pop_back();
+                return memory::reclaiming_result::reclaimed_something;
+            });
+        });
+        r_last.make_evictable([&] {
+            return with_allocator(r_last.allocator(), [&] {
+                if (objs_last.empty()) {
+                    return memory::reclaiming_result::reclaimed_nothing;
+                }
+                ++evictions_from_last;
+                objs_last.pop_back();
+                return memory::reclaiming_result::reclaimed_something;
+            });
+        });
+
+        logalloc::shard_tracker().reclaim(2 * segment_size);
+
+        // The last-priority region must not give up memory while the
+        // normal-priority one still has something to evict.
+        if (evictions_from_last) {
+            BOOST_REQUIRE(objs_normal.empty());
+        }
+
+        with_allocator(r_normal.allocator(), [&] { objs_normal.clear(); });
+        with_allocator(r_last.allocator(), [&] { objs_last.clear(); });
+    });
+}
+
 // No point in testing contiguous memory allocation in debug mode
 #ifndef SEASTAR_DEFAULT_ALLOCATOR
 SEASTAR_THREAD_TEST_CASE(test_can_reclaim_contiguous_memory_with_mixed_allocations) {
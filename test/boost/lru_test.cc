@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#define BOOST_TEST_MODULE core
+
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+#include "utils/lru.hh"
+
+namespace {
+
+class item : public evictable {
+    int _id;
+    std::vector<int>& _eviction_order;
+public:
+    item(int id, std::vector<int>& eviction_order)
+        : _id(id)
+        , _eviction_order(eviction_order)
+    { }
+    virtual void on_evicted() noexcept override {
+        _eviction_order.push_back(_id);
+    }
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(test_eviction_order_is_lru) {
+    std::vector<int> evicted;
+    std::vector<item> items;
+    items.reserve(4);
+    lru list;
+
+    for (int i = 0; i < 4; ++i) {
+        items.emplace_back(i, evicted);
+        list.add(items.back());
+    }
+    while (list.evict() == lru::reclaiming_result::reclaimed_something) { }
+
+    BOOST_REQUIRE(evicted == std::vector<int>({0, 1, 2, 3}));
+}
+
+BOOST_AUTO_TEST_CASE(test_touched_entries_outlive_scanned_entries) {
+    std::vector<int> evicted;
+    std::vector<item> items;
+    items.reserve(8);
+    lru list;
+
+    for (int i = 0; i < 8; ++i) {
+        items.emplace_back(i, evicted);
+        list.add(items.back());
+    }
+    // Entries 0 and 1 form the working set; the rest simulate a scan which
+    // reads each entry exactly once.
+    list.touch(items[0]);
+    list.touch(items[1]);
+
+    // The scanned entries must all go before any of the touched ones.
+    for (int i = 0; i < 6; ++i) {
+        BOOST_REQUIRE(list.evict() == lru::reclaiming_result::reclaimed_something);
+    }
+    BOOST_REQUIRE(evicted == std::vector<int>({2, 3, 4, 5, 6, 7}));
+
+    while (list.evict() == lru::reclaiming_result::reclaimed_something) { }
+    BOOST_REQUIRE(evicted == std::vector<int>({2, 3, 4, 5, 6, 7, 0, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(test_hot_section_is_bounded) {
+    std::vector<int> evicted;
+    std::vector<item> items;
+    items.reserve(8);
+    lru list;
+
+    for (int i = 0; i < 8; ++i) {
+        items.emplace_back(i, evicted);
+        list.add(items.back());
+    }
+    // Touch everything: the hot section cannot hold more than 3/4 of the
+    // entries, so the earliest-touched entries get demoted back and are
+    // evicted before the most recently touched ones.
+    for (auto& i : items) {
+        list.touch(i);
+    }
+    while (list.evict() == lru::reclaiming_result::reclaimed_something) { }
+
+    BOOST_REQUIRE_EQUAL(evicted.size(), 8);
+    // The most recently touched entry must survive the longest.
+    BOOST_REQUIRE_EQUAL(evicted.back(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(test_mark_hot_promotes_on_re_add) {
+    std::vector<int> evicted;
+    std::vector<item> items;
+    items.reserve(4);
+    lru list;
+
+    for (int i = 0; i < 4; ++i) {
+        items.emplace_back(i, evicted);
+        list.add(items.back());
+    }
+    // Simulate the unlink-while-in-use protocol: entry 0 is taken out for
+    // use and re-added afterwards, which counts as its promoting touch.
+    list.remove(items[0]);
+    lru::mark_hot(items[0]);
+    list.add(items[0]);
+
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE(list.evict() == lru::reclaiming_result::reclaimed_something);
+    }
+    BOOST_REQUIRE(evicted == std::vector<int>({1, 2, 3}));
+    while (list.evict() == lru::reclaiming_result::reclaimed_something) { }
+    BOOST_REQUIRE(evicted == std::vector<int>({1, 2, 3, 0}));
+}
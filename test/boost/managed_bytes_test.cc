@@ -42,8 +42,9 @@ struct fragmenting_allocation_strategy : standard_allocation_strategy {
 };
 
 constexpr size_t alloc_size = 63;
+// 39 and 40 straddle the inline capacity of the small-blob representation.
 const std::vector<size_t> sizes = {
-    0, 1, 15, 16,
+    0, 1, 15, 16, 39, 40,
     alloc_size - 1, alloc_size, alloc_size + 1,
     alloc_size * 4 - 1, alloc_size * 4, alloc_size * 4 + 1,
 };
@@ -80,6 +81,19 @@ BOOST_AUTO_TEST_CASE(test_constructor_from_bytes) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(test_small_blobs_are_stored_inline) {
+    fragmenting_allocation_strategy fragmenting_allocator(alloc_size);
+    with_allocator(fragmenting_allocator, [&] {
+        // 39 is the inline capacity of managed_bytes; keep in sync with
+        // managed_bytes::max_inline_size.
+        auto b = tests::random::get_bytes(39);
+        auto m = managed_bytes(b);
+        BOOST_CHECK_EQUAL(fragmenting_allocator.allocated_bytes, 0);
+        BOOST_CHECK_EQUAL(m.external_memory_usage(), 0);
+        BOOST_CHECK_EQUAL(to_bytes(m), b);
+    });
+}
+
 BOOST_AUTO_TEST_CASE(test_copy_constructor) {
     fragmenting_allocation_strategy alloc_1(alloc_size);
     fragmenting_allocation_strategy alloc_2(alloc_size + 1);
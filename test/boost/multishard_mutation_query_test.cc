@@ -488,6 +488,63 @@ SEASTAR_THREAD_TEST_CASE(test_read_all_multi_range) {
     }).get();
 }
 
+// Best run with SMP>=2
+SEASTAR_THREAD_TEST_CASE(test_read_all_singular_ranges) {
+    do_with_cql_env_thread([] (cql_test_env& env) -> future<> {
+        using namespace std::chrono_literals;
+
+        env.db().invoke_on_all([] (replica::database& db) {
+            db.set_querier_cache_entry_ttl(2s);
+        }).get();
+
+        auto [s, pkeys] = test::create_test_table(env, KEYSPACE_NAME, "test_read_all");
+
+        const auto limit = std::numeric_limits<uint64_t>::max();
+
+        const auto slice = s->full_slice();
+
+        // Read the partitions the way a multi-partition (IN) query does: with
+        // one singular range per partition. The step=2 case reads a subset of
+        // the partitions, so some shards may not be involved in the read at
+        // all.
+        for (const auto step : {1u, 2u}) {
+
+            std::vector<dht::decorated_key> selected_pkeys;
+            dht::partition_range_vector ranges;
+            for (unsigned r = 0; r < pkeys.size(); r += step) {
+                selected_pkeys.push_back(pkeys.at(r));
+                ranges.push_back(dht::partition_range::make_singular(pkeys.at(r)));
+            }
+
+            unsigned i = 0;
+
+            testlog.debug("Scan with step={}, ranges={}", step, ranges);
+
+            // Keep indent the same to reduce white-space noise
+            for (const auto page_size : {1, 4, 8, 19, 100}) {
+            for (const auto stateful : {stateful_query::no, stateful_query::yes}) {
+                testlog.debug("[scan #{}]: page_size={}, stateful={}", i++, page_size, stateful);
+
+                // First read all partition-by-partition (not paged).
+                auto expected_results = read_all_partitions_one_by_one(env.db(), s, selected_pkeys);
+
+                auto results = read_partitions_with_generic_paged_scan<mutation_result_builder>(env.db(), s, page_size, limit, stateful, ranges, slice, [&] (size_t) {
+                    tests::require_equal(aggregate_querier_cache_stat(env.db(), &query::querier_cache::stats::drops), 0u);
+                }).first;
+
+                check_results_are_equal(expected_results, results);
+
+                tests::require_equal(aggregate_querier_cache_stat(env.db(), &query::querier_cache::stats::drops), 0u);
+                tests::require_equal(aggregate_querier_cache_stat(env.db(), &query::querier_cache::stats::resource_based_evictions), 0u);
+            }}
+        }
+
+        require_eventually_empty_caches(env.db());
+
+        return make_ready_future<>();
+    }).get();
+}
+
 // Best run with SMP>=2
 SEASTAR_THREAD_TEST_CASE(test_read_with_partition_row_limits) {
     do_with_cql_env_thread([this] (cql_test_env& env) -> future<> {
@@ -109,3 +109,30 @@ BOOST_AUTO_TEST_CASE(test_hash_output) {
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_batch_hash_output) {
+    auto assert_hashes_equal = [] (bytes_view data, std::array<uint64_t,2> lhs, std::array<uint64_t,2> rhs) {
+        if (lhs != rhs) {
+            BOOST_FAIL(format("Hashes differ for {} (got {{0x{:x}, 0x{:x}}} and {{0x{:x}, 0x{:x}}})", to_hex(data),
+                lhs[0], lhs[1], rhs[0], rhs[1]));
+        }
+    };
+
+    // Hash the prefixes in batches of 1 to 4 keys of various (unequal)
+    // lengths and check the results against the scalar version.
+    for (unsigned n = 1; n <= 4; ++n) {
+        for (size_t i = 0; i + n <= full_sequence.size(); ++i) {
+            bytes_view prefixes[4];
+            for (unsigned lane = 0; lane < n; ++lane) {
+                prefixes[lane] = bytes_view(full_sequence.begin(), i + lane);
+            }
+
+            std::array<uint64_t,2> dst[4];
+            utils::murmur_hash::hash3_x64_128_batch4(prefixes, n, seed, dst);
+
+            for (unsigned lane = 0; lane < n; ++lane) {
+                assert_hashes_equal(prefixes[lane], dst[lane], prefix_hashes[i + lane]);
+            }
+        }
+    }
+}
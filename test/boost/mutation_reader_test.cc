@@ -60,6 +60,7 @@
 #include "readers/filtering.hh"
 #include "readers/evictable.hh"
 #include "readers/queue.hh"
+#include "readers/tee.hh"
 
 static schema_ptr make_schema() {
     return schema_builder("ks", "cf")
@@ -2542,6 +2543,77 @@ SEASTAR_THREAD_TEST_CASE(test_queue_reader) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(test_tee_reader) {
+    tests::reader_concurrency_semaphore_wrapper semaphore;
+    auto gen = random_mutation_generator(random_mutation_generator::generate_counters::no);
+
+    const auto expected_muts = gen(20);
+
+    auto read_all = [] (flat_mutation_reader_v2& reader, std::vector<mutation>& muts) {
+        return async([&reader, &muts] {
+            auto close_reader = deferred_close(reader);
+            while (auto mut_opt = read_mutation_from_flat_mutation_reader(reader).get0()) {
+                muts.emplace_back(std::move(*mut_opt));
+            }
+        });
+    };
+
+    // Both consumers see the full stream
+    {
+        auto p = make_queue_reader_v2(gen.schema(), semaphore.make_permit());
+        auto& secondary_reader = std::get<0>(p);
+
+        auto source = make_flat_mutation_reader_from_mutations_v2(gen.schema(), semaphore.make_permit(), expected_muts);
+        auto primary_reader = make_tee_reader_v2(std::move(source), std::move(std::get<1>(p)));
+
+        auto primary_muts = std::vector<mutation>{};
+        auto secondary_muts = std::vector<mutation>{};
+        when_all_succeed(read_all(primary_reader, primary_muts), read_all(secondary_reader, secondary_muts)).get();
+
+        BOOST_REQUIRE_EQUAL(primary_muts.size(), expected_muts.size());
+        BOOST_REQUIRE_EQUAL(secondary_muts.size(), expected_muts.size());
+        for (size_t i = 0; i < expected_muts.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(primary_muts.at(i), expected_muts.at(i));
+            BOOST_REQUIRE_EQUAL(secondary_muts.at(i), expected_muts.at(i));
+        }
+    }
+
+    // Closing the primary reader mid-stream aborts the secondary one
+    {
+        auto p = make_queue_reader_v2(gen.schema(), semaphore.make_permit());
+        auto& secondary_reader = std::get<0>(p);
+
+        auto source = make_flat_mutation_reader_from_mutations_v2(gen.schema(), semaphore.make_permit(), expected_muts);
+        source.set_max_buffer_size(1); // make sure the stream cannot be teed in one go
+        auto primary_reader = make_tee_reader_v2(std::move(source), std::move(std::get<1>(p)));
+
+        auto secondary_muts = std::vector<mutation>{};
+        auto secondary_fut = read_all(secondary_reader, secondary_muts);
+
+        BOOST_REQUIRE(bool(read_mutation_from_flat_mutation_reader(primary_reader).get0()));
+        primary_reader.close().get();
+
+        BOOST_REQUIRE_THROW(secondary_fut.get(), std::runtime_error);
+    }
+
+    // An abandoned secondary consumer doesn't disturb the primary one
+    {
+        auto p = make_queue_reader_v2(gen.schema(), semaphore.make_permit());
+
+        auto source = make_flat_mutation_reader_from_mutations_v2(gen.schema(), semaphore.make_permit(), expected_muts);
+        auto primary_reader = make_tee_reader_v2(std::move(source), std::move(std::get<1>(p)));
+
+        std::get<0>(p).close().get();
+
+        auto primary_muts = std::vector<mutation>{};
+        read_all(primary_reader, primary_muts).get();
+        BOOST_REQUIRE_EQUAL(primary_muts.size(), expected_muts.size());
+        for (size_t i = 0; i < expected_muts.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(primary_muts.at(i), expected_muts.at(i));
+        }
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(test_compacting_reader_as_mutation_source) {
     auto make_populate = [] (bool single_fragment_buffer) {
         return [single_fragment_buffer] (schema_ptr s, const std::vector<mutation>& mutations, gc_clock::time_point query_time) mutable {
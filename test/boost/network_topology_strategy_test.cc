@@ -147,6 +147,9 @@ void full_ring_check(const std::vector<ring_point>& ring_points,
 
     auto erm = calculate_effective_replication_map(ars_ptr, tmptr).get0();
 
+    std::vector<token> batch_tokens;
+    std::vector<inet_address_vector_replica_set> expected_endpoints;
+
     for (auto& rp : ring_points) {
         double cur_point1 = rp.point - 0.5;
         token t1(dht::token::kind::key, d2t(cur_point1 / ring_points.size()));
@@ -168,6 +171,23 @@ void full_ring_check(const std::vector<ring_point>& ring_points,
         endpoints_check(ars_ptr, tm, endpoints2, topo);
         check_ranges_are_sorted(erm, rp.host);
         BOOST_CHECK(endpoints1 == endpoints2);
+
+        batch_tokens.push_back(t2);
+        batch_tokens.push_back(t1);
+        expected_endpoints.push_back(endpoints2);
+        expected_endpoints.push_back(endpoints1);
+    }
+
+    //
+    // Check that the batched lookup agrees with the per-token one. The
+    // tokens are deliberately not sorted so the batch has to reorder them
+    // internally and still return the results in input order.
+    //
+    std::vector<inet_address_vector_replica_set> batch_endpoints;
+    erm->get_natural_endpoints(batch_tokens, batch_endpoints);
+    BOOST_REQUIRE_EQUAL(batch_endpoints.size(), expected_endpoints.size());
+    for (size_t i = 0; i < batch_endpoints.size(); i++) {
+        BOOST_CHECK(batch_endpoints[i] == expected_endpoints[i]);
     }
 }
 
@@ -343,10 +343,18 @@ public:
     }
 
     test_querier_cache& drops() {
-        BOOST_REQUIRE_EQUAL(_cache.get_stats().drops, ++_expected_stats.drops);
+        const auto& stats = _cache.get_stats();
+        BOOST_REQUIRE_EQUAL(stats.drops, ++_expected_stats.drops);
+        // Each drop has to be accounted for in exactly one cause counter.
+        BOOST_REQUIRE_EQUAL(stats.drops,
+                stats.drops_schema_version_mismatch + stats.drops_ring_pos_mismatch + stats.drops_clustering_pos_mismatch);
         return *this;
     }
 
+    const query::querier_cache::stats& get_stats() const {
+        return _cache.get_stats();
+    }
+
     test_querier_cache& no_evictions() {
         BOOST_REQUIRE_EQUAL(_cache.get_stats().time_based_evictions, _expected_stats.time_based_evictions);
         BOOST_REQUIRE_EQUAL(_cache.get_stats().resource_based_evictions, _expected_stats.resource_based_evictions);
@@ -527,6 +535,8 @@ SEASTAR_THREAD_TEST_CASE(lookup_with_different_schema_version_drops) {
         .no_misses()
         .drops()
         .no_evictions();
+
+    BOOST_REQUIRE_EQUAL(t.get_stats().drops_schema_version_mismatch, 1);
 }
 
 /*
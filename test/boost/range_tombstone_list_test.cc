@@ -530,6 +530,27 @@ BOOST_AUTO_TEST_CASE(test_random_list_is_not_overlapped) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_apply_monotonically_of_random_list_matches_apply) {
+    // apply_monotonically(range_tombstone_list&&) steals non-interacting
+    // entries from the source list; the result must nevertheless be
+    // identical to applying the tombstones one by one.
+    for (uint32_t i = 0; i < 2000; ++i) {
+        range_tombstone_list merged(*s);
+        range_tombstone_list src(*s);
+        for (auto&& rt : make_random()) {
+            merged.apply(*s, rt);
+        }
+        for (auto&& rt : make_random()) {
+            src.apply(*s, rt);
+        }
+        auto expected = merged;
+        expected.apply(*s, src);
+        merged.apply_monotonically(*s, std::move(src));
+        assert_that(*s, merged).is_equal_to(expected);
+        BOOST_REQUIRE(assert_valid(merged));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_non_sorted_addition_with_one_range_with_empty_end) {
     range_tombstone_list l(*s);
 
@@ -53,6 +53,34 @@ SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_clear_inactive_reads)
     BOOST_REQUIRE(std::all_of(handles.begin(), handles.end(), [] (const reader_concurrency_semaphore::inactive_read_handle& handle) { return !bool(handle); }));
 }
 
+SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_fragment_shell_pool) {
+    simple_schema s;
+    reader_concurrency_semaphore semaphore(reader_concurrency_semaphore::no_limits{}, get_name());
+    auto stop_sem = deferred_stop(semaphore);
+    auto permit = semaphore.make_tracking_only_permit(s.schema().get(), get_name(), db::no_timeout);
+
+    const size_t shell_size = 64;
+
+    // A freed shell is recycled by the next allocation of the same size.
+    auto* p1 = permit.alloc_fragment_shell(shell_size);
+    permit.free_fragment_shell(p1, shell_size);
+    BOOST_REQUIRE_EQUAL(permit.alloc_fragment_shell(shell_size), p1);
+    permit.free_fragment_shell(p1, shell_size);
+
+    // Shells of a different size bypass the pool.
+    auto* p2 = permit.alloc_fragment_shell(shell_size * 2);
+    BOOST_REQUIRE_NE(p2, p1);
+    permit.free_fragment_shell(p2, shell_size * 2);
+    BOOST_REQUIRE_EQUAL(permit.alloc_fragment_shell(shell_size), p1);
+    permit.free_fragment_shell(p1, shell_size);
+
+    // Another permit doesn't share the pool.
+    auto other_permit = semaphore.make_tracking_only_permit(s.schema().get(), get_name(), db::no_timeout);
+    auto* p3 = other_permit.alloc_fragment_shell(shell_size);
+    BOOST_REQUIRE_NE(p3, p1);
+    other_permit.free_fragment_shell(p3, shell_size);
+}
+
 SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_destroyed_permit_releases_units) {
     simple_schema s;
     const auto initial_resources = reader_concurrency_semaphore::resources{10, 1024 * 1024};
@@ -1041,6 +1069,38 @@ SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_evict_inactive_reads_
     fut2.get();
 }
 
+SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_adaptive_admission) {
+    reader_concurrency_semaphore semaphore(reader_concurrency_semaphore::for_tests{}, get_name(), 4, 4 * 1024);
+    auto stop_sem = deferred_stop(semaphore);
+    semaphore.enable_adaptive_admission(1, std::chrono::milliseconds(10));
+
+    // Saturation: an admitted read spent long in the wait queue, so the
+    // controller backs the count limit off. A second waiter keeps the wait
+    // list non-empty, preventing the limit from being probed upwards again.
+    std::vector<reader_permit> permits;
+    for (int i = 0; i < 4; ++i) {
+        permits.emplace_back(semaphore.obtain_permit(nullptr, get_name(), 1024, db::no_timeout).get0());
+    }
+    auto waiter1_fut = semaphore.obtain_permit(nullptr, get_name(), 1024, db::no_timeout);
+    BOOST_REQUIRE_EQUAL(semaphore.waiters(), 1);
+    seastar::sleep(std::chrono::milliseconds(20)).get(); // accrue wait above the high watermark
+
+    permits.pop_back();
+    auto waiter1_permit = waiter1_fut.get0();
+    BOOST_REQUIRE_GE(semaphore.get_stats().total_admission_wait_time_us, 2000);
+    auto waiter2_fut = semaphore.obtain_permit(nullptr, get_name(), 1024, db::no_timeout);
+
+    REQUIRE_EVENTUALLY_EQUAL(semaphore.initial_resources().count, 3);
+
+    // Recovery: with the queue drained and no admission waits the limit is
+    // probed back up to the configured maximum.
+    permits.clear();
+    { auto p = std::move(waiter1_permit); }
+    auto waiter2_permit = waiter2_fut.get0();
+
+    REQUIRE_EVENTUALLY_EQUAL(semaphore.initial_resources().count, 4);
+}
+
 SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_set_resources) {
     const auto initial_resources = reader_concurrency_semaphore::resources{4, 4 * 1024};
     reader_concurrency_semaphore semaphore(reader_concurrency_semaphore::for_tests{}, get_name(), initial_resources.count, initial_resources.memory);
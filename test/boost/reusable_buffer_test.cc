@@ -60,6 +60,77 @@ BOOST_AUTO_TEST_CASE(test_get_linearized_view) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_get_linearized_view_gather) {
+    utils::reusable_buffer buffer;
+
+    auto test = [&buffer] (size_t n) {
+        testlog.info("Testing gathered buffer size {}", n);
+        auto original = tests::random::get_bytes(n);
+
+        // gather the data in pieces of varying sizes
+        auto view = buffer.get_linearized_view(n, [&] (bytes_mutable_view out) {
+            BOOST_REQUIRE_EQUAL(out.size(), n);
+            auto dst = out.begin();
+            bytes_view left = original;
+            size_t piece = 1;
+            while (!left.empty()) {
+                auto this_size = std::min(left.size(), piece);
+                dst = std::copy_n(left.begin(), this_size, dst);
+                left.remove_prefix(this_size);
+                piece = piece * 2 + 1;
+            }
+        });
+        BOOST_REQUIRE_EQUAL(view.size(), n);
+        BOOST_REQUIRE(view == original);
+    };
+
+    for (auto j = 0; j < 2; j++) {
+        buffer.clear();
+
+        test(0);
+        test(1'000'000);
+        test(1'000);
+
+        for (auto i = 0; i < 25; i++) {
+            test(tests::random::get_int(512 * 1024));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_shrink_to_watermark) {
+    utils::reusable_buffer buffer;
+
+    auto use = [&buffer] (size_t n) {
+        buffer.get_linearized_view(n, [&] (bytes_mutable_view out) {
+            BOOST_REQUIRE_EQUAL(out.size(), n);
+        });
+    };
+
+    use(1'000'000);
+    BOOST_REQUIRE_GE(buffer.size(), 1'000'000);
+
+    // A steady-state period keeps the buffer as it is.
+    use(1'000'000);
+    buffer.shrink_to_watermark();
+    BOOST_REQUIRE_GE(buffer.size(), 1'000'000);
+
+    // Once demand drops, the next shrink gives back the excess.
+    use(1'000);
+    buffer.shrink_to_watermark();
+    BOOST_REQUIRE_LT(buffer.size(), 1'000'000);
+    BOOST_REQUIRE_GE(buffer.size(), 1'000);
+
+    // The shrunk buffer still works.
+    use(1'000);
+
+    // A period with no uses at all releases everything.
+    buffer.shrink_to_watermark();
+    buffer.shrink_to_watermark();
+    BOOST_REQUIRE_EQUAL(buffer.size(), 0);
+    use(2'000);
+    BOOST_REQUIRE_GE(buffer.size(), 2'000);
+}
+
 BOOST_AUTO_TEST_CASE(test_make_buffer) {
     utils::reusable_buffer buffer;
 
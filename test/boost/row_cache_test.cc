@@ -871,6 +871,32 @@ SEASTAR_TEST_CASE(test_eviction) {
     });
 }
 
+SEASTAR_TEST_CASE(test_cached_partition_keys) {
+    return seastar::async([] {
+        auto s = make_schema();
+        auto mt = make_lw_shared<replica::memtable>(s);
+
+        cache_tracker tracker;
+        row_cache cache(s, snapshot_source_from_snapshot(mt->as_data_source()), tracker);
+
+        std::vector<dht::decorated_key> keys;
+        for (int i = 0; i < 100; i++) {
+            auto m = make_new_mutation(s);
+            keys.emplace_back(m.decorated_key());
+            cache.populate(m);
+        }
+        std::sort(keys.begin(), keys.end(), dht::ring_position_less_comparator(*s));
+
+        auto cached = cache.cached_partition_keys(1000);
+        BOOST_REQUIRE_EQUAL(cached.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            BOOST_REQUIRE(cached[i].equal(*s, keys[i]));
+        }
+
+        BOOST_REQUIRE_EQUAL(cache.cached_partition_keys(10).size(), 10);
+    });
+}
+
 #ifndef SEASTAR_DEFAULT_ALLOCATOR // Depends on eviction, which is absent with the std allocator
 
 SEASTAR_TEST_CASE(test_eviction_from_invalidated) {
@@ -1781,6 +1807,53 @@ SEASTAR_TEST_CASE(test_slicing_mutation_reader) {
     });
 }
 
+SEASTAR_TEST_CASE(test_population_budget_limits_cache_growth_per_read) {
+    return seastar::async([] {
+        simple_schema s;
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+
+        constexpr auto row_count = 64;
+        auto m = mutation(s.schema(), s.make_pkey(0));
+        for (auto i = 0; i < row_count; i++) {
+            s.add_row(m, s.make_ckey(i), "v");
+        }
+
+        auto mt = make_lw_shared<replica::memtable>(s.schema());
+        mt->apply(m);
+
+        cache_tracker tracker;
+        tracker.set_population_budget(1);
+        row_cache cache(s.schema(), snapshot_source_from_snapshot(mt->as_data_source()), tracker);
+
+        auto pr = dht::partition_range::make_singular(m.decorated_key());
+
+        // The read must return full data even though most of it doesn't fit
+        // within the population budget.
+        assert_that(cache.make_reader(s.schema(), semaphore.make_permit(), pr))
+            .produces(m)
+            .produces_end_of_stream();
+
+        BOOST_REQUIRE(tracker.get_stats().population_budget_cutoffs > 0);
+        BOOST_REQUIRE(tracker.get_stats().rows < row_count);
+
+        // Later reads are still correct and make incremental progress.
+        auto rows_before = tracker.get_stats().rows;
+        assert_that(cache.make_reader(s.schema(), semaphore.make_permit(), pr))
+            .produces(m)
+            .produces_end_of_stream();
+        BOOST_REQUIRE(tracker.get_stats().rows > rows_before);
+        BOOST_REQUIRE(tracker.get_stats().rows < row_count);
+
+        // With the limit disabled a single read populates the whole partition.
+        tracker.set_population_budget(0);
+        cache.invalidate(row_cache::external_updater([] {})).get0();
+        assert_that(cache.make_reader(s.schema(), semaphore.make_permit(), pr))
+            .produces(m)
+            .produces_end_of_stream();
+        BOOST_REQUIRE(tracker.get_stats().rows >= row_count);
+    });
+}
+
 static void evict_one_partition(cache_tracker& tracker) {
     auto initial = tracker.partitions();
     assert(initial > 0);
@@ -2249,6 +2322,80 @@ static void apply(row_cache& cache, memtable_snapshot_source& underlying, replic
     cache.update(row_cache::external_updater([&] { underlying.apply(std::move(mt1)); }), m).get();
 }
 
+SEASTAR_TEST_CASE(test_batched_probe) {
+    return seastar::async([] {
+        auto s = make_schema();
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        cache_tracker tracker;
+        memtable_snapshot_source underlying(s);
+
+        std::vector<mutation> muts;
+        for (int i = 0; i < 8; ++i) {
+            muts.push_back(make_new_mutation(s));
+        }
+        std::sort(muts.begin(), muts.end(), mutation_decorated_key_less_comparator());
+        for (auto& m : muts) {
+            underlying.apply(m);
+        }
+
+        row_cache cache(s, snapshot_source([&] { return underlying(); }), tracker);
+
+        // Populate every other partition.
+        for (size_t i = 0; i < muts.size(); i += 2) {
+            auto range = dht::partition_range::make_singular(muts[i].decorated_key());
+            assert_that(cache.make_reader(s, semaphore.make_permit(), range))
+                .produces(muts[i])
+                .produces_end_of_stream();
+        }
+
+        std::vector<dht::decorated_key> keys;
+        for (auto& m : muts) {
+            keys.push_back(m.decorated_key());
+        }
+        auto present = cache.probe(keys);
+        BOOST_REQUIRE_EQUAL(present.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(present[i], i % 2 == 0);
+        }
+
+        // An empty batch is fine.
+        BOOST_REQUIRE(cache.probe({}).empty());
+    });
+}
+
+SEASTAR_TEST_CASE(test_update_preempted_mid_range_tombstone_list) {
+    return seastar::async([] {
+        simple_schema s;
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        cache_tracker tracker;
+        memtable_snapshot_source underlying(s.schema());
+
+        auto pk = s.make_pkey(0);
+        auto pr = dht::partition_range::make_singular(pk);
+
+        mutation m1(s.schema(), pk);
+        s.add_row(m1, s.make_ckey(0), "val");
+        underlying.apply(m1);
+
+        row_cache cache(s.schema(), snapshot_source([&] { return underlying(); }), tracker);
+        populate_range(cache, pr);
+
+        // Enough disjoint range tombstones for the update to yield in the
+        // middle of applying the list to the cached partition.
+        mutation m2(s.schema(), pk);
+        tombstone t{s.new_timestamp(), gc_clock::now()};
+        for (int i = 0; i < 2000; ++i) {
+            m2.partition().apply_delete(*s.schema(),
+                s.make_range_tombstone(query::clustering_range::make(s.make_ckey(2 * i + 1), s.make_ckey(2 * i + 2)), t));
+        }
+        apply(cache, underlying, m2);
+
+        assert_that(cache.make_reader(s.schema(), semaphore.make_permit(), pr))
+            .produces(m1 + m2)
+            .produces_end_of_stream();
+    });
+}
+
 SEASTAR_TEST_CASE(test_readers_get_all_data_after_eviction) {
     return seastar::async([] {
         simple_schema table;
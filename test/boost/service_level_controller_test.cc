@@ -111,3 +111,43 @@ SEASTAR_THREAD_TEST_CASE(subscriber_simple) {
     BOOST_REQUIRE_EQUAL(ccss.ops, expected_result);
     sl_controller.stop().get();
 }
+
+SEASTAR_THREAD_TEST_CASE(cpu_budget_admission) {
+    sharded<service_level_controller> sl_controller;
+    sharded<auth::service> auth_service;
+    sl_controller.start(std::ref(auth_service), service_level_options{}).get();
+    auto& controller = sl_controller.local();
+
+    utils::updateable_value_source<uint32_t> budget;
+    budget.set(100); // 100ms of execution time per second of wall-clock time
+    controller.set_cpu_budget(utils::updateable_value<uint32_t>(budget));
+
+    // A level within its budget is admitted immediately.
+    controller.wait_for_cpu_budget("sl1").get();
+    controller.account_cpu_time("sl1", std::chrono::milliseconds(10));
+    auto within_budget = controller.wait_for_cpu_budget("sl1");
+    BOOST_REQUIRE(within_budget.available());
+    within_budget.get();
+
+    // Overdrawing the budget delays the next statement until the deficit is
+    // earned back at the configured refill rate.
+    controller.account_cpu_time("sl1", std::chrono::milliseconds(150));
+    auto start = std::chrono::steady_clock::now();
+    controller.wait_for_cpu_budget("sl1").get();
+    auto waited = std::chrono::steady_clock::now() - start;
+    BOOST_REQUIRE(waited >= std::chrono::milliseconds(300));
+
+    // Other levels are unaffected by the overdrawn one.
+    auto other_level = controller.wait_for_cpu_budget("sl2");
+    BOOST_REQUIRE(other_level.available());
+    other_level.get();
+
+    // Disabling enforcement admits everything immediately.
+    budget.set(0);
+    controller.account_cpu_time("sl1", std::chrono::seconds(10));
+    auto unenforced = controller.wait_for_cpu_budget("sl1");
+    BOOST_REQUIRE(unenforced.available());
+    unenforced.get();
+
+    sl_controller.stop().get();
+}
@@ -36,6 +36,7 @@
 #include "range.hh"
 #include "partition_slice_builder.hh"
 #include "compaction/compaction_strategy_impl.hh"
+#include "compaction/throughput_calibration.hh"
 #include "compaction/date_tiered_compaction_strategy.hh"
 #include "compaction/time_window_compaction_strategy.hh"
 #include "compaction/leveled_compaction_strategy.hh"
@@ -1498,6 +1499,44 @@ SEASTAR_TEST_CASE(time_window_strategy_time_window_tests) {
     return make_ready_future<>();
 }
 
+SEASTAR_TEST_CASE(time_window_strategy_cold_cache_eviction_option_test) {
+    {
+        time_window_compaction_strategy_options options(std::map<sstring, sstring>{});
+        BOOST_REQUIRE_EQUAL(options.get_cold_cache_eviction_windows(), 0);
+    }
+    {
+        std::map<sstring, sstring> opts = { { time_window_compaction_strategy_options::COLD_CACHE_EVICTION_WINDOWS_KEY, "7" }, };
+        time_window_compaction_strategy_options options(opts);
+        BOOST_REQUIRE_EQUAL(options.get_cold_cache_eviction_windows(), 7);
+    }
+    BOOST_REQUIRE_THROW(time_window_compaction_strategy_options({{ time_window_compaction_strategy_options::COLD_CACHE_EVICTION_WINDOWS_KEY, "-1" }}),
+            exceptions::configuration_exception);
+    BOOST_REQUIRE_THROW(time_window_compaction_strategy_options({{ time_window_compaction_strategy_options::COLD_CACHE_EVICTION_WINDOWS_KEY, "five" }}),
+            exceptions::syntax_exception);
+
+    return make_ready_future<>();
+}
+
+SEASTAR_TEST_CASE(time_window_strategy_cold_compression_chunk_length_option_test) {
+    {
+        time_window_compaction_strategy_options options(std::map<sstring, sstring>{});
+        BOOST_REQUIRE_EQUAL(options.get_cold_compression_chunk_length_in_kb(), 0);
+    }
+    {
+        std::map<sstring, sstring> opts = { { time_window_compaction_strategy_options::COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY, "64" }, };
+        time_window_compaction_strategy_options options(opts);
+        BOOST_REQUIRE_EQUAL(options.get_cold_compression_chunk_length_in_kb(), 64);
+    }
+    BOOST_REQUIRE_THROW(time_window_compaction_strategy_options({{ time_window_compaction_strategy_options::COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY, "-16" }}),
+            exceptions::configuration_exception);
+    BOOST_REQUIRE_THROW(time_window_compaction_strategy_options({{ time_window_compaction_strategy_options::COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY, "48" }}),
+            exceptions::configuration_exception);
+    BOOST_REQUIRE_THROW(time_window_compaction_strategy_options({{ time_window_compaction_strategy_options::COLD_COMPRESSION_CHUNK_LENGTH_IN_KB_KEY, "big" }}),
+            exceptions::syntax_exception);
+
+    return make_ready_future<>();
+}
+
 SEASTAR_TEST_CASE(time_window_strategy_ts_resolution_check) {
   return test_env::do_with([] (test_env& env) {
     auto ts = 1451001601000L; // 2015-12-25 @ 00:00:01, in milliseconds
@@ -1804,6 +1843,64 @@ SEASTAR_TEST_CASE(size_tiered_beyond_max_threshold_test) {
   });
 }
 
+SEASTAR_TEST_CASE(size_tiered_bounded_output_test) {
+  return test_env::do_with([] (test_env& env) {
+    table_for_tests cf(env.manager());
+    std::map<sstring, sstring> options = {{"sstable_size_in_mb", "1"}};
+    auto cs = sstables::make_compaction_strategy(sstables::compaction_strategy_type::size_tiered, options);
+
+    std::vector<sstables::shared_sstable> candidates;
+    int min_threshold = cf->schema()->min_compaction_threshold();
+    candidates.reserve(min_threshold);
+    for (auto i = 0; i < min_threshold; i++) { // min_threshold sstables of similar size
+        auto sst = env.make_sstable(cf.schema(), "", i, la, big);
+        sstables::test(sst).set_data_file_size(10*1024*1024);
+        candidates.push_back(std::move(sst));
+    }
+    auto strategy_c = make_strategy_control_for_test(false);
+    auto desc = cs.get_sstables_for_compaction(cf.as_table_state(), *strategy_c, std::move(candidates));
+    BOOST_REQUIRE(desc.sstables.size() == size_t(min_threshold));
+    // With sstable_size_in_mb set, the job must bound output fragments and
+    // allow splitting a partition that doesn't fit in one fragment.
+    BOOST_REQUIRE_EQUAL(desc.max_sstable_bytes, 1UL*1024*1024);
+    BOOST_REQUIRE(desc.can_split_large_partition);
+    return cf.stop_and_keep_alive();
+  });
+}
+
+SEASTAR_TEST_CASE(size_tiered_hot_bucket_test) {
+  return test_env::do_with([] (test_env& env) {
+    table_for_tests cf(env.manager());
+    auto cs = sstables::make_compaction_strategy(sstables::compaction_strategy_type::size_tiered, cf.schema()->compaction_strategy_options());
+
+    // Two buckets: a cold one with more sstables and a hot, bigger one.
+    // Without read activity the bigger cold bucket would win; hotness must
+    // override that.
+    std::vector<sstables::shared_sstable> candidates;
+    int min_threshold = cf->schema()->min_compaction_threshold();
+    for (auto i = 0; i < min_threshold + 1; i++) {
+        auto sst = env.make_sstable(cf.schema(), "", i, la, big);
+        sstables::test(sst).set_data_file_size(1);
+        candidates.push_back(std::move(sst));
+    }
+    constexpr uint64_t hot_size = 10*1024*1024;
+    for (auto i = 0; i < min_threshold; i++) {
+        auto sst = env.make_sstable(cf.schema(), "", min_threshold + 1 + i, la, big);
+        sstables::test(sst).set_data_file_size(hot_size);
+        sst->bump_read_hotness();
+        BOOST_REQUIRE(sst->read_hotness() > 0);
+        candidates.push_back(std::move(sst));
+    }
+    auto strategy_c = make_strategy_control_for_test(false);
+    auto desc = cs.get_sstables_for_compaction(cf.as_table_state(), *strategy_c, std::move(candidates));
+    BOOST_REQUIRE(desc.sstables.size() == size_t(min_threshold));
+    for (auto& sst : desc.sstables) {
+        BOOST_REQUIRE_EQUAL(sst->data_size(), hot_size);
+    }
+    return cf.stop_and_keep_alive();
+  });
+}
+
 SEASTAR_TEST_CASE(sstable_expired_data_ratio) {
     return test_env::do_with_async([] (test_env& env) {
         auto tmp = tmpdir();
@@ -5017,3 +5114,12 @@ SEASTAR_TEST_CASE(compaction_manager_stop_and_drain_race_test) {
     testlog.info("stopping compaction manager");
     co_await cm.stop();
 }
+
+SEASTAR_TEST_CASE(compaction_throughput_calibration_test) {
+    auto dir = tmpdir();
+    // A small sample - this checks plumbing, not measurement quality.
+    auto mbs = co_await sstables::calibrate_compaction_throughput(dir.path().string(), 1 << 20);
+    BOOST_REQUIRE(mbs >= 1);
+    // The temporary file must be gone.
+    BOOST_REQUIRE(!co_await seastar::file_exists((dir.path() / ".compaction_calibration").string()));
+}
@@ -2287,6 +2287,85 @@ SEASTAR_TEST_CASE(sstable_bad_tombstone_histogram_test) {
     });
 }
 
+SEASTAR_TEST_CASE(sstable_may_have_tombstones_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        for (auto version : writable_sstable_versions) {
+            auto builder = schema_builder("tests", "may_have_tombstones_test")
+                    .with_column("id", utf8_type, column_kind::partition_key)
+                    .with_column("value", int32_type);
+            auto s = builder.build();
+            auto& value_col = *s->get_column_definition("value");
+
+            auto tmp = tmpdir();
+            auto sst_gen = [&env, s, &tmp, gen = make_lw_shared<unsigned>(1), version]() mutable {
+                return env.make_sstable(s, tmp.path().string(), (*gen)++, version, big);
+            };
+
+            // Live, non-expiring data only.
+            mutation live(s, partition_key::from_exploded(*s, {to_bytes("live")}));
+            live.set_clustered_cell(clustering_key::make_empty(), value_col,
+                    make_atomic_cell(int32_type, int32_type->decompose(1)));
+            auto sst = make_sstable_containing(sst_gen, {live});
+            BOOST_REQUIRE(!sst->may_have_tombstones());
+
+            // A tombstone must be reported.
+            mutation del(s, partition_key::from_exploded(*s, {to_bytes("del")}));
+            del.partition().apply(tombstone(1, gc_clock::now()));
+            sst = make_sstable_containing(sst_gen, {live, del});
+            BOOST_REQUIRE(sst->may_have_tombstones());
+
+            // So must an expiring cell, which becomes a tombstone once it expires.
+            mutation expiring(s, partition_key::from_exploded(*s, {to_bytes("ttl")}));
+            expiring.set_clustered_cell(clustering_key::make_empty(), value_col,
+                    make_atomic_cell(int32_type, int32_type->decompose(1), 3600, 3600));
+            sst = make_sstable_containing(sst_gen, {expiring});
+            BOOST_REQUIRE(sst->may_have_tombstones());
+        }
+    });
+}
+
+// Rows whose cells all share the row marker's timestamp must be written with
+// the use_row_timestamp encoding (one liveness payload per row), so they have
+// to serialize strictly smaller than the same rows with per-cell timestamps.
+SEASTAR_TEST_CASE(sstable_row_uniform_cell_encoding_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        constexpr int n_columns = 16;
+        constexpr int n_rows = 128;
+
+        auto builder = schema_builder("tests", "row_uniform_cell_encoding_test")
+                .with_column("id", utf8_type, column_kind::partition_key)
+                .with_column("ck", int32_type, column_kind::clustering_key);
+        for (auto i = 0; i < n_columns; i++) {
+            builder.with_column(to_bytes("v" + to_sstring(i)), int32_type);
+        }
+        auto s = builder.build();
+
+        auto tmp = tmpdir();
+        auto sst_gen = [&env, s, &tmp, gen = make_lw_shared<unsigned>(1)]() mutable {
+            return env.make_sstable(s, tmp.path().string(), (*gen)++, sstables::get_highest_sstable_version(), big);
+        };
+
+        auto make_mutation = [&] (bool uniform_timestamps) {
+            const api::timestamp_type base_ts = 1577836800000000;
+            mutation m(s, partition_key::from_exploded(*s, {to_bytes("key")}));
+            for (auto r = 0; r < n_rows; r++) {
+                auto ck = clustering_key::from_single_value(*s, int32_type->decompose(r));
+                m.partition().clustered_row(*s, ck).apply(row_marker(base_ts));
+                for (auto i = 0; i < n_columns; i++) {
+                    auto cell_ts = uniform_timestamps ? base_ts : base_ts + i + 1;
+                    m.set_clustered_cell(ck, *s->get_column_definition(to_bytes("v" + to_sstring(i))),
+                            atomic_cell::make_live(*int32_type, cell_ts, int32_type->decompose(i)));
+                }
+            }
+            return m;
+        };
+
+        auto uniform_sst = make_sstable_containing(sst_gen, {make_mutation(true)});
+        auto distinct_sst = make_sstable_containing(sst_gen, {make_mutation(false)});
+        BOOST_REQUIRE_LT(uniform_sst->data_size(), distinct_sst->data_size());
+    });
+}
+
 SEASTAR_TEST_CASE(sstable_owner_shards) {
     return test_env::do_with_async([] (test_env& env) {
         cell_locker_stats cl_stats;
@@ -26,10 +26,13 @@ static void add_entry(logalloc::region& r,
     as(r, [&] {
         with_allocator(r.allocator(), [&] {
             sstables::key sst_key = sstables::key::from_partition_key(s, key);
+            auto token = s.get_partitioner().get_token(s, key);
             page._entries.push_back(make_managed<index_entry>(
                     managed_bytes(sst_key.get_bytes()),
+                    token,
                     position,
                     managed_ref<promoted_index>()));
+            page._tokens.push_back(token);
         });
     });
 }
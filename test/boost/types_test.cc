@@ -517,6 +517,47 @@ BOOST_AUTO_TEST_CASE(test_compound_type_compare) {
         type.serialize_value({bytes("c"), bytes("b"), bytes("c")})) < 0);
 }
 
+// Compounds made entirely of fixed-width byte-order comparable types take a
+// memcmp-based fast path in compound_type::compare(). Check that it agrees
+// with the generic component-wise comparison, including around sign
+// boundaries, reversed components, prefixes and empty component values.
+BOOST_AUTO_TEST_CASE(test_compound_type_compare_fixed_layout) {
+    compound_type<> type({long_type, int32_type});
+
+    auto key = [&] (int64_t a, int32_t b) {
+        return type.serialize_value({long_type->decompose(a), int32_type->decompose(b)});
+    };
+
+    BOOST_REQUIRE(type.compare(key(1, 2), key(1, 2)) == 0);
+    BOOST_REQUIRE(type.compare(key(1, 2), key(1, 3)) < 0);
+    BOOST_REQUIRE(type.compare(key(2, 2), key(1, 3)) > 0);
+    BOOST_REQUIRE(type.compare(key(-1, 0), key(1, 0)) < 0);
+    BOOST_REQUIRE(type.compare(key(std::numeric_limits<int64_t>::min(), 0), key(-1, 0)) < 0);
+    BOOST_REQUIRE(type.compare(key(1, -1), key(1, 1)) < 0);
+
+    // Empty component values are legal and sort before all proper values.
+    auto empty_first = type.serialize_value({long_type->decompose(int64_t(1)), bytes()});
+    BOOST_REQUIRE(type.compare(empty_first, key(1, std::numeric_limits<int32_t>::min())) < 0);
+    BOOST_REQUIRE(type.compare(empty_first, empty_first) == 0);
+
+    compound_type<allow_prefixes::yes> prefixable({long_type, int32_type});
+    auto prefix = prefixable.serialize_value(std::vector<bytes>{long_type->decompose(int64_t(1))});
+    BOOST_REQUIRE(prefixable.compare(prefix, key(1, 0)) < 0);
+    BOOST_REQUIRE(prefixable.compare(key(1, 0), prefix) > 0);
+    BOOST_REQUIRE(prefixable.compare(prefix, key(0, 0)) > 0);
+
+    compound_type<> reversed({long_type, reversed_type_impl::get_instance(int32_type)});
+    BOOST_REQUIRE(reversed.compare(key(1, 2), key(1, 3)) > 0);
+    BOOST_REQUIRE(reversed.compare(key(1, -1), key(1, 1)) > 0);
+    BOOST_REQUIRE(reversed.compare(key(0, 2), key(1, 1)) < 0);
+
+    // Variable-width components must not engage the fast path.
+    compound_type<> generic({long_type, utf8_type});
+    BOOST_REQUIRE(generic.compare(
+        generic.serialize_value({long_type->decompose(int64_t(1)), bytes("b")}),
+        generic.serialize_value({long_type->decompose(int64_t(1)), bytes("ab")})) > 0);
+}
+
 template <typename T>
 std::optional<T>
 extract(data_value a) {
@@ -572,6 +613,27 @@ BOOST_AUTO_TEST_CASE(test_tuple) {
     test_string_conversion({10, {}, "a@@:b:c"}, "10:@:a\\@\\@\\:b\\:c");
 }
 
+BOOST_AUTO_TEST_CASE(test_map_find_value) {
+    auto t = map_type_impl::get_instance(int32_type, utf8_type, true);
+    map_type_impl::native_type m;
+    for (int i = 0; i < 100; i += 2) {
+        m.emplace_back(data_value(i), data_value(format("v{}", i)));
+    }
+    auto serialized = managed_bytes(t->decompose(make_map_value(t, m)));
+    auto sf = cql_serialization_format::internal();
+    for (int i = 0; i < 100; ++i) {
+        auto found = t->find_value(managed_bytes_view(serialized), managed_bytes_view(int32_type->decompose(i)), sf);
+        if (i % 2 == 0) {
+            BOOST_REQUIRE(found);
+            BOOST_REQUIRE(utf8_type->equal(to_bytes(*found), utf8_type->decompose(format("v{}", i))));
+        } else {
+            BOOST_REQUIRE(!found);
+        }
+    }
+    // An absent (null) map has an empty serialized form.
+    BOOST_REQUIRE(!t->find_value(managed_bytes_view(), managed_bytes_view(int32_type->decompose(0)), sf));
+}
+
 void test_validation_fails(const shared_ptr<const abstract_type>& type, bytes_view v)
 {
     try {
@@ -869,6 +931,19 @@ BOOST_AUTO_TEST_CASE(test_map_to_json) {
     BOOST_REQUIRE_EQUAL(to_json_string(*m, map_v.serialize()), "{\"42\": \"abc\", \"42\": \"abc\"}");
 }
 
+BOOST_AUTO_TEST_CASE(test_string_to_json_escaping) {
+    auto v = data_value("a\"b\\c\nd\x01" "e");
+    const char* expected = "\"a\\\"b\\\\c\\nd\\u0001e\"";
+    BOOST_REQUIRE_EQUAL(to_json_string(*utf8_type, v.serialize()), expected);
+
+    // The streaming writer must produce the same bytes.
+    auto ser = v.serialize_nonnull();
+    bytes_ostream out;
+    to_json(*utf8_type, bytes_view(ser), out);
+    auto lin = out.linearize();
+    BOOST_REQUIRE_EQUAL(sstring(reinterpret_cast<const char*>(lin.data()), lin.size()), expected);
+}
+
 BOOST_AUTO_TEST_CASE(test_set_to_string) {
     auto m = set_type_impl::get_instance(int32_type, true);
     using native_type = std::vector<data_value>;
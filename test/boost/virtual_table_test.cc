@@ -16,7 +16,9 @@
 #include "db/virtual_table.hh"
 #include "db/system_keyspace.hh"
 #include "db/config.hh"
+#include "replica/database.hh"
 #include "test/lib/cql_assertions.hh"
+#include "test/lib/reader_concurrency_semaphore.hh"
 
 namespace db {
 
@@ -53,6 +55,25 @@ public:
     }
 };
 
+class counting_table : public memtable_filling_virtual_table {
+public:
+    int executions = 0;
+
+    explicit counting_table(lowres_clock::duration result_ttl)
+            : memtable_filling_virtual_table(test_table::build_schema()) {
+        _result_ttl = result_ttl;
+    }
+
+    future<> execute(std::function<void(mutation)> mutation_sink) override {
+        ++executions;
+        mutation m(_s, partition_key::from_single_value(*_s, data_value(42).serialize_nonnull()));
+        row& cr = m.partition().clustered_row(*_s, clustering_key::from_single_value(*_s, data_value(1).serialize_nonnull())).cells();
+        set_cell(cr, "v", 8);
+        mutation_sink(std::move(m));
+        return make_ready_future<>();
+    }
+};
+
 }
 
 SEASTAR_TEST_CASE(test_set_cell) {
@@ -102,3 +123,61 @@ SEASTAR_THREAD_TEST_CASE(test_system_config_table_no_live_update) {
         );
     }).get();
 }
+
+SEASTAR_THREAD_TEST_CASE(test_memtable_filling_result_cache) {
+    tests::reader_concurrency_semaphore_wrapper semaphore;
+
+    auto drain = [&] (db::counting_table& table) {
+        auto ms = table.as_mutation_source();
+        auto rd = ms.make_reader_v2(table.schema(), semaphore.make_permit(), query::full_partition_range);
+        while (rd().get0()) {
+        }
+        rd.close().get();
+    };
+
+    // With a TTL, the second read is served from the cached result.
+    auto cached = db::counting_table(std::chrono::hours(1));
+    drain(cached);
+    drain(cached);
+    BOOST_REQUIRE_EQUAL(cached.executions, 1);
+
+    // Without one, every read regenerates.
+    auto uncached = db::counting_table(std::chrono::seconds(0));
+    drain(uncached);
+    drain(uncached);
+    BOOST_REQUIRE_EQUAL(uncached.executions, 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_partition_existence_table) {
+    do_with_cql_env_thread([] (cql_test_env& env) {
+        env.execute_cql("CREATE TABLE ks.pe (pk int PRIMARY KEY, v int);").get();
+        env.execute_cql("INSERT INTO ks.pe (pk, v) VALUES (1, 10);").get();
+
+        auto s = env.local_db().find_schema("ks", "pe");
+        auto key_of = [&s] (int pk) {
+            return to_bytes(partition_key::from_single_value(*s, int32_type->decompose(pk)).representation());
+        };
+        auto check = [&env] (bytes key) {
+            return env.execute_cql(format("SELECT may_exist FROM system.partition_existence"
+                    " WHERE keyspace_name = 'ks' AND table_name = 'pe' AND partition_key = 0x{};", to_hex(key))).get0();
+        };
+
+        // Key present in a memtable.
+        assert_that(check(key_of(1))).is_rows().with_size(1).with_row({ boolean_type->decompose(true) });
+        // Absent key - every filter says no.
+        assert_that(check(key_of(2))).is_rows().with_size(1).with_row({ boolean_type->decompose(false) });
+
+        // Flush, so the sstable bloom filter answers instead of the memtable.
+        env.db().invoke_on_all([] (replica::database& db) {
+            return db.find_column_family("ks", "pe").flush();
+        }).get();
+        assert_that(check(key_of(1))).is_rows().with_size(1).with_row({ boolean_type->decompose(true) });
+        // No negative check against the sstable here - a bloom filter is
+        // allowed (if unlikely) to answer "maybe" for an absent key.
+
+        // Unknown tables and malformed keys produce an empty result.
+        auto res = env.execute_cql("SELECT may_exist FROM system.partition_existence"
+                " WHERE keyspace_name = 'ks' AND table_name = 'no_such_table' AND partition_key = 0x00;").get0();
+        assert_that(res).is_rows().with_size(0);
+    }).get();
+}
@@ -86,6 +86,7 @@ future<scheduling_groups> get_scheduling_groups() {
         _scheduling_groups->memtable_scheduling_group = co_await create_scheduling_group("memtable", 1000);
         _scheduling_groups->memtable_to_cache_scheduling_group = co_await create_scheduling_group("memtable_to_cache", 200);
         _scheduling_groups->gossip_scheduling_group = co_await create_scheduling_group("gossip", 1000);
+        _scheduling_groups->background_compression_scheduling_group = co_await create_scheduling_group("background_compression", 200);
     }
     co_return *_scheduling_groups;
 }
@@ -558,6 +559,9 @@ public:
             sl_controller.start(std::ref(auth_service), qos::service_level_options{}).get();
             auto stop_sl_controller = defer([&sl_controller] { sl_controller.stop().get(); });
             sl_controller.invoke_on_all(&qos::service_level_controller::start).get();
+            sl_controller.invoke_on_all([&cfg] (qos::service_level_controller& sl) {
+                sl.set_cpu_budget(utils::updateable_value<uint32_t>(cfg->service_level_cpu_budget_ms_per_second));
+            }).get();
             sharded<cql3::query_processor> qp;
 
             auto sys_ks = seastar::sharded<db::system_keyspace>();
@@ -673,6 +677,7 @@ public:
             dbcfg.memtable_scheduling_group = scheduling_groups.memtable_scheduling_group;
             dbcfg.memtable_to_cache_scheduling_group = scheduling_groups.memtable_to_cache_scheduling_group;
             dbcfg.gossip_scheduling_group = scheduling_groups.gossip_scheduling_group;
+            dbcfg.background_compression_scheduling_group = scheduling_groups.background_compression_scheduling_group;
             dbcfg.sstables_format = sstables::from_string(cfg->sstable_format());
 
             // get_cm_cfg is called on each shard when starting a sharded<compaction_manager>
@@ -8,6 +8,7 @@
 
 #include <seastar/testing/test_case.hh>
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
 
 #include "utils/UUID_gen.hh"
 
@@ -136,6 +137,31 @@ SEASTAR_TEST_CASE(test_store_load_log_entries) {
     }, raft_cql_test_config());
 }
 
+SEASTAR_TEST_CASE(test_store_log_entries_group_commit) {
+    return do_with_cql_env([] (cql_test_env& env) -> future<> {
+        cql3::query_processor& qp = env.local_qp();
+        raft_sys_table_storage storage(qp, gid, raft::server_id::create_random_id(),
+                std::chrono::milliseconds(1));
+
+        std::vector<raft::log_entry_ptr> entries = create_test_log();
+        // Issue one store call per entry without waiting in between, so that
+        // the calls are coalesced into a single batch write.
+        std::vector<std::vector<raft::log_entry_ptr>> stores;
+        for (const raft::log_entry_ptr& eptr : entries) {
+            stores.push_back({eptr});
+        }
+        co_await parallel_for_each(stores, [&storage] (const std::vector<raft::log_entry_ptr>& s) {
+            return storage.store_log_entries(s);
+        });
+        raft::log_entries loaded_entries = co_await storage.load_log();
+
+        BOOST_CHECK_EQUAL(entries.size(), loaded_entries.size());
+        for (size_t i = 0, end = entries.size(); i != end; ++i) {
+            BOOST_CHECK(*entries[i] == *loaded_entries[i]);
+        }
+    }, raft_cql_test_config());
+}
+
 SEASTAR_TEST_CASE(test_truncate_log) {
     return do_with_cql_env([] (cql_test_env& env) -> future<> {
         cql3::query_processor& qp = env.local_qp();
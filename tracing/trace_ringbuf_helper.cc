@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+#include <cstring>
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/file.hh>
+#include <seastar/core/metrics.hh>
+#include <seastar/core/seastar.hh>
+
+#include "cql3/query_processor.hh"
+#include "db/config.hh"
+#include "tracing/trace_ringbuf_helper.hh"
+#include "utils/class_registrator.hh"
+
+namespace tracing {
+
+static logging::logger rb_logger("trace_ringbuf_helper");
+
+trace_ringbuf_helper::trace_ringbuf_helper(tracing& tr)
+        : i_tracing_backend_helper(tr)
+        , _ring(ring_capacity)
+        , _flush_timer([this] { maybe_flush(); })
+{
+    namespace sm = seastar::metrics;
+
+    _metrics.add_group("tracing_ringbuf_helper", {
+        sm::make_counter("flushed_records", [this] { return _stats.flushed_records; },
+                        sm::description("Counts the number of trace records flushed to the per-shard trace file.")),
+
+        sm::make_counter("overwritten_records", [this] { return _stats.overwritten_records; },
+                        sm::description("Counts the number of trace records overwritten in the ring buffer before they were flushed. "
+                                        "A non-zero value means records are produced faster than the disk absorbs them and the oldest ones are lost.")),
+
+        sm::make_counter("flush_errors", [this] { return _stats.flush_errors; },
+                        sm::description("Counts the number of errors during flushing the ring buffer to the trace file. "
+                                        "One error may cause one or more trace records to be lost.")),
+    });
+}
+
+future<> trace_ringbuf_helper::start(cql3::query_processor& qp) {
+    const auto& dirs = qp.db().get_config().data_file_directories();
+    if (dirs.empty()) {
+        throw std::runtime_error("trace_ringbuf_helper requires a data directory for its trace files");
+    }
+    auto path = format("{}/tracing-shard-{}.bin", dirs[0], this_shard_id());
+    auto f = co_await open_file_dma(path, open_flags::wo | open_flags::create | open_flags::truncate);
+    _out = co_await make_file_output_stream(std::move(f));
+
+    struct file_header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t record_size;
+    } header{file_magic, file_version, uint16_t(sizeof(record))};
+    co_await _out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    _flush_timer.arm_periodic(std::chrono::seconds(1));
+    rb_logger.info("writing binary trace records to {}", path);
+}
+
+future<> trace_ringbuf_helper::stop() {
+    _flush_timer.cancel();
+    co_await _pending_flushes.close();
+    if (_size) {
+        co_await flush().handle_exception([this] (std::exception_ptr ep) {
+            ++_stats.flush_errors;
+            rb_logger.warn("failed to flush trace records on shutdown: {}", ep);
+        });
+    }
+    co_await _out.close();
+}
+
+trace_ringbuf_helper::record& trace_ringbuf_helper::next_slot() noexcept {
+    record& r = _ring[_head];
+    _head = (_head + 1) % ring_capacity;
+    if (_size == ring_capacity) {
+        // The writer outran the flusher; drop the oldest unflushed record.
+        _tail = (_tail + 1) % ring_capacity;
+        ++_stats.overwritten_records;
+    } else {
+        ++_size;
+    }
+    return r;
+}
+
+void trace_ringbuf_helper::fill_common(record& r, const one_session_records& records) noexcept {
+    r.session_id_msb = records.session_id.get_most_significant_bits();
+    r.session_id_lsb = records.session_id.get_least_significant_bits();
+    r.parent_id = records.parent_id.get_id();
+    r.my_span_id = records.my_span_id.get_id();
+}
+
+void trace_ringbuf_helper::append_event(const one_session_records& records, const event_record& e) noexcept {
+    record& r = next_slot();
+    fill_common(r, records);
+    r.wall_time_us = std::chrono::duration_cast<std::chrono::microseconds>(e.event_time_point.time_since_epoch()).count();
+    r.elapsed_us = uint32_t(std::min<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(e.elapsed).count(), std::numeric_limits<uint32_t>::max()));
+    r.record_kind = record::kind::event;
+    r.message_size = uint8_t(std::min(e.message.size(), record::message_capacity));
+    std::memcpy(r.message, e.message.data(), r.message_size);
+}
+
+void trace_ringbuf_helper::append_session(const one_session_records& records) noexcept {
+    const session_record& s = records.session_rec;
+    record& r = next_slot();
+    fill_common(r, records);
+    r.wall_time_us = std::chrono::duration_cast<std::chrono::microseconds>(s.started_at.time_since_epoch()).count();
+    r.elapsed_us = uint32_t(std::min<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(s.elapsed).count(), std::numeric_limits<uint32_t>::max()));
+    r.record_kind = record::kind::session;
+    r.message_size = uint8_t(std::min(s.request.size(), record::message_capacity));
+    std::memcpy(r.message, s.request.data(), r.message_size);
+}
+
+void trace_ringbuf_helper::write_records_bulk(records_bulk& bulk) {
+    for (auto& records : bulk) {
+        auto nr = records->size();
+        for (const event_record& e : records->events_recs) {
+            append_event(*records, e);
+        }
+        records->events_recs.clear();
+        if (records->session_rec.ready()) {
+            append_session(*records);
+        }
+        records->data_consumed();
+        _local_tracing.write_complete(nr);
+    }
+    if (_size >= flush_threshold) {
+        maybe_flush();
+    }
+}
+
+void trace_ringbuf_helper::maybe_flush() {
+    if (_flushing || !_size || _pending_flushes.is_closed()) {
+        return;
+    }
+    _flushing = true;
+    // Future is waited on indirectly in `stop()` (via `_pending_flushes`).
+    (void)with_gate(_pending_flushes, [this] {
+        return flush().handle_exception([this] (std::exception_ptr ep) {
+            ++_stats.flush_errors;
+            rb_logger.warn("failed to flush trace records: {}", ep);
+        }).finally([this] { _flushing = false; });
+    });
+}
+
+future<> trace_ringbuf_helper::flush() {
+    // Copy the unflushed span out of the ring before the first preemption
+    // point, so that appends racing with the write - including overwrites
+    // of the oldest records - cannot touch the bytes on their way out.
+    auto n = _size;
+    temporary_buffer<char> buf(n * sizeof(record));
+    auto* out = buf.get_write();
+    auto contiguous = std::min(n, ring_capacity - _tail);
+    std::memcpy(out, _ring.data() + _tail, contiguous * sizeof(record));
+    std::memcpy(out + contiguous * sizeof(record), _ring.data(), (n - contiguous) * sizeof(record));
+    _tail = (_tail + n) % ring_capacity;
+    _size -= n;
+
+    co_await _out.write(buf.get(), buf.size());
+    co_await _out.flush();
+    _stats.flushed_records += n;
+}
+
+std::unique_ptr<backend_session_state_base> trace_ringbuf_helper::allocate_session_state() const {
+    return std::make_unique<backend_session_state_base>();
+}
+
+using registry_ringbuf = class_registrator<i_tracing_backend_helper, trace_ringbuf_helper, tracing&>;
+static registry_ringbuf registrator_ringbuf("trace_ringbuf_helper");
+
+}
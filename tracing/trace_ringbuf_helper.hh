@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2023-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+#pragma once
+
+#include <seastar/core/fstream.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/timer.hh>
+#include "tracing/tracing.hh"
+
+namespace tracing {
+
+/**
+ * A low-overhead tracing backend: trace records are serialized into a
+ * pre-allocated per-shard ring buffer of fixed-size binary records and
+ * flushed in bulk to a per-shard append-only file, off the request path.
+ * Unlike trace_keyspace_helper nothing is written to system_traces, so the
+ * traced workload does not compete with its own trace mutations and
+ * sampled tracing can stay enabled in production.
+ *
+ * When records are produced faster than they are flushed the oldest
+ * unflushed records are overwritten in place - tracing never exerts
+ * back-pressure on the workload.
+ *
+ * Select it with the tracing_backend configuration option.
+ */
+class trace_ringbuf_helper final : public i_tracing_backend_helper {
+public:
+    // The trace file is a small header followed by raw records in the
+    // writing CPU's native byte order; the format is meant for offline
+    // consumption on the same architecture.
+    static constexpr uint32_t file_magic = 0x53545242; // "BRTS" on disk
+    static constexpr uint16_t file_version = 1;
+
+    struct record {
+        static constexpr size_t message_capacity = 46;
+        enum class kind : uint8_t { session = 0, event = 1 };
+
+        int64_t session_id_msb;
+        int64_t session_id_lsb;
+        uint64_t parent_id;
+        uint64_t my_span_id;
+        uint64_t wall_time_us;          // µs since the epoch
+        uint32_t elapsed_us;
+        kind record_kind;
+        uint8_t message_size;
+        char message[message_capacity]; // truncated, not NUL-terminated
+    };
+    static_assert(sizeof(record) == 96, "record is the unit of the trace file format");
+    static_assert(std::is_trivially_copyable_v<record>);
+
+private:
+    static constexpr size_t ring_capacity = 64 * 1024;
+    static constexpr size_t flush_threshold = ring_capacity / 2;
+
+    std::vector<record> _ring;
+    size_t _head = 0; // next slot to write
+    size_t _tail = 0; // oldest unflushed record
+    size_t _size = 0; // number of unflushed records
+    bool _flushing = false;
+    output_stream<char> _out;
+    seastar::gate _pending_flushes;
+    timer<lowres_clock> _flush_timer;
+
+    struct stats {
+        uint64_t flushed_records = 0;
+        uint64_t overwritten_records = 0;
+        uint64_t flush_errors = 0;
+    } _stats;
+
+    seastar::metrics::metric_groups _metrics;
+
+public:
+    trace_ringbuf_helper(tracing& tr);
+    virtual ~trace_ringbuf_helper() {}
+
+    virtual future<> start(cql3::query_processor& qp) override;
+    virtual future<> stop() override;
+    virtual void write_records_bulk(records_bulk& bulk) override;
+    virtual std::unique_ptr<backend_session_state_base> allocate_session_state() const override;
+
+private:
+    record& next_slot() noexcept;
+    void fill_common(record& r, const one_session_records& records) noexcept;
+    void append_event(const one_session_records& records, const event_record& e) noexcept;
+    void append_session(const one_session_records& records) noexcept;
+    void maybe_flush();
+    future<> flush();
+};
+
+}
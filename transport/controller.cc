@@ -90,6 +90,12 @@ future<> controller::do_start_server() {
         smp_service_group_config cql_server_smp_service_group_config;
         cql_server_smp_service_group_config.max_nonlocal_requests = 5000;
         cql_server_config.bounce_request_smp_service_group = create_smp_service_group(cql_server_smp_service_group_config).get0();
+        if (auto shares = cfg.native_transport_connection_setup_shares()) {
+            if (!_connection_setup_sg) {
+                _connection_setup_sg = create_scheduling_group("cql_conn_setup", shares).get0();
+            }
+            cql_server_config.connection_setup_scheduling_group = _connection_setup_sg;
+        }
         const seastar::net::inet_address ip = utils::resolve(cfg.rpc_address, family, preferred).get0();
 
         struct listen_cfg {
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <optional>
+
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/future.hh>
@@ -45,6 +48,10 @@ class controller : public protocol_server {
     sharded<service::memory_limiter>& _mem_limiter;
     sharded<qos::service_level_controller>& _sl_controller;
     const db::config& _config;
+    // Created lazily on the first server start and kept across
+    // disablebinary/enablebinary cycles, since scheduling groups are a
+    // scarce resource and cannot be created anew on every restart.
+    std::optional<scheduling_group> _connection_setup_sg;
 
     future<> set_cql_ready(bool ready);
     future<> do_start_server();
@@ -11,6 +11,9 @@
 #include "server.hh"
 #include "utils/reusable_buffer.hh"
 
+#include <any>
+#include <type_traits>
+
 namespace cql_transport {
 
 enum class cql_binary_opcode : uint8_t {
@@ -38,7 +41,23 @@ class response {
     cql_binary_opcode _opcode;
     uint8_t           _flags = 0; // a bitwise OR mask of zero or more cql_frame_flags values
     bytes_ostream _body;
+    // Body fragments which are referenced rather than copied into _body.
+    // Each sits logically at the recorded offset of _body; make_message()
+    // interleaves them with the _body fragments. _pinned keeps the
+    // referenced storage alive for as long as this response.
+    struct external_fragment {
+        size_t body_offset;
+        const char* data;
+        size_t size;
+    };
+    std::vector<external_fragment> _externals;
+    size_t _externals_size = 0;
+    std::any _pinned;
 public:
+    // Values at least this large are referenced instead of copied into the
+    // body, provided the response was pinned to their owner (see pin()).
+    static constexpr size_t external_value_threshold = 4096;
+
     template<typename T>
     class placeholder;
 
@@ -57,6 +76,13 @@ public:
         _flags |= flag;
     }
 
+    // Makes the response keep the given object alive for as long as the
+    // response itself, allowing write_value() to reference large values'
+    // storage instead of copying it into the body.
+    void pin(std::any owner) {
+        _pinned = std::move(owner);
+    }
+
     void serialize(const event::schema_change& event, uint8_t version);
     void write_byte(uint8_t b);
     void write_int(int32_t n);
@@ -73,6 +99,7 @@ public:
     void write_consistency(db::consistency_level c);
     void write_string_map(std::map<sstring, sstring> string_map);
     void write_string_multimap(std::multimap<sstring, sstring> string_map);
+    void write_bytes_map(const std::map<sstring, bytes>& bytes_map);
     void write_value(bytes_opt value);
     void write_value(std::optional<query::result_bytes_view> value);
     void write(const cql3::metadata& m, bool skip = false);
@@ -86,12 +113,43 @@ public:
         return _opcode;
     }
     size_t size() const {
-        return _body.size();
+        return _body.size() + _externals_size;
     }
 private:
+    // Walks the logical body - the _body fragments interleaved with the
+    // external fragments sitting at their recorded offsets - in order,
+    // calling emit(data, size) for each piece.
+    template <typename Emit>
+    requires std::is_invocable_v<Emit, const char*, size_t>
+    void visit_body_fragments(Emit&& emit) const {
+        auto ext = _externals.begin();
+        size_t body_pos = 0;
+        auto emit_externals_at = [&] (size_t pos) {
+            while (ext != _externals.end() && ext->body_offset == pos) {
+                emit(ext->data, ext->size);
+                ++ext;
+            }
+        };
+        for (auto&& fragment : _body.fragments()) {
+            auto p = reinterpret_cast<const char*>(fragment.data());
+            size_t len = fragment.size();
+            while (len) {
+                emit_externals_at(body_pos);
+                size_t n = len;
+                if (ext != _externals.end()) {
+                    n = std::min(n, ext->body_offset - body_pos);
+                }
+                emit(p, n);
+                p += n;
+                len -= n;
+                body_pos += n;
+            }
+        }
+        emit_externals_at(body_pos);
+    }
     void compress(cql_compression compression);
-    void compress_lz4();
-    void compress_snappy();
+    void compress_lz4(bytes_view input);
+    void compress_snappy(bytes_view input);
 
     template <typename CqlFrameHeaderType>
     sstring make_frame_one(uint8_t version, size_t length) {
@@ -28,6 +28,7 @@
 #include "db/write_type.hh"
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future-util.hh>
+#include <seastar/core/reactor.hh>
 #include <seastar/core/seastar.hh>
 #include "utils/UUID.hh"
 #include <seastar/net/byteorder.hh>
@@ -61,6 +62,7 @@
 #include "transport/cql_protocol_extension.hh"
 #include "utils/bit_cast.hh"
 #include "db/config.hh"
+#include "replica/database.hh"
 
 template<typename T = void>
 using coordinator_result = exceptions::coordinator_result<T>;
@@ -153,6 +155,8 @@ cql_server::cql_server(distributed<cql3::query_processor>& qp, auth::service& au
     , _config(config)
     , _max_request_size(config.max_request_size)
     , _max_concurrent_requests(db_cfg.max_concurrent_requests_per_shard)
+    , _max_queued_requests(db_cfg.max_queued_requests_per_shard)
+    , _shed_queued_requests_reactor_utilization(db_cfg.shed_queued_requests_reactor_utilization)
     , _memory_available(ml.get_semaphore())
     , _notifier(std::make_unique<event_notifier>(*this))
     , _auth_service(auth_service)
@@ -577,8 +581,75 @@ void cql_server::connection::handle_error(future<>&& f) {
     }
 }
 
+// The fraction of wall-clock time the reactor spent busy, averaged over
+// roughly the last sampling interval. Sampled lazily and cached so that
+// querying it once per frame costs a clock read.
+static double sampled_reactor_utilization() {
+    using namespace std::chrono;
+    constexpr auto sampling_interval = 100ms;
+    static thread_local steady_clock::time_point last_sampled;
+    static thread_local nanoseconds last_busy_time{};
+    static thread_local double utilization = 0;
+
+    const auto now = steady_clock::now();
+    const auto elapsed = now - last_sampled;
+    if (elapsed >= sampling_interval) {
+        const auto busy_time = engine().total_busy_time();
+        if (last_sampled.time_since_epoch().count()) {
+            utilization = duration<double>(busy_time - last_busy_time) / duration<double>(elapsed);
+        }
+        last_sampled = now;
+        last_busy_time = busy_time;
+    }
+    return utilization;
+}
+
+// Proactive front-door shedding. A request arriving while others are already
+// queued for the shard's request memory joins the back of that queue; if the
+// queue is deep or the reactor is saturated on top of it, the request will
+// almost certainly exhaust its timeout after still consuming parse, auth and
+// execution work. Rejecting it right after the frame header - before its
+// body is even read - spends the overloaded shard's cycles on requests that
+// can still make their deadline. Both thresholds are live-updateable and
+// disabled by default; reactive shedding via _shed_incoming_requests kicks
+// in regardless once memory waits actually time out.
+bool cql_server::connection::should_shed_at_front_door() const {
+    const size_t queued = _server._memory_available.waiters();
+    if (!queued) {
+        return false;
+    }
+    if (queued >= _server._max_queued_requests) {
+        return true;
+    }
+    const double utilization_threshold = _server._shed_queued_requests_reactor_utilization;
+    return utilization_threshold > 0 && sampled_reactor_utilization() >= utilization_threshold;
+}
+
 future<> cql_server::connection::process_request() {
-    return read_frame().then_wrapped([this] (future<std::optional<cql_binary_frame_v3>>&& v) {
+    if (_connection_setup_pending) [[unlikely]] {
+        _connection_setup_pending = false;
+        const auto& sg = _server._config.connection_setup_scheduling_group;
+        if (sg && *sg != current_scheduling_group()) {
+            // For TLS sockets the handshake is driven lazily by the first
+            // read, so running the first request cycle in the dedicated
+            // group makes reconnect storms of full handshakes compete with
+            // each other for its shares instead of with statement execution
+            // on established connections. Subsequent cycles run in the
+            // server's usual group, as the do_until() loop in process()
+            // resumes there.
+            return with_scheduling_group(*sg, [this] {
+                return process_request();
+            });
+        }
+    }
+    auto frame = read_frame();
+    if (!frame.available()) {
+        // The next frame is not buffered yet, so the pipelined burst (if
+        // any) is over. Return the spare memory units to the semaphore
+        // rather than holding them across an idle period.
+        _spare_mem_units.return_all();
+    }
+    return frame.then_wrapped([this] (future<std::optional<cql_binary_frame_v3>>&& v) {
         auto maybe_frame = v.get0();
         if (!maybe_frame) {
             // eof
@@ -588,7 +659,7 @@ future<> cql_server::connection::process_request() {
         auto& f = *maybe_frame;
 
         const bool allow_shedding = _client_state.get_workload_type() == service::client_state::workload_type::interactive;
-        if (allow_shedding && _shed_incoming_requests) {
+        if (allow_shedding && (_shed_incoming_requests || should_shed_at_front_door())) {
             ++_server._stats.requests_shed;
             return _read_buf.skip(f.length).then([this, stream = f.stream] {
                 write_response(make_error(stream, exceptions::exception_code::OVERLOADED,
@@ -628,8 +699,24 @@ future<> cql_server::connection::process_request() {
             });
         }
 
+        // Frames of a pipelined burst share one semaphore admission: when
+        // the memory semaphore is uncontended, acquire enough units for
+        // several frames up front and carve the following frames' permits
+        // out of the spare units locally. The spare units are returned as
+        // soon as the connection stops having a complete frame buffered.
+        constexpr size_t mem_batch_frames = 8;
+        if (_spare_mem_units.count() < mem_estimate
+                && !_server._memory_available.waiters()
+                && _server._memory_available.current() >= mem_estimate * mem_batch_frames) {
+            _spare_mem_units.return_all();
+            if (auto units = try_get_units(_server._memory_available, mem_estimate * mem_batch_frames)) {
+                _spare_mem_units = std::move(*units);
+            }
+        }
         const auto shedding_timeout = std::chrono::milliseconds(50);
-        auto fut = allow_shedding
+        auto fut = _spare_mem_units.count() >= mem_estimate
+                ? make_ready_future<semaphore_units<>>(_spare_mem_units.split(mem_estimate))
+                : allow_shedding
                 ? get_units(_server._memory_available, mem_estimate, shedding_timeout).then_wrapped([this, length = f.length] (auto f) {
                     try {
                         return make_ready_future<semaphore_units<>>(f.get0());
@@ -704,8 +791,11 @@ future<> cql_server::connection::process_request() {
 
 namespace compression_buffers {
 
-// Reusable buffers for compression and decompression. Cleared every
-// clear_buffers_trigger uses.
+// Reusable buffers for compression and decompression. Periodically shrunk
+// to the size the last clear_buffers_trigger uses actually needed, so a
+// shard which once saw an unusually large frame doesn't hold on to a
+// buffer of that size forever, while a shard in steady state keeps its
+// buffers and generates no allocator traffic for framing at all.
 static constexpr size_t clear_buffers_trigger = 100'000;
 static thread_local size_t buffer_use_count = 0;
 static thread_local utils::reusable_buffer input_buffer;
@@ -713,8 +803,8 @@ static thread_local utils::reusable_buffer output_buffer;
 
 void on_compression_buffer_use() {
     if (++buffer_use_count == clear_buffers_trigger) {
-        input_buffer.clear();
-        output_buffer.clear();
+        input_buffer.shrink_to_watermark();
+        output_buffer.shrink_to_watermark();
         buffer_use_count = 0;
     }
 }
@@ -852,7 +942,32 @@ cql_server::connection::init_cql_serialization_format() {
 
 std::unique_ptr<cql_server::response>
 make_result(int16_t stream, messages::result_message& msg, const tracing::trace_state_ptr& tr_state,
-        cql_protocol_version_type version, bool skip_metadata = false);
+        cql_protocol_version_type version, bool skip_metadata = false, std::any pin = {},
+        std::optional<bytes> shard_load_hint = {});
+
+// Builds the value of the SCYLLA_SHARD_LOAD custom-payload entry piggybacked
+// on RESULT messages when the SCYLLA_SHARD_LOAD_HINT protocol extension is
+// negotiated, describing the load of the shard that served the request so
+// that shard-aware drivers can bias replica/shard selection away from hot
+// shards. Returns a disengaged optional if the extension wasn't negotiated
+// or the protocol version has no custom payload support.
+static std::optional<bytes> make_shard_load_hint(cql3::query_processor& qp, const service::client_state& client_state, cql_protocol_version_type version) {
+    if (version < 4 || !client_state.is_protocol_extension_set(cql_protocol_extension::SHARD_LOAD_HINT)) {
+        return std::nullopt;
+    }
+    auto& semaphore = qp.db().real_database().get_reader_concurrency_semaphore();
+    const auto initial = semaphore.initial_resources();
+    const auto available = semaphore.available_resources();
+    // Memory is the resource that reads actually block on, so report its
+    // occupancy; the count dimension saturates much earlier than the shard.
+    const int32_t memory_permille = initial.memory ? std::clamp<int64_t>((initial.memory - available.memory) * 1000 / initial.memory, 0, 1000) : 0;
+    const int32_t queued_reads = semaphore.waiters();
+    bytes b(bytes::initialized_later(), 2 * sizeof(int32_t));
+    auto out = b.begin();
+    write_be<int32_t>(reinterpret_cast<char*>(&*out), memory_permille);
+    write_be<int32_t>(reinterpret_cast<char*>(&*out) + sizeof(int32_t), queued_reads);
+    return b;
+}
 
 template<typename Process>
 future<cql_server::result_with_foreign_response_ptr>
@@ -929,14 +1044,15 @@ process_query_internal(service::client_state& client_state, distributed<cql3::qu
         tracing::begin(trace_state, "Execute CQL3 query", client_state.get_client_address());
     }
 
-    return qp.local().execute_direct_without_checking_exception_message(query, query_state, options).then([q_state = std::move(q_state), stream, skip_metadata, version] (auto msg) {
+    return qp.local().execute_direct_without_checking_exception_message(query, query_state, options).then([&qp, q_state = std::move(q_state), stream, skip_metadata, version] (auto msg) {
         if (msg->move_to_shard()) {
             return process_fn_return_type(dynamic_pointer_cast<messages::result_message::bounce_to_shard>(msg));
         } else if (msg->is_exception()) {
             return process_fn_return_type(convert_error_message_to_coordinator_result(msg.get()));
         } else {
             tracing::trace(q_state->query_state.get_trace_state(), "Done processing - preparing a result");
-            return process_fn_return_type(make_foreign(make_result(stream, *msg, q_state->query_state.get_trace_state(), version, skip_metadata)));
+            auto load_hint = make_shard_load_hint(qp.local(), q_state->query_state.get_client_state(), version);
+            return process_fn_return_type(make_foreign(make_result(stream, *msg, q_state->query_state.get_trace_state(), version, skip_metadata, msg, std::move(load_hint))));
         }
     });
 }
@@ -978,9 +1094,11 @@ future<std::unique_ptr<cql_server::response>> cql_server::connection::process_pr
 }
 
 static future<process_fn_return_type>
-process_execute_internal(service::client_state& client_state, distributed<cql3::query_processor>& qp, request_reader in,
+do_process_execute_internal(service::client_state& client_state, distributed<cql3::query_processor>& qp, request_reader in,
         uint16_t stream, cql_protocol_version_type version, cql_serialization_format serialization_format,
-        service_permit permit, tracing::trace_state_ptr trace_state, bool init_trace, cql3::computed_function_values cached_pk_fn_calls) {
+        service_permit permit, tracing::trace_state_ptr trace_state, bool init_trace, cql3::computed_function_values cached_pk_fn_calls,
+        bool allow_recover_prepared) {
+    auto saved_in = in;
     cql3::prepared_cache_key_type cache_key(in.read_short_bytes());
     auto& id = cql3::prepared_cache_key_type::cql_id(cache_key);
     bool needs_authorization = false;
@@ -994,6 +1112,20 @@ process_execute_internal(service::client_state& client_state, distributed<cql3::
     }
 
     if (!prepared) {
+        if (allow_recover_prepared) {
+            // The statement may have been prepared on another node and replicated
+            // via system_distributed.prepared_statements (e.g. the client was
+            // moved here by a load balancer). Try to recover it and retry the
+            // lookup once; if recovery fails, the retry throws the usual
+            // not-found exception and the client re-prepares.
+            return qp.local().recover_prepared_statement(cache_key, client_state).then(
+                    [&client_state, &qp, in = std::move(saved_in), stream, version, serialization_format,
+                            permit = std::move(permit), trace_state = std::move(trace_state), init_trace,
+                            cached_pk_fn_calls = std::move(cached_pk_fn_calls)] (bool) mutable {
+                return do_process_execute_internal(client_state, qp, std::move(in), stream, version, serialization_format,
+                        std::move(permit), std::move(trace_state), init_trace, std::move(cached_pk_fn_calls), false);
+            });
+        }
         throw exceptions::prepared_query_not_found_exception(id);
     }
 
@@ -1043,18 +1175,27 @@ process_execute_internal(service::client_state& client_state, distributed<cql3::
 
     tracing::trace(trace_state, "Processing a statement");
     return qp.local().execute_prepared_without_checking_exception_message(std::move(prepared), std::move(cache_key), query_state, options, needs_authorization)
-            .then([trace_state = query_state.get_trace_state(), skip_metadata, q_state = std::move(q_state), stream, version] (auto msg) {
+            .then([&qp, trace_state = query_state.get_trace_state(), skip_metadata, q_state = std::move(q_state), stream, version] (auto msg) {
         if (msg->move_to_shard()) {
             return process_fn_return_type(dynamic_pointer_cast<messages::result_message::bounce_to_shard>(msg));
         } else if (msg->is_exception()) {
             return process_fn_return_type(convert_error_message_to_coordinator_result(msg.get()));
         } else {
             tracing::trace(q_state->query_state.get_trace_state(), "Done processing - preparing a result");
-            return process_fn_return_type(make_foreign(make_result(stream, *msg, q_state->query_state.get_trace_state(), version, skip_metadata)));
+            auto load_hint = make_shard_load_hint(qp.local(), q_state->query_state.get_client_state(), version);
+            return process_fn_return_type(make_foreign(make_result(stream, *msg, q_state->query_state.get_trace_state(), version, skip_metadata, msg, std::move(load_hint))));
         }
     });
 }
 
+static future<process_fn_return_type>
+process_execute_internal(service::client_state& client_state, distributed<cql3::query_processor>& qp, request_reader in,
+        uint16_t stream, cql_protocol_version_type version, cql_serialization_format serialization_format,
+        service_permit permit, tracing::trace_state_ptr trace_state, bool init_trace, cql3::computed_function_values cached_pk_fn_calls) {
+    return do_process_execute_internal(client_state, qp, std::move(in), stream, version, serialization_format,
+            std::move(permit), std::move(trace_state), init_trace, std::move(cached_pk_fn_calls), true);
+}
+
 future<cql_server::result_with_foreign_response_ptr> cql_server::connection::process_execute(uint16_t stream, request_reader in,
         service::client_state& client_state, service_permit permit, tracing::trace_state_ptr trace_state) {
     ++_server._stats.execute_requests;
@@ -1168,14 +1309,15 @@ process_batch_internal(service::client_state& client_state, distributed<cql3::qu
 
     auto batch = ::make_shared<cql3::statements::batch_statement>(cql3::statements::batch_statement::type(type), std::move(modifications), cql3::attributes::none(), qp.local().get_cql_stats());
     return qp.local().execute_batch_without_checking_exception_message(batch, query_state, options, std::move(pending_authorization_entries))
-            .then([stream, batch, q_state = std::move(q_state), trace_state = query_state.get_trace_state(), version] (auto msg) {
+            .then([&qp, stream, batch, q_state = std::move(q_state), trace_state = query_state.get_trace_state(), version] (auto msg) {
         if (msg->move_to_shard()) {
             return process_fn_return_type(dynamic_pointer_cast<messages::result_message::bounce_to_shard>(msg));
         } else if (msg->is_exception()) {
             return process_fn_return_type(convert_error_message_to_coordinator_result(msg.get()));
         } else {
             tracing::trace(q_state->query_state.get_trace_state(), "Done processing - preparing a result");
-            return process_fn_return_type(make_foreign(make_result(stream, *msg, trace_state, version)));
+            auto load_hint = make_shard_load_hint(qp.local(), q_state->query_state.get_client_state(), version);
+            return process_fn_return_type(make_foreign(make_result(stream, *msg, trace_state, version, false, msg, std::move(load_hint))));
         }
     });
 }
@@ -1454,12 +1596,22 @@ public:
 
 std::unique_ptr<cql_server::response>
 make_result(int16_t stream, messages::result_message& msg, const tracing::trace_state_ptr& tr_state,
-        cql_protocol_version_type version, bool skip_metadata) {
+        cql_protocol_version_type version, bool skip_metadata, std::any pin,
+        std::optional<bytes> shard_load_hint) {
     auto response = std::make_unique<cql_server::response>(stream, cql_binary_opcode::RESULT, tr_state);
+    if (pin.has_value()) {
+        // Lets the response reference large result values instead of
+        // copying them into its body, see response::pin().
+        response->pin(std::move(pin));
+    }
     if (__builtin_expect(!msg.warnings().empty() && version > 3, false)) {
         response->set_frame_flag(cql_frame_flags::warning);
         response->write_string_list(msg.warnings());
     }
+    if (shard_load_hint) {
+        response->set_frame_flag(cql_frame_flags::custom_payload);
+        response->write_bytes_map({{"SCYLLA_SHARD_LOAD", std::move(*shard_load_hint)}});
+    }
     cql_server::fmt_visitor fmt{version, *response, skip_metadata};
     msg.accept(fmt);
     return response;
@@ -1510,33 +1662,47 @@ scattered_message<char> cql_server::response::make_message(uint8_t version, cql_
         compress(compression);
     }
     scattered_message<char> msg;
-    auto frame = make_frame(version, _body.size());
+    auto frame = make_frame(version, size());
     msg.append(std::move(frame));
-    for (auto&& fragment : _body.fragments()) {
-        msg.append_static(reinterpret_cast<const char*>(fragment.data()), fragment.size());
-    }
+    visit_body_fragments([&msg] (const char* data, size_t size) {
+        msg.append_static(data, size);
+    });
     return msg;
 }
 
 void cql_server::response::compress(cql_compression compression)
 {
+    using namespace compression_buffers;
+    // The single-block format of compressed CQL frames requires contiguous
+    // input, so one gathering copy is unavoidable here. Feed the logical
+    // body straight into the compression input buffer instead of first
+    // folding the external fragments into _body with an extra copy.
+    auto input = _externals.empty() ? input_buffer.get_linearized_view(_body)
+            : input_buffer.get_linearized_view(size(), [this] (bytes_mutable_view out) {
+        auto dst = out.begin();
+        visit_body_fragments([&dst] (const char* data, size_t size) {
+            dst = std::copy_n(reinterpret_cast<const int8_t*>(data), size, dst);
+        });
+    });
     switch (compression) {
     case cql_compression::lz4:
-        compress_lz4();
+        compress_lz4(input);
         break;
     case cql_compression::snappy:
-        compress_snappy();
+        compress_snappy(input);
         break;
     default:
         throw std::invalid_argument("Invalid CQL compression algorithm");
     }
+    // the external fragments are now part of the compressed body
+    _externals.clear();
+    _externals_size = 0;
     set_frame_flag(cql_frame_flags::compression);
 }
 
-void cql_server::response::compress_lz4()
+void cql_server::response::compress_lz4(bytes_view view)
 {
     using namespace compression_buffers;
-    auto view = input_buffer.get_linearized_view(_body);
     const char* input = reinterpret_cast<const char*>(view.data());
     size_t input_len = view.size();
 
@@ -1560,10 +1726,9 @@ void cql_server::response::compress_lz4()
     on_compression_buffer_use();
 }
 
-void cql_server::response::compress_snappy()
+void cql_server::response::compress_snappy(bytes_view view)
 {
     using namespace compression_buffers;
-    auto view = input_buffer.get_linearized_view(_body);
     const char* input = reinterpret_cast<const char*>(view.data());
     size_t input_len = view.size();
 
@@ -1725,6 +1890,15 @@ void cql_server::response::write_string_map(std::map<sstring, sstring> string_ma
     }
 }
 
+void cql_server::response::write_bytes_map(const std::map<sstring, bytes>& bytes_map)
+{
+    write_short(cast_if_fits<uint16_t>(bytes_map.size()));
+    for (auto&& b : bytes_map) {
+        write_string(b.first);
+        write_bytes(b.second);
+    }
+}
+
 void cql_server::response::write_string_multimap(std::multimap<sstring, sstring> string_map)
 {
     std::vector<sstring> keys;
@@ -1763,6 +1937,15 @@ void cql_server::response::write_value(std::optional<query::result_bytes_view> v
 
     write_int(value->size_bytes());
     using boost::range::for_each;
+    if (_pinned.has_value() && value->size_bytes() >= external_value_threshold) {
+        // The value's storage outlives this response (see pin()), so keep
+        // references to its fragments instead of copying them into _body.
+        for_each(*value, [&] (bytes_view fragment) {
+            _externals.push_back(external_fragment{_body.size(), reinterpret_cast<const char*>(fragment.data()), fragment.size()});
+            _externals_size += fragment.size();
+        });
+        return;
+    }
     for_each(*value, [&] (bytes_view fragment) {
         _body.write(fragment);
     });
@@ -1908,23 +2091,36 @@ void cql_server::response::write(const cql3::metadata& m, bool no_metadata) {
         return;
     }
 
-    auto names_i = m.get_names().begin();
+    // The column specifications are constant for a given selection, so they
+    // are encoded once and the resulting blob is cached in the column_info
+    // shared by all metadata instances of that selection. Wide selections
+    // otherwise spend more time re-encoding metadata than copying row data.
+    auto& info = *m.get_column_info();
+    if (info._serialized_specs.empty() || info._serialized_specs_global_tables_spec != global_tables_spec) {
+        response specs(0, _opcode, tracing::trace_state_ptr());
 
-    if (global_tables_spec) {
-        auto first_spec = *names_i;
-        write_string(first_spec->ks_name);
-        write_string(first_spec->cf_name);
-    }
+        auto names_i = m.get_names().begin();
 
-    for (uint32_t i = 0; i < m.column_count(); ++i, ++names_i) {
-        lw_shared_ptr<cql3::column_specification> name = *names_i;
-        if (!global_tables_spec) {
-            write_string(name->ks_name);
-            write_string(name->cf_name);
+        if (global_tables_spec) {
+            auto first_spec = *names_i;
+            specs.write_string(first_spec->ks_name);
+            specs.write_string(first_spec->cf_name);
         }
-        write_string(name->name->text());
-        type_codec::encode(*this, name->type);
+
+        for (uint32_t i = 0; i < m.column_count(); ++i, ++names_i) {
+            lw_shared_ptr<cql3::column_specification> name = *names_i;
+            if (!global_tables_spec) {
+                specs.write_string(name->ks_name);
+                specs.write_string(name->cf_name);
+            }
+            specs.write_string(name->name->text());
+            type_codec::encode(specs, name->type);
+        }
+
+        info._serialized_specs = bytes(specs._body.linearize());
+        info._serialized_specs_global_tables_spec = global_tables_spec;
     }
+    _body.write(info._serialized_specs);
 }
 
 void cql_server::response::write(const cql3::prepared_metadata& m, uint8_t version)
@@ -15,7 +15,9 @@
 #include "auth/authenticator.hh"
 #include <seastar/core/distributed.hh>
 #include "timeout_config.hh"
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/semaphore.hh>
+#include <any>
 #include <memory>
 #include <boost/intrusive/list.hpp>
 #include <seastar/net/tls.hh>
@@ -72,9 +74,10 @@ enum class cql_compression {
 };
 
 enum cql_frame_flags {
-    compression = 0x01,
-    tracing     = 0x02,
-    warning     = 0x08,
+    compression    = 0x01,
+    tracing        = 0x02,
+    custom_payload = 0x04, // protocol v4 and above
+    warning        = 0x08,
 };
 
 struct [[gnu::packed]] cql_binary_frame_v1 {
@@ -121,6 +124,11 @@ struct cql_server_config {
     std::optional<uint16_t> shard_aware_transport_port_ssl;
     bool allow_shard_aware_drivers = true;
     smp_service_group bounce_request_smp_service_group = default_smp_service_group();
+    // When engaged, the first request cycle of every connection - which for
+    // TLS sockets drives the handshake - runs in this scheduling group
+    // instead of the statement group, so reconnect storms don't starve
+    // statement execution. See native_transport_connection_setup_shares.
+    std::optional<seastar::scheduling_group> connection_setup_scheduling_group;
 };
 
 class cql_server : public seastar::peering_sharded_service<cql_server>, public generic_server::server {
@@ -155,6 +163,8 @@ private:
     cql_server_config _config;
     size_t _max_request_size;
     utils::updateable_value<uint32_t> _max_concurrent_requests;
+    utils::updateable_value<uint32_t> _max_queued_requests;
+    utils::updateable_value<double> _shed_queued_requests_reactor_utilization;
     semaphore& _memory_available;
     seastar::metrics::metric_groups _metrics;
     std::unique_ptr<event_notifier> _notifier;
@@ -181,7 +191,8 @@ private:
     class fmt_visitor;
     friend class connection;
     friend std::unique_ptr<cql_server::response> make_result(int16_t stream, messages::result_message& msg,
-            const tracing::trace_state_ptr& tr_state, cql_protocol_version_type version, bool skip_metadata);
+            const tracing::trace_state_ptr& tr_state, cql_protocol_version_type version, bool skip_metadata, std::any pin,
+            std::optional<bytes> shard_load_hint);
 
     class connection : public generic_server::connection {
         cql_server& _server;
@@ -193,9 +204,18 @@ private:
         service::client_state _client_state;
         timer<lowres_clock> _shedding_timer;
         bool _shed_incoming_requests = false;
+        // Memory units acquired ahead of need for a pipelined burst of
+        // requests, so that the frames of one burst share a single
+        // semaphore admission instead of going to the semaphore one by
+        // one. Returned to the semaphore when the connection goes idle.
+        semaphore_units<> _spare_mem_units;
         unsigned _request_cpu = 0;
         bool _ready = false;
         bool _authenticating = false;
+        // Cleared after the first request cycle, which covers connection
+        // setup (including the TLS handshake, driven by the first read) and
+        // may be diverted to a dedicated scheduling group.
+        bool _connection_setup_pending = true;
 
         enum class tracing_request_type : uint8_t {
             not_requested,
@@ -228,6 +248,7 @@ private:
         future<foreign_ptr<std::unique_ptr<cql_server::response>>> process_request_one(fragmented_temporary_buffer::istream buf, uint8_t op, uint16_t stream, service::client_state& client_state, tracing_request_type tracing_request, service_permit permit);
         unsigned frame_size() const;
         unsigned pick_request_cpu();
+        bool should_shed_at_front_door() const;
         cql_binary_frame_v3 parse_frame(temporary_buffer<char> buf) const;
         future<fragmented_temporary_buffer> read_and_decompress_frame(size_t length, uint8_t flags);
         future<std::optional<cql_binary_frame_v3>> read_frame();
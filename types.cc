@@ -874,6 +874,31 @@ struct is_byte_order_equal_visitor {
 
 bool abstract_type::is_byte_order_equal() const { return visit(*this, is_byte_order_equal_visitor{}); }
 
+namespace {
+struct byte_order_comparable_layout_visitor {
+    using layout = abstract_type::byte_order_comparable_layout;
+    template <typename T> std::optional<layout> operator()(const integer_type_impl<T>&) { return layout{sizeof(T), true, false}; }
+    std::optional<layout> operator()(const boolean_type_impl&) { return layout{1, false, false}; }
+    std::optional<layout> operator()(const timestamp_type_impl&) { return layout{8, true, false}; }
+    std::optional<layout> operator()(const time_type_impl&) { return layout{8, true, false}; }
+    std::optional<layout> operator()(const simple_date_type_impl&) { return layout{4, false, false}; }
+    // The legacy date type compares its serialized form unsigned.
+    std::optional<layout> operator()(const date_type_impl&) { return layout{8, false, false}; }
+    std::optional<layout> operator()(const reversed_type_impl& t) {
+        auto l = t.underlying_type()->byte_order_comparable_fixed_layout();
+        if (l) {
+            l->reversed = !l->reversed;
+        }
+        return l;
+    }
+    std::optional<layout> operator()(const abstract_type&) { return std::nullopt; }
+};
+}
+
+std::optional<abstract_type::byte_order_comparable_layout> abstract_type::byte_order_comparable_fixed_layout() const {
+    return visit(*this, byte_order_comparable_layout_visitor{});
+}
+
 static bool
 check_compatibility(const tuple_type_impl &t, const abstract_type& previous, bool (abstract_type::*predicate)(const abstract_type&) const);
 
@@ -1128,6 +1153,29 @@ map_type_impl::compare_maps(data_type keys, data_type values, managed_bytes_view
     return size1 <=> size2;
 }
 
+std::optional<managed_bytes_view>
+map_type_impl::find_value(managed_bytes_view in, managed_bytes_view key, cql_serialization_format sf) const {
+    if (in.empty()) {
+        return std::nullopt;
+    }
+    auto size = read_collection_size(in, sf);
+    std::vector<std::pair<managed_bytes_view, managed_bytes_view>> entries;
+    entries.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        auto k = read_collection_value(in, sf);
+        auto v = read_collection_value(in, sf);
+        entries.emplace_back(k, v);
+    }
+    auto it = std::lower_bound(entries.begin(), entries.end(), key,
+            [this] (const std::pair<managed_bytes_view, managed_bytes_view>& entry, const managed_bytes_view& k) {
+        return _keys->compare(entry.first, k) < 0;
+    });
+    if (it != entries.end() && _keys->compare(it->first, key) == 0) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
 static size_t map_serialized_size(const map_type_impl::native_type* m) {
     size_t len = collection_size_len(cql_serialization_format::internal());
     size_t psz = collection_value_len(cql_serialization_format::internal());
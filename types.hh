@@ -562,6 +562,26 @@ public:
      * When returns false, nothing can be inferred.
      */
     bool is_byte_order_equal() const;
+
+    /**
+     * Describes the serialized form of types whose values can be compared
+     * with a plain byte comparison. Engaged only for fixed-width types for
+     * which compare() over the serialized form reduces to an unsigned
+     * lexicographical comparison after the sign bit of the first byte is
+     * flipped when flip_sign is set (big-endian two's complement integers)
+     * and the result is inverted when reversed is set (reversed types).
+     *
+     * Note that empty (zero-length) values are still valid for these types
+     * and sort before all proper values, so users must check the serialized
+     * length against value_length before taking the byte-comparison path.
+     */
+    struct byte_order_comparable_layout {
+        uint32_t value_length;
+        bool flip_sign;
+        bool reversed;
+    };
+    std::optional<byte_order_comparable_layout> byte_order_comparable_fixed_layout() const;
+
     sstring get_string(const bytes& b) const;
     sstring to_string(bytes_view bv) const {
         return to_string_impl(deserialize(bv));
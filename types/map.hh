@@ -41,6 +41,14 @@ public:
     virtual bool is_value_compatible_with_frozen(const collection_type_impl& previous) const override;
     static std::strong_ordering compare_maps(data_type keys_comparator, data_type values_comparator,
                         managed_bytes_view o1, managed_bytes_view o2);
+    // Looks up the value stored under the given key in a serialized map,
+    // without deserializing the whole map. Entries of a serialized map are
+    // ordered by key, so after one pass over the length prefixes to build an
+    // entry table the key is binary-searched, costing O(log n) key
+    // comparisons instead of deserializing n entries.
+    // The returned view points into the input buffer. Disengaged if the key
+    // is absent.
+    std::optional<managed_bytes_view> find_value(managed_bytes_view serialized_map, managed_bytes_view key, cql_serialization_format sf) const;
     using abstract_type::deserialize;
     using collection_type_impl::deserialize;
     template <FragmentedView View> data_value deserialize(View v, cql_serialization_format sf) const;
@@ -124,6 +124,31 @@ namespace bloom_calculations {
         return std::min(probs.size() - 1, size_t(v));
     }
 
+    /**
+     * Scales a table's configured false positive chance for an sstable
+     * written to the given leveled compaction strategy level.
+     *
+     * With LCS every read probes the filters of all L0 sstables and of at
+     * most one sstable per deeper level, while each deeper level holds
+     * roughly ten times the data of the previous one. Sizing all filters
+     * for the same fp chance therefore spends almost all filter memory on
+     * the deepest levels, which contribute at most one probe per read.
+     * Doubling the allowed fp chance per level past L1 reclaims most of
+     * that memory while the total false positive rate of a read grows by
+     * a small constant factor.
+     *
+     * Levels 0 and 1 keep the configured chance; the loosened chance is
+     * capped so deep levels still retain a useful filter.
+     */
+    inline double fp_chance_for_level(double fp_chance, int level) {
+        constexpr double max_loosened_fp_chance = 0.1;
+        if (level <= 1 || fp_chance >= max_loosened_fp_chance) {
+            return fp_chance;
+        }
+        auto loosened = fp_chance * double(1 << std::min(level - 1, 10));
+        return std::min(loosened, max_loosened_fp_chance);
+    }
+
     /**
      * Retrieves the minimum supported bloom_filter_fp_chance value
      * if compute_bloom_spec() above is attempted with bloom_filter_fp_chance
@@ -16,6 +16,7 @@
 #include <seastar/core/align.hh>
 #include <seastar/core/loop.hh>
 #include "utils/large_bitset.hh"
+#include "utils/small_vector.hh"
 #include <array>
 #include <cstdlib>
 #include "bloom_filter.hh"
@@ -51,15 +52,28 @@ bloom_filter::~bloom_filter() noexcept {
 }
 
 bool bloom_filter::is_present(hashed_key key) {
-    bool result = true;
-    for_each_index(key, _hash_count, _bitset.size(), _format, [this, &result] (auto i) {
+    // Compute all probe positions up front and prefetch the backing words,
+    // so the (usually cache-cold) bitmap reads overlap instead of costing
+    // one serialized miss per hash function.
+    utils::small_vector<size_t, 8> indexes;
+    for_each_index(key, _hash_count, _bitset.size(), _format, [this, &indexes] (auto i) {
+        _bitset.prefetch(i);
+        indexes.push_back(i);
+        return stop_iteration::no;
+    });
+    for (auto i : indexes) {
         if (!_bitset.test(i)) {
-            result = false;
-            return stop_iteration::yes;
+            return false;
         }
+    }
+    return true;
+}
+
+void bloom_filter::prefetch(hashed_key key) {
+    for_each_index(key, _hash_count, _bitset.size(), _format, [this] (auto i) {
+        _bitset.prefetch(i);
         return stop_iteration::no;
     });
-    return result;
 }
 
 void bloom_filter::add(const bytes_view& key) {
@@ -81,6 +81,8 @@ private:
             if (_use_count++ == 0) {
                 if (is_linked()) {
                     parent->_lru.remove(*this);
+                    // Reuse of an idle page; have the re-add promote it.
+                    lru::mark_hot(*this);
                 }
             }
             return std::unique_ptr<cached_page, cached_page_del>(this);
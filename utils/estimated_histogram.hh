@@ -374,6 +374,16 @@ struct estimated_histogram {
     // buckets is one element longer than bucketOffsets -- the last element is values greater than the last offset
     std::vector<int64_t> buckets;
 
+private:
+    // _octave_start[k] is the index of the first bucket offset that is >= 2^k.
+    // Since the offsets grow by a factor of 1.2, each power-of-2 range holds
+    // at most ceil(log1.2(2)) = 4 of them, so find_bucket_index() can jump to
+    // the right octave in O(1) and finish with a scan of a handful of entries
+    // instead of binary-searching the whole offset array on every sample.
+    std::vector<uint16_t> _octave_start;
+
+public:
+
     int64_t _count = 0;
     int64_t _sample_sum = 0;
 
@@ -417,6 +427,7 @@ private:
     void new_offsets(int size) {
         bucket_offsets.resize(size);
         if (size == 0) {
+            _octave_start.clear();
             return;
         }
         int64_t last = 1;
@@ -429,6 +440,33 @@ private:
             bucket_offsets[i] = next;
             last = next;
         }
+        _octave_start.assign(log2floor(uint64_t(last)) + 1, 0);
+        size_t pos = 0;
+        for (size_t k = 0; k < _octave_start.size(); k++) {
+            while (pos < bucket_offsets.size() && bucket_offsets[pos] < (int64_t(1) << k)) {
+                pos++;
+            }
+            _octave_start[k] = pos;
+        }
+    }
+
+    /**
+     * Equivalent to std::lower_bound() over bucket_offsets, i.e. returns the
+     * index of the first offset that is >= n, or bucket_offsets.size() (the
+     * overflow bucket) when there is none.
+     */
+    size_t find_bucket_index(int64_t n) const {
+        if (bucket_offsets.empty() || n <= bucket_offsets.front()) {
+            return 0;
+        }
+        if (n > bucket_offsets.back()) {
+            return bucket_offsets.size();
+        }
+        size_t pos = _octave_start[log2floor(uint64_t(n))];
+        while (bucket_offsets[pos] < n) {
+            pos++;
+        }
+        return pos;
     }
 public:
     /**
@@ -455,12 +493,7 @@ public:
      * @param n
      */
     void add(int64_t n) {
-        auto pos = bucket_offsets.size();
-        auto low = std::lower_bound(bucket_offsets.begin(), bucket_offsets.end(), n);
-        if (low != bucket_offsets.end()) {
-            pos = std::distance(bucket_offsets.begin(), low);
-        }
-        buckets.at(pos)++;
+        buckets.at(find_bucket_index(n))++;
         _count++;
         _sample_sum += n;
     }
@@ -477,12 +510,7 @@ public:
         if (new_count <= _count) {
             return;
         }
-        auto pos = bucket_offsets.size();
-        auto low = std::lower_bound(bucket_offsets.begin(), bucket_offsets.end(), n);
-        if (low != bucket_offsets.end()) {
-            pos = std::distance(bucket_offsets.begin(), low);
-        }
-        buckets.at(pos)+= new_count - _count;
+        buckets.at(find_bucket_index(n)) += new_count - _count;
         _sample_sum += n * (new_count - _count);
         _count = new_count;
     }
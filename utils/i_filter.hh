@@ -40,6 +40,10 @@ struct i_filter {
     virtual void add(const bytes_view& key) = 0;
     virtual bool is_present(const bytes_view& key) = 0;
     virtual bool is_present(hashed_key) = 0;
+    // Starts pulling the probe positions of the given key into cache, so a
+    // following is_present() call doesn't stall on memory. Lets callers that
+    // probe one key against many filters batch the misses across filters.
+    virtual void prefetch(hashed_key) {}
     virtual void clear() = 0;
     virtual void close() = 0;
 
@@ -38,6 +38,12 @@ public:
         return _storage.memory_size();
     }
 
+    // Brings the word backing the given bit into cache ahead of test().
+    // Useful for overlapping the memory latency of several independent
+    // probes, e.g. the k positions of a bloom filter lookup.
+    void prefetch(size_t idx) const {
+        __builtin_prefetch(&_storage[idx / bits_per_int()], 0, 3);
+    }
     bool test(size_t idx) const {
         auto idx1 = idx / bits_per_int();
         idx %= bits_per_int();
@@ -71,6 +71,8 @@ struct do_nothing_loading_cache_stats {
 /// read in a non-blocking way as long as it's frequently accessed. Note however that since reloading is an asynchronous
 /// procedure it may get delayed by other running task. Therefore choosing the "expiration" too close to the ("refresh" + "max load latency")
 /// value one risks to have his/her cache values evicted when the system is heavily loaded.
+/// As a safety net, an actively read entry whose value is about to expire is reloaded ahead of its expiry regardless of
+/// the "refresh" period, and is only evicted due to "aging" if that reload fails to complete in time.
 ///
 /// The cache is also limited in size and if adding the next value is going
 /// to exceed the cache size limit the least recently used value(s) is(are) going to be evicted until the size of the cache
@@ -298,6 +300,17 @@ public:
         return true;
     }
 
+    /// rief Sample the LRU maintenance on the hit path.
+    ///
+    /// Once an entry reaches the privileged section, its position in the LRU
+    /// list is refreshed at most once per given period instead of on every
+    /// hit. Appropriate for read-mostly caches whose hottest entries are hit
+    /// many times per period and whose expiry is much coarser than the period.
+    /// Zero (the default) updates recency on every hit.
+    void set_lru_touch_period(loading_cache_clock_type::duration d) noexcept {
+        _lru_touch_period = d;
+    }
+
     template <typename LoadFunc>
     requires std::is_invocable_r_v<future<value_type>, LoadFunc, const key_type&>
     future<value_ptr> get_ptr(const Key& k, LoadFunc&& load) {
@@ -485,6 +498,21 @@ private:
     ///
     /// \param lru_entry Cache item that has been "touched"
     void touch_lru_entry_2_sections(ts_value_lru_entry& lru_entry) {
+        // Sampled recency update: once an entry made it to the privileged
+        // section, refresh its position in the LRU at most once per
+        // _lru_touch_period. Hot entries can be hit hundreds of thousands
+        // of times per second and relinking them at the front of the list
+        // on every hit costs more than the recency information is worth
+        // when eviction decisions are much coarser.
+        if (_lru_touch_period != loading_cache_clock_type::duration{}
+                && lru_entry.is_linked()
+                && lru_entry.touch_count() > SectionHitThreshold) {
+            auto now = loading_cache_clock_type::now();
+            if (now - lru_entry.last_lru_touch() < _lru_touch_period) {
+                return;
+            }
+            lru_entry.set_last_lru_touch(now);
+        }
         if (lru_entry.is_linked()) {
             lru_list_type& lru_list = container_list(lru_entry);
             lru_list.erase(lru_list.iterator_to(lru_entry));
@@ -638,25 +666,33 @@ private:
             return;
         }
 
-        // Clean up items that were not touched for the whole expiry period.
-        drop_expired();
-
         // check if rehashing is needed and do it if it is.
         periodic_rehash();
 
         if constexpr (ReloadEnabled == loading_cache_reload_enabled::no) {
+            // Clean up items that were not touched for the whole expiry period.
+            drop_expired();
             _logger.trace("on_timer(): rearming");
             _timer.arm(loading_cache_clock_type::now() + _timer_period);
             return;
         }
 
-        // Reload all those which value needs to be reloaded.
+        // Reload all those which value needs to be reloaded, as well as those
+        // whose value would expire before the next timer tick. The latter gives
+        // a frequently read entry a chance to be refreshed ahead of its expiry
+        // instead of being dropped and synchronously reloaded by the unlucky
+        // request that comes right after - important when "refresh" is close to
+        // (or greater than) "expiry". Entries that nobody has read for the whole
+        // expiry period are not worth an extra load and are left to expire.
         // Future is waited on indirectly in `stop()` (via `_timer_reads_gate`).
         // FIXME: error handling
         (void)with_gate(_timer_reads_gate, [this] {
+            auto now = loading_cache_clock_type::now();
             auto to_reload = boost::copy_range<utils::chunked_vector<timestamped_val_ptr>>(boost::range::join(_unprivileged_lru_list, _lru_list)
-                    | boost::adaptors::filtered([this] (ts_value_lru_entry& lru_entry) {
-                        return lru_entry.timestamped_value().loaded() + _cfg.refresh < loading_cache_clock_type::now();
+                    | boost::adaptors::filtered([this, now] (ts_value_lru_entry& lru_entry) {
+                        const timestamped_val& v = lru_entry.timestamped_value();
+                        return now - v.last_read() <= _cfg.expiry &&
+                                (v.loaded() + _cfg.refresh < now || v.loaded() + _cfg.expiry < now + _timer_period);
                     })
                     | boost::adaptors::transformed([] (ts_value_lru_entry& lru_entry) {
                         return lru_entry.timestamped_value_ptr();
@@ -666,6 +702,14 @@ private:
                 _logger.trace("on_timer(): {}: reloading the value", loading_values_type::to_key(ts_value_ptr));
                 return this->reload(std::move(ts_value_ptr));
             }).finally([this] {
+                // Clean up items that were not touched for the whole expiry
+                // period and items whose values are older than the expiry
+                // period because the reloads above failed to refresh them.
+                // Doing this after the reload pass (rather than before it)
+                // ensures that an actively read entry is only dropped if its
+                // value genuinely cannot be reloaded, preserving the promise
+                // that a cached value never outlives the expiry period.
+                drop_expired();
                 _logger.trace("on_timer(): rearming");
 
                 // If the config was updated after on_timer and before this continuation finished
@@ -680,6 +724,7 @@ private:
     }
 
     loading_values_type _loading_values;
+    loading_cache_clock_type::duration _lru_touch_period{};
     lru_list_type _lru_list;              // list containing "privileged" section entries
     lru_list_type _unprivileged_lru_list; // list containing "unprivileged" section entries
     size_t _privileged_section_size = 0;
@@ -737,6 +782,7 @@ private:
     timestamped_val_ptr _ts_val_ptr;
     loading_cache& _parent;
     int _touch_count;
+    loading_cache_clock_type::time_point _last_lru_touch;
 
 public:
     lru_entry(timestamped_val_ptr ts_val, loading_cache& owner_cache)
@@ -759,6 +805,14 @@ public:
         return _touch_count;
     }
 
+    loading_cache_clock_type::time_point last_lru_touch() const noexcept {
+        return _last_lru_touch;
+    }
+
+    void set_last_lru_touch(loading_cache_clock_type::time_point tp) noexcept {
+        _last_lru_touch = tp;
+    }
+
     ~lru_entry() {
         if (safe_link_list_hook::is_linked()) {
             lru_list_type& lru_list = _parent.container_list(*this);
@@ -2628,8 +2628,9 @@ size_t tracker::impl::compact_and_evict_locked(size_t reserve_segments, size_t m
     //
     // Algorithm outline.
     //
-    // Regions are kept in a max-heap ordered so that regions with
-    // sparser segments are picked first. Non-compactible regions will be
+    // Regions are kept in a max-heap ordered so that regions with a lower
+    // reclaim priority are picked first and, within the same priority, regions
+    // with sparser segments come first. Non-compactible regions will be
     // picked last. In each iteration we try to release one whole segment from
     // the region which has the sparsest segment. We do it until we released
     // enough segments or there are no more regions we can compact.
@@ -2660,6 +2661,9 @@ size_t tracker::impl::compact_and_evict_locked(size_t reserve_segments, size_t m
         if (c1->is_compactible() != c2->is_compactible()) {
             return !c1->is_compactible();
         }
+        if (c1->get_reclaim_priority() != c2->get_reclaim_priority()) {
+            return c1->get_reclaim_priority() > c2->get_reclaim_priority();
+        }
         return c2->min_occupancy() < c1->min_occupancy();
     };
 
@@ -2715,7 +2719,12 @@ size_t tracker::impl::compact_and_evict_locked(size_t reserve_segments, size_t m
             timing_logger.log(level, "- processed {} regions, reclaimed from {}", regions, evictable_regions);
         });
         llogger.debug("Considering evictable regions.");
-        // FIXME: Fair eviction
+        // Evict from lower-priority regions first, so that e.g. the row cache
+        // keeps its memory until everything else has been evicted.
+        boost::range::sort(_regions, [] (region::impl* r1, region::impl* r2) {
+            return r1->get_reclaim_priority() < r2->get_reclaim_priority();
+        });
+        // FIXME: Fair eviction within the same priority
         for (region::impl* r : _regions) {
             if (preempt && need_preempt()) {
                 break;
@@ -290,10 +290,22 @@ public:
     friend std::ostream& operator<<(std::ostream&, const occupancy_stats&);
 };
 
+// Relative order in which regions give up memory when the shard is under
+// memory pressure. Among regions which are equally compactible, the tracker
+// reclaims from lower-priority regions first, so a region holding data which
+// is expensive to repopulate (e.g. the row cache) can be marked to yield
+// memory only after the others are exhausted.
+enum class reclaim_priority : uint8_t {
+    first = 0,
+    normal = 1,
+    last = 2,
+};
+
 class basic_region_impl : public allocation_strategy {
 protected:
     tracker& _tracker;
     bool _reclaiming_enabled = true;
+    reclaim_priority _reclaim_priority = reclaim_priority::normal;
     seastar::shard_id _cpu = this_shard_id();
 public:
     basic_region_impl(tracker& tracker) : _tracker(tracker)
@@ -309,6 +321,15 @@ public:
     bool reclaiming_enabled() const noexcept {
         return _reclaiming_enabled;
     }
+
+    void set_reclaim_priority(reclaim_priority prio) noexcept {
+        assert(this_shard_id() == _cpu);
+        _reclaim_priority = prio;
+    }
+
+    reclaim_priority get_reclaim_priority() const noexcept {
+        return _reclaim_priority;
+    }
 };
 
 //
@@ -381,6 +402,13 @@ public:
     // Returns the reclaimability state of this region.
     bool reclaiming_enabled() const noexcept { return _impl->reclaiming_enabled(); }
 
+    // Sets the order in which this region gives up memory relative to other
+    // regions when the tracker reclaims. Lower-priority regions are compacted
+    // and evicted from first. Defaults to reclaim_priority::normal.
+    void set_reclaim_priority(reclaim_priority prio) noexcept { _impl->set_reclaim_priority(prio); }
+
+    reclaim_priority get_reclaim_priority() const noexcept { return _impl->get_reclaim_priority(); }
+
     // Returns a value which is increased when this region is either compacted or
     // evicted from, which invalidates references into the region.
     // When the value returned by this method doesn't change, references remain valid.
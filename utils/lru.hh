@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include <boost/intrusive/list.hpp>
 #include <seastar/core/memory.hh>
 
@@ -23,6 +25,9 @@ class evictable {
     using lru_link_type = boost::intrusive::list_member_hook<
         boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
     lru_link_type _lru_link;
+    // Which lru section the evictable is linked in. Maintained by lru, where
+    // the sections live; meaningless while unlinked.
+    bool _lru_hot = false;
 protected:
     // Prevent destruction via evictable pointer. LRU is not aware of allocation strategy.
     // Prevent destruction of a linked evictable. While we could unlink the evictable here
@@ -44,47 +49,118 @@ public:
 
     void swap(evictable& o) noexcept {
         _lru_link.swap_nodes(o._lru_link);
+        std::swap(_lru_hot, o._lru_hot);
     }
 };
 
+// A scan-resistant LRU: a segmented LRU with a probationary (cold) and a
+// protected (hot) section. New entries are admitted into the cold section and
+// are promoted into the hot section only when touched again, so entries read
+// exactly once - e.g. by a large analytics scan - march through the cold
+// section and fall out without ever displacing the established working set.
+// Eviction drains the cold section first; the hot section is bounded to a
+// fixed fraction of all entries, with overflow demoted back to the cold
+// section's most-recently-used end.
 class lru {
 private:
     friend class evictable;
     using lru_type = boost::intrusive::list<evictable,
         boost::intrusive::member_hook<evictable, evictable::lru_link_type, &evictable::_lru_link>,
         boost::intrusive::constant_time_size<false>>; // we need this to have bi::auto_unlink on hooks.
-    lru_type _list;
+    lru_type _cold; // the probationary section; entries seen once, evicted first
+    lru_type _hot;  // the protected section; entries touched while cold
+    // The hooks are auto_unlink so the lists cannot track their size; do it
+    // here to be able to bound the hot section.
+    size_t _cold_size = 0;
+    size_t _hot_size = 0;
+    // The hot section may not grow beyond this multiple of the cold section's
+    // size, i.e. the protected working set may use at most 3/4 of the cache.
+    static constexpr size_t hot_to_cold_ratio = 3;
+
+    void evict_from(lru_type& list, size_t& size) noexcept {
+        evictable& e = list.front();
+        list.pop_front();
+        --size;
+        e._lru_hot = false;
+        e.on_evicted();
+    }
+
+    // Bounds the hot section after it grew by one entry. Demotes rather than
+    // evicts: a demoted entry gets another chance at the cold section's
+    // most-recently-used end.
+    void maybe_demote() noexcept {
+        if (_hot_size > hot_to_cold_ratio * _cold_size) {
+            evictable& demoted = _hot.front();
+            _hot.erase(_hot.iterator_to(demoted));
+            --_hot_size;
+            demoted._lru_hot = false;
+            _cold.push_back(demoted);
+            ++_cold_size;
+        }
+    }
 public:
     using reclaiming_result = seastar::memory::reclaiming_result;
 
     ~lru() {
-        _list.clear_and_dispose([] (evictable* e) {
+        auto dispose = [] (evictable* e) {
+            e->_lru_hot = false;
             e->on_evicted();
-        });
+        };
+        _hot.clear_and_dispose(dispose);
+        _cold.clear_and_dispose(dispose);
     }
 
     void remove(evictable& e) noexcept {
-        _list.erase(_list.iterator_to(e));
+        if (e._lru_hot) {
+            _hot.erase(_hot.iterator_to(e));
+            --_hot_size;
+        } else {
+            _cold.erase(_cold.iterator_to(e));
+            --_cold_size;
+        }
     }
 
+    // Admits e into the section recorded in its hotness bit: the cold section
+    // for new entries, or the hot section if it was marked hot while unlinked
+    // (see mark_hot()).
     void add(evictable& e) noexcept {
-        _list.push_back(e);
+        if (e._lru_hot) {
+            _hot.push_back(e);
+            ++_hot_size;
+            maybe_demote();
+        } else {
+            _cold.push_back(e);
+            ++_cold_size;
+        }
     }
 
     void touch(evictable& e) noexcept {
         remove(e);
-        add(e);
+        e._lru_hot = true;
+        _hot.push_back(e);
+        ++_hot_size;
+        maybe_demote();
+    }
+
+    // Marks an unlinked evictable so that the next add() admits it straight
+    // into the hot section. For caches which unlink entries for the duration
+    // of their use: a hit on an idle entry unlinks it, and the eventual
+    // re-add should count as the promoting second touch.
+    static void mark_hot(evictable& e) noexcept {
+        e._lru_hot = true;
     }
 
     // Evicts a single element from the LRU
     reclaiming_result evict() noexcept {
-        if (_list.empty()) {
-            return reclaiming_result::reclaimed_nothing;
+        if (!_cold.empty()) {
+            evict_from(_cold, _cold_size);
+            return reclaiming_result::reclaimed_something;
         }
-        evictable& e = _list.front();
-        _list.pop_front();
-        e.on_evicted();
-        return reclaiming_result::reclaimed_something;
+        if (!_hot.empty()) {
+            evict_from(_hot, _hot_size);
+            return reclaiming_result::reclaimed_something;
+        }
+        return reclaiming_result::reclaimed_nothing;
     }
 
     // Evicts all elements.
@@ -95,7 +171,9 @@ public:
 };
 
 inline
-evictable::evictable(evictable&& o) noexcept {
+evictable::evictable(evictable&& o) noexcept
+    : _lru_hot(o._lru_hot)
+{
     if (o._lru_link.is_linked()) {
         auto prev = o._lru_link.prev_;
         o._lru_link.unlink();
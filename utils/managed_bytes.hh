@@ -75,7 +75,13 @@ struct blob_storage {
 // A managed version of "bytes" (can be used with LSA).
 class managed_bytes {
     friend class bytes_ostream;
-    static constexpr size_t max_inline_size = 15;
+    // Capacity of the small-blob representation. Sized so that the typical
+    // small values - UUIDs and short strings, including the atomic_cell
+    // header in front of them - are stored in place rather than through a
+    // blob_storage allocation, which both cuts the LSA object count and
+    // saves a pointer chase on every read of such a value. Must fit in the
+    // int8_t size field below.
+    static constexpr size_t max_inline_size = 39;
     struct small_blob {
         bytes_view::value_type data[max_inline_size];
         int8_t size; // -1 -> use blob_storage
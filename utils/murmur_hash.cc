@@ -11,6 +11,8 @@
 
 #include "murmur_hash.hh"
 
+#include <algorithm>
+
 namespace utils {
 
 namespace murmur_hash {
@@ -218,5 +220,98 @@ void hash3_x64_128(bytes_view key, uint64_t seed, std::array<uint64_t,2> &result
     result[1] = h2;
 }
 
+void hash3_x64_128_batch4(const bytes_view* keys, unsigned n, uint64_t seed, std::array<uint64_t, 2>* results)
+{
+    uint64_t h1[4];
+    uint64_t h2[4];
+    uint32_t nblocks[4];
+    uint32_t max_nblocks = 0;
+
+    for (unsigned lane = 0; lane < n; lane++) {
+        h1[lane] = seed;
+        h2[lane] = seed;
+        nblocks[lane] = keys[lane].size() >> 4; // Process as 128-bit blocks.
+        max_nblocks = std::max(max_nblocks, nblocks[lane]);
+    }
+
+    uint64_t c1 = 0x87c37b91114253d5L;
+    uint64_t c2 = 0x4cf5ad432745937fL;
+
+    //----------
+    // body, interleaved across the lanes so that the independent
+    // multiply/rotate chains can execute in parallel
+
+    for (uint32_t i = 0; i < max_nblocks; i++)
+    {
+        for (unsigned lane = 0; lane < n; lane++) {
+            if (i >= nblocks[lane]) {
+                continue;
+            }
+            uint64_t k1 = getblock(keys[lane], i*2+0);
+            uint64_t k2 = getblock(keys[lane], i*2+1);
+
+            k1 *= c1; k1 = rotl64(k1,31); k1 *= c2; h1[lane] ^= k1;
+
+            h1[lane] = rotl64(h1[lane],27); h1[lane] += h2[lane]; h1[lane] = h1[lane]*5+0x52dce729;
+
+            k2 *= c2; k2  = rotl64(k2,33); k2 *= c1; h2[lane] ^= k2;
+
+            h2[lane] = rotl64(h2[lane],31); h2[lane] += h1[lane]; h2[lane] = h2[lane]*5+0x38495ab5;
+        }
+    }
+
+    //----------
+    // tails and finalization, one lane at a time
+
+    for (unsigned lane = 0; lane < n; lane++) {
+        bytes_view key = keys[lane];
+        uint32_t length = key.size();
+
+        // Advance offset to the unprocessed tail of the data.
+        key.remove_prefix(nblocks[lane] * 16);
+
+        uint64_t k1 = 0;
+        uint64_t k2 = 0;
+
+        switch (length & 15)
+        {
+        case 15: k2 ^= ((uint64_t) key[14]) << 48;
+        case 14: k2 ^= ((uint64_t) key[13]) << 40;
+        case 13: k2 ^= ((uint64_t) key[12]) << 32;
+        case 12: k2 ^= ((uint64_t) key[11]) << 24;
+        case 11: k2 ^= ((uint64_t) key[10]) << 16;
+        case 10: k2 ^= ((uint64_t) key[9]) << 8;
+        case  9: k2 ^= ((uint64_t) key[8]) << 0;
+            k2 *= c2; k2  = rotl64(k2,33); k2 *= c1; h2[lane] ^= k2;
+        case  8: k1 ^= ((uint64_t) key[7]) << 56;
+        case  7: k1 ^= ((uint64_t) key[6]) << 48;
+        case  6: k1 ^= ((uint64_t) key[5]) << 40;
+        case  5: k1 ^= ((uint64_t) key[4]) << 32;
+        case  4: k1 ^= ((uint64_t) key[3]) << 24;
+        case  3: k1 ^= ((uint64_t) key[2]) << 16;
+        case  2: k1 ^= ((uint64_t) key[1]) << 8;
+        case  1: k1 ^= ((uint64_t) key[0]);
+            k1 *= c1; k1  = rotl64(k1,31); k1 *= c2; h1[lane] ^= k1;
+        };
+
+        uint64_t hl1 = h1[lane];
+        uint64_t hl2 = h2[lane];
+
+        hl1 ^= length; hl2 ^= length;
+
+        hl1 += hl2;
+        hl2 += hl1;
+
+        hl1 = fmix(hl1);
+        hl2 = fmix(hl2);
+
+        hl1 += hl2;
+        hl2 += hl1;
+
+        results[lane][0] = hl1;
+        results[lane][1] = hl2;
+    }
+}
+
 } // namespace murmur_hash
 } // namespace utils
@@ -139,6 +139,13 @@ void hash3_x64_128(InputIterator in, uint32_t length, uint64_t seed, std::array<
 
 void hash3_x64_128(bytes_view key, uint64_t seed, std::array<uint64_t, 2>& result);
 
+// Hashes up to four keys in one call, interleaving their block rounds.
+// A single hash3_x64_128() is one long dependency chain of multiplies and
+// rotates, which leaves most of the CPU's multiplier pipeline idle;
+// round-robining over several independent states keeps it fed. Produces
+// exactly the same result as hashing each key individually.
+void hash3_x64_128_batch4(const bytes_view* keys, unsigned n, uint64_t seed, std::array<uint64_t, 2>* results);
+
 } // namespace murmur_hash
 
 } // namespace utils
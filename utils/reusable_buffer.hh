@@ -49,8 +49,12 @@ class reusable_buffer { // extract to utils
     // FIXME: We should start using std::byte for these things.
     std::unique_ptr<int8_t[]> _buffer;
     size_t _size = 0;
+    // Largest size requested since the last shrink_to_watermark(), i.e. how
+    // much of the buffer the current usage period actually needed.
+    size_t _high_watermark = 0;
 private:
     bytes_mutable_view reserve(size_t n) {
+        _high_watermark = std::max(_high_watermark, n);
         if (_size < n) {
             // Reusable buffers are expected to be used when large contiguous
             // allocations are unavoidable. There is not much point in warning
@@ -100,6 +104,22 @@ public:
         return bytes_view(mutable_view);
     }
 
+    /// Returns a linearised view of data gathered by the caller
+    ///
+    /// fill is called with a mutable view of a buffer of the given size and
+    /// must write exactly that much data into it. Useful when the data is
+    /// scattered across multiple sources and a single gathering copy is
+    /// cheaper than first merging the sources into one fragmented buffer.
+    /// The returned view remains valid until another member function of
+    /// this is called.
+    template<typename Function>
+    requires std::is_invocable_v<Function, bytes_mutable_view>
+    bytes_view get_linearized_view(size_t size, Function&& fill) {
+        auto mutable_view = reserve(size);
+        fill(mutable_view);
+        return bytes_view(mutable_view);
+    }
+
     /// Creates a bytes_ostream
     ///
     /// make_buffer calls provided function object and gives it a mutable
@@ -158,10 +178,37 @@ public:
         return fragmented_temporary_buffer(std::move(fragments), actual_length);
     }
 
+    /// Returns the size of the currently allocated buffer.
+    size_t size() const noexcept {
+        return _size;
+    }
+
     /// Releases all allocated memory.
     void clear() noexcept {
         _buffer.reset();
         _size = 0;
+        _high_watermark = 0;
+    }
+
+    /// Shrinks the buffer to the largest size requested since the previous
+    /// call (or since construction), and starts a new observation period.
+    ///
+    /// Unlike clear(), a buffer in steady state - one whose periods keep
+    /// needing similar sizes - is left untouched, so its users see no
+    /// allocator traffic at all; only the excess above the recently observed
+    /// demand is given back.
+    void shrink_to_watermark() {
+        if (_high_watermark < _size) {
+            if (_high_watermark == 0) {
+                clear();
+            } else {
+                seastar::memory::scoped_large_allocation_warning_disable g;
+                auto new_buffer = std::unique_ptr<int8_t[]>(new int8_t[_high_watermark]);
+                _buffer = std::move(new_buffer);
+                _size = _high_watermark;
+            }
+        }
+        _high_watermark = 0;
     }
 };
 
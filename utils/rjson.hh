@@ -170,6 +170,30 @@ rjson::value copy(const rjson::value& value);
 // as parse() will allocate member names and values.
 // Throws rjson::error if parsing failed.
 rjson::value parse(std::string_view str, size_t max_nested_level = default_max_nested_level);
+
+// Parses the given JSON string by feeding SAX events directly into the given
+// handler, which must implement rapidjson's Handler concept (see
+// https://rapidjson.org/classrapidjson_1_1_handler.html), without
+// materializing a DOM. Parsing is iterative rather than recursive, so deeply
+// nested input cannot cause a stack overflow and no nesting-level guard is
+// needed.
+// Returns true when the whole input was parsed successfully, or false when
+// the handler aborted the parse by returning false from one of its event
+// functions. Throws rjson::error if the input is not valid JSON.
+template <typename Handler>
+bool parse_sax(std::string_view str, Handler& handler) {
+    rapidjson::MemoryStream ms(str.data(), str.size());
+    rapidjson::EncodedInputStream<encoding, rapidjson::MemoryStream> is(ms);
+    rapidjson::GenericReader<encoding, encoding, allocator> reader;
+    reader.Parse<rapidjson::kParseIterativeFlag>(is, handler);
+    if (reader.HasParseError()) {
+        if (reader.GetParseErrorCode() == rapidjson::kParseErrorTermination) {
+            return false;
+        }
+        throw rjson::error(std::string("Parsing JSON failed: ") + rapidjson::GetParseError_En(reader.GetParseErrorCode()));
+    }
+    return true;
+}
 // Parses a JSON value returns a disengaged optional on failure.
 // NOTICE: any error context will be lost, so this function should
 // be used only if one does not care why parsing failed.
@@ -249,6 +249,19 @@ internal::validate_partial(const uint8_t *data, size_t len) {
         while (len >= 16) {
             const uint8x16_t input = vld1q_u8(data);
 
+            // Fast path for ASCII-dominated data (e.g. JSON-ish text
+            // columns): if neither this block nor the previous one has the
+            // high bit set anywhere, there is no multi-byte sequence
+            // straddling the block boundary and no range to check. A pure
+            // ASCII previous block also implies prev_first_len is all zero,
+            // so skipping the range machinery is exactly equivalent.
+            if (vmaxvq_u8(vorrq_u8(input, prev_input)) < 0x80) {
+                prev_input = input;
+                data += 16;
+                len -= 16;
+                continue;
+            }
+
             // high_nibbles = input >> 4
             const uint8x16_t high_nibbles = vshrq_n_u8(input, 4);
 
@@ -432,6 +445,19 @@ internal::validate_partial(const uint8_t *data, size_t len) {
         while (len >= 16) {
             const __m128i input = _mm_lddqu_si128((const __m128i *)data);
 
+            // Fast path for ASCII-dominated data (e.g. JSON-ish text
+            // columns): if neither this block nor the previous one has the
+            // high bit set anywhere, there is no multi-byte sequence
+            // straddling the block boundary and no range to check. A pure
+            // ASCII previous block also implies prev_first_len is all zero,
+            // so skipping the range machinery is exactly equivalent.
+            if (_mm_movemask_epi8(_mm_or_si128(input, prev_input)) == 0) {
+                prev_input = input;
+                data += 16;
+                len -= 16;
+                continue;
+            }
+
             // high_nibbles = input >> 4
             const __m128i high_nibbles =
                 _mm_and_si128(_mm_srli_epi16(input, 4), _mm_set1_epi8(0x0F));
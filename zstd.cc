@@ -13,15 +13,38 @@
 #define ZSTD_STATIC_LINKING_ONLY
 #include "zstd.h"
 
+#include "bytes.hh"
 #include "compress.hh"
 #include "utils/class_registrator.hh"
 
 static const sstring COMPRESSION_LEVEL = "compression_level";
+static const sstring DICTIONARY = "dictionary";
 static const sstring COMPRESSOR_NAME = compressor::namespace_prefix + "ZstdCompressor";
 
+struct cdict_deleter {
+    void operator()(ZSTD_CDict* d) const { ZSTD_freeCDict(d); }
+};
+
+struct ddict_deleter {
+    void operator()(ZSTD_DDict* d) const { ZSTD_freeDDict(d); }
+};
+
 class zstd_processor : public compressor {
     int _compression_level = 3;
 
+    // Optional shared dictionary, trained on representative chunks of the
+    // table's data. Small (4k) chunks compress poorly on their own because
+    // each one starts with an empty history window; priming the compressor
+    // with a dictionary recovers much of the lost ratio. The dictionary is
+    // passed as a hex-encoded compression option, so it travels with the
+    // table schema and is recorded in each sstable's compression metadata,
+    // making every sstable self-contained for reads.
+    bytes _dictionary;
+    // Digested forms of _dictionary, ready for use by compression
+    // and decompression. Engaged iff _dictionary is not empty.
+    std::unique_ptr<ZSTD_CDict, cdict_deleter> _cdict;
+    std::unique_ptr<ZSTD_DDict, ddict_deleter> _ddict;
+
     // Manages memory for the compression context.
     std::unique_ptr<char[], free_deleter> _cctx_raw;
     // Compression context. Observer of _cctx_raw.
@@ -72,8 +95,22 @@ zstd_processor::zstd_processor(const opt_getter& opts)
        ? std::stoi(*chunk_len_kb) * 1024
        : compression_parameters::DEFAULT_CHUNK_LENGTH;
 
+    auto dict = opts(DICTIONARY);
+    if (dict) {
+        try {
+            _dictionary = from_hex(*dict);
+        } catch (const std::exception& e) {
+            throw exceptions::syntax_exception(
+                format("Invalid hex value for {}", DICTIONARY));
+        }
+        if (_dictionary.empty()) {
+            throw exceptions::configuration_exception(
+                format("{} must not be empty", DICTIONARY));
+        }
+    }
+
     // We assume that the uncompressed input length is always <= chunk_len.
-    auto cparams = ZSTD_getCParams(_compression_level, chunk_len, 0);
+    auto cparams = ZSTD_getCParams(_compression_level, chunk_len, _dictionary.size());
     auto cctx_size = ZSTD_estimateCCtxSize_usingCParams(cparams);
     // According to the ZSTD documentation, pointer to the context buffer must be 8-bytes aligned.
     _cctx_raw = allocate_aligned_buffer<char>(cctx_size, 8);
@@ -88,10 +125,28 @@ zstd_processor::zstd_processor(const opt_getter& opts)
     if (!_cctx) {
         throw std::runtime_error("Unable to initialize ZSTD decompression context");
     }
+
+    if (!_dictionary.empty()) {
+        // Digest the dictionary once, up front. Loading a raw dictionary on
+        // every 4k chunk would dominate the compression cost.
+        // Pass the same cparams we sized the static contexts with, so that
+        // compression with the dictionary fits in _cctx.
+        _cdict.reset(ZSTD_createCDict_advanced(_dictionary.data(), _dictionary.size(),
+                ZSTD_dlm_byCopy, ZSTD_dct_auto, cparams, ZSTD_defaultCMem));
+        if (!_cdict) {
+            throw std::runtime_error("Unable to create ZSTD compression dictionary");
+        }
+        _ddict.reset(ZSTD_createDDict(_dictionary.data(), _dictionary.size()));
+        if (!_ddict) {
+            throw std::runtime_error("Unable to create ZSTD decompression dictionary");
+        }
+    }
 }
 
 size_t zstd_processor::uncompress(const char* input, size_t input_len, char* output, size_t output_len) const {
-    auto ret = ZSTD_decompressDCtx(_dctx, output, output_len, input, input_len);
+    auto ret = _ddict
+        ? ZSTD_decompress_usingDDict(_dctx, output, output_len, input, input_len, _ddict.get())
+        : ZSTD_decompressDCtx(_dctx, output, output_len, input, input_len);
     if (ZSTD_isError(ret)) {
         throw std::runtime_error( format("ZSTD decompression failure: {}", ZSTD_getErrorName(ret)));
     }
@@ -100,7 +155,9 @@ size_t zstd_processor::uncompress(const char* input, size_t input_len, char* out
 
 
 size_t zstd_processor::compress(const char* input, size_t input_len, char* output, size_t output_len) const {
-    auto ret = ZSTD_compressCCtx(_cctx, output, output_len, input, input_len, _compression_level);
+    auto ret = _cdict
+        ? ZSTD_compress_usingCDict(_cctx, output, output_len, input, input_len, _cdict.get())
+        : ZSTD_compressCCtx(_cctx, output, output_len, input, input_len, _compression_level);
     if (ZSTD_isError(ret)) {
         throw std::runtime_error( format("ZSTD compression failure: {}", ZSTD_getErrorName(ret)));
     }
@@ -112,11 +169,15 @@ size_t zstd_processor::compress_max_size(size_t input_len) const {
 }
 
 std::set<sstring> zstd_processor::option_names() const {
-    return {COMPRESSION_LEVEL};
+    return {COMPRESSION_LEVEL, DICTIONARY};
 }
 
 std::map<sstring, sstring> zstd_processor::options() const {
-    return {{COMPRESSION_LEVEL, std::to_string(_compression_level)}};
+    std::map<sstring, sstring> opts = {{COMPRESSION_LEVEL, std::to_string(_compression_level)}};
+    if (!_dictionary.empty()) {
+        opts.emplace(DICTIONARY, to_hex(_dictionary));
+    }
+    return opts;
 }
 
 static const class_registrator<compressor, zstd_processor, const compressor::opt_getter&>